@@ -86,6 +86,17 @@
 
 #define LWIP_TIMER_INTERVAL_MS 25
 
+// incoming packets can be passed to lwIP as PBUF_REF if lwIP processes them synchronously and does not keep
+// pointers into the payload of queued pbufs, which is the case for TCP out-of-order segments and IPv6 reassembly
+#if NO_SYS && LWIP_SUPPORT_CUSTOM_PBUF && !(LWIP_TCP && TCP_QUEUE_OOSEQ) && !(LWIP_IPV6 && LWIP_IPV6_REASS)
+#define BNEP_LWIP_INCOMING_PBUF_REF
+
+// number of incoming packets that lwIP can keep, e.g. for IP reassembly or refused TCP data, without copying them into a pbuf
+#ifndef BNEP_LWIP_NUM_INCOMING_PBUF_REFS
+#define BNEP_LWIP_NUM_INCOMING_PBUF_REFS 1
+#endif
+#endif
+
 static void bnep_lwip_outgoing_process(void * arg);
 static bool bnep_lwip_outgoing_packets_empty(void);
 
@@ -112,8 +123,17 @@ static btstack_packet_handler_t client_handler;
 // next packet only modified from btstack context
 static struct pbuf * bnep_lwip_outgoing_next_packet;
 
-// temp buffer to unchain buffer
-static uint8_t btstack_network_outgoing_buffer[HCI_ACL_PAYLOAD_SIZE];
+#ifdef BNEP_LWIP_INCOMING_PBUF_REF
+typedef struct {
+    // custom pbuf - assert: first field
+    struct pbuf_custom pbuf_custom;
+    bool in_use;
+    // payload storage if lwIP keeps the pbuf after input
+    uint8_t payload[HCI_ACL_PAYLOAD_SIZE];
+} bnep_lwip_incoming_pbuf_t;
+
+static bnep_lwip_incoming_pbuf_t bnep_lwip_incoming_pbufs[BNEP_LWIP_NUM_INCOMING_PBUF_REFS];
+#endif
 
 // helper functions to hide NO_SYS vs. FreeRTOS implementations
 
@@ -307,6 +327,58 @@ static int bnep_lwip_netif_down(void){
     return 0;
 }
 
+#ifdef BNEP_LWIP_INCOMING_PBUF_REF
+static void bnep_lwip_incoming_pbuf_free(struct pbuf * p){
+    bnep_lwip_incoming_pbuf_t * incoming_pbuf = (bnep_lwip_incoming_pbuf_t *) p;
+    incoming_pbuf->in_use = false;
+}
+
+/**
+ * @brief Forward packet to TCP/IP stack without copying it
+ * @param packet
+ * @param size
+ * @return true if packet was processed
+ */
+static bool bnep_lwip_netif_process_packet_pbuf_ref(const uint8_t * packet, uint16_t size){
+    if (size > HCI_ACL_PAYLOAD_SIZE) return false;
+
+    bnep_lwip_incoming_pbuf_t * incoming_pbuf = NULL;
+    uint8_t i;
+    for (i = 0; i < BNEP_LWIP_NUM_INCOMING_PBUF_REFS; i++){
+        if (bnep_lwip_incoming_pbufs[i].in_use == false){
+            incoming_pbuf = &bnep_lwip_incoming_pbufs[i];
+            break;
+        }
+    }
+    if (incoming_pbuf == NULL) return false;
+
+    // reference packet in HCI buffer
+    incoming_pbuf->in_use = true;
+    incoming_pbuf->pbuf_custom.custom_free_function = &bnep_lwip_incoming_pbuf_free;
+    struct pbuf * p = pbuf_alloced_custom(PBUF_RAW, size, PBUF_REF, &incoming_pbuf->pbuf_custom, (void *) packet, size);
+
+    // keep reference to detect if lwIP holds on to the pbuf
+    pbuf_ref(p);
+
+    /* pass all packets to ethernet_input, which decides what packets it supports */
+    int res = btstack_netif.input(p, &btstack_netif);
+    if (res != ERR_OK){
+        log_error("bnep_lwip_netif_process_packet: IP input error\n");
+        pbuf_free(p);
+    }
+
+    // HCI buffer gets reused after this, store payload if pbuf is still used by lwIP
+    if (p->ref > 1){
+        uint16_t payload_offset = (uint16_t) (((const uint8_t *) p->payload) - packet);
+        (void) memcpy(incoming_pbuf->payload, packet, size);
+        p->payload = &incoming_pbuf->payload[payload_offset];
+    }
+
+    pbuf_free(p);
+    return true;
+}
+#endif
+
 /**
  * @brief Forward packet to TCP/IP stack
  * @param packet
@@ -314,6 +386,10 @@ static int bnep_lwip_netif_down(void){
  */
 static void bnep_lwip_netif_process_packet(const uint8_t * packet, uint16_t size){
 
+#ifdef BNEP_LWIP_INCOMING_PBUF_REF
+    if (bnep_lwip_netif_process_packet_pbuf_ref(packet, size)) return;
+#endif
+
     /* We allocate a pbuf chain of pbufs from the pool. */
     struct pbuf * p = pbuf_alloc(PBUF_RAW, size, PBUF_POOL);
     log_debug("bnep_lwip_netif_process_packet, pbuf_alloc = %p", p);
@@ -374,27 +450,40 @@ static void bnep_lwip_outgoing_process(void * arg){
     bnep_request_can_send_now_event(bnep_cid);
 }
 
+static void bnep_lwip_copy_frame(void * context, uint16_t offset, uint8_t * buffer, uint16_t len){
+    struct pbuf * p = (struct pbuf *) context;
+    pbuf_copy_partial(p, buffer, len, offset);
+}
+
 static void bnep_lwip_send_packet(void){
+    // copy pbuf chain directly into outgoing buffer
+    uint16_t len = btstack_min(HCI_ACL_PAYLOAD_SIZE, bnep_lwip_outgoing_next_packet->tot_len);
+    bnep_send_with_copy_callback(bnep_cid, len, &bnep_lwip_copy_frame, bnep_lwip_outgoing_next_packet);
+}
+
+static void bnep_lwip_send_packets(void){
     if (bnep_lwip_outgoing_next_packet == NULL){
         log_error("CAN SEND NOW, but now packet queued");
         return;
     }
 
-    // flatten into our buffer
-    uint32_t len = btstack_min(sizeof(btstack_network_outgoing_buffer), bnep_lwip_outgoing_next_packet->tot_len);
-    pbuf_copy_partial(bnep_lwip_outgoing_next_packet, btstack_network_outgoing_buffer, len, 0);
-    bnep_send(bnep_cid, (uint8_t*) btstack_network_outgoing_buffer, len);
-}
+    // send queued packets as long as L2CAP accepts them
+    while (true){
+        bnep_lwip_send_packet();
+        log_debug("bnep_lwip_packet_sent: %p", bnep_lwip_outgoing_next_packet);
 
-static void bnep_lwip_packet_sent(void){
-    log_debug("bnep_lwip_packet_sent: %p", bnep_lwip_outgoing_next_packet);
+        // release current packet
+        bnep_lwip_outgoing_packet_processed();
+
+        // more ?
+        if (bnep_lwip_outgoing_packets_empty()) return;
+        bnep_lwip_outgoing_next_packet = bnep_lwip_outgoing_pop_packet();
 
-    // release current packet
-    bnep_lwip_outgoing_packet_processed();
+        if (bnep_can_send_packet_now(bnep_cid) == 0) break;
+    }
 
-    // more ?
-    if (bnep_lwip_outgoing_packets_empty()) return;
-    bnep_lwip_trigger_outgoing_process();
+    // request can send now for next packet
+    bnep_request_can_send_now_event(bnep_cid);
 }
 
 static void bnep_lwip_discard_packets(void){
@@ -454,12 +543,11 @@ static void packet_handler (uint8_t packet_type, uint16_t channel, uint8_t *pack
                     bnep_lwip_netif_down();
                     break;
 
-                /* @text BNEP_EVENT_CAN_SEND_NOW indicates that a new packet can be send. This triggers the send of a 
-                 * stored network packet. The tap datas source can be enabled again
+                /* @text BNEP_EVENT_CAN_SEND_NOW indicates that a new packet can be send. This triggers the send of
+                 * stored network packets until L2CAP cannot accept more.
                  */
                 case BNEP_EVENT_CAN_SEND_NOW:
-                    bnep_lwip_send_packet();
-                    bnep_lwip_packet_sent();
+                    bnep_lwip_send_packets();
                     break;
                     
                 default:
@@ -0,0 +1,241 @@
+/*
+ * Copyright (C) 2024 BlueKitchen GmbH
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holders nor the names of
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ * 4. Any redistribution, use, or modification is done solely for
+ *    personal benefit and not for any commercial purpose or for
+ *    monetary gain.
+ *
+ * THIS SOFTWARE IS PROVIDED BY BLUEKITCHEN GMBH AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL BLUEKITCHEN
+ * GMBH OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF
+ * THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ *
+ * Please inquire about commercial licensing options at 
+ * contact@bluekitchen-gmbh.com
+ *
+ */
+
+#define BTSTACK_FILE__ "btstack_lc3_thread_pool_posix.c"
+
+/*
+ *  btstack_lc3_thread_pool_posix.c
+ *
+ *  A job covers one LC3 frame for all channels. The calling thread publishes the job,
+ *  wakes up the worker threads and then claims channels together with them until all
+ *  channels are done. As each codec context is bound to a single channel, channels can
+ *  be processed in any order without further synchronization. Jobs from different calling
+ *  threads are serialized by the job mutex, as there is only a single current job.
+ */
+
+#include "btstack_config.h"
+
+// enable POSIX functions (needed for -std=c99)
+#define _POSIX_C_SOURCE 200809
+
+#include "btstack_lc3_thread_pool_posix.h"
+
+#include "bluetooth.h"
+#include "btstack_debug.h"
+#include "btstack_util.h"
+
+#include <pthread.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#ifndef BTSTACK_LC3_THREAD_POOL_POSIX_MAX_THREADS
+#define BTSTACK_LC3_THREAD_POOL_POSIX_MAX_THREADS 8
+#endif
+
+typedef struct {
+    bool encode;
+    union {
+        const btstack_lc3_encoder_t * encoder;
+        const btstack_lc3_decoder_t * decoder;
+    } codec;
+    void * const * contexts;
+    uint8_t  num_channels;
+    uint16_t octets_per_frame;
+    // encode
+    const int16_t * pcm_in;
+    uint8_t * bytes_out;
+    // decode
+    const uint8_t * bytes_in;
+    const uint8_t * BFI;
+    int16_t * pcm_out;
+    uint8_t * BEC_detect;
+} btstack_lc3_thread_pool_job_t;
+
+static pthread_t       lc3_thread_pool_threads[BTSTACK_LC3_THREAD_POOL_POSIX_MAX_THREADS];
+static uint8_t         lc3_thread_pool_num_threads;
+static bool            lc3_thread_pool_running;
+static pthread_mutex_t lc3_thread_pool_mutex     = PTHREAD_MUTEX_INITIALIZER;
+// held by calling thread for the whole job
+static pthread_mutex_t lc3_thread_pool_job_mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t  lc3_thread_pool_work_cond = PTHREAD_COND_INITIALIZER;
+static pthread_cond_t  lc3_thread_pool_done_cond = PTHREAD_COND_INITIALIZER;
+
+// current job, protected by mutex
+static btstack_lc3_thread_pool_job_t lc3_thread_pool_job;
+static uint32_t lc3_thread_pool_job_generation;
+static uint8_t  lc3_thread_pool_next_channel;
+static uint8_t  lc3_thread_pool_num_channels_done;
+static uint8_t  lc3_thread_pool_failed_channel;
+static uint8_t  lc3_thread_pool_status;
+
+static uint8_t btstack_lc3_thread_pool_process_channel(const btstack_lc3_thread_pool_job_t * job, uint8_t channel){
+    if (job->encode){
+        return (*job->codec.encoder->encode_signed_16)(job->contexts[channel], &job->pcm_in[channel], job->num_channels,
+                                                         &job->bytes_out[channel * job->octets_per_frame]);
+    } else {
+        uint8_t channel_bfi = (job->BFI != NULL) ? job->BFI[channel] : 0;
+        uint8_t channel_bec_detect = 0;
+        uint8_t status = (*job->codec.decoder->decode_signed_16)(job->contexts[channel], &job->bytes_in[channel * job->octets_per_frame],
+                                                                 channel_bfi, &job->pcm_out[channel], job->num_channels,
+                                                                 &channel_bec_detect);
+        if (job->BEC_detect != NULL){
+            job->BEC_detect[channel] = channel_bec_detect;
+        }
+        return status;
+    }
+}
+
+// claim and process channels of current job until none are left. mutex must be held, returns with mutex held
+static void btstack_lc3_thread_pool_process_job(void){
+    while (lc3_thread_pool_next_channel < lc3_thread_pool_job.num_channels){
+        uint8_t channel = lc3_thread_pool_next_channel++;
+        pthread_mutex_unlock(&lc3_thread_pool_mutex);
+
+        uint8_t status = btstack_lc3_thread_pool_process_channel(&lc3_thread_pool_job, channel);
+
+        pthread_mutex_lock(&lc3_thread_pool_mutex);
+        // report status of lowest failed channel to match sequential processing
+        if ((status != ERROR_CODE_SUCCESS) && (channel < lc3_thread_pool_failed_channel)){
+            lc3_thread_pool_failed_channel = channel;
+            lc3_thread_pool_status = status;
+        }
+        lc3_thread_pool_num_channels_done++;
+        if (lc3_thread_pool_num_channels_done == lc3_thread_pool_job.num_channels){
+            pthread_cond_signal(&lc3_thread_pool_done_cond);
+        }
+    }
+}
+
+static void * btstack_lc3_thread_pool_worker_thread(void * arg){
+    UNUSED(arg);
+    uint32_t job_generation = 0;
+    pthread_mutex_lock(&lc3_thread_pool_mutex);
+    while (true){
+        while (lc3_thread_pool_running && (job_generation == lc3_thread_pool_job_generation)){
+            pthread_cond_wait(&lc3_thread_pool_work_cond, &lc3_thread_pool_mutex);
+        }
+        if (lc3_thread_pool_running == false) break;
+        job_generation = lc3_thread_pool_job_generation;
+        btstack_lc3_thread_pool_process_job();
+    }
+    pthread_mutex_unlock(&lc3_thread_pool_mutex);
+    return NULL;
+}
+
+static uint8_t btstack_lc3_thread_pool_run_job(const btstack_lc3_thread_pool_job_t * job){
+    pthread_mutex_lock(&lc3_thread_pool_job_mutex);
+    pthread_mutex_lock(&lc3_thread_pool_mutex);
+    lc3_thread_pool_job = *job;
+    lc3_thread_pool_next_channel = 0;
+    lc3_thread_pool_num_channels_done = 0;
+    lc3_thread_pool_failed_channel = 0xff;
+    lc3_thread_pool_status = ERROR_CODE_SUCCESS;
+    lc3_thread_pool_job_generation++;
+    // wake up workers only if there's work left for them
+    if ((lc3_thread_pool_num_threads > 0) && (job->num_channels > 1)){
+        pthread_cond_broadcast(&lc3_thread_pool_work_cond);
+    }
+    btstack_lc3_thread_pool_process_job();
+    while (lc3_thread_pool_num_channels_done < lc3_thread_pool_job.num_channels){
+        pthread_cond_wait(&lc3_thread_pool_done_cond, &lc3_thread_pool_mutex);
+    }
+    uint8_t status = lc3_thread_pool_status;
+    pthread_mutex_unlock(&lc3_thread_pool_mutex);
+    pthread_mutex_unlock(&lc3_thread_pool_job_mutex);
+    return status;
+}
+
+uint8_t btstack_lc3_thread_pool_posix_init(uint8_t num_threads){
+    if (lc3_thread_pool_running){
+        return ERROR_CODE_COMMAND_DISALLOWED;
+    }
+    num_threads = btstack_min(num_threads, BTSTACK_LC3_THREAD_POOL_POSIX_MAX_THREADS);
+    lc3_thread_pool_running = true;
+    lc3_thread_pool_num_threads = 0;
+    while (lc3_thread_pool_num_threads < num_threads){
+        int err = pthread_create(&lc3_thread_pool_threads[lc3_thread_pool_num_threads], NULL, &btstack_lc3_thread_pool_worker_thread, NULL);
+        if (err != 0){
+            log_error("LC3 thread pool: failed to create worker thread, error %d", err);
+            btstack_lc3_thread_pool_posix_deinit();
+            return ERROR_CODE_MEMORY_CAPACITY_EXCEEDED;
+        }
+        lc3_thread_pool_num_threads++;
+    }
+    return ERROR_CODE_SUCCESS;
+}
+
+uint8_t btstack_lc3_thread_pool_posix_encode_frames_signed_16(const btstack_lc3_encoder_t * encoder, void * const * encoder_contexts,
+                                                              uint8_t num_channels, const int16_t * pcm_in,
+                                                              uint8_t * bytes, uint16_t octets_per_frame){
+    btstack_lc3_thread_pool_job_t job = { 0 };
+    job.encode = true;
+    job.codec.encoder = encoder;
+    job.contexts = encoder_contexts;
+    job.num_channels = num_channels;
+    job.octets_per_frame = octets_per_frame;
+    job.pcm_in = pcm_in;
+    job.bytes_out = bytes;
+    return btstack_lc3_thread_pool_run_job(&job);
+}
+
+uint8_t btstack_lc3_thread_pool_posix_decode_frames_signed_16(const btstack_lc3_decoder_t * decoder, void * const * decoder_contexts,
+                                                              uint8_t num_channels, const uint8_t * bytes, uint16_t octets_per_frame,
+                                                              const uint8_t * BFI, int16_t * pcm_out, uint8_t * BEC_detect){
+    btstack_lc3_thread_pool_job_t job = { 0 };
+    job.encode = false;
+    job.codec.decoder = decoder;
+    job.contexts = decoder_contexts;
+    job.num_channels = num_channels;
+    job.octets_per_frame = octets_per_frame;
+    job.bytes_in = bytes;
+    job.BFI = BFI;
+    job.pcm_out = pcm_out;
+    job.BEC_detect = BEC_detect;
+    return btstack_lc3_thread_pool_run_job(&job);
+}
+
+void btstack_lc3_thread_pool_posix_deinit(void){
+    pthread_mutex_lock(&lc3_thread_pool_mutex);
+    lc3_thread_pool_running = false;
+    pthread_cond_broadcast(&lc3_thread_pool_work_cond);
+    pthread_mutex_unlock(&lc3_thread_pool_mutex);
+    uint8_t i;
+    for (i = 0; i < lc3_thread_pool_num_threads; i++){
+        pthread_join(lc3_thread_pool_threads[i], NULL);
+    }
+    lc3_thread_pool_num_threads = 0;
+}
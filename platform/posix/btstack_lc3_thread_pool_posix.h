@@ -0,0 +1,109 @@
+/*
+ * Copyright (C) 2024 BlueKitchen GmbH
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holders nor the names of
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ * 4. Any redistribution, use, or modification is done solely for
+ *    personal benefit and not for any commercial purpose or for
+ *    monetary gain.
+ *
+ * THIS SOFTWARE IS PROVIDED BY BLUEKITCHEN GMBH AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL BLUEKITCHEN
+ * GMBH OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF
+ * THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ *
+ * Please inquire about commercial licensing options at 
+ * contact@bluekitchen-gmbh.com
+ *
+ */
+
+/*
+ *  btstack_lc3_thread_pool_posix.h
+ *
+ *  Encode/decode all channels of an LC3 frame in parallel using a pool of POSIX threads
+ */
+
+#ifndef BTSTACK_LC3_THREAD_POOL_POSIX_H
+#define BTSTACK_LC3_THREAD_POOL_POSIX_H
+
+#include <stdint.h>
+#include "btstack_lc3.h"
+
+#if defined __cplusplus
+extern "C" {
+#endif
+
+/* API_START */
+
+/**
+ * @brief Start worker threads
+ * @note the calling thread also processes channels, num_threads = 0 processes all channels on the calling thread
+ * @param num_threads number of worker threads, max BTSTACK_LC3_THREAD_POOL_POSIX_MAX_THREADS
+ * @return status ERROR_CODE_SUCCESS, ERROR_CODE_COMMAND_DISALLOWED if already started,
+ *                ERROR_CODE_MEMORY_CAPACITY_EXCEEDED if threads could not be created
+ */
+uint8_t btstack_lc3_thread_pool_posix_init(uint8_t num_threads);
+
+/**
+ * @brief Encode one frame for all channels from interleaved 16-bit PCM samples, see btstack_lc3_encode_frames_signed_16
+ * @note blocks until all channels have been encoded. Calls from multiple threads are processed one after the other.
+ *       Encoder contexts are used by at most one thread at a time
+ * @param encoder
+ * @param encoder_contexts array with one encoder context per channel
+ * @param num_channels
+ * @param pcm_in interleaved PCM samples for all channels
+ * @param bytes output for num_channels LC3 frames, stored consecutively
+ * @param octets_per_frame
+ * @return status ERROR_CODE_SUCCESS or status of first failed channel
+ */
+uint8_t btstack_lc3_thread_pool_posix_encode_frames_signed_16(const btstack_lc3_encoder_t * encoder, void * const * encoder_contexts,
+                                                              uint8_t num_channels, const int16_t * pcm_in,
+                                                              uint8_t * bytes, uint16_t octets_per_frame);
+
+/**
+ * @brief Decode one frame for all channels into interleaved 16-bit PCM samples, see btstack_lc3_decode_frames_signed_16
+ * @note blocks until all channels have been decoded. Calls from multiple threads are processed one after the other.
+ *       Decoder contexts are used by at most one thread at a time
+ * @param decoder
+ * @param decoder_contexts array with one decoder context per channel
+ * @param num_channels
+ * @param bytes num_channels LC3 frames, stored consecutively
+ * @param octets_per_frame
+ * @param BFI array with Bad Frame Indication per channel, or NULL if all frames are valid
+ * @param pcm_out buffer for interleaved PCM samples of all channels
+ * @param BEC_detect array for Bit Error Detected flag per channel, or NULL
+ * @return status ERROR_CODE_SUCCESS or status of first failed channel
+ */
+uint8_t btstack_lc3_thread_pool_posix_decode_frames_signed_16(const btstack_lc3_decoder_t * decoder, void * const * decoder_contexts,
+                                                              uint8_t num_channels, const uint8_t * bytes, uint16_t octets_per_frame,
+                                                              const uint8_t * BFI, int16_t * pcm_out, uint8_t * BEC_detect);
+
+/**
+ * @brief Stop and join worker threads
+ */
+void btstack_lc3_thread_pool_posix_deinit(void);
+
+/* API_END */
+
+#if defined __cplusplus
+}
+#endif
+#endif // BTSTACK_LC3_THREAD_POOL_POSIX_H
@@ -44,10 +44,14 @@
 
 
 #include "btstack_network.h"
+#include "btstack_network_posix.h"
 
 #include "btstack_config.h"
 #include "btstack_debug.h"
+#include "btstack_event.h"
 #include "btstack_run_loop.h"
+#include "btstack_util.h"
+#include "classic/bnep.h"
 
 #include <sys/types.h>
 #include <sys/socket.h>
@@ -65,6 +69,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <time.h>
 #include <unistd.h>
 
 #if defined(__APPLE__) || defined(__FreeBSD__)
@@ -134,6 +139,365 @@ static void process_tap_dev_data(btstack_data_source_t *ds, btstack_data_source_
     (*btstack_network_send_packet_callback)(network_buffer, network_buffer_len);
 }
 
+/*
+ * @text In bridge mode, the TAP interface is non-blocking and read in batches. Each frame is stored once in a
+ * shared frame buffer and referenced by the outgoing queues of all BNEP channels that accept it. The BNEP
+ * filters of a channel are checked before a frame is queued or copied. bnep_send uses the compressed
+ * packet types if source or destination match the addresses of the BNEP channel.
+ */
+
+typedef struct {
+    uint16_t len;
+    uint8_t  ref_count;
+    uint64_t time_us;
+    uint8_t  data[BNEP_MTU_MIN];
+} btstack_network_posix_frame_t;
+
+static bool bridge_active;
+static btstack_network_posix_frame_t bridge_frames[BTSTACK_NETWORK_POSIX_NUM_FRAMES];
+static uint8_t bridge_free_frames[BTSTACK_NETWORK_POSIX_NUM_FRAMES];
+static uint8_t bridge_num_free_frames;
+static btstack_linked_list_t bridge_channels;
+static btstack_network_posix_queue_t bridge_tap_queue;
+static bool bridge_tap_read_paused;
+static btstack_network_posix_statistics_t bridge_statistics;
+
+static uint64_t bridge_get_time_us(void){
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return ((uint64_t) now.tv_sec * 1000000u) + ((uint64_t) now.tv_nsec / 1000u);
+}
+
+static bool bridge_queue_push(btstack_network_posix_queue_t * queue, uint8_t frame_index){
+    if (queue->count == BTSTACK_NETWORK_POSIX_QUEUE_SIZE) return false;
+    queue->frames[(queue->head + queue->count) % BTSTACK_NETWORK_POSIX_QUEUE_SIZE] = frame_index;
+    queue->count++;
+    return true;
+}
+
+static uint8_t bridge_queue_pop(btstack_network_posix_queue_t * queue){
+    uint8_t frame_index = queue->frames[queue->head];
+    queue->head = (queue->head + 1) % BTSTACK_NETWORK_POSIX_QUEUE_SIZE;
+    queue->count--;
+    return frame_index;
+}
+
+static int bridge_frame_alloc(void){
+    if (bridge_num_free_frames == 0) return -1;
+    bridge_num_free_frames--;
+    uint8_t frame_index = bridge_free_frames[bridge_num_free_frames];
+    bridge_frames[frame_index].ref_count = 1;
+    return frame_index;
+}
+
+static void bridge_frame_release(uint8_t frame_index){
+    btstack_network_posix_frame_t * frame = &bridge_frames[frame_index];
+    btstack_assert(frame->ref_count > 0);
+    frame->ref_count--;
+    if (frame->ref_count > 0) return;
+    bridge_free_frames[bridge_num_free_frames++] = frame_index;
+    // resume reading from TAP interface
+    if (bridge_tap_read_paused && (tap_fd >= 0)){
+        bridge_tap_read_paused = false;
+        btstack_run_loop_enable_data_source_callbacks(&tap_dev_ds, DATA_SOURCE_CALLBACK_READ);
+    }
+}
+
+static void bridge_queue_flush(btstack_network_posix_queue_t * queue){
+    while (queue->count > 0){
+        bridge_frame_release(bridge_queue_pop(queue));
+    }
+}
+
+static btstack_network_posix_channel_t * bridge_channel_for_addr(const uint8_t * addr){
+    btstack_linked_list_iterator_t it;
+    btstack_linked_list_iterator_init(&it, &bridge_channels);
+    while (btstack_linked_list_iterator_has_next(&it)){
+        btstack_network_posix_channel_t * channel = (btstack_network_posix_channel_t *) btstack_linked_list_iterator_next(&it);
+        if (memcmp(channel->remote_addr, addr, ETHER_ADDR_LEN) == 0) return channel;
+    }
+    return NULL;
+}
+
+btstack_network_posix_channel_t * btstack_network_posix_bridge_get_channel(uint16_t bnep_cid){
+    btstack_linked_list_iterator_t it;
+    btstack_linked_list_iterator_init(&it, &bridge_channels);
+    while (btstack_linked_list_iterator_has_next(&it)){
+        btstack_network_posix_channel_t * channel = (btstack_network_posix_channel_t *) btstack_linked_list_iterator_next(&it);
+        if (channel->bnep_cid == bnep_cid) return channel;
+    }
+    return NULL;
+}
+
+// queue frame for channel, frame is allocated and filled on first use if *frame_index < 0
+// caller releases the reference from allocation
+static void bridge_channel_enqueue(btstack_network_posix_channel_t * channel, const uint8_t * packet, uint16_t len,
+                                   uint64_t time_us, int * frame_index){
+    if (!bnep_frame_passes_filter(channel->bnep_cid, packet, len)){
+        channel->num_frames_filtered++;
+        return;
+    }
+    if (channel->queue.count == BTSTACK_NETWORK_POSIX_QUEUE_SIZE){
+        channel->num_frames_dropped++;
+        return;
+    }
+    if (*frame_index < 0){
+        if (len > sizeof(bridge_frames[0].data)){
+            channel->num_frames_dropped++;
+            return;
+        }
+        *frame_index = bridge_frame_alloc();
+        if (*frame_index < 0){
+            channel->num_frames_dropped++;
+            bridge_statistics.num_frames_dropped++;
+            return;
+        }
+        btstack_network_posix_frame_t * frame = &bridge_frames[*frame_index];
+        (void)memcpy(frame->data, packet, len);
+        frame->len = len;
+        frame->time_us = time_us;
+    }
+    bridge_frames[*frame_index].ref_count++;
+    bridge_queue_push(&channel->queue, (uint8_t) *frame_index);
+    if (channel->can_send_now_requested == false){
+        channel->can_send_now_requested = true;
+        bnep_request_can_send_now_event(channel->bnep_cid);
+    }
+}
+
+// forward frame to destination channel or, for multicast and unknown destinations, to all channels except source
+static void bridge_forward_to_channels(btstack_network_posix_channel_t * source, const uint8_t * packet, uint16_t len,
+                                       uint64_t time_us, int * frame_index){
+    btstack_network_posix_channel_t * destination = NULL;
+    if ((packet[0] & 0x01) == 0){
+        destination = bridge_channel_for_addr(packet);
+    }
+    if (destination != NULL){
+        if (destination != source){
+            bridge_channel_enqueue(destination, packet, len, time_us, frame_index);
+        }
+        return;
+    }
+    btstack_linked_list_iterator_t it;
+    btstack_linked_list_iterator_init(&it, &bridge_channels);
+    while (btstack_linked_list_iterator_has_next(&it)){
+        btstack_network_posix_channel_t * channel = (btstack_network_posix_channel_t *) btstack_linked_list_iterator_next(&it);
+        if (channel == source) continue;
+        bridge_channel_enqueue(channel, packet, len, time_us, frame_index);
+    }
+}
+
+static void bridge_channel_send_queued(btstack_network_posix_channel_t * channel){
+    channel->can_send_now_requested = false;
+    while (channel->queue.count > 0){
+        if (!bnep_can_send_packet_now(channel->bnep_cid)) break;
+        uint8_t frame_index = channel->queue.frames[channel->queue.head];
+        btstack_network_posix_frame_t * frame = &bridge_frames[frame_index];
+        int err = bnep_send(channel->bnep_cid, frame->data, frame->len);
+        if (err == BTSTACK_ACL_BUFFERS_FULL) break;
+        (void) bridge_queue_pop(&channel->queue);
+        if (err == 0){
+            uint32_t latency_us = (uint32_t) (bridge_get_time_us() - frame->time_us);
+            channel->num_frames_sent++;
+            channel->num_bytes_sent += frame->len;
+            channel->latency_us_total += latency_us;
+            channel->latency_us_max = btstack_max(channel->latency_us_max, latency_us);
+        } else {
+            channel->num_frames_dropped++;
+        }
+        bridge_frame_release(frame_index);
+    }
+    if (channel->queue.count > 0){
+        channel->can_send_now_requested = true;
+        bnep_request_can_send_now_event(channel->bnep_cid);
+    }
+}
+
+static bool bridge_tap_write_frame(const uint8_t * packet, uint16_t size){
+    ssize_t rc = write(tap_fd, packet, size);
+    if (rc < 0){
+        if ((errno == EAGAIN) || (errno == EWOULDBLOCK)) return false;
+        log_error("TAP: Could not write to TAP device: %s", strerror(errno));
+        bridge_statistics.num_tap_frames_dropped++;
+        return true;
+    }
+    if (rc != size) {
+        log_error("TAP: Package written only partially %d of %d bytes", (int) rc, size);
+    }
+    bridge_statistics.num_tap_frames_sent++;
+    bridge_statistics.num_tap_bytes_sent += size;
+    return true;
+}
+
+static void bridge_tap_write(const uint8_t * packet, uint16_t size){
+    if (tap_fd < 0) return;
+    // keep frame order
+    if ((bridge_tap_queue.count == 0) && bridge_tap_write_frame(packet, size)) return;
+    int frame_index = -1;
+    if ((size <= sizeof(bridge_frames[0].data)) && (bridge_tap_queue.count < BTSTACK_NETWORK_POSIX_QUEUE_SIZE)){
+        frame_index = bridge_frame_alloc();
+    }
+    if (frame_index < 0){
+        bridge_statistics.num_tap_frames_dropped++;
+        return;
+    }
+    btstack_network_posix_frame_t * frame = &bridge_frames[frame_index];
+    (void)memcpy(frame->data, packet, size);
+    frame->len = size;
+    bridge_queue_push(&bridge_tap_queue, (uint8_t) frame_index);
+    btstack_run_loop_enable_data_source_callbacks(&tap_dev_ds, DATA_SOURCE_CALLBACK_WRITE);
+}
+
+static void bridge_tap_write_queued(void){
+    while (bridge_tap_queue.count > 0){
+        uint8_t frame_index = bridge_tap_queue.frames[bridge_tap_queue.head];
+        btstack_network_posix_frame_t * frame = &bridge_frames[frame_index];
+        if (!bridge_tap_write_frame(frame->data, frame->len)) return;
+        (void) bridge_queue_pop(&bridge_tap_queue);
+        bridge_frame_release(frame_index);
+    }
+    btstack_run_loop_disable_data_source_callbacks(&tap_dev_ds, DATA_SOURCE_CALLBACK_WRITE);
+}
+
+static void bridge_tap_read(void){
+    uint16_t num_frames = 0;
+    while (num_frames < BTSTACK_NETWORK_POSIX_READ_BATCH_SIZE){
+        int frame_index = bridge_frame_alloc();
+        if (frame_index < 0){
+            // resumed when a frame buffer gets released
+            bridge_tap_read_paused = true;
+            btstack_run_loop_disable_data_source_callbacks(&tap_dev_ds, DATA_SOURCE_CALLBACK_READ);
+            break;
+        }
+        btstack_network_posix_frame_t * frame = &bridge_frames[frame_index];
+        ssize_t len = read(tap_fd, frame->data, sizeof(frame->data));
+        if (len <= 0){
+            if ((len < 0) && (errno != EAGAIN) && (errno != EWOULDBLOCK)){
+                log_error("TAP: Error while reading: %s", strerror(errno));
+            }
+            bridge_frame_release((uint8_t) frame_index);
+            break;
+        }
+        num_frames++;
+        bridge_statistics.num_tap_frames_received++;
+        bridge_statistics.num_tap_bytes_received += (uint64_t) len;
+        if (len >= 14){
+            frame->len = (uint16_t) len;
+            frame->time_us = bridge_get_time_us();
+            bridge_forward_to_channels(NULL, frame->data, frame->len, frame->time_us, &frame_index);
+        }
+        // drop reference held for reading, frame is freed if no channel accepted it
+        bridge_frame_release((uint8_t) frame_index);
+    }
+    if (num_frames > 0){
+        bridge_statistics.num_tap_read_batches++;
+    }
+}
+
+static void bridge_process_tap_dev(btstack_data_source_t *ds, btstack_data_source_callback_type_t callback_type){
+    UNUSED(ds);
+    switch (callback_type){
+        case DATA_SOURCE_CALLBACK_READ:
+            bridge_tap_read();
+            break;
+        case DATA_SOURCE_CALLBACK_WRITE:
+            bridge_tap_write_queued();
+            break;
+        default:
+            break;
+    }
+}
+
+void btstack_network_posix_bridge_init(void){
+    bridge_active = true;
+    bridge_channels = NULL;
+    bridge_tap_read_paused = false;
+    memset(&bridge_tap_queue, 0, sizeof(bridge_tap_queue));
+    memset(&bridge_statistics, 0, sizeof(bridge_statistics));
+    uint8_t i;
+    for (i = 0; i < BTSTACK_NETWORK_POSIX_NUM_FRAMES; i++){
+        bridge_frames[i].ref_count = 0;
+        bridge_free_frames[i] = i;
+    }
+    bridge_num_free_frames = BTSTACK_NETWORK_POSIX_NUM_FRAMES;
+}
+
+void btstack_network_posix_bridge_add_channel(btstack_network_posix_channel_t * channel, uint16_t bnep_cid, bd_addr_t remote_addr){
+    memset(channel, 0, sizeof(btstack_network_posix_channel_t));
+    channel->bnep_cid = bnep_cid;
+    bd_addr_copy(channel->remote_addr, remote_addr);
+    btstack_linked_list_add_tail(&bridge_channels, (btstack_linked_item_t *) channel);
+}
+
+void btstack_network_posix_bridge_remove_channel(uint16_t bnep_cid){
+    btstack_network_posix_channel_t * channel = btstack_network_posix_bridge_get_channel(bnep_cid);
+    if (channel == NULL) return;
+    btstack_linked_list_remove(&bridge_channels, (btstack_linked_item_t *) channel);
+    bridge_queue_flush(&channel->queue);
+}
+
+void btstack_network_posix_bridge_packet_handler(uint8_t packet_type, uint16_t channel, uint8_t * packet, uint16_t size){
+    btstack_network_posix_channel_t * bridge_channel;
+    switch (packet_type){
+        case HCI_EVENT_PACKET:
+            if (hci_event_packet_get_type(packet) != BNEP_EVENT_CAN_SEND_NOW) break;
+            bridge_channel = btstack_network_posix_bridge_get_channel(bnep_event_can_send_now_get_bnep_cid(packet));
+            if (bridge_channel == NULL) break;
+            bridge_channel_send_queued(bridge_channel);
+            break;
+        case BNEP_DATA_PACKET:
+            if (size < 14) break;
+            bridge_channel = btstack_network_posix_bridge_get_channel(channel);
+            if (bridge_channel != NULL){
+                bridge_channel->num_frames_received++;
+                bridge_channel->num_bytes_received += size;
+            }
+            // unicast to other BNEP channel
+            if ((packet[0] & 0x01) == 0){
+                btstack_network_posix_channel_t * destination = bridge_channel_for_addr(packet);
+                if ((destination != NULL) && (destination != bridge_channel)){
+                    int frame_index = -1;
+                    bridge_channel_enqueue(destination, packet, size, bridge_get_time_us(), &frame_index);
+                    if (frame_index >= 0){
+                        bridge_frame_release((uint8_t) frame_index);
+                    }
+                    break;
+                }
+            } else {
+                int frame_index = -1;
+                bridge_forward_to_channels(bridge_channel, packet, size, bridge_get_time_us(), &frame_index);
+                if (frame_index >= 0){
+                    bridge_frame_release((uint8_t) frame_index);
+                }
+            }
+            bridge_tap_write(packet, size);
+            break;
+        default:
+            break;
+    }
+}
+
+const btstack_network_posix_statistics_t * btstack_network_posix_bridge_get_statistics(void){
+    return &bridge_statistics;
+}
+
+void btstack_network_posix_bridge_reset_statistics(void){
+    memset(&bridge_statistics, 0, sizeof(bridge_statistics));
+    btstack_linked_list_iterator_t it;
+    btstack_linked_list_iterator_init(&it, &bridge_channels);
+    while (btstack_linked_list_iterator_has_next(&it)){
+        btstack_network_posix_channel_t * channel = (btstack_network_posix_channel_t *) btstack_linked_list_iterator_next(&it);
+        channel->num_frames_sent = 0;
+        channel->num_bytes_sent = 0;
+        channel->num_frames_received = 0;
+        channel->num_bytes_received = 0;
+        channel->num_frames_filtered = 0;
+        channel->num_frames_dropped = 0;
+        channel->latency_us_total = 0;
+        channel->latency_us_max = 0;
+    }
+}
+
 /**
  * @brief Initialize network interface
  * @param send_packet_callback
@@ -246,7 +610,13 @@ int btstack_network_up(bd_addr_t network_address){
 
     /* Create and register a new runloop data source */
     btstack_run_loop_set_data_source_fd(&tap_dev_ds, tap_fd);
-    btstack_run_loop_set_data_source_handler(&tap_dev_ds, &process_tap_dev_data);
+    if (bridge_active){
+        // read and write without blocking the run loop
+        fcntl(tap_fd, F_SETFL, fcntl(tap_fd, F_GETFL, 0) | O_NONBLOCK);
+        btstack_run_loop_set_data_source_handler(&tap_dev_ds, &bridge_process_tap_dev);
+    } else {
+        btstack_run_loop_set_data_source_handler(&tap_dev_ds, &process_tap_dev_data);
+    }
     btstack_run_loop_add_data_source(&tap_dev_ds);
     btstack_run_loop_enable_data_source_callbacks(&tap_dev_ds, DATA_SOURCE_CALLBACK_READ);
 
@@ -274,6 +644,10 @@ int btstack_network_down(void){
         close(tap_fd);
     }
     tap_fd = -1;
+    if (bridge_active){
+        bridge_queue_flush(&bridge_tap_queue);
+        bridge_tap_read_paused = false;
+    }
     return 0;
 }
 
@@ -285,6 +659,12 @@ int btstack_network_down(void){
 void btstack_network_process_packet(const uint8_t * packet, uint16_t size){
 
     if (tap_fd < 0) return;
+
+    if (bridge_active){
+        bridge_tap_write(packet, size);
+        return;
+    }
+
     // Write out the ethernet frame to the tap device 
 
     int rc = write(tap_fd, packet, size);
@@ -0,0 +1,171 @@
+/*
+ * Copyright (C) 2024 BlueKitchen GmbH
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holders nor the names of
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ * 4. Any redistribution, use, or modification is done solely for
+ *    personal benefit and not for any commercial purpose or for
+ *    monetary gain.
+ *
+ * THIS SOFTWARE IS PROVIDED BY BLUEKITCHEN GMBH AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL BLUEKITCHEN
+ * GMBH OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF
+ * THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ *
+ * Please inquire about commercial licensing options at 
+ * contact@bluekitchen-gmbh.com
+ *
+ */
+
+/*
+ *  btstack_network_posix.h
+ *
+ *  Bridge TAP network interface and multiple BNEP channels with batched I/O
+ */
+
+#ifndef BTSTACK_NETWORK_POSIX_H
+#define BTSTACK_NETWORK_POSIX_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "bluetooth.h"
+#include "btstack_linked_list.h"
+#include "btstack_network.h"
+
+#if defined __cplusplus
+extern "C" {
+#endif
+
+// number of Ethernet frame buffers shared by TAP and all BNEP channels
+#ifndef BTSTACK_NETWORK_POSIX_NUM_FRAMES
+#define BTSTACK_NETWORK_POSIX_NUM_FRAMES 16
+#endif
+
+// max number of frames queued per BNEP channel and for the TAP interface
+#ifndef BTSTACK_NETWORK_POSIX_QUEUE_SIZE
+#define BTSTACK_NETWORK_POSIX_QUEUE_SIZE 8
+#endif
+
+// max number of frames read from TAP interface per run loop iteration
+#ifndef BTSTACK_NETWORK_POSIX_READ_BATCH_SIZE
+#define BTSTACK_NETWORK_POSIX_READ_BATCH_SIZE 8
+#endif
+
+typedef struct {
+    uint8_t frames[BTSTACK_NETWORK_POSIX_QUEUE_SIZE];
+    uint8_t head;
+    uint8_t count;
+} btstack_network_posix_queue_t;
+
+typedef struct {
+    btstack_linked_item_t item;
+
+    uint16_t  bnep_cid;
+    bd_addr_t remote_addr;
+
+    // outgoing frames
+    btstack_network_posix_queue_t queue;
+    bool can_send_now_requested;
+
+    // statistics
+    uint32_t num_frames_sent;
+    uint64_t num_bytes_sent;
+    uint32_t num_frames_received;
+    uint64_t num_bytes_received;
+    uint32_t num_frames_filtered;
+    uint32_t num_frames_dropped;
+    // time from reception on TAP interface or other BNEP channel until bnep_send
+    uint64_t latency_us_total;
+    uint32_t latency_us_max;
+} btstack_network_posix_channel_t;
+
+typedef struct {
+    uint32_t num_tap_frames_received;
+    uint64_t num_tap_bytes_received;
+    uint32_t num_tap_read_batches;
+    uint32_t num_tap_frames_sent;
+    uint64_t num_tap_bytes_sent;
+    uint32_t num_tap_frames_dropped;
+    // no free frame buffer
+    uint32_t num_frames_dropped;
+} btstack_network_posix_statistics_t;
+
+/* API_START */
+
+/**
+ * @brief Initialize network interface in bridge mode instead of btstack_network_init
+ * @note In bridge mode, frames read from the TAP interface are forwarded to all BNEP channels that pass the
+ *       destination address and the network protocol / multicast filters of the remote. Frames received on a BNEP
+ *       channel are written to the TAP interface or forwarded to the other BNEP channels. Use btstack_network_up
+ *       and btstack_network_down as usual.
+ */
+void btstack_network_posix_bridge_init(void);
+
+/**
+ * @brief Add BNEP channel to bridge, e.g. on BNEP_EVENT_CHANNEL_OPENED
+ * @param channel storage
+ * @param bnep_cid
+ * @param remote_addr
+ */
+void btstack_network_posix_bridge_add_channel(btstack_network_posix_channel_t * channel, uint16_t bnep_cid, bd_addr_t remote_addr);
+
+/**
+ * @brief Remove BNEP channel from bridge, e.g. on BNEP_EVENT_CHANNEL_CLOSED. Queued frames are dropped
+ * @param bnep_cid
+ */
+void btstack_network_posix_bridge_remove_channel(uint16_t bnep_cid);
+
+/**
+ * @brief Packet handler for BNEP_DATA_PACKET and BNEP_EVENT_CAN_SEND_NOW, call from BNEP packet handler
+ * @note BNEP_EVENT_CAN_SEND_NOW is requested by the bridge for channels with queued frames
+ * @param packet_type
+ * @param channel
+ * @param packet
+ * @param size
+ */
+void btstack_network_posix_bridge_packet_handler(uint8_t packet_type, uint16_t channel, uint8_t * packet, uint16_t size);
+
+/**
+ * @brief Get channel for BNEP CID to access per-channel statistics
+ * @param bnep_cid
+ * @return channel or NULL
+ */
+btstack_network_posix_channel_t * btstack_network_posix_bridge_get_channel(uint16_t bnep_cid);
+
+/**
+ * @brief Get TAP interface statistics
+ * @return statistics
+ */
+const btstack_network_posix_statistics_t * btstack_network_posix_bridge_get_statistics(void);
+
+/**
+ * @brief Reset TAP interface and per-channel statistics
+ */
+void btstack_network_posix_bridge_reset_statistics(void);
+
+/* API_END */
+
+#if defined __cplusplus
+}
+#endif
+
+#endif // BTSTACK_NETWORK_POSIX_H
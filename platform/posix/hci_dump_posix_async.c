@@ -0,0 +1,532 @@
+/*
+ * Copyright (C) 2024 BlueKitchen GmbH
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holders nor the names of
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ * 4. Any redistribution, use, or modification is done solely for
+ *    personal benefit and not for any commercial purpose or for
+ *    monetary gain.
+ *
+ * THIS SOFTWARE IS PROVIDED BY BLUEKITCHEN GMBH AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL BLUEKITCHEN
+ * GMBH OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF
+ * THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ *
+ * Please inquire about commercial licensing options at
+ * contact@bluekitchen-gmbh.com
+ *
+ */
+
+#define BTSTACK_FILE__ "hci_dump_posix_async.c"
+
+/*
+ *  hci_dump_posix_async.c
+ *
+ *  Dump HCI trace in various formats into a file without blocking the caller:
+ *
+ *  - BlueZ's hcidump format
+ *  - Apple's PacketLogger
+ *  - BTSnoop
+ *
+ *  Packets are formatted into a single-producer/single-consumer ring buffer
+ *  and written by a separate thread with writev(). If the ring buffer is full,
+ *  packets are dropped and counted.
+ *
+ *  Packets and messages must be logged from the same thread, i.e. the BTstack run loop.
+ */
+
+#include "btstack_config.h"
+
+// enable POSIX functions (needed for -std=c99)
+#define _POSIX_C_SOURCE 200809
+
+#ifdef __FreeBSD__
+// FreeBSD does not set __BSD_VISIBLE or __XSI_VISIBLE if _POSIX_C_SOURCE is defined
+#define __BSD_VISIBLE 1
+#define __XSI_VISIBLE 1
+#endif
+
+#include "hci_dump_posix_async.h"
+
+#include "btstack_debug.h"
+#include "btstack_util.h"
+
+#include <sys/time.h>     // for timestamps
+#include <sys/stat.h>     // file modes
+#include <sys/uio.h>      // writev
+
+#include <time.h>
+#include <stdio.h>        // printf
+#include <string.h>
+#include <fcntl.h>        // open
+#include <unistd.h>       // write
+#include <errno.h>        // errno
+#include <pthread.h>
+
+// size of ring buffer between logging thread and writer thread
+#ifndef HCI_DUMP_POSIX_ASYNC_BUFFER_SIZE
+#define HCI_DUMP_POSIX_ASYNC_BUFFER_SIZE (256 * 1024)
+#endif
+
+// max time pending packets stay in buffer
+#ifndef HCI_DUMP_POSIX_ASYNC_FLUSH_INTERVAL_MS
+#define HCI_DUMP_POSIX_ASYNC_FLUSH_INTERVAL_MS 100
+#endif
+
+#define HCI_DUMP_POSIX_ASYNC_MAX_FILENAME_LEN 256
+
+static uint8_t  hci_dump_async_buffer[HCI_DUMP_POSIX_ASYNC_BUFFER_SIZE];
+
+// free running positions, written by producer (write) and consumer (read) only
+static uint32_t hci_dump_async_write_pos;
+static uint32_t hci_dump_async_read_pos;
+
+static pthread_t       hci_dump_async_thread;
+static pthread_mutex_t hci_dump_async_mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t  hci_dump_async_cond  = PTHREAD_COND_INITIALIZER;
+static bool            hci_dump_async_stop;
+static bool            hci_dump_async_reset_requested;
+// records before this position are discarded on reset
+static uint32_t        hci_dump_async_reset_pos;
+
+// set by logging thread, file is only accessed by writer thread while active
+static bool     hci_dump_async_active;
+static int      hci_dump_async_file = -1;
+static int      hci_dump_async_format;
+static char     hci_dump_async_filename[HCI_DUMP_POSIX_ASYNC_MAX_FILENAME_LEN];
+static char     hci_dump_async_log_message_buffer[256];
+
+// rotation
+static uint32_t hci_dump_async_max_file_size;
+static uint32_t hci_dump_async_max_duration_s;
+static uint8_t  hci_dump_async_max_files;
+static uint32_t hci_dump_async_file_size;
+static time_t   hci_dump_async_file_opened;
+
+// statistics
+static uint32_t hci_dump_async_dropped_packets;
+// records discarded by writer thread, e.g. if log file cannot be opened after rotation
+static uint32_t hci_dump_async_discarded_packets;
+static uint32_t hci_dump_async_bytes_written;
+static uint16_t hci_dump_async_files_rotated;
+
+// provide summary for ISO Data Packets if not supported by fileformat/viewer yet
+static uint16_t hci_dump_iso_summary(uint8_t in,  uint8_t *packet, uint16_t len){
+    UNUSED(len);
+    uint16_t conn_handle = little_endian_read_16(packet, 0) & 0xfff;
+    uint8_t pb = (packet[1] >> 4) & 3;
+    uint8_t ts = (packet[1] >> 6) & 1;
+    uint16_t pos = 4;
+    uint32_t time_stamp = 0;
+    if (ts){
+        time_stamp = little_endian_read_32(packet, pos);
+        pos += 4;
+    }
+    if ((pb & 1) == 0) {
+        uint16_t packet_sequence = little_endian_read_16(packet, pos);
+        pos += 2;
+        uint16_t iso_sdu_len = little_endian_read_16(packet, pos);
+        uint8_t packet_status_flag = packet[pos+1] >> 6;
+        return snprintf(hci_dump_async_log_message_buffer,sizeof(hci_dump_async_log_message_buffer), "ISO %s, handle %04x, pb %u, ts 0x%08x, size %u, sequence 0x%04x, packet status %u, iso pdu len %u",
+                        in ? "IN" : "OUT", conn_handle, pb, time_stamp, len, packet_sequence, packet_status_flag, iso_sdu_len);
+    } else {
+        return snprintf(hci_dump_async_log_message_buffer,sizeof(hci_dump_async_log_message_buffer), "ISO %s, handle %04x, pb %u, ts 0x%08x, size %u",
+                        in ? "IN" : "OUT", conn_handle, pb, time_stamp, len);
+    }
+}
+
+// MARK: writer thread
+
+static void hci_dump_async_write_file_header(void){
+    if (hci_dump_async_format != HCI_DUMP_BTSNOOP) return;
+    // write BTSnoop file header
+    const uint8_t file_header[] = {
+        // Identification Pattern: "btsnoop\0"
+        0x62, 0x74, 0x73, 0x6E, 0x6F, 0x6F, 0x70, 0x00,
+        // Version: 1
+        0x00, 0x00, 0x00, 0x01,
+        // Datalink Type: 1002 - H4
+        0x00, 0x00, 0x03, 0xEA,
+    };
+    ssize_t bytes_written = write(hci_dump_async_file, &file_header, sizeof(file_header));
+    UNUSED(bytes_written);
+    hci_dump_async_file_size = sizeof(file_header);
+}
+
+static int hci_dump_async_open_file(void){
+    int oflags = O_WRONLY | O_CREAT | O_TRUNC;
+#ifdef _WIN32
+    oflags |= O_BINARY;
+#endif
+    hci_dump_async_file = open(hci_dump_async_filename, oflags, S_IRUSR | S_IWUSR | S_IRGRP | S_IROTH );
+    if (hci_dump_async_file < 0){
+        return errno;
+    }
+    hci_dump_async_file_opened = time(NULL);
+    hci_dump_async_file_size = 0;
+    hci_dump_async_write_file_header();
+    return 0;
+}
+
+static void hci_dump_async_truncate_file(void){
+    (void) lseek(hci_dump_async_file, 0, SEEK_SET);
+    int err = ftruncate(hci_dump_async_file, 0);
+    UNUSED(err);
+    hci_dump_async_file_opened = time(NULL);
+    hci_dump_async_file_size = 0;
+    hci_dump_async_write_file_header();
+}
+
+static void hci_dump_async_rotate_file(void){
+    if (hci_dump_async_max_files == 0){
+        hci_dump_async_truncate_file();
+        return;
+    }
+    close(hci_dump_async_file);
+    // shift <filename>.n-1 to <filename>.n and <filename> to <filename>.1
+    char from[HCI_DUMP_POSIX_ASYNC_MAX_FILENAME_LEN + 4];
+    char to[HCI_DUMP_POSIX_ASYNC_MAX_FILENAME_LEN + 4];
+    uint8_t i;
+    for (i = hci_dump_async_max_files; i > 1; i--){
+        snprintf(from, sizeof(from), "%s.%u", hci_dump_async_filename, i - 1);
+        snprintf(to,   sizeof(to),   "%s.%u", hci_dump_async_filename, i);
+        (void) rename(from, to);
+    }
+    snprintf(to, sizeof(to), "%s.1", hci_dump_async_filename);
+    (void) rename(hci_dump_async_filename, to);
+    hci_dump_async_files_rotated++;
+    if (hci_dump_async_open_file() != 0){
+        log_error("hci_dump_posix_async: failed to open %s after rotation", hci_dump_async_filename);
+    }
+}
+
+static bool hci_dump_async_rotation_required(void){
+    if ((hci_dump_async_max_file_size > 0) && (hci_dump_async_file_size >= hci_dump_async_max_file_size)) return true;
+    if ((hci_dump_async_max_duration_s > 0) && ((uint32_t)(time(NULL) - hci_dump_async_file_opened) >= hci_dump_async_max_duration_s)) return true;
+    return false;
+}
+
+static uint32_t hci_dump_async_peek_32(uint32_t pos, bool big_endian){
+    uint8_t data[4];
+    uint8_t i;
+    for (i = 0; i < 4; i++){
+        data[i] = hci_dump_async_buffer[(pos + i) % HCI_DUMP_POSIX_ASYNC_BUFFER_SIZE];
+    }
+    return big_endian ? big_endian_read_32(data, 0) : little_endian_read_32(data, 0);
+}
+
+// count records between read and end position, both are on a record boundary
+static uint32_t hci_dump_async_count_records(uint32_t read_pos, uint32_t end_pos){
+    uint32_t num_records = 0;
+    while (read_pos != end_pos){
+        uint32_t record_len;
+        switch (hci_dump_async_format){
+            case HCI_DUMP_BLUEZ:
+                record_len = HCI_DUMP_HEADER_SIZE_BLUEZ - 1 + (hci_dump_async_peek_32(read_pos, false) & 0xffff);
+                break;
+            case HCI_DUMP_PACKETLOGGER:
+                record_len = 4 + hci_dump_async_peek_32(read_pos, true);
+                break;
+            default:
+                // included length
+                record_len = HCI_DUMP_HEADER_SIZE_BTSNOOP + hci_dump_async_peek_32(read_pos + 4, true);
+                break;
+        }
+        read_pos += record_len;
+        num_records++;
+    }
+    return num_records;
+}
+
+// drop pending records up to end position
+static void hci_dump_async_discard_pending(uint32_t end_pos, bool count_as_dropped){
+    uint32_t read_pos = hci_dump_async_read_pos;
+    if (count_as_dropped){
+        uint32_t num_records = hci_dump_async_count_records(read_pos, end_pos);
+        __atomic_store_n(&hci_dump_async_discarded_packets, hci_dump_async_discarded_packets + num_records, __ATOMIC_RELAXED);
+    }
+    __atomic_store_n(&hci_dump_async_read_pos, end_pos, __ATOMIC_RELEASE);
+}
+
+// write all records up to write position with a single writev, write position is always on a record boundary
+static void hci_dump_async_write_pending(uint32_t write_pos){
+    uint32_t read_pos  = hci_dump_async_read_pos;
+    uint32_t pending   = write_pos - read_pos;
+    if (pending == 0) return;
+
+    if (hci_dump_async_file < 0){
+        hci_dump_async_discard_pending(write_pos, true);
+        return;
+    }
+
+    uint32_t offset = read_pos % HCI_DUMP_POSIX_ASYNC_BUFFER_SIZE;
+    uint32_t bytes_until_wrap = HCI_DUMP_POSIX_ASYNC_BUFFER_SIZE - offset;
+    struct iovec iov[2];
+    int iovcnt = 1;
+    iov[0].iov_base = &hci_dump_async_buffer[offset];
+    if (pending <= bytes_until_wrap){
+        iov[0].iov_len = pending;
+    } else {
+        iov[0].iov_len = bytes_until_wrap;
+        iov[1].iov_base = &hci_dump_async_buffer[0];
+        iov[1].iov_len  = pending - bytes_until_wrap;
+        iovcnt = 2;
+    }
+
+    ssize_t bytes_written = writev(hci_dump_async_file, iov, iovcnt);
+    if (bytes_written > 0){
+        hci_dump_async_file_size     += (uint32_t) bytes_written;
+        hci_dump_async_bytes_written += (uint32_t) bytes_written;
+    }
+
+    // release space to producer
+    __atomic_store_n(&hci_dump_async_read_pos, write_pos, __ATOMIC_RELEASE);
+}
+
+static void * hci_dump_async_writer_thread(void * context){
+    UNUSED(context);
+    while (true){
+        pthread_mutex_lock(&hci_dump_async_mutex);
+        bool stop = hci_dump_async_stop;
+        if (!stop){
+            struct timespec deadline;
+            clock_gettime(CLOCK_REALTIME, &deadline);
+            deadline.tv_nsec += (HCI_DUMP_POSIX_ASYNC_FLUSH_INTERVAL_MS % 1000) * 1000000L;
+            deadline.tv_sec  += (HCI_DUMP_POSIX_ASYNC_FLUSH_INTERVAL_MS / 1000) + (deadline.tv_nsec / 1000000000L);
+            deadline.tv_nsec %= 1000000000L;
+            pthread_cond_timedwait(&hci_dump_async_cond, &hci_dump_async_mutex, &deadline);
+            stop = hci_dump_async_stop;
+        }
+        bool reset = hci_dump_async_reset_requested;
+        uint32_t reset_pos = hci_dump_async_reset_pos;
+        hci_dump_async_reset_requested = false;
+        // records up to here were logged before any later reset request
+        uint32_t write_pos = __atomic_load_n(&hci_dump_async_write_pos, __ATOMIC_ACQUIRE);
+        pthread_mutex_unlock(&hci_dump_async_mutex);
+
+        if (reset){
+            // records logged before the reset must not end up in the truncated file
+            hci_dump_async_discard_pending(reset_pos, false);
+            if (hci_dump_async_file >= 0){
+                hci_dump_async_truncate_file();
+            }
+        }
+        hci_dump_async_write_pending(write_pos);
+        if (stop) break;
+        if ((hci_dump_async_file >= 0) && hci_dump_async_rotation_required()){
+            hci_dump_async_rotate_file();
+        }
+    }
+    return NULL;
+}
+
+static void hci_dump_async_wakeup_writer(void){
+    pthread_mutex_lock(&hci_dump_async_mutex);
+    pthread_cond_signal(&hci_dump_async_cond);
+    pthread_mutex_unlock(&hci_dump_async_mutex);
+}
+
+// MARK: producer
+
+static void hci_dump_async_reset(void){
+    pthread_mutex_lock(&hci_dump_async_mutex);
+    hci_dump_async_reset_requested = true;
+    hci_dump_async_reset_pos = hci_dump_async_write_pos;
+    pthread_cond_signal(&hci_dump_async_cond);
+    pthread_mutex_unlock(&hci_dump_async_mutex);
+}
+
+static void hci_dump_async_store(const uint8_t * data, uint16_t len, uint32_t * write_pos){
+    uint32_t offset = *write_pos % HCI_DUMP_POSIX_ASYNC_BUFFER_SIZE;
+    uint32_t bytes_until_wrap = HCI_DUMP_POSIX_ASYNC_BUFFER_SIZE - offset;
+    if (len <= bytes_until_wrap){
+        (void)memcpy(&hci_dump_async_buffer[offset], data, len);
+    } else {
+        (void)memcpy(&hci_dump_async_buffer[offset], data, bytes_until_wrap);
+        (void)memcpy(&hci_dump_async_buffer[0], &data[bytes_until_wrap], len - bytes_until_wrap);
+    }
+    *write_pos += len;
+}
+
+static void hci_dump_async_log_truncated_packet(uint8_t packet_type, uint8_t in, uint8_t *packet, uint16_t len, uint16_t original_len) {
+    if (!hci_dump_async_active) return;
+
+    union {
+        uint8_t header_bluez[HCI_DUMP_HEADER_SIZE_BLUEZ];
+        uint8_t header_packetlogger[HCI_DUMP_HEADER_SIZE_PACKETLOGGER];
+        uint8_t header_btsnoop[HCI_DUMP_HEADER_SIZE_BTSNOOP+1];
+    } header;
+
+    uint32_t tv_sec = 0;
+    uint32_t tv_us  = 0;
+    uint64_t ts_usec;
+
+    // get time
+    struct timeval curr_time;
+    gettimeofday(&curr_time, NULL);
+    tv_sec = curr_time.tv_sec;
+    tv_us  = curr_time.tv_usec;
+
+    uint16_t header_len = 0;
+    switch (hci_dump_async_format){
+        case HCI_DUMP_BLUEZ:
+            // ISO packets not supported
+            if (packet_type == HCI_ISO_DATA_PACKET){
+                len = hci_dump_iso_summary(in, packet, len);
+                packet_type = LOG_MESSAGE_PACKET;
+                packet = (uint8_t*) hci_dump_async_log_message_buffer;
+            }
+            hci_dump_setup_header_bluez(header.header_bluez, tv_sec, tv_us, packet_type, in, len);
+            header_len = HCI_DUMP_HEADER_SIZE_BLUEZ;
+            break;
+        case HCI_DUMP_PACKETLOGGER:
+            // ISO packets not supported
+            if (packet_type == HCI_ISO_DATA_PACKET){
+                len = hci_dump_iso_summary(in, packet, len);
+                packet_type = LOG_MESSAGE_PACKET;
+                packet = (uint8_t*) hci_dump_async_log_message_buffer;
+            }
+            hci_dump_setup_header_packetlogger(header.header_packetlogger, tv_sec, tv_us, packet_type, in, len);
+            header_len = HCI_DUMP_HEADER_SIZE_PACKETLOGGER;
+            break;
+        case HCI_DUMP_BTSNOOP:
+            // log messages not supported
+            if (packet_type == LOG_MESSAGE_PACKET) return;
+            ts_usec = 0xdcddb30f2f8000LLU + 1000000LLU * curr_time.tv_sec + curr_time.tv_usec;
+            // append packet type to pcap header
+            hci_dump_setup_header_btsnoop_truncated(header.header_btsnoop, ts_usec >> 32, ts_usec & 0xFFFFFFFF, hci_dump_async_dropped_packets, packet_type, in, len+1, original_len+1);
+            header.header_btsnoop[HCI_DUMP_HEADER_SIZE_BTSNOOP] = packet_type;
+            header_len = HCI_DUMP_HEADER_SIZE_BTSNOOP + 1;
+            break;
+        default:
+            btstack_unreachable();
+            return;
+    }
+
+    // drop record if it does not fit
+    uint32_t write_pos = hci_dump_async_write_pos;
+    uint32_t read_pos  = __atomic_load_n(&hci_dump_async_read_pos, __ATOMIC_ACQUIRE);
+    uint32_t free_space = HCI_DUMP_POSIX_ASYNC_BUFFER_SIZE - (write_pos - read_pos);
+    uint32_t record_len = (uint32_t) header_len + len;
+    if (record_len > free_space){
+        hci_dump_async_dropped_packets++;
+        return;
+    }
+
+    hci_dump_async_store((const uint8_t *) &header, header_len, &write_pos);
+    hci_dump_async_store(packet, len, &write_pos);
+
+    // publish record
+    __atomic_store_n(&hci_dump_async_write_pos, write_pos, __ATOMIC_RELEASE);
+
+    // wake up writer early if buffer gets half full
+    uint32_t pending = write_pos - read_pos;
+    if ((pending >= (HCI_DUMP_POSIX_ASYNC_BUFFER_SIZE / 2)) && ((pending - record_len) < (HCI_DUMP_POSIX_ASYNC_BUFFER_SIZE / 2))){
+        hci_dump_async_wakeup_writer();
+    }
+}
+
+static void hci_dump_async_log_packet(uint8_t packet_type, uint8_t in, uint8_t *packet, uint16_t len) {
+    hci_dump_async_log_truncated_packet(packet_type, in, packet, len, len);
+}
+
+static void hci_dump_async_log_message(int log_level, const char * format, va_list argptr){
+    UNUSED(log_level);
+    if (!hci_dump_async_active) return;
+    int len = vsnprintf(hci_dump_async_log_message_buffer, sizeof(hci_dump_async_log_message_buffer), format, argptr);
+    if (len < 0) return;
+    len = btstack_min(len, sizeof(hci_dump_async_log_message_buffer) - 1);
+    hci_dump_async_log_packet(LOG_MESSAGE_PACKET, 0, (uint8_t*) hci_dump_async_log_message_buffer, (uint16_t) len);
+}
+
+// MARK: API
+
+void hci_dump_posix_async_set_rotation(uint32_t max_file_size, uint32_t max_duration_s, uint8_t max_files){
+    hci_dump_async_max_file_size  = max_file_size;
+    hci_dump_async_max_duration_s = max_duration_s;
+    hci_dump_async_max_files      = max_files;
+}
+
+// returns system errno
+int hci_dump_posix_async_open(const char *filename, hci_dump_format_t format){
+    btstack_assert(format == HCI_DUMP_BLUEZ || format == HCI_DUMP_PACKETLOGGER || format == HCI_DUMP_BTSNOOP);
+    btstack_assert(hci_dump_async_active == false);
+
+    if (strlen(filename) >= sizeof(hci_dump_async_filename)) return ENAMETOOLONG;
+    btstack_strcpy(hci_dump_async_filename, sizeof(hci_dump_async_filename), filename);
+
+    hci_dump_async_format = format;
+    hci_dump_async_write_pos = 0;
+    hci_dump_async_read_pos  = 0;
+    hci_dump_async_stop = false;
+    hci_dump_async_reset_requested = false;
+    hci_dump_async_dropped_packets = 0;
+    hci_dump_async_discarded_packets = 0;
+    hci_dump_async_bytes_written = 0;
+    hci_dump_async_files_rotated = 0;
+
+    int err = hci_dump_async_open_file();
+    if (err != 0){
+        printf("failed to open file %s, errno = %d\n", filename, err);
+        return err;
+    }
+
+    err = pthread_create(&hci_dump_async_thread, NULL, &hci_dump_async_writer_thread, NULL);
+    if (err != 0){
+        close(hci_dump_async_file);
+        hci_dump_async_file = -1;
+        return err;
+    }
+    hci_dump_async_active = true;
+    return 0;
+}
+
+void hci_dump_posix_async_close(void){
+    if (!hci_dump_async_active) return;
+    hci_dump_async_active = false;
+    pthread_mutex_lock(&hci_dump_async_mutex);
+    hci_dump_async_stop = true;
+    pthread_cond_signal(&hci_dump_async_cond);
+    pthread_mutex_unlock(&hci_dump_async_mutex);
+    pthread_join(hci_dump_async_thread, NULL);
+    close(hci_dump_async_file);
+    hci_dump_async_file = -1;
+}
+
+void hci_dump_posix_async_get_statistics(hci_dump_posix_async_statistics_t * statistics){
+    statistics->dropped_packets = hci_dump_async_dropped_packets + __atomic_load_n(&hci_dump_async_discarded_packets, __ATOMIC_RELAXED);
+    statistics->bytes_written   = __atomic_load_n(&hci_dump_async_bytes_written, __ATOMIC_RELAXED);
+    statistics->files_rotated   = __atomic_load_n(&hci_dump_async_files_rotated, __ATOMIC_RELAXED);
+}
+
+const hci_dump_t * hci_dump_posix_async_get_instance(void){
+    static const hci_dump_t hci_dump_instance = {
+        // void (*reset)(void);
+        &hci_dump_async_reset,
+        // void (*log_packet)(uint8_t packet_type, uint8_t in, uint8_t *packet, uint16_t len);
+        &hci_dump_async_log_packet,
+        // void (*log_message)(int log_level, const char * format, va_list argptr);
+        &hci_dump_async_log_message,
+        // void (*log_truncated_packet)(uint8_t packet_type, uint8_t in, uint8_t *packet, uint16_t len, uint16_t original_len);
+        &hci_dump_async_log_truncated_packet,
+    };
+    return &hci_dump_instance;
+}
@@ -0,0 +1,99 @@
+/*
+ * Copyright (C) 2024 BlueKitchen GmbH
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holders nor the names of
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ * 4. Any redistribution, use, or modification is done solely for
+ *    personal benefit and not for any commercial purpose or for
+ *    monetary gain.
+ *
+ * THIS SOFTWARE IS PROVIDED BY BLUEKITCHEN GMBH AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL BLUEKITCHEN
+ * GMBH OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF
+ * THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ *
+ * Please inquire about commercial licensing options at
+ * contact@bluekitchen-gmbh.com
+ *
+ */
+
+/*
+ *  Dump HCI trace in binary formats like PacketLogger, BlueZ (hcidump) and BTSnoop into file from a writer thread
+ */
+
+#ifndef HCI_DUMP_POSIX_ASYNC_H
+#define HCI_DUMP_POSIX_ASYNC_H
+
+#include <stdint.h>
+#include "hci_dump.h"
+
+#if defined __cplusplus
+extern "C" {
+#endif
+
+/* API_START */
+
+typedef struct {
+    uint32_t dropped_packets;
+    uint32_t bytes_written;
+    uint16_t files_rotated;
+} hci_dump_posix_async_statistics_t;
+
+/**
+ * @brief Get HCI Dump POSIX Async Instance
+ * @return hci_dump_impl
+ */
+const hci_dump_t * hci_dump_posix_async_get_instance(void);
+
+/**
+ * @brief Configure log file rotation, call before hci_dump_posix_async_open
+ * @note rotated files are named <filename>.1 (newest) up to <filename>.<max_files>
+ * @param max_file_size in bytes, 0 = no size limit
+ * @param max_duration_s in seconds, 0 = no time limit
+ * @param max_files number of rotated files to keep, 0 = truncate log file instead
+ */
+void hci_dump_posix_async_set_rotation(uint32_t max_file_size, uint32_t max_duration_s, uint8_t max_files);
+
+/**
+ * @brief Open Log file and start writer thread
+ * @param filename or path
+ * @param format
+ * @returns 0 if ok, errno otherwise
+ */
+int hci_dump_posix_async_open(const char *filename, hci_dump_format_t format);
+
+/**
+ * @brief Write all pending packets, stop writer thread and close Log file
+ */
+void hci_dump_posix_async_close(void);
+
+/**
+ * @brief Get statistics
+ * @param statistics
+ */
+void hci_dump_posix_async_get_statistics(hci_dump_posix_async_statistics_t * statistics);
+
+/* API_END */
+
+#if defined __cplusplus
+}
+#endif
+#endif // HCI_DUMP_POSIX_ASYNC_H
@@ -0,0 +1,331 @@
+/*
+ * Copyright (C) 2024 BlueKitchen GmbH
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holders nor the names of
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ * 4. Any redistribution, use, or modification is done solely for
+ *    personal benefit and not for any commercial purpose or for
+ *    monetary gain.
+ *
+ * THIS SOFTWARE IS PROVIDED BY BLUEKITCHEN GMBH AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL BLUEKITCHEN
+ * GMBH OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF
+ * THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ *
+ * Please inquire about commercial licensing options at
+ * contact@bluekitchen-gmbh.com
+ *
+ */
+
+#define BTSTACK_FILE__ "hci_dump_posix_flight_recorder.c"
+
+/*
+ *  hci_dump_posix_flight_recorder.c
+ *
+ *  Keep the most recent HCI trace in a circular memory buffer and write it
+ *  into a file on request or when a trigger event is logged:
+ *
+ *  - BlueZ's hcidump format
+ *  - Apple's PacketLogger
+ *  - BTSnoop
+ *
+ *  Records are stored with their file format header. The header's length
+ *  field is used to find the oldest record when space is needed.
+ */
+
+#include "btstack_config.h"
+
+// enable POSIX functions (needed for -std=c99)
+#define _POSIX_C_SOURCE 200809
+
+#ifdef __FreeBSD__
+// FreeBSD does not set __BSD_VISIBLE or __XSI_VISIBLE if _POSIX_C_SOURCE is defined
+#define __BSD_VISIBLE 1
+#define __XSI_VISIBLE 1
+#endif
+
+#include "hci_dump_posix_flight_recorder.h"
+
+#include "btstack_debug.h"
+#include "btstack_util.h"
+
+#include <sys/time.h>     // for timestamps
+#include <sys/stat.h>     // file modes
+
+#include <stdio.h>        // printf
+#include <string.h>
+#include <fcntl.h>        // open
+#include <unistd.h>       // write
+#include <errno.h>        // errno
+
+#define HCI_DUMP_FLIGHT_RECORDER_MAX_PATH_LEN 256
+
+static uint8_t * hci_dump_flight_recorder_buffer;
+static uint32_t  hci_dump_flight_recorder_size;
+// start of oldest record and number of used bytes
+static uint32_t  hci_dump_flight_recorder_start;
+static uint32_t  hci_dump_flight_recorder_used;
+static uint32_t  hci_dump_flight_recorder_dropped_packets;
+static int       hci_dump_flight_recorder_format;
+
+static uint8_t   hci_dump_flight_recorder_triggers;
+static char      hci_dump_flight_recorder_path_prefix[HCI_DUMP_FLIGHT_RECORDER_MAX_PATH_LEN];
+static uint16_t  hci_dump_flight_recorder_trace_nr;
+
+static char      hci_dump_flight_recorder_log_message_buffer[256];
+
+static uint8_t hci_dump_flight_recorder_get_byte(uint32_t offset){
+    return hci_dump_flight_recorder_buffer[(hci_dump_flight_recorder_start + offset) % hci_dump_flight_recorder_size];
+}
+
+// get size of oldest record from its header
+static uint32_t hci_dump_flight_recorder_oldest_record_size(void){
+    uint8_t header[8];
+    uint8_t i;
+    for (i = 0; i < sizeof(header); i++){
+        header[i] = hci_dump_flight_recorder_get_byte(i);
+    }
+    switch (hci_dump_flight_recorder_format){
+        case HCI_DUMP_BLUEZ:
+            // len includes packet type
+            return HCI_DUMP_HEADER_SIZE_BLUEZ - 1u + little_endian_read_16(header, 0);
+        case HCI_DUMP_PACKETLOGGER:
+            // len includes header without len field
+            return 4u + big_endian_read_32(header, 0);
+        case HCI_DUMP_BTSNOOP:
+            // included length
+            return HCI_DUMP_HEADER_SIZE_BTSNOOP + big_endian_read_32(header, 4);
+        default:
+            btstack_unreachable();
+            return hci_dump_flight_recorder_used;
+    }
+}
+
+static void hci_dump_flight_recorder_store(const uint8_t * data, uint16_t len){
+    uint32_t offset = (hci_dump_flight_recorder_start + hci_dump_flight_recorder_used) % hci_dump_flight_recorder_size;
+    uint32_t bytes_until_wrap = hci_dump_flight_recorder_size - offset;
+    if (len <= bytes_until_wrap){
+        (void)memcpy(&hci_dump_flight_recorder_buffer[offset], data, len);
+    } else {
+        (void)memcpy(&hci_dump_flight_recorder_buffer[offset], data, bytes_until_wrap);
+        (void)memcpy(&hci_dump_flight_recorder_buffer[0], &data[bytes_until_wrap], len - bytes_until_wrap);
+    }
+    hci_dump_flight_recorder_used += len;
+}
+
+static void hci_dump_flight_recorder_add_record(const uint8_t * header, uint16_t header_len, const uint8_t * packet, uint16_t len){
+    uint32_t record_size = (uint32_t) header_len + len;
+    if (record_size > hci_dump_flight_recorder_size){
+        hci_dump_flight_recorder_dropped_packets++;
+        return;
+    }
+    // discard oldest records
+    while ((hci_dump_flight_recorder_size - hci_dump_flight_recorder_used) < record_size){
+        uint32_t oldest_size = hci_dump_flight_recorder_oldest_record_size();
+        hci_dump_flight_recorder_start = (hci_dump_flight_recorder_start + oldest_size) % hci_dump_flight_recorder_size;
+        hci_dump_flight_recorder_used -= oldest_size;
+    }
+    hci_dump_flight_recorder_store(header, header_len);
+    hci_dump_flight_recorder_store(packet, len);
+}
+
+static bool hci_dump_flight_recorder_is_trigger(uint8_t packet_type, const uint8_t * packet, uint16_t len){
+    if (packet_type != HCI_EVENT_PACKET) return false;
+    if (len < 2) return false;
+    switch (packet[0]){
+        case HCI_EVENT_HARDWARE_ERROR:
+            return (hci_dump_flight_recorder_triggers & HCI_DUMP_FLIGHT_RECORDER_TRIGGER_HARDWARE_ERROR) != 0u;
+        case HCI_EVENT_DISCONNECTION_COMPLETE:
+            if ((hci_dump_flight_recorder_triggers & HCI_DUMP_FLIGHT_RECORDER_TRIGGER_DISCONNECT) == 0u) return false;
+            if (len < 6) return false;
+            switch (packet[5]){
+                case ERROR_CODE_REMOTE_USER_TERMINATED_CONNECTION:
+                case ERROR_CODE_REMOTE_DEVICE_TERMINATED_CONNECTION_DUE_TO_LOW_RESOURCES:
+                case ERROR_CODE_REMOTE_DEVICE_TERMINATED_CONNECTION_DUE_TO_POWER_OFF:
+                case ERROR_CODE_CONNECTION_TERMINATED_BY_LOCAL_HOST:
+                    return false;
+                default:
+                    return true;
+            }
+        default:
+            return false;
+    }
+}
+
+static void hci_dump_flight_recorder_reset(void){
+    hci_dump_posix_flight_recorder_clear();
+}
+
+static void hci_dump_flight_recorder_log_truncated_packet(uint8_t packet_type, uint8_t in, uint8_t *packet, uint16_t len, uint16_t original_len) {
+    if (hci_dump_flight_recorder_buffer == NULL) return;
+
+    union {
+        uint8_t header_bluez[HCI_DUMP_HEADER_SIZE_BLUEZ];
+        uint8_t header_packetlogger[HCI_DUMP_HEADER_SIZE_PACKETLOGGER];
+        uint8_t header_btsnoop[HCI_DUMP_HEADER_SIZE_BTSNOOP+1];
+    } header;
+
+    uint32_t tv_sec = 0;
+    uint32_t tv_us  = 0;
+    uint64_t ts_usec;
+
+    // get time
+    struct timeval curr_time;
+    gettimeofday(&curr_time, NULL);
+    tv_sec = curr_time.tv_sec;
+    tv_us  = curr_time.tv_usec;
+
+    uint16_t header_len = 0;
+    switch (hci_dump_flight_recorder_format){
+        case HCI_DUMP_BLUEZ:
+            // ISO packets not supported
+            if (packet_type == HCI_ISO_DATA_PACKET) return;
+            hci_dump_setup_header_bluez(header.header_bluez, tv_sec, tv_us, packet_type, in, len);
+            header_len = HCI_DUMP_HEADER_SIZE_BLUEZ;
+            break;
+        case HCI_DUMP_PACKETLOGGER:
+            // ISO packets not supported
+            if (packet_type == HCI_ISO_DATA_PACKET) return;
+            hci_dump_setup_header_packetlogger(header.header_packetlogger, tv_sec, tv_us, packet_type, in, len);
+            header_len = HCI_DUMP_HEADER_SIZE_PACKETLOGGER;
+            break;
+        case HCI_DUMP_BTSNOOP:
+            // log messages not supported
+            if (packet_type == LOG_MESSAGE_PACKET) return;
+            ts_usec = 0xdcddb30f2f8000LLU + 1000000LLU * curr_time.tv_sec + curr_time.tv_usec;
+            // append packet type to pcap header
+            hci_dump_setup_header_btsnoop_truncated(header.header_btsnoop, ts_usec >> 32, ts_usec & 0xFFFFFFFF, hci_dump_flight_recorder_dropped_packets, packet_type, in, len+1, original_len+1);
+            header.header_btsnoop[HCI_DUMP_HEADER_SIZE_BTSNOOP] = packet_type;
+            header_len = HCI_DUMP_HEADER_SIZE_BTSNOOP + 1;
+            break;
+        default:
+            btstack_unreachable();
+            return;
+    }
+
+    hci_dump_flight_recorder_add_record((const uint8_t *) &header, header_len, packet, len);
+
+    if (hci_dump_flight_recorder_is_trigger(packet_type, packet, len)){
+        (void) hci_dump_posix_flight_recorder_trigger();
+    }
+}
+
+static void hci_dump_flight_recorder_log_packet(uint8_t packet_type, uint8_t in, uint8_t *packet, uint16_t len) {
+    hci_dump_flight_recorder_log_truncated_packet(packet_type, in, packet, len, len);
+}
+
+static void hci_dump_flight_recorder_log_message(int log_level, const char * format, va_list argptr){
+    if (hci_dump_flight_recorder_buffer == NULL) return;
+    int len = vsnprintf(hci_dump_flight_recorder_log_message_buffer, sizeof(hci_dump_flight_recorder_log_message_buffer), format, argptr);
+    if (len < 0) return;
+    len = btstack_min(len, sizeof(hci_dump_flight_recorder_log_message_buffer) - 1);
+    hci_dump_flight_recorder_log_packet(LOG_MESSAGE_PACKET, 0, (uint8_t*) hci_dump_flight_recorder_log_message_buffer, (uint16_t) len);
+    if ((log_level == HCI_DUMP_LOG_LEVEL_ERROR) && ((hci_dump_flight_recorder_triggers & HCI_DUMP_FLIGHT_RECORDER_TRIGGER_LOG_ERROR) != 0u)){
+        (void) hci_dump_posix_flight_recorder_trigger();
+    }
+}
+
+void hci_dump_posix_flight_recorder_init(uint8_t * buffer, uint32_t size, hci_dump_format_t format){
+    btstack_assert(format == HCI_DUMP_BLUEZ || format == HCI_DUMP_PACKETLOGGER || format == HCI_DUMP_BTSNOOP);
+    hci_dump_flight_recorder_buffer = buffer;
+    hci_dump_flight_recorder_size   = size;
+    hci_dump_flight_recorder_format = format;
+    hci_dump_flight_recorder_triggers = 0;
+    hci_dump_flight_recorder_trace_nr = 0;
+    hci_dump_flight_recorder_path_prefix[0] = 0;
+    hci_dump_posix_flight_recorder_clear();
+}
+
+void hci_dump_posix_flight_recorder_set_triggers(const char * path_prefix, uint8_t triggers){
+    btstack_strcpy(hci_dump_flight_recorder_path_prefix, sizeof(hci_dump_flight_recorder_path_prefix), path_prefix);
+    hci_dump_flight_recorder_triggers = triggers;
+}
+
+void hci_dump_posix_flight_recorder_clear(void){
+    hci_dump_flight_recorder_start = 0;
+    hci_dump_flight_recorder_used  = 0;
+    hci_dump_flight_recorder_dropped_packets = 0;
+}
+
+// returns system errno
+int hci_dump_posix_flight_recorder_write(const char * filename){
+    if (hci_dump_flight_recorder_buffer == NULL) return EINVAL;
+
+    int oflags = O_WRONLY | O_CREAT | O_TRUNC;
+#ifdef _WIN32
+    oflags |= O_BINARY;
+#endif
+    int dump_file = open(filename, oflags, S_IRUSR | S_IWUSR | S_IRGRP | S_IROTH );
+    if (dump_file < 0){
+        printf("failed to open file %s, errno = %d\n", filename, errno);
+        return errno;
+    }
+
+    ssize_t bytes_written;
+    if (hci_dump_flight_recorder_format == HCI_DUMP_BTSNOOP){
+        // write BTSnoop file header
+        const uint8_t file_header[] = {
+            // Identification Pattern: "btsnoop\0"
+            0x62, 0x74, 0x73, 0x6E, 0x6F, 0x6F, 0x70, 0x00,
+            // Version: 1
+            0x00, 0x00, 0x00, 0x01,
+            // Datalink Type: 1002 - H4
+            0x00, 0x00, 0x03, 0xEA,
+        };
+        bytes_written = write(dump_file, &file_header, sizeof(file_header));
+        UNUSED(bytes_written);
+    }
+
+    // write recorded trace, might wrap around
+    uint32_t bytes_until_wrap = hci_dump_flight_recorder_size - hci_dump_flight_recorder_start;
+    uint32_t first_len = btstack_min(hci_dump_flight_recorder_used, bytes_until_wrap);
+    bytes_written = write(dump_file, &hci_dump_flight_recorder_buffer[hci_dump_flight_recorder_start], first_len);
+    UNUSED(bytes_written);
+    if (first_len < hci_dump_flight_recorder_used){
+        bytes_written = write(dump_file, &hci_dump_flight_recorder_buffer[0], hci_dump_flight_recorder_used - first_len);
+        UNUSED(bytes_written);
+    }
+
+    close(dump_file);
+    return 0;
+}
+
+int hci_dump_posix_flight_recorder_trigger(void){
+    if (hci_dump_flight_recorder_path_prefix[0] == 0) return EINVAL;
+    char filename[HCI_DUMP_FLIGHT_RECORDER_MAX_PATH_LEN + 8];
+    snprintf(filename, sizeof(filename), "%s-%u", hci_dump_flight_recorder_path_prefix, hci_dump_flight_recorder_trace_nr);
+    hci_dump_flight_recorder_trace_nr++;
+    return hci_dump_posix_flight_recorder_write(filename);
+}
+
+const hci_dump_t * hci_dump_posix_flight_recorder_get_instance(void){
+    static const hci_dump_t hci_dump_instance = {
+        // void (*reset)(void);
+        &hci_dump_flight_recorder_reset,
+        // void (*log_packet)(uint8_t packet_type, uint8_t in, uint8_t *packet, uint16_t len);
+        &hci_dump_flight_recorder_log_packet,
+        // void (*log_message)(int log_level, const char * format, va_list argptr);
+        &hci_dump_flight_recorder_log_message,
+        // void (*log_truncated_packet)(uint8_t packet_type, uint8_t in, uint8_t *packet, uint16_t len, uint16_t original_len);
+        &hci_dump_flight_recorder_log_truncated_packet,
+    };
+    return &hci_dump_instance;
+}
@@ -0,0 +1,104 @@
+/*
+ * Copyright (C) 2024 BlueKitchen GmbH
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holders nor the names of
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ * 4. Any redistribution, use, or modification is done solely for
+ *    personal benefit and not for any commercial purpose or for
+ *    monetary gain.
+ *
+ * THIS SOFTWARE IS PROVIDED BY BLUEKITCHEN GMBH AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL BLUEKITCHEN
+ * GMBH OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF
+ * THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ *
+ * Please inquire about commercial licensing options at
+ * contact@bluekitchen-gmbh.com
+ *
+ */
+
+/*
+ *  Keep recent HCI trace in memory and write it into file when triggered
+ */
+
+#ifndef HCI_DUMP_POSIX_FLIGHT_RECORDER_H
+#define HCI_DUMP_POSIX_FLIGHT_RECORDER_H
+
+#include <stdint.h>
+#include "hci_dump.h"
+
+#if defined __cplusplus
+extern "C" {
+#endif
+
+/* API_START */
+
+// events that trigger a write of the recorded trace
+#define HCI_DUMP_FLIGHT_RECORDER_TRIGGER_HARDWARE_ERROR      0x01u
+#define HCI_DUMP_FLIGHT_RECORDER_TRIGGER_DISCONNECT          0x02u
+#define HCI_DUMP_FLIGHT_RECORDER_TRIGGER_LOG_ERROR           0x04u
+
+/**
+ * @brief Get HCI Dump POSIX Flight Recorder Instance
+ * @return hci_dump_impl
+ */
+const hci_dump_t * hci_dump_posix_flight_recorder_get_instance(void);
+
+/**
+ * @brief Init Flight Recorder with preallocated buffer. Oldest packets are discarded if buffer is full
+ * @param buffer
+ * @param size of buffer
+ * @param format HCI_DUMP_BLUEZ, HCI_DUMP_PACKETLOGGER or HCI_DUMP_BTSNOOP
+ */
+void hci_dump_posix_flight_recorder_init(uint8_t * buffer, uint32_t size, hci_dump_format_t format);
+
+/**
+ * @brief Configure automatic triggers
+ * @note Disconnect trigger ignores regular reasons: remote user terminated, low resources, power off and local host terminated
+ * @param path_prefix for trace files, written as <path_prefix>-<nr>
+ * @param triggers bit mask of HCI_DUMP_FLIGHT_RECORDER_TRIGGER_*
+ */
+void hci_dump_posix_flight_recorder_set_triggers(const char * path_prefix, uint8_t triggers);
+
+/**
+ * @brief Write recorded trace to next file <path_prefix>-<nr>, e.g. from btstack_assert_failed
+ * @returns 0 if ok, errno otherwise
+ */
+int hci_dump_posix_flight_recorder_trigger(void);
+
+/**
+ * @brief Write recorded trace into file. Recording continues
+ * @param filename or path
+ * @returns 0 if ok, errno otherwise
+ */
+int hci_dump_posix_flight_recorder_write(const char * filename);
+
+/**
+ * @brief Discard recorded trace
+ */
+void hci_dump_posix_flight_recorder_clear(void);
+
+/* API_END */
+
+#if defined __cplusplus
+}
+#endif
+#endif // HCI_DUMP_POSIX_FLIGHT_RECORDER_H
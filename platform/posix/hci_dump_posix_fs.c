@@ -109,7 +109,7 @@ static uint16_t hci_dump_iso_summary(uint8_t in,  uint8_t *packet, uint16_t len)
     }
 }
 
-static void hci_dump_posix_fs_log_packet(uint8_t packet_type, uint8_t in, uint8_t *packet, uint16_t len) {
+static void hci_dump_posix_fs_log_truncated_packet(uint8_t packet_type, uint8_t in, uint8_t *packet, uint16_t len, uint16_t original_len) {
     if (dump_file < 0) return;
 
     static union {
@@ -155,7 +155,7 @@ static void hci_dump_posix_fs_log_packet(uint8_t packet_type, uint8_t in, uint8_
             if (packet_type == LOG_MESSAGE_PACKET) return;
             ts_usec = 0xdcddb30f2f8000LLU + 1000000LLU * curr_time.tv_sec + curr_time.tv_usec;
             // append packet type to pcap header
-            hci_dump_setup_header_btsnoop(header.header_btsnoop, ts_usec >> 32, ts_usec & 0xFFFFFFFF, 0, packet_type, in, len+1);
+            hci_dump_setup_header_btsnoop_truncated(header.header_btsnoop, ts_usec >> 32, ts_usec & 0xFFFFFFFF, 0, packet_type, in, len+1, original_len+1);
             header.header_btsnoop[HCI_DUMP_HEADER_SIZE_BTSNOOP] = packet_type;
             header_len = HCI_DUMP_HEADER_SIZE_BTSNOOP + 1;
             break;
@@ -171,6 +171,10 @@ static void hci_dump_posix_fs_log_packet(uint8_t packet_type, uint8_t in, uint8_
     UNUSED(bytes_written);
 }
 
+static void hci_dump_posix_fs_log_packet(uint8_t packet_type, uint8_t in, uint8_t *packet, uint16_t len) {
+    hci_dump_posix_fs_log_truncated_packet(packet_type, in, packet, len, len);
+}
+
 static void hci_dump_posix_fs_log_message(int log_level, const char * format, va_list argptr){
     UNUSED(log_level);
     if (dump_file < 0) return;
@@ -222,6 +226,8 @@ const hci_dump_t * hci_dump_posix_fs_get_instance(void){
         &hci_dump_posix_fs_log_packet,
         // void (*log_message)(int log_level, const char * format, va_list argptr);
         &hci_dump_posix_fs_log_message,
+        // void (*log_truncated_packet)(uint8_t packet_type, uint8_t in, uint8_t *packet, uint16_t len, uint16_t original_len);
+        &hci_dump_posix_fs_log_truncated_packet,
     };
     return &hci_dump_instance;
 }
@@ -179,3 +179,165 @@ bool ad_data_contains_uuid128(uint8_t ad_len, const uint8_t * ad_data, const uin
     return false;
 }
 
+
+// returns offset + 1 of first AD Structure with given type, 0 if not present
+static uint8_t ad_index_get_first(const ad_index_t * index, uint8_t data_type){
+    if (data_type == BLUETOOTH_DATA_TYPE_MANUFACTURER_SPECIFIC_DATA){
+        return index->manufacturer_specific_data_offset;
+    }
+    if (data_type >= AD_INDEX_NUM_TYPES){
+        // not indexed, find first
+        ad_context_t context;
+        for (ad_iterator_init(&context, index->length, index->data) ; ad_iterator_has_more(&context) ; ad_iterator_next(&context)){
+            if (ad_iterator_get_data_type(&context) == data_type){
+                return context.offset + 1u;
+            }
+        }
+        return 0;
+    }
+    return index->type_offsets[data_type];
+}
+
+// returns offset + 1 of next AD Structure with same type, 0 if none
+static uint8_t ad_index_get_next(const ad_index_t * index, uint8_t data_type, uint8_t current){
+    bool repeated;
+    if (data_type == BLUETOOTH_DATA_TYPE_MANUFACTURER_SPECIFIC_DATA){
+        repeated = index->manufacturer_specific_data_repeated;
+    } else if (data_type >= AD_INDEX_NUM_TYPES){
+        repeated = true;
+    } else {
+        repeated = (index->repeated_types[data_type >> 3] & (1u << (data_type & 7u))) != 0u;
+    }
+    if (repeated == false){
+        return 0;
+    }
+    ad_context_t context;
+    ad_iterator_init(&context, index->length, index->data);
+    context.offset = current - 1u;
+    for (ad_iterator_next(&context) ; ad_iterator_has_more(&context) ; ad_iterator_next(&context)){
+        if (ad_iterator_get_data_type(&context) == data_type){
+            return context.offset + 1u;
+        }
+    }
+    return 0;
+}
+
+void ad_index_init(ad_index_t * index, uint8_t ad_len, const uint8_t * ad_data){
+    memset(index, 0, sizeof(ad_index_t));
+    index->data   = ad_data;
+    index->length = ad_len;
+    ad_context_t context;
+    for (ad_iterator_init(&context, ad_len, ad_data) ; ad_iterator_has_more(&context) ; ad_iterator_next(&context)){
+        uint8_t data_type = ad_iterator_get_data_type(&context);
+        uint8_t offset = context.offset + 1u;
+        if (data_type == BLUETOOTH_DATA_TYPE_MANUFACTURER_SPECIFIC_DATA){
+            if (index->manufacturer_specific_data_offset == 0u){
+                index->manufacturer_specific_data_offset = offset;
+            } else {
+                index->manufacturer_specific_data_repeated = true;
+            }
+        } else if (data_type < AD_INDEX_NUM_TYPES){
+            if (index->type_offsets[data_type] == 0u){
+                index->type_offsets[data_type] = offset;
+            } else {
+                index->repeated_types[data_type >> 3] |= (uint8_t) (1u << (data_type & 7u));
+            }
+        }
+    }
+}
+
+const uint8_t * ad_index_get_data(const ad_index_t * index, uint8_t data_type, uint8_t * data_len){
+    uint8_t offset = ad_index_get_first(index, data_type);
+    if (offset == 0u){
+        return NULL;
+    }
+    *data_len = index->data[offset - 1u] - 1u;
+    return &index->data[offset + 1u];
+}
+
+bool ad_index_contains(const ad_index_t * index, uint8_t data_type){
+    return ad_index_get_first(index, data_type) != 0u;
+}
+
+static bool ad_index_uuid16_in_list(const uint16_t * uuids16, uint8_t num_uuids16, uint16_t uuid16){
+    uint8_t i;
+    for (i = 0; i < num_uuids16; i++){
+        if (uuids16[i] == uuid16){
+            return true;
+        }
+    }
+    return false;
+}
+
+bool ad_index_contains_any_uuid16(const ad_index_t * index, const uint16_t * uuids16, uint8_t num_uuids16){
+    static const uint8_t list_types[] = {
+        BLUETOOTH_DATA_TYPE_INCOMPLETE_LIST_OF_16_BIT_SERVICE_CLASS_UUIDS,
+        BLUETOOTH_DATA_TYPE_COMPLETE_LIST_OF_16_BIT_SERVICE_CLASS_UUIDS,
+        BLUETOOTH_DATA_TYPE_INCOMPLETE_LIST_OF_128_BIT_SERVICE_CLASS_UUIDS,
+        BLUETOOTH_DATA_TYPE_COMPLETE_LIST_OF_128_BIT_SERVICE_CLASS_UUIDS,
+    };
+    // Bluetooth Base UUID in little endian, 16-bit UUID in bytes 12 and 13
+    uint8_t base_uuid[16], base_uuid_le[16];
+    uuid_add_bluetooth_prefix(base_uuid, 0);
+    reverse_128(base_uuid, base_uuid_le);
+
+    uint8_t type_index;
+    for (type_index = 0; type_index < sizeof(list_types); type_index++){
+        uint8_t data_type = list_types[type_index];
+        uint8_t offset;
+        for (offset = ad_index_get_first(index, data_type) ; offset != 0u ; offset = ad_index_get_next(index, data_type, offset)){
+            uint8_t data_len     = index->data[offset - 1u] - 1u;
+            const uint8_t * data = &index->data[offset + 1u];
+            uint8_t i;
+            if (type_index < 2u){
+                for (i = 0u; (i + 2u) <= data_len; i += 2u){
+                    if (ad_index_uuid16_in_list(uuids16, num_uuids16, little_endian_read_16(data, i))){
+                        return true;
+                    }
+                }
+            } else {
+                for (i = 0u; (i + 16u) <= data_len; i += 16u){
+                    const uint8_t * uuid128_le = &data[i];
+                    if (memcmp(uuid128_le, base_uuid_le, 12) != 0) continue;
+                    if (little_endian_read_16(uuid128_le, 14) != 0u) continue;
+                    if (ad_index_uuid16_in_list(uuids16, num_uuids16, little_endian_read_16(uuid128_le, 12))){
+                        return true;
+                    }
+                }
+            }
+        }
+    }
+    return false;
+}
+
+bool ad_index_contains_uuid128(const ad_index_t * index, const uint8_t * uuid128){
+    // input in big endian/network order, bluetooth data in little endian
+    uint8_t uuid128_le[16];
+    reverse_128(uuid128, uuid128_le);
+    if (uuid_has_bluetooth_prefix(uuid128) && (big_endian_read_16(uuid128, 0) == 0u)){
+        uint16_t uuid16 = (uint16_t) big_endian_read_16(uuid128, 2);
+        if (ad_index_contains_any_uuid16(index, &uuid16, 1)){
+            return true;
+        }
+    }
+    static const uint8_t list_types[] = {
+        BLUETOOTH_DATA_TYPE_INCOMPLETE_LIST_OF_128_BIT_SERVICE_CLASS_UUIDS,
+        BLUETOOTH_DATA_TYPE_COMPLETE_LIST_OF_128_BIT_SERVICE_CLASS_UUIDS,
+    };
+    uint8_t type_index;
+    for (type_index = 0; type_index < sizeof(list_types); type_index++){
+        uint8_t data_type = list_types[type_index];
+        uint8_t offset;
+        for (offset = ad_index_get_first(index, data_type) ; offset != 0u ; offset = ad_index_get_next(index, data_type, offset)){
+            uint8_t data_len     = index->data[offset - 1u] - 1u;
+            const uint8_t * data = &index->data[offset + 1u];
+            uint8_t i;
+            for (i = 0u; (i + 16u) <= data_len; i += 16u){
+                if (memcmp(uuid128_le, &data[i], 16) == 0) {
+                    return true;
+                }
+            }
+        }
+    }
+    return false;
+}
@@ -75,6 +75,66 @@ const uint8_t * ad_iterator_get_data(const ad_context_t * context);
 bool ad_data_contains_uuid16(uint8_t ad_len, const uint8_t * ad_data, uint16_t uuid16);
 bool ad_data_contains_uuid128(uint8_t ad_len, const uint8_t * ad_data, const uint8_t * uuid128);
 
+// AD Types 0x00..AD_INDEX_NUM_TYPES-1 and Manufacturer Specific Data are indexed
+#define AD_INDEX_NUM_TYPES 0x40
+
+/**
+ * Index of AD Structures in Advertising or Scan Response data, built in a single pass.
+ * Allows to check for multiple AD Types and UUIDs without re-parsing the data.
+ */
+typedef struct ad_index {
+    const uint8_t * data;
+    uint8_t   length;
+    // offset + 1 of first AD Structure for each AD Type, 0 if not present
+    uint8_t   type_offsets[AD_INDEX_NUM_TYPES];
+    uint8_t   manufacturer_specific_data_offset;
+    // AD Types that occur more than once, bit per type
+    uint8_t   repeated_types[AD_INDEX_NUM_TYPES / 8];
+    bool      manufacturer_specific_data_repeated;
+} ad_index_t;
+
+/**
+ * @brief Build index for AD data. The data needs to stay valid while the index is used
+ * @param index
+ * @param ad_len
+ * @param ad_data
+ */
+void ad_index_init(ad_index_t * index, uint8_t ad_len, const uint8_t * ad_data);
+
+/**
+ * @brief Get data of first AD Structure with given AD Type
+ * @param index
+ * @param data_type
+ * @param data_len
+ * @return pointer to AD Structure data or NULL if not present
+ */
+const uint8_t * ad_index_get_data(const ad_index_t * index, uint8_t data_type, uint8_t * data_len);
+
+/**
+ * @brief Check if AD Structure with given AD Type is present
+ * @param index
+ * @param data_type
+ * @return true if present
+ */
+bool ad_index_contains(const ad_index_t * index, uint8_t data_type);
+
+/**
+ * @brief Check if any of the given 16-bit UUIDs is contained in 16-bit or 128-bit Service UUID lists
+ * @param index
+ * @param uuids16 list of UUIDs
+ * @param num_uuids16
+ * @return true if at least one UUID was found
+ */
+bool ad_index_contains_any_uuid16(const ad_index_t * index, const uint16_t * uuids16, uint8_t num_uuids16);
+
+/**
+ * @brief Check if 128-bit UUID is contained in 16-bit or 128-bit Service UUID lists
+ * @param index
+ * @param uuid128 in big endian
+ * @return true if found
+ */
+bool ad_index_contains_uuid128(const ad_index_t * index, const uint8_t * uuid128);
+
 /* API_END */
 
 #if defined __cplusplus
@@ -47,7 +47,7 @@
 
 // LE Device DB Implementation storing entries in btstack_tlv
 
-// Local cache is used to keep track of deleted entries in TLV
+// RAM index keeps track of valid entries and their identification, only pairing data is read from TLV
 
 #define INVALID_ENTRY_ADDR_TYPE 0xff
 
@@ -93,8 +93,26 @@ typedef struct le_device_db_entry_t {
 #error "NVM_NUM_DEVICE_DB_ENTRIES must not be 0, please update in btstack_config.h"
 #endif
 
-// only stores if entry present
-static uint8_t  entry_map[NVM_NUM_DEVICE_DB_ENTRIES];
+#define LE_DEVICE_DB_TLV_INDEX_NONE 0xffffu
+
+// RAM index of stored entries, allows to add/lookup/evict without reading from TLV
+typedef struct {
+    uint32_t  seq_nr;
+    uint8_t   addr_type;    // INVALID_ENTRY_ADDR_TYPE if slot is unused
+    bd_addr_t addr;
+    sm_key_t  irk;
+    // valid entries: list ordered by seq_nr, unused slots: free list via lru_next
+    uint16_t  lru_prev;
+    uint16_t  lru_next;
+    // valid entries: chain of entries in same address hash bucket
+    uint16_t  hash_next;
+} le_device_db_tlv_index_entry_t;
+
+static le_device_db_tlv_index_entry_t index_entries[NVM_NUM_DEVICE_DB_ENTRIES];
+static uint16_t index_hash_buckets[NVM_NUM_DEVICE_DB_ENTRIES];
+static uint16_t index_lru_head;     // lowest seq_nr, evicted first
+static uint16_t index_lru_tail;     // highest seq_nr
+static uint16_t index_free_head;
 static uint32_t num_valid_entries;
 
 static const btstack_tlv_t * le_device_db_tlv_btstack_tlv_impl;
@@ -144,16 +162,117 @@ static bool le_device_db_tlv_delete(int index){
 	return true;
 }
 
+static uint16_t le_device_db_tlv_index_hash(uint8_t addr_type, const bd_addr_t addr){
+    uint32_t hash = addr_type;
+    uint8_t i;
+    for (i=0;i<6u;i++){
+        hash = (hash * 31u) + addr[i];
+    }
+    return (uint16_t) (hash % NVM_NUM_DEVICE_DB_ENTRIES);
+}
+
+static bool le_device_db_tlv_index_valid(int index){
+    return index_entries[index].addr_type != INVALID_ENTRY_ADDR_TYPE;
+}
+
+static int le_device_db_tlv_index_lookup(uint8_t addr_type, const bd_addr_t addr){
+    uint16_t index = index_hash_buckets[le_device_db_tlv_index_hash(addr_type, addr)];
+    while (index != LE_DEVICE_DB_TLV_INDEX_NONE){
+        le_device_db_tlv_index_entry_t * index_entry = &index_entries[index];
+        if ((index_entry->addr_type == addr_type) && (memcmp(index_entry->addr, addr, 6) == 0)){
+            return index;
+        }
+        index = index_entry->hash_next;
+    }
+    return -1;
+}
+
+static void le_device_db_tlv_index_free_push(uint16_t index){
+    index_entries[index].addr_type = INVALID_ENTRY_ADDR_TYPE;
+    index_entries[index].lru_next  = index_free_head;
+    index_free_head = index;
+}
+
+// insert after last entry with seq_nr <= entry's seq_nr, only walks the list during scan
+static void le_device_db_tlv_index_lru_insert(uint16_t index){
+    le_device_db_tlv_index_entry_t * index_entry = &index_entries[index];
+    uint16_t prev = index_lru_tail;
+    while ((prev != LE_DEVICE_DB_TLV_INDEX_NONE) && (index_entries[prev].seq_nr > index_entry->seq_nr)){
+        prev = index_entries[prev].lru_prev;
+    }
+    uint16_t next = (prev == LE_DEVICE_DB_TLV_INDEX_NONE) ? index_lru_head : index_entries[prev].lru_next;
+    index_entry->lru_prev = prev;
+    index_entry->lru_next = next;
+    if (prev == LE_DEVICE_DB_TLV_INDEX_NONE){
+        index_lru_head = index;
+    } else {
+        index_entries[prev].lru_next = index;
+    }
+    if (next == LE_DEVICE_DB_TLV_INDEX_NONE){
+        index_lru_tail = index;
+    } else {
+        index_entries[next].lru_prev = index;
+    }
+}
+
+static void le_device_db_tlv_index_insert(uint16_t index){
+    le_device_db_tlv_index_entry_t * index_entry = &index_entries[index];
+    uint16_t bucket = le_device_db_tlv_index_hash(index_entry->addr_type, index_entry->addr);
+    index_entry->hash_next = index_hash_buckets[bucket];
+    index_hash_buckets[bucket] = index;
+    le_device_db_tlv_index_lru_insert(index);
+}
+
+static void le_device_db_tlv_index_remove(uint16_t index){
+    le_device_db_tlv_index_entry_t * index_entry = &index_entries[index];
+
+    // unlink from hash bucket
+    uint16_t * link = &index_hash_buckets[le_device_db_tlv_index_hash(index_entry->addr_type, index_entry->addr)];
+    while (*link != LE_DEVICE_DB_TLV_INDEX_NONE){
+        if (*link == index){
+            *link = index_entry->hash_next;
+            break;
+        }
+        link = &index_entries[*link].hash_next;
+    }
+
+    // unlink from lru list
+    if (index_entry->lru_prev == LE_DEVICE_DB_TLV_INDEX_NONE){
+        index_lru_head = index_entry->lru_next;
+    } else {
+        index_entries[index_entry->lru_prev].lru_next = index_entry->lru_next;
+    }
+    if (index_entry->lru_next == LE_DEVICE_DB_TLV_INDEX_NONE){
+        index_lru_tail = index_entry->lru_prev;
+    } else {
+        index_entries[index_entry->lru_next].lru_prev = index_entry->lru_prev;
+    }
+}
+
 static void le_device_db_tlv_scan(void){
     int i;
     num_valid_entries = 0;
-    memset(entry_map, 0, sizeof(entry_map));
+    index_lru_head  = LE_DEVICE_DB_TLV_INDEX_NONE;
+    index_lru_tail  = LE_DEVICE_DB_TLV_INDEX_NONE;
+    index_free_head = LE_DEVICE_DB_TLV_INDEX_NONE;
+    for (i=0;i<NVM_NUM_DEVICE_DB_ENTRIES;i++){
+        index_hash_buckets[i] = LE_DEVICE_DB_TLV_INDEX_NONE;
+    }
     for (i=0;i<NVM_NUM_DEVICE_DB_ENTRIES;i++){
         // lookup entry
         le_device_db_entry_t entry;
-        if (!le_device_db_tlv_fetch(i, &entry)) continue;
+        if (!le_device_db_tlv_fetch(i, &entry)) {
+            // free list is used highest index first
+            le_device_db_tlv_index_free_push((uint16_t) i);
+            continue;
+        }
 
-        entry_map[i] = 1;
+        le_device_db_tlv_index_entry_t * index_entry = &index_entries[i];
+        index_entry->seq_nr    = entry.seq_nr;
+        index_entry->addr_type = (uint8_t) entry.addr_type;
+        (void)memcpy(index_entry->addr, entry.addr, 6);
+        (void)memcpy(index_entry->irk, entry.irk, 16);
+        le_device_db_tlv_index_insert((uint16_t) i);
         num_valid_entries++;
     }
     log_info("num valid le device entries %u", (unsigned int) num_valid_entries);
@@ -184,13 +303,14 @@ void le_device_db_remove(int index){
     btstack_assert(index < le_device_db_max_count());
     
     // check if entry exists
-    if (entry_map[index] == 0u) return; 
+    if (!le_device_db_tlv_index_valid(index)) return;
 
 	// delete entry in TLV
 	le_device_db_tlv_delete(index);
 
 	// mark as unused
-    entry_map[index] = 0;
+    le_device_db_tlv_index_remove((uint16_t) index);
+    le_device_db_tlv_index_free_push((uint16_t) index);
 
     // keep track
     num_valid_entries--;
@@ -199,35 +319,20 @@ void le_device_db_remove(int index){
 int le_device_db_add(int addr_type, bd_addr_t addr, sm_key_t irk){
 
     uint32_t highest_seq_nr = 0;
-    uint32_t lowest_seq_nr  = 0xFFFFFFFFU;
-    int index_for_lowest_seq_nr = -1;
     int index_for_addr  = -1;
     int index_for_empty = -1;
+    int index_for_lowest_seq_nr = -1;
     bool new_entry = false;
 
-	// find unused entry in the used list
-    int i;
-    for (i=0;i<NVM_NUM_DEVICE_DB_ENTRIES;i++){
-         if (entry_map[i] != 0u) {
-            le_device_db_entry_t entry;
-            le_device_db_tlv_fetch(i, &entry);
-            // found addr?
-            if ((memcmp(addr, entry.addr, 6) == 0) && (addr_type == entry.addr_type)){
-                index_for_addr = i;
-            }
-            // update highest seq nr
-            if (entry.seq_nr > highest_seq_nr){
-                highest_seq_nr = entry.seq_nr;
-            }
-            // find entry with lowest seq nr
-            if ((index_for_lowest_seq_nr == -1) || (entry.seq_nr < lowest_seq_nr)){
-                index_for_lowest_seq_nr = i;
-                lowest_seq_nr = entry.seq_nr;
-            }
-        } else {
-            index_for_empty = i;
-        }
+    // entry with highest seq nr is at the end of the lru list
+    if (index_lru_tail != LE_DEVICE_DB_TLV_INDEX_NONE){
+        highest_seq_nr = index_entries[index_lru_tail].seq_nr;
+        index_for_lowest_seq_nr = index_lru_head;
+    }
+    if (index_free_head != LE_DEVICE_DB_TLV_INDEX_NONE){
+        index_for_empty = index_free_head;
     }
+    index_for_addr = le_device_db_tlv_index_lookup((uint8_t) addr_type, addr);
 
     log_info("index_for_addr %x, index_for_empy %x, index_for_lowest_seq_nr %x", index_for_addr, index_for_empty, index_for_lowest_seq_nr);
 
@@ -267,8 +372,19 @@ int le_device_db_add(int addr_type, bd_addr_t addr, sm_key_t irk){
         log_error("tag store failed");
         return -1;
     }
-    // set in entry_mape
-    entry_map[index_to_use] = 1;
+
+    // update index: drop previous entry in slot, re-insert as most recent one
+    if (new_entry){
+        index_free_head = index_entries[index_to_use].lru_next;
+    } else {
+        le_device_db_tlv_index_remove((uint16_t) index_to_use);
+    }
+    le_device_db_tlv_index_entry_t * index_entry = &index_entries[index_to_use];
+    index_entry->seq_nr    = entry.seq_nr;
+    index_entry->addr_type = (uint8_t) addr_type;
+    (void)memcpy(index_entry->addr, addr, 6);
+    (void)memcpy(index_entry->irk, irk, 16);
+    le_device_db_tlv_index_insert((uint16_t) index_to_use);
 
     // keep track - don't increase if old entry found or replaced
     if (new_entry){
@@ -281,21 +397,29 @@ int le_device_db_add(int addr_type, bd_addr_t addr, sm_key_t irk){
 
 // get device information: addr type and address
 void le_device_db_info(int index, int * addr_type, bd_addr_t addr, sm_key_t irk){
+    btstack_assert(index >= 0);
+    btstack_assert(index < NVM_NUM_DEVICE_DB_ENTRIES);
 
-	// fetch entry
-    le_device_db_entry_t entry;
-    int ok = le_device_db_tlv_fetch(index, &entry);
+    // served from RAM index
+    const le_device_db_tlv_index_entry_t * index_entry = &index_entries[index];
+    bool ok = le_device_db_tlv_index_valid(index);
 
-    // set defaults if not found
-    if (!ok) {
-        memset(&entry, 0, sizeof(le_device_db_entry_t));
-        entry.addr_type = BD_ADDR_TYPE_UNKNOWN;
+    // setup return values, use defaults if not found
+    if (addr_type != NULL) *addr_type = ok ? (int) index_entry->addr_type : (int) BD_ADDR_TYPE_UNKNOWN;
+    if (addr != NULL) {
+        if (ok) {
+            (void)memcpy(addr, index_entry->addr, 6);
+        } else {
+            memset(addr, 0, 6);
+        }
+    }
+    if (irk != NULL) {
+        if (ok) {
+            (void)memcpy(irk, index_entry->irk, 16);
+        } else {
+            memset(irk, 0, 16);
+        }
     }
-
-    // setup return values
-    if (addr_type != NULL) *addr_type = entry.addr_type;
-    if (addr != NULL) (void)memcpy(addr, entry.addr, 6);
-    if (irk != NULL) (void)memcpy(irk, entry.irk, 16);
 }
 
 void le_device_db_encryption_set(int index, uint16_t ediv, uint8_t rand[8], sm_key_t ltk, int key_size, int authenticated, int authorized, int secure_connection){
@@ -462,7 +586,7 @@ void le_device_db_dump(void){
     uint32_t i;
 
     for (i=0;i<NVM_NUM_DEVICE_DB_ENTRIES;i++){
-        if (!entry_map[i]) continue;
+        if (!le_device_db_tlv_index_valid(i)) continue;
 		// fetch entry
 		le_device_db_entry_t entry;
 		le_device_db_tlv_fetch(i, &entry);
@@ -0,0 +1,325 @@
+/*
+ * Copyright (C) 2024 BlueKitchen GmbH
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holders nor the names of
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ * 4. Any redistribution, use, or modification is done solely for
+ *    personal benefit and not for any commercial purpose or for
+ *    monetary gain.
+ *
+ * THIS SOFTWARE IS PROVIDED BY BLUEKITCHEN GMBH AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL BLUEKITCHEN
+ * GMBH OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF
+ * THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ *
+ * Please inquire about commercial licensing options at
+ * contact@bluekitchen-gmbh.com
+ *
+ */
+
+#define BTSTACK_FILE__ "le_scan_pipeline.c"
+
+#include "btstack_config.h"
+
+#include <string.h>
+
+#include "ble/le_scan_pipeline.h"
+
+#include "ad_parser.h"
+#include "btstack_debug.h"
+#include "btstack_defines.h"
+#include "btstack_event.h"
+#include "btstack_ring_buffer.h"
+#include "btstack_run_loop.h"
+#include "btstack_util.h"
+#include "hci.h"
+
+#ifdef ENABLE_LE_CENTRAL
+
+// number of slots checked in duplicate table starting at hashed slot
+#define LE_SCAN_PIPELINE_DUPLICATE_PROBE_LEN 4
+
+static btstack_ring_buffer_t le_scan_pipeline_ring_buffer;
+static void (*le_scan_pipeline_callback)(uint16_t num_reports);
+static uint16_t le_scan_pipeline_num_reports_queued;
+
+static const le_scan_pipeline_address_t * le_scan_pipeline_addresses;
+static uint16_t le_scan_pipeline_num_addresses;
+
+static bool    le_scan_pipeline_ad_type_filter_active;
+static uint8_t le_scan_pipeline_ad_types[256 / 8];
+
+static le_scan_pipeline_duplicate_entry_t * le_scan_pipeline_duplicates;
+static uint16_t le_scan_pipeline_num_duplicates;
+static uint32_t le_scan_pipeline_duplicate_timeout_ms;
+
+static le_scan_pipeline_statistics_t le_scan_pipeline_statistics;
+
+static void le_scan_pipeline_handle_report(const uint8_t * event, uint16_t size);
+static void le_scan_pipeline_reports_complete(void);
+
+static const hci_le_advertising_report_handler_t le_scan_pipeline_report_handler = {
+    &le_scan_pipeline_handle_report,
+    &le_scan_pipeline_reports_complete
+};
+
+// extract fields from GAP Advertising Report or GAP Extended Advertising Report
+static bool le_scan_pipeline_parse_report(const uint8_t * event, uint16_t size, bd_addr_type_t * address_type,
+                                          bd_addr_t address, uint16_t * event_type, uint8_t * data_len, const uint8_t ** data){
+    uint16_t pos;
+    switch (hci_event_packet_get_type(event)){
+        case GAP_EVENT_ADVERTISING_REPORT:
+            if (size < 12u) return false;
+            *event_type   = event[2];
+            *address_type = (bd_addr_type_t) event[3];
+            pos = 4;
+            *data_len = event[11];
+            if ((12u + *data_len) > size) return false;
+            *data = &event[12];
+            break;
+        case GAP_EVENT_EXTENDED_ADVERTISING_REPORT:
+            if (size < 26u) return false;
+            *event_type   = little_endian_read_16(event, 2);
+            *address_type = (bd_addr_type_t) event[4];
+            pos = 5;
+            *data_len = event[25];
+            if ((26u + *data_len) > size) return false;
+            *data = &event[26];
+            break;
+        default:
+            return false;
+    }
+    reverse_bd_addr(&event[pos], address);
+    return true;
+}
+
+static bool le_scan_pipeline_address_accepted(bd_addr_type_t address_type, const bd_addr_t address){
+    if (le_scan_pipeline_num_addresses == 0u){
+        return true;
+    }
+    uint16_t i;
+    for (i = 0; i < le_scan_pipeline_num_addresses; i++){
+        const le_scan_pipeline_address_t * entry = &le_scan_pipeline_addresses[i];
+        if (entry->address_type != address_type) continue;
+        uint8_t prefix_len = entry->prefix_len;
+        if ((prefix_len == 0u) || (prefix_len > BD_ADDR_LEN)){
+            prefix_len = BD_ADDR_LEN;
+        }
+        if (memcmp(entry->address, address, prefix_len) == 0){
+            return true;
+        }
+    }
+    return false;
+}
+
+static bool le_scan_pipeline_ad_types_accepted(uint8_t data_len, const uint8_t * data){
+    if (le_scan_pipeline_ad_type_filter_active == false){
+        return true;
+    }
+    ad_context_t context;
+    for (ad_iterator_init(&context, data_len, data) ; ad_iterator_has_more(&context) ; ad_iterator_next(&context)){
+        uint8_t data_type = ad_iterator_get_data_type(&context);
+        if ((le_scan_pipeline_ad_types[data_type >> 3] & (1u << (data_type & 7u))) != 0u){
+            return true;
+        }
+    }
+    return false;
+}
+
+// returns true if report was seen before within timeout, otherwise stores it
+static bool le_scan_pipeline_is_duplicate(bd_addr_type_t address_type, const bd_addr_t address, uint16_t event_type,
+                                          uint8_t data_len, const uint8_t * data){
+    if (le_scan_pipeline_num_duplicates == 0u){
+        return false;
+    }
+
+    uint8_t header[2];
+    little_endian_store_16(header, 0, event_type);
+    uint32_t data_hash = btstack_crc32_init();
+    data_hash = btstack_crc32_update(data_hash, header, sizeof(header));
+    data_hash = btstack_crc32_update(data_hash, data, data_len);
+    data_hash = btstack_crc32_finalize(data_hash);
+
+    // slot based on address and data hash
+    uint32_t key_hash = btstack_crc32_update(data_hash, address, BD_ADDR_LEN) ^ (uint32_t) address_type;
+    uint16_t index = (uint16_t) (key_hash % le_scan_pipeline_num_duplicates);
+
+    uint32_t now = btstack_run_loop_get_time_ms();
+    le_scan_pipeline_duplicate_entry_t * candidate = NULL;
+    uint16_t i;
+    for (i = 0; (i < LE_SCAN_PIPELINE_DUPLICATE_PROBE_LEN) && (i < le_scan_pipeline_num_duplicates); i++){
+        le_scan_pipeline_duplicate_entry_t * entry = &le_scan_pipeline_duplicates[index];
+        index++;
+        if (index == le_scan_pipeline_num_duplicates){
+            index = 0;
+        }
+        if (entry->in_use == false){
+            if (candidate == NULL){
+                candidate = entry;
+            }
+            continue;
+        }
+        if ((entry->data_hash == data_hash) && (entry->address_type == address_type) && (bd_addr_cmp(entry->address, address) == 0)){
+            if ((le_scan_pipeline_duplicate_timeout_ms != 0u) && ((uint32_t)(now - entry->timestamp_ms) >= le_scan_pipeline_duplicate_timeout_ms)){
+                // aged: report again
+                entry->timestamp_ms = now;
+                return false;
+            }
+            return true;
+        }
+        // evict oldest entry in probe window if no free slot
+        if ((candidate == NULL) || (candidate->in_use && ((int32_t)(entry->timestamp_ms - candidate->timestamp_ms) < 0))){
+            candidate = entry;
+        }
+    }
+
+    btstack_assert(candidate != NULL);
+    candidate->in_use       = true;
+    candidate->timestamp_ms = now;
+    candidate->data_hash    = data_hash;
+    candidate->address_type = address_type;
+    bd_addr_copy(candidate->address, address);
+    return false;
+}
+
+static void le_scan_pipeline_handle_report(const uint8_t * event, uint16_t size){
+    le_scan_pipeline_statistics.num_received++;
+
+    bd_addr_type_t address_type;
+    bd_addr_t address;
+    uint16_t event_type;
+    uint8_t data_len;
+    const uint8_t * data;
+    if (le_scan_pipeline_parse_report(event, size, &address_type, address, &event_type, &data_len, &data) == false){
+        le_scan_pipeline_statistics.num_filtered++;
+        return;
+    }
+
+    // cheap filters first
+    if (le_scan_pipeline_address_accepted(address_type, address) == false){
+        le_scan_pipeline_statistics.num_filtered++;
+        return;
+    }
+    if (le_scan_pipeline_ad_types_accepted(data_len, data) == false){
+        le_scan_pipeline_statistics.num_filtered++;
+        return;
+    }
+    if (le_scan_pipeline_is_duplicate(address_type, address, event_type, data_len, data)){
+        le_scan_pipeline_statistics.num_duplicates++;
+        return;
+    }
+
+    // store complete report or drop it
+    if (btstack_ring_buffer_bytes_free(&le_scan_pipeline_ring_buffer) < size){
+        le_scan_pipeline_statistics.num_dropped++;
+        return;
+    }
+    btstack_ring_buffer_write(&le_scan_pipeline_ring_buffer, (uint8_t *) event, size);
+    le_scan_pipeline_num_reports_queued++;
+}
+
+static void le_scan_pipeline_reports_complete(void){
+    uint16_t num_reports = le_scan_pipeline_num_reports_queued;
+    if (num_reports == 0u){
+        return;
+    }
+    le_scan_pipeline_num_reports_queued = 0;
+    if (le_scan_pipeline_callback != NULL){
+        (*le_scan_pipeline_callback)(num_reports);
+    }
+}
+
+void le_scan_pipeline_init(uint8_t * storage, uint32_t storage_size){
+    btstack_ring_buffer_init(&le_scan_pipeline_ring_buffer, storage, storage_size);
+    le_scan_pipeline_num_reports_queued = 0;
+    memset(&le_scan_pipeline_statistics, 0, sizeof(le_scan_pipeline_statistics));
+    hci_set_le_advertising_report_handler(&le_scan_pipeline_report_handler);
+}
+
+void le_scan_pipeline_register_callback(void (*callback)(uint16_t num_reports)){
+    le_scan_pipeline_callback = callback;
+}
+
+void le_scan_pipeline_set_address_filter(const le_scan_pipeline_address_t * addresses, uint16_t num_addresses){
+    le_scan_pipeline_addresses = addresses;
+    le_scan_pipeline_num_addresses = (addresses != NULL) ? num_addresses : 0;
+}
+
+void le_scan_pipeline_set_ad_type_filter(const uint8_t * ad_types, uint8_t num_ad_types){
+    memset(le_scan_pipeline_ad_types, 0, sizeof(le_scan_pipeline_ad_types));
+    uint8_t i;
+    for (i = 0; i < num_ad_types; i++){
+        uint8_t ad_type = ad_types[i];
+        le_scan_pipeline_ad_types[ad_type >> 3] |= (uint8_t) (1u << (ad_type & 7u));
+    }
+    le_scan_pipeline_ad_type_filter_active = num_ad_types > 0u;
+}
+
+void le_scan_pipeline_set_duplicate_filter(le_scan_pipeline_duplicate_entry_t * entries, uint16_t num_entries, uint32_t timeout_ms){
+    le_scan_pipeline_duplicates = entries;
+    le_scan_pipeline_num_duplicates = (entries != NULL) ? num_entries : 0;
+    le_scan_pipeline_duplicate_timeout_ms = timeout_ms;
+    if (le_scan_pipeline_num_duplicates > 0u){
+        memset(entries, 0, le_scan_pipeline_num_duplicates * sizeof(le_scan_pipeline_duplicate_entry_t));
+    }
+}
+
+uint16_t le_scan_pipeline_get_report(uint8_t * buffer, uint16_t buffer_size){
+    while (btstack_ring_buffer_bytes_available(&le_scan_pipeline_ring_buffer) >= 2u){
+        uint8_t header[2];
+        uint32_t bytes_read;
+        btstack_ring_buffer_read(&le_scan_pipeline_ring_buffer, header, 2, &bytes_read);
+        uint16_t size = 2u + header[1];
+        if (size <= buffer_size){
+            buffer[0] = header[0];
+            buffer[1] = header[1];
+            btstack_ring_buffer_read(&le_scan_pipeline_ring_buffer, &buffer[2], header[1], &bytes_read);
+            return size;
+        }
+        // report does not fit into buffer, skip it
+        log_error("report size %u > buffer size %u", size, buffer_size);
+        le_scan_pipeline_statistics.num_dropped++;
+        uint8_t skip_buffer[32];
+        uint16_t bytes_to_skip = header[1];
+        while (bytes_to_skip > 0u){
+            uint16_t bytes_to_read = btstack_min(bytes_to_skip, sizeof(skip_buffer));
+            btstack_ring_buffer_read(&le_scan_pipeline_ring_buffer, skip_buffer, bytes_to_read, &bytes_read);
+            bytes_to_skip -= bytes_to_read;
+        }
+    }
+    return 0;
+}
+
+void le_scan_pipeline_get_statistics(le_scan_pipeline_statistics_t * statistics){
+    *statistics = le_scan_pipeline_statistics;
+}
+
+void le_scan_pipeline_deinit(void){
+    hci_set_le_advertising_report_handler(NULL);
+    le_scan_pipeline_callback = NULL;
+    le_scan_pipeline_addresses = NULL;
+    le_scan_pipeline_num_addresses = 0;
+    le_scan_pipeline_ad_type_filter_active = false;
+    le_scan_pipeline_duplicates = NULL;
+    le_scan_pipeline_num_duplicates = 0;
+}
+
+#endif
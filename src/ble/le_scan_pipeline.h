@@ -0,0 +1,158 @@
+/*
+ * Copyright (C) 2024 BlueKitchen GmbH
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holders nor the names of
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ * 4. Any redistribution, use, or modification is done solely for
+ *    personal benefit and not for any commercial purpose or for
+ *    monetary gain.
+ *
+ * THIS SOFTWARE IS PROVIDED BY BLUEKITCHEN GMBH AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL BLUEKITCHEN
+ * GMBH OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF
+ * THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ *
+ * Please inquire about commercial licensing options at
+ * contact@bluekitchen-gmbh.com
+ *
+ */
+
+/**
+ * @title LE Scan Pipeline
+ *
+ * Host-side processing of GAP Advertising Reports for dense scanning.
+ *
+ * Instead of emitting each GAP_EVENT_ADVERTISING_REPORT / GAP_EVENT_EXTENDED_ADVERTISING_REPORT
+ * to all registered event handlers, reports are passed through optional address, AD Type and
+ * duplicate filters. Surviving reports are stored in a ring buffer provided by the application,
+ * and the application is notified once per HCI LE Advertising Report event.
+ *
+ * Reports are stored in the same format as the GAP events, so the regular
+ * gap_event_advertising_report_* and gap_event_extended_advertising_report_* getters can be used.
+ *
+ * Note: while the pipeline is active, no GAP Advertising Reports are delivered via
+ * hci_add_event_handler, this includes other stack components like the Mesh ADV Bearer.
+ */
+
+#ifndef LE_SCAN_PIPELINE_H
+#define LE_SCAN_PIPELINE_H
+
+#include <stdint.h>
+
+#include "bluetooth.h"
+#include "btstack_bool.h"
+
+#if defined __cplusplus
+extern "C" {
+#endif
+
+// max size of a stored report: event type + len + max payload
+#define LE_SCAN_PIPELINE_MAX_REPORT_SIZE (2 + 255)
+
+/* API_START */
+
+typedef struct {
+    bd_addr_type_t address_type;
+    bd_addr_t      address;
+    // number of leading address bytes that have to match, e.g. 3 to match OUI. 0 or 6 match full address
+    uint8_t        prefix_len;
+} le_scan_pipeline_address_t;
+
+typedef struct {
+    uint32_t       timestamp_ms;
+    uint32_t       data_hash;
+    bd_addr_t      address;
+    bd_addr_type_t address_type;
+    bool           in_use;
+} le_scan_pipeline_duplicate_entry_t;
+
+typedef struct {
+    // reports received from HCI
+    uint32_t num_received;
+    // reports discarded by address or AD Type filter
+    uint32_t num_filtered;
+    // reports discarded by duplicate filter
+    uint32_t num_duplicates;
+    // reports dropped as ring buffer was full
+    uint32_t num_dropped;
+} le_scan_pipeline_statistics_t;
+
+/**
+ * @brief Init LE Scan Pipeline and take over delivery of GAP Advertising Reports
+ * @param storage for ring buffer, should hold several reports of up to LE_SCAN_PIPELINE_MAX_REPORT_SIZE bytes
+ * @param storage_size
+ */
+void le_scan_pipeline_init(uint8_t * storage, uint32_t storage_size);
+
+/**
+ * @brief Register callback that is called once per HCI event if new reports have been queued
+ * @param callback with number of newly queued reports
+ */
+void le_scan_pipeline_register_callback(void (*callback)(uint16_t num_reports));
+
+/**
+ * @brief Only accept reports from listed addresses
+ * @param addresses array, needs to stay valid while filter is active
+ * @param num_addresses or 0 to disable address filter
+ */
+void le_scan_pipeline_set_address_filter(const le_scan_pipeline_address_t * addresses, uint16_t num_addresses);
+
+/**
+ * @brief Only accept reports that contain at least one of the given AD Types
+ * @param ad_types list of AD Types, see bluetooth_data_types.h
+ * @param num_ad_types or 0 to disable AD Type filter
+ */
+void le_scan_pipeline_set_ad_type_filter(const uint8_t * ad_types, uint8_t num_ad_types);
+
+/**
+ * @brief Drop reports with identical address, event type and advertising data seen recently
+ * @param entries table provided by application, larger table reduces false reports for many devices
+ * @param num_entries or 0 to disable duplicate filter
+ * @param timeout_ms after which a duplicate is reported again, 0 = only report again after entry was evicted
+ */
+void le_scan_pipeline_set_duplicate_filter(le_scan_pipeline_duplicate_entry_t * entries, uint16_t num_entries, uint32_t timeout_ms);
+
+/**
+ * @brief Get next report from ring buffer
+ * @param buffer of at least LE_SCAN_PIPELINE_MAX_REPORT_SIZE bytes
+ * @param buffer_size
+ * @return size of GAP_EVENT_ADVERTISING_REPORT or GAP_EVENT_EXTENDED_ADVERTISING_REPORT, or 0 if ring buffer is empty
+ */
+uint16_t le_scan_pipeline_get_report(uint8_t * buffer, uint16_t buffer_size);
+
+/**
+ * @brief Get pipeline statistics
+ * @param statistics
+ */
+void le_scan_pipeline_get_statistics(le_scan_pipeline_statistics_t * statistics);
+
+/**
+ * @brief Stop pipeline and restore regular delivery of GAP Advertising Reports
+ */
+void le_scan_pipeline_deinit(void);
+
+/* API_END */
+
+#if defined __cplusplus
+}
+#endif
+
+#endif // LE_SCAN_PIPELINE_H
@@ -98,6 +98,7 @@
 #include "ble/gatt-service/tx_power_service_server.h"
 #include "ble/gatt_client.h"
 #include "ble/le_device_db.h"
+#include "ble/le_scan_pipeline.h"
 #include "ble/sm.h"
 #endif
 
@@ -122,6 +123,7 @@
 #include "classic/btstack_link_key_db.h"
 #include "classic/btstack_sbc.h"
 #include "classic/btstack_sbc_bluedroid.h"
+#include "classic/btstack_sco_engine.h"
 #include "classic/device_id_server.h"
 #include "classic/gatt_sdp.h"
 #include "classic/goep_client.h"
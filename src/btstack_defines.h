@@ -3160,6 +3160,19 @@ typedef uint8_t sm_key_t[16];
  */
 #define A2DP_SUBEVENT_SIGNALING_CAPABILITIES_COMPLETE                0x1Bu
 
+/**
+ * @format 12111144       Sent only by A2DP source if rate control is enabled for stream, see a2dp_source_rate_control_enable.
+ * @param subevent_code
+ * @param a2dp_cid
+ * @param local_seid
+ * @param bitpool
+ * @param num_free_acl_slots
+ * @param num_packets_in_flight
+ * @param num_samples
+ * @param num_congested_samples
+ */
+#define A2DP_SUBEVENT_STREAMING_RATE_CHANGED                         0x1Cu
+
 
 /** AVRCP Subevent */
 
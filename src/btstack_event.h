@@ -10291,6 +10291,70 @@ static inline uint16_t a2dp_subevent_signaling_capabilities_complete_get_a2dp_ci
     return little_endian_read_16(event, 3);
 }
 
+/**
+ * @brief Get field a2dp_cid from event A2DP_SUBEVENT_STREAMING_RATE_CHANGED
+ * @param event packet
+ * @return a2dp_cid
+ * @note: btstack_type 2
+ */
+static inline uint16_t a2dp_subevent_streaming_rate_changed_get_a2dp_cid(const uint8_t * event){
+    return little_endian_read_16(event, 3);
+}
+/**
+ * @brief Get field local_seid from event A2DP_SUBEVENT_STREAMING_RATE_CHANGED
+ * @param event packet
+ * @return local_seid
+ * @note: btstack_type 1
+ */
+static inline uint8_t a2dp_subevent_streaming_rate_changed_get_local_seid(const uint8_t * event){
+    return event[5];
+}
+/**
+ * @brief Get field bitpool from event A2DP_SUBEVENT_STREAMING_RATE_CHANGED
+ * @param event packet
+ * @return bitpool
+ * @note: btstack_type 1
+ */
+static inline uint8_t a2dp_subevent_streaming_rate_changed_get_bitpool(const uint8_t * event){
+    return event[6];
+}
+/**
+ * @brief Get field num_free_acl_slots from event A2DP_SUBEVENT_STREAMING_RATE_CHANGED
+ * @param event packet
+ * @return num_free_acl_slots
+ * @note: btstack_type 1
+ */
+static inline uint8_t a2dp_subevent_streaming_rate_changed_get_num_free_acl_slots(const uint8_t * event){
+    return event[7];
+}
+/**
+ * @brief Get field num_packets_in_flight from event A2DP_SUBEVENT_STREAMING_RATE_CHANGED
+ * @param event packet
+ * @return num_packets_in_flight
+ * @note: btstack_type 1
+ */
+static inline uint8_t a2dp_subevent_streaming_rate_changed_get_num_packets_in_flight(const uint8_t * event){
+    return event[8];
+}
+/**
+ * @brief Get field num_samples from event A2DP_SUBEVENT_STREAMING_RATE_CHANGED
+ * @param event packet
+ * @return num_samples
+ * @note: btstack_type 4
+ */
+static inline uint32_t a2dp_subevent_streaming_rate_changed_get_num_samples(const uint8_t * event){
+    return little_endian_read_32(event, 9);
+}
+/**
+ * @brief Get field num_congested_samples from event A2DP_SUBEVENT_STREAMING_RATE_CHANGED
+ * @param event packet
+ * @return num_congested_samples
+ * @note: btstack_type 4
+ */
+static inline uint32_t a2dp_subevent_streaming_rate_changed_get_num_congested_samples(const uint8_t * event){
+    return little_endian_read_32(event, 13);
+}
+
 /**
  * @brief Get field avrcp_cid from event AVRCP_SUBEVENT_NOTIFICATION_PLAYBACK_STATUS_CHANGED
  * @param event packet
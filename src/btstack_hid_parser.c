@@ -555,3 +555,162 @@ bool btstack_hid_report_id_declared(uint16_t hid_descriptor_len, const uint8_t *
     }
     return false;
 }
+
+static bool btstack_hid_compile_add_report_id(btstack_hid_compiled_descriptor_t * compiled, uint8_t report_id){
+    uint8_t i;
+    for (i = 0; i < compiled->num_reports; i++){
+        if (compiled->reports[i].report_id == report_id){
+            return true;
+        }
+    }
+    if (compiled->num_reports >= MAX_NR_HID_COMPILED_REPORTS){
+        return false;
+    }
+    compiled->reports[compiled->num_reports].report_id = report_id;
+    compiled->num_reports++;
+    return true;
+}
+
+static bool btstack_hid_compile_report(btstack_hid_compiled_descriptor_t * compiled, btstack_hid_compiled_report_t * report,
+                                       const uint8_t * hid_descriptor, uint16_t hid_descriptor_len){
+    // run single-pass parser on dummy report with report id. Control flow of the parser does not depend
+    // on report content, so the recorded fields are valid for all reports with this report id
+    uint8_t dummy_report[2];
+    dummy_report[0] = report->report_id;
+    dummy_report[1] = 0;
+
+    btstack_hid_parser_t parser;
+    btstack_hid_parser_init(&parser, hid_descriptor, hid_descriptor_len, compiled->report_type, dummy_report, 1);
+
+    report->fields_offset = compiled->num_fields;
+    report->num_fields    = 0;
+    report->report_size   = (uint16_t) btstack_hid_get_report_size_for_id(report->report_id, compiled->report_type, hid_descriptor_len, hid_descriptor);
+
+    while (btstack_hid_parser_has_more(&parser)){
+        if (compiled->num_fields >= compiled->max_fields){
+            log_error("compile: field storage exhausted");
+            return false;
+        }
+        btstack_hid_field_t * field = &compiled->fields[compiled->num_fields];
+        field->bit_offset      = parser.report_pos_in_bit;
+        field->bit_size        = parser.global_report_size;
+        field->flags           = 0;
+        if ((parser.descriptor_item.item_value & 2) != 0){
+            field->flags |= BTSTACK_HID_FIELD_FLAG_VARIABLE;
+        }
+        if (parser.global_logical_minimum < 0){
+            field->flags |= BTSTACK_HID_FIELD_FLAG_SIGNED;
+        }
+        field->logical_minimum = parser.global_logical_minimum;
+        field->logical_maximum = parser.global_logical_maximum;
+
+        int32_t value;
+        btstack_hid_parser_get_field(&parser, &field->usage_page, &field->usage, &value);
+        if ((field->flags & BTSTACK_HID_FIELD_FLAG_VARIABLE) == 0u){
+            // usage provided by report
+            field->usage = 0;
+        }
+        compiled->num_fields++;
+        report->num_fields++;
+    }
+    return true;
+}
+
+bool btstack_hid_descriptor_compile(btstack_hid_compiled_descriptor_t * compiled, const uint8_t * hid_descriptor, uint16_t hid_descriptor_len,
+                                    hid_report_type_t report_type, btstack_hid_field_t * fields, uint16_t max_fields){
+    memset(compiled, 0, sizeof(btstack_hid_compiled_descriptor_t));
+    compiled->report_type = report_type;
+    compiled->fields      = fields;
+    compiled->max_fields  = max_fields;
+
+    // collect report ids
+    const uint8_t * descriptor = hid_descriptor;
+    uint16_t descriptor_len = hid_descriptor_len;
+    while (descriptor_len){
+        hid_descriptor_item_t item;
+        bool ok = btstack_hid_parse_descriptor_item(&item, descriptor, descriptor_len);
+        if (ok == false){
+            return false;
+        }
+        if ((item.item_type == Global) && (item.item_tag == ReportID)){
+            compiled->report_ids_declared = true;
+            if (btstack_hid_compile_add_report_id(compiled, (uint8_t) item.item_value) == false){
+                log_error("compile: too many report ids");
+                return false;
+            }
+        }
+        descriptor_len -= item.item_size;
+        descriptor += item.item_size;
+    }
+    if (compiled->report_ids_declared == false){
+        (void) btstack_hid_compile_add_report_id(compiled, 0);
+    }
+
+    // collect fields for each report id
+    uint8_t i;
+    for (i = 0; i < compiled->num_reports; i++){
+        if (btstack_hid_compile_report(compiled, &compiled->reports[i], hid_descriptor, hid_descriptor_len) == false){
+            return false;
+        }
+    }
+    return true;
+}
+
+static const btstack_hid_compiled_report_t * btstack_hid_compiled_get_report(const btstack_hid_compiled_descriptor_t * compiled, int report_id){
+    uint8_t i;
+    for (i = 0; i < compiled->num_reports; i++){
+        if (compiled->reports[i].report_id == report_id){
+            return &compiled->reports[i];
+        }
+    }
+    return NULL;
+}
+
+const btstack_hid_field_t * btstack_hid_compiled_get_fields(const btstack_hid_compiled_descriptor_t * compiled, const uint8_t * hid_report, uint16_t hid_report_len, uint16_t * num_fields){
+    int report_id = 0;
+    if (compiled->report_ids_declared){
+        if (hid_report_len == 0u){
+            return NULL;
+        }
+        report_id = hid_report[0];
+    }
+    const btstack_hid_compiled_report_t * report = btstack_hid_compiled_get_report(compiled, report_id);
+    if (report == NULL){
+        return NULL;
+    }
+    *num_fields = report->num_fields;
+    return &compiled->fields[report->fields_offset];
+}
+
+int btstack_hid_compiled_get_report_size_for_id(const btstack_hid_compiled_descriptor_t * compiled, int report_id){
+    const btstack_hid_compiled_report_t * report = btstack_hid_compiled_get_report(compiled, report_id);
+    if (report == NULL){
+        return 0;
+    }
+    return report->report_size;
+}
+
+void btstack_hid_field_get_value(const btstack_hid_field_t * field, const uint8_t * hid_report, uint16_t hid_report_len, uint16_t * usage_page, uint16_t * usage, int32_t * value){
+    *usage_page = field->usage_page;
+
+    // read field (up to 32 bit unsigned, up to 31 bit signed), bits outside of report are read as zero
+    uint16_t pos_start = field->bit_offset >> 3;
+    uint16_t pos_end   = (field->bit_offset + field->bit_size - 1u) >> 3;
+    uint32_t multi_byte_value = 0;
+    uint16_t i;
+    for (i = 0; (i < 4u) && ((pos_start + i) <= pos_end) && ((pos_start + i) < hid_report_len); i++){
+        multi_byte_value |= ((uint32_t) hid_report[pos_start + i]) << (i * 8u);
+    }
+    uint32_t unsigned_value = (multi_byte_value >> (field->bit_offset & 0x07u)) & ((1u << field->bit_size) - 1u);
+    if ((field->flags & BTSTACK_HID_FIELD_FLAG_VARIABLE) != 0u){
+        *usage = field->usage;
+        if (((field->flags & BTSTACK_HID_FIELD_FLAG_SIGNED) != 0u) && ((unsigned_value & (1u << (field->bit_size - 1u))) != 0u)){
+            *value = unsigned_value - (1u << field->bit_size);
+        } else {
+            *value = unsigned_value;
+        }
+    } else {
+        *usage = unsigned_value;
+        *value = 1;
+    }
+}
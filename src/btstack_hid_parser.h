@@ -40,12 +40,16 @@
  *
  * Single-pass HID Report Parser: HID Report is directly parsed without preprocessing HID Descriptor to minimize memory.
  *
+ * Alternatively, the HID Descriptor can be compiled into a table of fields per Report ID, which allows to decode
+ * HID Reports without walking the HID Descriptor for each report.
+ *
  */
 
 #ifndef BTSTACK_HID_PARSER_H
 #define BTSTACK_HID_PARSER_H
 
 #include <stdint.h>
+#include "btstack_config.h"
 #include "btstack_bool.h"
 #include "btstack_hid.h"
 
@@ -151,6 +155,47 @@ typedef struct {
     uint8_t         global_report_id;
 } btstack_hid_parser_t;
 
+// max number of Report IDs in compiled HID Descriptor
+#ifndef MAX_NR_HID_COMPILED_REPORTS
+#define MAX_NR_HID_COMPILED_REPORTS 16
+#endif
+
+#define BTSTACK_HID_FIELD_FLAG_VARIABLE 0x01u
+#define BTSTACK_HID_FIELD_FLAG_SIGNED   0x02u
+
+// single field in a HID Report
+typedef struct {
+    // position in report, including Report ID
+    uint16_t bit_offset;
+    uint8_t  bit_size;
+    uint8_t  flags;
+    uint16_t usage_page;
+    // usage for variable items, usage is reported in field for array items
+    uint16_t usage;
+    int32_t  logical_minimum;
+    int32_t  logical_maximum;
+} btstack_hid_field_t;
+
+typedef struct {
+    uint8_t  report_id;
+    uint16_t report_size;
+    uint16_t fields_offset;
+    uint16_t num_fields;
+} btstack_hid_compiled_report_t;
+
+typedef struct {
+    hid_report_type_t report_type;
+    bool              report_ids_declared;
+
+    uint8_t           num_reports;
+    btstack_hid_compiled_report_t reports[MAX_NR_HID_COMPILED_REPORTS];
+
+    // field storage
+    btstack_hid_field_t * fields;
+    uint16_t          max_fields;
+    uint16_t          num_fields;
+} btstack_hid_compiled_descriptor_t;
+
 /* API_START */
 
 /**
@@ -214,6 +259,50 @@ hid_report_id_status_t btstack_hid_id_valid(int report_id, uint16_t hid_descript
  * @return true if report ID declared in descriptor
  */
 bool btstack_hid_report_id_declared(uint16_t hid_descriptor_len, const uint8_t * hid_descriptor);
+
+/**
+ * @brief Compile HID Descriptor into per-Report ID table of fields, which allows to decode reports
+ *        without parsing the HID Descriptor again. Fields are identical to the ones provided by btstack_hid_parser_get_field
+ * @param compiled descriptor
+ * @param hid_descriptor
+ * @param hid_descriptor_len
+ * @param report_type
+ * @param fields storage for fields of all reports
+ * @param max_fields
+ * @return true if descriptor was compiled, false on parse error or if field storage or report table is too small
+ */
+bool btstack_hid_descriptor_compile(btstack_hid_compiled_descriptor_t * compiled, const uint8_t * hid_descriptor, uint16_t hid_descriptor_len,
+                                    hid_report_type_t report_type, btstack_hid_field_t * fields, uint16_t max_fields);
+
+/**
+ * @brief Get fields for HID Report, Report ID is taken from first byte if Report IDs are declared
+ * @param compiled descriptor
+ * @param hid_report
+ * @param hid_report_len
+ * @param num_fields
+ * @return fields or NULL if Report ID unknown
+ */
+const btstack_hid_field_t * btstack_hid_compiled_get_fields(const btstack_hid_compiled_descriptor_t * compiled, const uint8_t * hid_report, uint16_t hid_report_len, uint16_t * num_fields);
+
+/**
+ * @brief Get report size for Report ID from compiled descriptor
+ * @param compiled descriptor
+ * @param report_id
+ * @return report size in bytes or 0 if Report ID unknown, see btstack_hid_get_report_size_for_id
+ */
+int btstack_hid_compiled_get_report_size_for_id(const btstack_hid_compiled_descriptor_t * compiled, int report_id);
+
+/**
+ * @brief Get usage and value of field in HID Report
+ * @param field
+ * @param hid_report
+ * @param hid_report_len
+ * @param usage_page
+ * @param usage
+ * @param value provided in HID report
+ */
+void btstack_hid_field_get_value(const btstack_hid_field_t * field, const uint8_t * hid_report, uint16_t hid_report_len, uint16_t * usage_page, uint16_t * usage, int32_t * value);
+
 /* API_END */
 
 #if defined __cplusplus
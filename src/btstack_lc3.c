@@ -43,8 +43,11 @@
 
 #define BTSTACK_FILE__ "btstack_lc3.c"
 
+#include <stddef.h>
+
 #include "btstack_lc3.h"
 #include "btstack_debug.h"
+#include "bluetooth.h"
 
 uint16_t btstack_lc3_frame_duration_in_us(btstack_lc3_frame_duration_t frame_duration){
     switch (frame_duration){
@@ -65,3 +68,37 @@ uint16_t btstack_lc3_samples_per_frame(uint32_t sample_rate, btstack_lc3_frame_d
     // assume sample rate is x 1000 hz
     return (sample_rate / 1000) * (btstack_lc3_frame_duration_in_us(frame_duration) / 100) / 10;
 }
+
+uint8_t btstack_lc3_encode_frames_signed_16(const btstack_lc3_encoder_t * encoder, void * const * encoder_contexts, uint8_t num_channels,
+                                            const int16_t * pcm_in, uint8_t * bytes, uint16_t octets_per_frame){
+    uint8_t status = ERROR_CODE_SUCCESS;
+    uint8_t channel;
+    for (channel = 0; channel < num_channels; channel++){
+        uint8_t channel_status = (*encoder->encode_signed_16)(encoder_contexts[channel], &pcm_in[channel], num_channels,
+                                                              &bytes[channel * octets_per_frame]);
+        if (status == ERROR_CODE_SUCCESS){
+            status = channel_status;
+        }
+    }
+    return status;
+}
+
+uint8_t btstack_lc3_decode_frames_signed_16(const btstack_lc3_decoder_t * decoder, void * const * decoder_contexts, uint8_t num_channels,
+                                            const uint8_t * bytes, uint16_t octets_per_frame, const uint8_t * BFI,
+                                            int16_t * pcm_out, uint8_t * BEC_detect){
+    uint8_t status = ERROR_CODE_SUCCESS;
+    uint8_t channel;
+    for (channel = 0; channel < num_channels; channel++){
+        uint8_t channel_bfi = (BFI != NULL) ? BFI[channel] : 0;
+        uint8_t channel_bec_detect = 0;
+        uint8_t channel_status = (*decoder->decode_signed_16)(decoder_contexts[channel], &bytes[channel * octets_per_frame], channel_bfi,
+                                                              &pcm_out[channel], num_channels, &channel_bec_detect);
+        if (BEC_detect != NULL){
+            BEC_detect[channel] = channel_bec_detect;
+        }
+        if (status == ERROR_CODE_SUCCESS){
+            status = channel_status;
+        }
+    }
+    return status;
+}
@@ -140,6 +140,35 @@ uint16_t btstack_lc3_frame_duration_in_us(btstack_lc3_frame_duration_t frame_dur
  */
 uint16_t btstack_lc3_samples_per_frame(uint32_t sample_rate, btstack_lc3_frame_duration_t frame_duration);
 
+/**
+ * @brief Encode one frame for all channels from interleaved 16-bit PCM samples
+ * @param encoder
+ * @param encoder_contexts array with one encoder context per channel
+ * @param num_channels
+ * @param pcm_in interleaved PCM samples for all channels
+ * @param bytes output for num_channels LC3 frames, stored consecutively
+ * @param octets_per_frame
+ * @return status ERROR_CODE_SUCCESS or status of first failed channel
+ */
+uint8_t btstack_lc3_encode_frames_signed_16(const btstack_lc3_encoder_t * encoder, void * const * encoder_contexts, uint8_t num_channels,
+                                            const int16_t * pcm_in, uint8_t * bytes, uint16_t octets_per_frame);
+
+/**
+ * @brief Decode one frame for all channels into interleaved 16-bit PCM samples
+ * @param decoder
+ * @param decoder_contexts array with one decoder context per channel
+ * @param num_channels
+ * @param bytes num_channels LC3 frames, stored consecutively
+ * @param octets_per_frame
+ * @param BFI array with Bad Frame Indication per channel, or NULL if all frames are valid
+ * @param pcm_out buffer for interleaved PCM samples of all channels
+ * @param BEC_detect array for Bit Error Detected flag per channel, or NULL
+ * @return status ERROR_CODE_SUCCESS or status of first failed channel
+ */
+uint8_t btstack_lc3_decode_frames_signed_16(const btstack_lc3_decoder_t * decoder, void * const * decoder_contexts, uint8_t num_channels,
+                                            const uint8_t * bytes, uint16_t octets_per_frame, const uint8_t * BFI,
+                                            int16_t * pcm_out, uint8_t * BEC_detect);
+
 /* API_END */
 
 #if defined __cplusplus
@@ -41,21 +41,160 @@
 #include "btstack_debug.h"
 #include "btstack_resample.h"
 
+#include <string.h>
+
+#ifdef ENABLE_RESAMPLE_POLYPHASE
+
+#define NUM_PHASES 32
+#define PHASE_BITS 5
+
+// Blackman windowed sinc, cutoff at 0.45 fs, 16 taps, 32 phases + 1 for interpolation to next phase
+// each phase normalized to unity DC gain in Q14
+static const int16_t btstack_resample_polyphase_coefficients[NUM_PHASES + 1][BTSTACK_RESAMPLE_POLYPHASE_TAPS] = {
+    {     9,    -55,    180,   -422,    780,  -1186,   1513,  14746,   1513,  -1186,    780,   -422,    180,    -55,      9,      0},
+    {     9,    -54,    173,   -397,    711,  -1013,   1058,  14725,   1987,  -1357,    847,   -443,    184,    -55,      9,      0},
+    {     8,    -53,    166,   -371,    638,   -840,    626,  14666,   2480,  -1525,    909,   -462,    188,    -55,      9,      0},
+    {     8,    -51,    158,   -343,    564,   -668,    217,  14567,   2990,  -1689,    966,   -478,    190,    -55,      8,      0},
+    {     8,    -49,    148,   -314,    488,   -498,   -168,  14428,   3515,  -1846,   1018,   -491,    190,    -53,      8,      0},
+    {     7,    -46,    139,   -283,    412,   -333,   -527,  14250,   4053,  -1996,   1063,   -500,    189,    -51,      7,      0},
+    {     7,    -44,    128,   -252,    336,   -172,   -861,  14036,   4602,  -2136,   1102,   -505,    186,    -49,      6,      0},
+    {     6,    -41,    117,   -220,    261,    -17,  -1167,  13783,   5159,  -2266,   1133,   -505,    181,    -45,      5,      0},
+    {     6,    -38,    106,   -188,    187,    131,  -1446,  13495,   5722,  -2382,   1156,   -502,    174,    -41,      4,      0},
+    {     5,    -35,     94,   -156,    115,    272,  -1697,  13176,   6288,  -2485,   1170,   -494,    165,    -37,      3,      0},
+    {     5,    -31,     82,   -124,     45,    403,  -1920,  12823,   6856,  -2572,   1174,   -481,    154,    -31,      1,      0},
+    {     4,    -28,     71,    -93,    -22,    526,  -2115,  12439,   7423,  -2642,   1169,   -463,    141,    -25,     -1,      0},
+    {     4,    -25,     59,    -63,    -86,    639,  -2283,  12027,   7985,  -2693,   1154,   -440,    126,    -18,     -3,      1},
+    {     3,    -22,     48,    -34,   -145,    741,  -2423,  11591,   8540,  -2724,   1128,   -413,    108,    -10,     -5,      1},
+    {     3,    -19,     37,     -6,   -201,    833,  -2536,  11128,   9087,  -2734,   1091,   -380,     89,     -2,     -7,      1},
+    {     2,    -16,     27,     20,   -253,    914,  -2623,  10647,   9621,  -2721,   1043,   -343,     68,      7,    -10,      1},
+    {     2,    -13,     17,     45,   -300,    984,  -2684,  10141,  10141,  -2684,    984,   -300,     45,     17,    -13,      2},
+    {     1,    -10,      7,     68,   -343,   1043,  -2721,   9621,  10647,  -2623,    914,   -253,     20,     27,    -16,      2},
+    {     1,     -7,     -2,     89,   -380,   1091,  -2734,   9087,  11128,  -2536,    833,   -201,     -6,     37,    -19,      3},
+    {     1,     -5,    -10,    108,   -413,   1128,  -2724,   8540,  11591,  -2423,    741,   -145,    -34,     48,    -22,      3},
+    {     1,     -3,    -18,    126,   -440,   1154,  -2693,   7985,  12027,  -2283,    639,    -86,    -63,     59,    -25,      4},
+    {     0,     -1,    -25,    141,   -463,   1169,  -2642,   7423,  12439,  -2115,    526,    -22,    -93,     71,    -28,      4},
+    {     0,      1,    -31,    154,   -481,   1174,  -2572,   6856,  12823,  -1920,    403,     45,   -124,     82,    -31,      5},
+    {     0,      3,    -37,    165,   -494,   1170,  -2485,   6288,  13176,  -1697,    272,    115,   -156,     94,    -35,      5},
+    {     0,      4,    -41,    174,   -502,   1156,  -2382,   5722,  13495,  -1446,    131,    187,   -188,    106,    -38,      6},
+    {     0,      5,    -45,    181,   -505,   1133,  -2266,   5159,  13783,  -1167,    -17,    261,   -220,    117,    -41,      6},
+    {     0,      6,    -49,    186,   -505,   1102,  -2136,   4602,  14036,   -861,   -172,    336,   -252,    128,    -44,      7},
+    {     0,      7,    -51,    189,   -500,   1063,  -1996,   4053,  14250,   -527,   -333,    412,   -283,    139,    -46,      7},
+    {     0,      8,    -53,    190,   -491,   1018,  -1846,   3515,  14428,   -168,   -498,    488,   -314,    148,    -49,      8},
+    {     0,      8,    -55,    190,   -478,    966,  -1689,   2990,  14567,    217,   -668,    564,   -343,    158,    -51,      8},
+    {     0,      9,    -55,    188,   -462,    909,  -1525,   2480,  14666,    626,   -840,    638,   -371,    166,    -53,      8},
+    {     0,      9,    -55,    184,   -443,    847,  -1357,   1987,  14725,   1058,  -1013,    711,   -397,    173,    -54,      9},
+    {     0,      9,    -55,    180,   -422,    780,  -1186,   1513,  14746,   1513,  -1186,    780,   -422,    180,    -55,      9}
+};
+
+#endif
+
 void btstack_resample_init(btstack_resample_t * context, int num_channels){
+    btstack_assert(num_channels <= BTSTACK_RESAMPLE_MAX_CHANNELS);
     context->src_pos = 0;
     context->src_step = 0x10000;  // default resampling 1.0
     context->last_sample[0] = 0;
     context->last_sample[1] = 0;
     context->num_channels   = num_channels;
+#ifdef ENABLE_RESAMPLE_POLYPHASE
+    memset(context->history, 0, sizeof(context->history));
+    context->history_pos = 0;
+#endif
 }
 
 void btstack_resample_set_factor(btstack_resample_t * context, uint32_t src_step){
     context->src_step = src_step;
 }
 
+#ifdef ENABLE_RESAMPLE_POLYPHASE
+
+static int16_t btstack_resample_saturate(int32_t value){
+    if (value > 32767)  return 32767;
+    if (value < -32768) return -32768;
+    return (int16_t) value;
+}
+
+// interpolate between filter outputs of adjacent phases and convert from Q14
+static int16_t btstack_resample_interpolate(int32_t y0, int32_t y1, uint16_t fraction){
+    int32_t y = y0 + (int32_t)(((int64_t)(y1 - y0) * fraction) >> 16);
+    return btstack_resample_saturate((y + (1 << 13)) >> 14);
+}
+
+// delay line is stored twice, so all TAPS frames starting with the oldest one are contiguous
+static int32_t btstack_resample_fir_mono(const int16_t * samples, const int16_t * coefficients){
+    int32_t acc = 0;
+    int k;
+    for (k=0;k<BTSTACK_RESAMPLE_POLYPHASE_TAPS;k++){
+        acc += samples[k] * coefficients[k];
+    }
+    return acc;
+}
+
+static void btstack_resample_fir_stereo(const int16_t * samples, const int16_t * coefficients, int32_t * left, int32_t * right){
+    int32_t acc_left  = 0;
+    int32_t acc_right = 0;
+    int k;
+    for (k=0;k<BTSTACK_RESAMPLE_POLYPHASE_TAPS;k++){
+        acc_left  += samples[2*k]   * coefficients[k];
+        acc_right += samples[2*k+1] * coefficients[k];
+    }
+    *left  = acc_left;
+    *right = acc_right;
+}
+
+static uint16_t btstack_resample_block_polyphase(btstack_resample_t * context, const int16_t * input_buffer, uint32_t num_frames, int16_t * output_buffer){
+    const int num_channels = context->num_channels;
+    const uint16_t history_len = BTSTACK_RESAMPLE_POLYPHASE_TAPS * num_channels;
+    uint16_t dest_frames = 0;
+    uint32_t i;
+    for (i=0;i<num_frames;i++){
+        // add frame to delay line, oldest frame is at history_pos + 1 afterwards
+        uint16_t pos = context->history_pos * num_channels;
+        int c;
+        for (c=0;c<num_channels;c++){
+            int16_t sample = *input_buffer++;
+            context->history[pos + c] = sample;
+            context->history[pos + history_len + c] = sample;
+        }
+        context->history_pos++;
+        if (context->history_pos == BTSTACK_RESAMPLE_POLYPHASE_TAPS){
+            context->history_pos = 0;
+        }
+        const int16_t * samples = &context->history[context->history_pos * num_channels];
+
+        // emit all frames located between center frame and next one
+        while (context->src_pos < 0x10000){
+            const uint16_t t        = context->src_pos & 0xffffu;
+            const uint16_t phase    = t >> (16 - PHASE_BITS);
+            const uint16_t fraction = (uint16_t)(t << PHASE_BITS);
+            const int16_t * h0 = btstack_resample_polyphase_coefficients[phase];
+            const int16_t * h1 = btstack_resample_polyphase_coefficients[phase + 1];
+            if (num_channels == 2){
+                int32_t left0, right0, left1, right1;
+                btstack_resample_fir_stereo(samples, h0, &left0, &right0);
+                btstack_resample_fir_stereo(samples, h1, &left1, &right1);
+                *output_buffer++ = btstack_resample_interpolate(left0,  left1,  fraction);
+                *output_buffer++ = btstack_resample_interpolate(right0, right1, fraction);
+            } else {
+                int32_t y0 = btstack_resample_fir_mono(samples, h0);
+                int32_t y1 = btstack_resample_fir_mono(samples, h1);
+                *output_buffer++ = btstack_resample_interpolate(y0, y1, fraction);
+            }
+            dest_frames++;
+            context->src_pos += context->src_step;
+        }
+        context->src_pos -= 0x10000;
+    }
+    return dest_frames;
+}
+#endif
+
 uint16_t btstack_resample_block(btstack_resample_t * context, const int16_t * input_buffer, uint32_t num_frames, int16_t * output_buffer){
     btstack_assert(context->num_channels > 0);
 
+#ifdef ENABLE_RESAMPLE_POLYPHASE
+    return btstack_resample_block_polyphase(context, input_buffer, num_frames, output_buffer);
+#else
+
     uint16_t dest_frames = 0;
     uint16_t dest_samples = 0;
     // samples between last sample of previous block and first sample in current block 
@@ -97,4 +236,5 @@ uint16_t btstack_resample_block(btstack_resample_t * context, const int16_t * in
         context->src_pos += context->src_step;
     }
     return dest_frames;
+#endif
 }
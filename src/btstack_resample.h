@@ -40,11 +40,17 @@
  *
  * Linear resampling for 16-bit audio code samples using 16 bit/16 bit fixed point math.
  *
+ * With ENABLE_RESAMPLE_POLYPHASE, a 16-tap polyphase FIR filter is used instead, which reduces
+ * interpolation artifacts at the cost of a delay of BTSTACK_RESAMPLE_POLYPHASE_TAPS / 2 frames.
+ * It is meant for resampling factors close to 1.0, e.g. for sample rate compensation.
+ *
  */
 
 #ifndef BTSTACK_RESAMPLE_H
 #define BTSTACK_RESAMPLE_H
 
+#include "btstack_config.h"
+
 #include <stdint.h>
 
 #if defined __cplusplus
@@ -53,11 +59,20 @@ extern "C" {
 
 #define BTSTACK_RESAMPLE_MAX_CHANNELS 2
 
+#ifdef ENABLE_RESAMPLE_POLYPHASE
+#define BTSTACK_RESAMPLE_POLYPHASE_TAPS 16
+#endif
+
 typedef struct {
     uint32_t src_pos;
     uint32_t src_step;
     int16_t  last_sample[BTSTACK_RESAMPLE_MAX_CHANNELS];
     int      num_channels;
+#ifdef ENABLE_RESAMPLE_POLYPHASE
+    // interleaved delay line, stored twice to allow for linear access
+    int16_t  history[2 * BTSTACK_RESAMPLE_POLYPHASE_TAPS * BTSTACK_RESAMPLE_MAX_CHANNELS];
+    uint16_t history_pos;
+#endif
 } btstack_resample_t;
 
 /* API_START */
@@ -208,6 +208,11 @@ void a2dp_replace_subevent_id_and_emit_source(uint8_t * packet, uint16_t size, u
     a2dp_replace_subevent_id_and_emit(a2dp_source_callback, packet, size, subevent_id);
 }
 
+void a2dp_emit_source(uint8_t * packet, uint16_t size){
+    btstack_assert(a2dp_source_callback != NULL);
+    (*a2dp_source_callback)(HCI_EVENT_PACKET, 0, packet, size);
+}
+
 void a2dp_replace_subevent_id_and_emit_sink(uint8_t *packet, uint16_t size, uint8_t subevent_id) {
     a2dp_replace_subevent_id_and_emit(a2dp_sink_callback, packet, size, subevent_id);
 }
@@ -67,6 +67,8 @@ void a2dp_register_source_packet_handler(btstack_packet_handler_t callback);
 
 void a2dp_replace_subevent_id_and_emit_source(uint8_t * packet, uint16_t size, uint8_t subevent_id);
 
+void a2dp_emit_source(uint8_t * packet, uint16_t size);
+
 // sink
 void a2dp_register_sink_packet_handler(btstack_packet_handler_t callback);
 
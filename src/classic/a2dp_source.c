@@ -70,6 +70,24 @@ static const char * a2dp_default_source_service_provider_name = "BTstack A2DP So
 
 static uint8_t (*a2dp_source_media_config_validator)(const avdtp_stream_endpoint_t * stream_endpoint, const uint8_t * event, uint16_t size);
 
+// rate control: packets in flight on ACL connection considered as congestion
+#ifndef A2DP_SOURCE_RATE_CONTROL_CONGESTION_PACKETS_IN_FLIGHT
+#define A2DP_SOURCE_RATE_CONTROL_CONGESTION_PACKETS_IN_FLIGHT 4
+#endif
+
+// rate control: number of samples without congestion before bitpool is increased
+#ifndef A2DP_SOURCE_RATE_CONTROL_INCREASE_SAMPLES
+#define A2DP_SOURCE_RATE_CONTROL_INCREASE_SAMPLES 64
+#endif
+
+// rate control: number of samples after bitpool decrease before congestion can decrease it again
+#ifndef A2DP_SOURCE_RATE_CONTROL_DECREASE_HOLD_OFF_SAMPLES
+#define A2DP_SOURCE_RATE_CONTROL_DECREASE_HOLD_OFF_SAMPLES 16
+#endif
+
+static btstack_linked_list_t a2dp_source_broadcasts;
+static btstack_linked_list_t a2dp_source_rate_controls;
+
 void a2dp_source_create_sdp_record(uint8_t * service, uint32_t service_record_handle, uint16_t supported_features, const char * service_name, const char * service_provider_name){
     if (service_provider_name == NULL){
         service_provider_name = a2dp_default_source_service_provider_name;
@@ -81,6 +99,149 @@ void a2dp_source_create_sdp_record(uint8_t * service, uint32_t service_record_ha
                            supported_features, service_name, service_provider_name);
 }
 
+static uint8_t * a2dp_source_broadcast_get_packet(const a2dp_source_broadcast_t * broadcast, uint32_t packet_nr){
+    uint32_t packet_size = A2DP_SOURCE_BROADCAST_PACKET_HEADER_SIZE + broadcast->max_payload_size;
+    return &broadcast->storage[(packet_nr % broadcast->num_packets) * packet_size];
+}
+
+static a2dp_source_broadcast_sink_t * a2dp_source_broadcast_get_sink(uint16_t a2dp_cid, uint8_t local_seid, a2dp_source_broadcast_t ** out_broadcast){
+    btstack_linked_list_iterator_t broadcast_it;
+    btstack_linked_list_iterator_init(&broadcast_it, &a2dp_source_broadcasts);
+    while (btstack_linked_list_iterator_has_next(&broadcast_it)){
+        a2dp_source_broadcast_t * broadcast = (a2dp_source_broadcast_t *) btstack_linked_list_iterator_next(&broadcast_it);
+        btstack_linked_list_iterator_t sink_it;
+        btstack_linked_list_iterator_init(&sink_it, &broadcast->sinks);
+        while (btstack_linked_list_iterator_has_next(&sink_it)){
+            a2dp_source_broadcast_sink_t * sink = (a2dp_source_broadcast_sink_t *) btstack_linked_list_iterator_next(&sink_it);
+            if ((sink->a2dp_cid == a2dp_cid) && (sink->local_seid == local_seid)){
+                *out_broadcast = broadcast;
+                return sink;
+            }
+        }
+    }
+    return NULL;
+}
+
+static void a2dp_source_broadcast_sink_request_can_send_now(a2dp_source_broadcast_sink_t * sink){
+    if (sink->can_send_now_requested) return;
+    sink->can_send_now_requested = true;
+    avdtp_source_stream_endpoint_request_can_send_now(sink->a2dp_cid, sink->local_seid);
+}
+
+// drop pending request when sink leaves broadcast group, A2DP_SUBEVENT_STREAMING_CAN_SEND_MEDIA_PACKET_NOW was not requested by application
+static void a2dp_source_broadcast_sink_cancel_can_send_now(a2dp_source_broadcast_sink_t * sink){
+    if (sink->can_send_now_requested == false) return;
+    sink->can_send_now_requested = false;
+    avdtp_stream_endpoint_t * stream_endpoint = avdtp_get_stream_endpoint_for_seid(sink->local_seid);
+    if (stream_endpoint != NULL){
+        stream_endpoint->request_can_send_now = false;
+    }
+}
+
+static void a2dp_source_broadcast_sink_send_next(a2dp_source_broadcast_t * broadcast, a2dp_source_broadcast_sink_t * sink){
+    sink->can_send_now_requested = false;
+    if (sink->packet_nr == broadcast->packet_nr) return;
+
+    const uint8_t * packet = a2dp_source_broadcast_get_packet(broadcast, sink->packet_nr);
+    uint32_t timestamp    = little_endian_read_32(packet, 0);
+    uint16_t payload_size = little_endian_read_16(packet, 4);
+    uint8_t  marker       = packet[6];
+    if (sink->timestamp_offset_set == false){
+        sink->timestamp_offset_set = true;
+        sink->timestamp_offset = timestamp;
+    }
+    uint8_t status = avdtp_source_stream_send_media_payload_rtp(sink->a2dp_cid, sink->local_seid, marker, timestamp - sink->timestamp_offset,
+                                                                &packet[A2DP_SOURCE_BROADCAST_PACKET_HEADER_SIZE], payload_size);
+    if (status != ERROR_CODE_SUCCESS){
+        log_info("broadcast sink cid 0x%02x, seid %u: send failed, status 0x%02x", sink->a2dp_cid, sink->local_seid, status);
+        sink->num_packets_dropped++;
+    }
+    sink->packet_nr++;
+
+    if (sink->packet_nr != broadcast->packet_nr){
+        a2dp_source_broadcast_sink_request_can_send_now(sink);
+    }
+}
+
+static void a2dp_source_rate_control_emit_rate_changed(a2dp_source_rate_control_t * rate_control, uint8_t num_free_acl_slots, uint8_t num_packets_in_flight){
+    uint8_t event[17];
+    int pos = 0;
+    event[pos++] = HCI_EVENT_A2DP_META;
+    event[pos++] = sizeof(event) - 2;
+    event[pos++] = A2DP_SUBEVENT_STREAMING_RATE_CHANGED;
+    little_endian_store_16(event, pos, rate_control->a2dp_cid);
+    pos += 2;
+    event[pos++] = rate_control->local_seid;
+    event[pos++] = rate_control->bitpool;
+    event[pos++] = num_free_acl_slots;
+    event[pos++] = num_packets_in_flight;
+    little_endian_store_32(event, pos, rate_control->num_samples);
+    pos += 4;
+    little_endian_store_32(event, pos, rate_control->num_congested_samples);
+    a2dp_emit_source(event, sizeof(event));
+}
+
+static void a2dp_source_rate_control_sample(uint16_t a2dp_cid, uint8_t local_seid, uint32_t num_packets_queued){
+    btstack_linked_list_iterator_t it;
+    btstack_linked_list_iterator_init(&it, &a2dp_source_rate_controls);
+    while (btstack_linked_list_iterator_has_next(&it)){
+        a2dp_source_rate_control_t * rate_control = (a2dp_source_rate_control_t *) btstack_linked_list_iterator_next(&it);
+        if ((rate_control->a2dp_cid != a2dp_cid) || (rate_control->local_seid != local_seid)) continue;
+
+        avdtp_stream_endpoint_t * stream_endpoint = avdtp_get_stream_endpoint_for_seid(local_seid);
+        if (stream_endpoint == NULL) return;
+
+        uint8_t num_packets_in_flight = (uint8_t) btstack_min(hci_number_outgoing_acl_packets_for_handle(stream_endpoint->media_con_handle), 255);
+        int     num_free_acl_slots    = hci_number_free_acl_slots_for_handle(stream_endpoint->media_con_handle);
+        if (num_free_acl_slots < 0){
+            num_free_acl_slots = 0;
+        }
+        num_free_acl_slots = btstack_min(num_free_acl_slots, 255);
+
+        bool congested = (num_packets_in_flight >= A2DP_SOURCE_RATE_CONTROL_CONGESTION_PACKETS_IN_FLIGHT) || (num_packets_queued > 1u);
+        rate_control->num_samples++;
+
+        // after a decrease, packets encoded with the previous bitpool are still in flight or queued
+        bool hold_off = rate_control->num_hold_off_samples > 0u;
+        if (hold_off){
+            rate_control->num_hold_off_samples--;
+        }
+
+        uint8_t bitpool = rate_control->bitpool;
+        if (congested){
+            rate_control->num_congested_samples++;
+            rate_control->num_good_samples = 0;
+            if (hold_off == false){
+                uint8_t step = btstack_max(1, bitpool / 4);
+                if (bitpool >= (rate_control->min_bitpool + step)){
+                    bitpool -= step;
+                } else {
+                    bitpool = rate_control->min_bitpool;
+                }
+                if (bitpool != rate_control->bitpool){
+                    rate_control->num_hold_off_samples = A2DP_SOURCE_RATE_CONTROL_DECREASE_HOLD_OFF_SAMPLES;
+                }
+            }
+        } else {
+            rate_control->num_good_samples++;
+            if (rate_control->num_good_samples >= A2DP_SOURCE_RATE_CONTROL_INCREASE_SAMPLES){
+                rate_control->num_good_samples = 0;
+                if (bitpool < rate_control->max_bitpool){
+                    bitpool++;
+                }
+            }
+        }
+
+        if (bitpool != rate_control->bitpool){
+            log_info("rate control cid 0x%02x, seid %u: bitpool %u -> %u, free acl slots %u, in flight %u, queued %u",
+                     a2dp_cid, local_seid, rate_control->bitpool, bitpool, num_free_acl_slots, num_packets_in_flight, (unsigned int) num_packets_queued);
+            rate_control->bitpool = bitpool;
+            a2dp_source_rate_control_emit_rate_changed(rate_control, (uint8_t) num_free_acl_slots, num_packets_in_flight);
+        }
+        return;
+    }
+}
+
 static void a2dp_source_packet_handler_internal(uint8_t packet_type, uint16_t channel, uint8_t *packet, uint16_t size){
     UNUSED(channel);
     UNUSED(size);
@@ -88,6 +249,11 @@ static void a2dp_source_packet_handler_internal(uint8_t packet_type, uint16_t ch
     if (packet_type != HCI_EVENT_PACKET) return;
     if (hci_event_packet_get_type(packet) != HCI_EVENT_AVDTP_META) return;
 
+    a2dp_source_broadcast_t * broadcast;
+    a2dp_source_broadcast_sink_t * sink;
+    uint16_t cid;
+    uint8_t  local_seid;
+
     switch (hci_event_avdtp_meta_get_subevent_code(packet)){
 
         case AVDTP_SUBEVENT_SIGNALING_DELAY_REPORT:
@@ -95,6 +261,14 @@ static void a2dp_source_packet_handler_internal(uint8_t packet_type, uint16_t ch
             break;
 
         case AVDTP_SUBEVENT_STREAMING_CAN_SEND_MEDIA_PACKET_NOW:
+            cid = avdtp_subevent_streaming_can_send_media_packet_now_get_avdtp_cid(packet);
+            local_seid = avdtp_subevent_streaming_can_send_media_packet_now_get_local_seid(packet);
+            sink = a2dp_source_broadcast_get_sink(cid, local_seid, &broadcast);
+            a2dp_source_rate_control_sample(cid, local_seid, (sink != NULL) ? (broadcast->packet_nr - sink->packet_nr) : 0);
+            if (sink != NULL){
+                a2dp_source_broadcast_sink_send_next(broadcast, sink);
+                break;
+            }
             a2dp_replace_subevent_id_and_emit_source(packet, size, A2DP_SUBEVENT_STREAMING_CAN_SEND_MEDIA_PACKET_NOW);
             break;
         
@@ -120,6 +294,8 @@ void a2dp_source_deinit(void){
     a2dp_deinit();
     avdtp_source_deinit();
     a2dp_source_media_config_validator = NULL;
+    a2dp_source_broadcasts = NULL;
+    a2dp_source_rate_controls = NULL;
 }
 
 avdtp_stream_endpoint_t * a2dp_source_create_stream_endpoint(avdtp_media_type_t media_type, avdtp_media_codec_type_t media_codec_type,
@@ -317,3 +493,85 @@ void a2dp_source_register_media_config_validator(uint8_t (*callback)(const avdtp
     avdtp_source_register_media_config_validator(&a2dp_source_media_config_validator_callback);
 }
 
+uint8_t a2dp_source_broadcast_init(a2dp_source_broadcast_t * broadcast, uint8_t * storage, uint32_t storage_size, uint16_t max_payload_size){
+    uint32_t num_packets = storage_size / (A2DP_SOURCE_BROADCAST_PACKET_HEADER_SIZE + max_payload_size);
+    if (num_packets == 0u){
+        return ERROR_CODE_MEMORY_CAPACITY_EXCEEDED;
+    }
+    memset(broadcast, 0, sizeof(a2dp_source_broadcast_t));
+    broadcast->storage = storage;
+    broadcast->num_packets = (uint16_t) btstack_min(num_packets, 0xffffu);
+    broadcast->max_payload_size = max_payload_size;
+    btstack_linked_list_add(&a2dp_source_broadcasts, (btstack_linked_item_t *) broadcast);
+    return ERROR_CODE_SUCCESS;
+}
+
+void a2dp_source_broadcast_add_sink(a2dp_source_broadcast_t * broadcast, a2dp_source_broadcast_sink_t * sink, uint16_t a2dp_cid, uint8_t local_seid){
+    memset(sink, 0, sizeof(a2dp_source_broadcast_sink_t));
+    sink->a2dp_cid = a2dp_cid;
+    sink->local_seid = local_seid;
+    sink->packet_nr = broadcast->packet_nr;
+    btstack_linked_list_add_tail(&broadcast->sinks, (btstack_linked_item_t *) sink);
+}
+
+void a2dp_source_broadcast_remove_sink(a2dp_source_broadcast_t * broadcast, a2dp_source_broadcast_sink_t * sink){
+    btstack_linked_list_remove(&broadcast->sinks, (btstack_linked_item_t *) sink);
+    a2dp_source_broadcast_sink_cancel_can_send_now(sink);
+}
+
+uint8_t a2dp_source_broadcast_send_media_payload_rtp(a2dp_source_broadcast_t * broadcast, uint8_t marker, uint32_t timestamp,
+                                                     const uint8_t * payload, uint16_t payload_size){
+    if (payload_size > broadcast->max_payload_size){
+        return ERROR_CODE_MEMORY_CAPACITY_EXCEEDED;
+    }
+
+    // store packet once for all sinks
+    uint8_t * packet = a2dp_source_broadcast_get_packet(broadcast, broadcast->packet_nr);
+    little_endian_store_32(packet, 0, timestamp);
+    little_endian_store_16(packet, 4, payload_size);
+    packet[6] = marker;
+    (void)memcpy(&packet[A2DP_SOURCE_BROADCAST_PACKET_HEADER_SIZE], payload, payload_size);
+    broadcast->packet_nr++;
+
+    btstack_linked_list_iterator_t it;
+    btstack_linked_list_iterator_init(&it, &broadcast->sinks);
+    while (btstack_linked_list_iterator_has_next(&it)){
+        a2dp_source_broadcast_sink_t * sink = (a2dp_source_broadcast_sink_t *) btstack_linked_list_iterator_next(&it);
+        // drop oldest packets if sink falls behind, its slot was just overwritten
+        uint32_t num_packets_queued = broadcast->packet_nr - sink->packet_nr;
+        if (num_packets_queued > broadcast->num_packets){
+            uint32_t num_packets_dropped = num_packets_queued - broadcast->num_packets;
+            log_info("broadcast sink cid 0x%02x, seid %u: drop %u packets", sink->a2dp_cid, sink->local_seid, (unsigned int) num_packets_dropped);
+            sink->num_packets_dropped += num_packets_dropped;
+            sink->packet_nr += num_packets_dropped;
+        }
+        a2dp_source_broadcast_sink_request_can_send_now(sink);
+    }
+    return ERROR_CODE_SUCCESS;
+}
+
+void a2dp_source_broadcast_deinit(a2dp_source_broadcast_t * broadcast){
+    btstack_linked_list_remove(&a2dp_source_broadcasts, (btstack_linked_item_t *) broadcast);
+    btstack_linked_list_iterator_t it;
+    btstack_linked_list_iterator_init(&it, &broadcast->sinks);
+    while (btstack_linked_list_iterator_has_next(&it)){
+        a2dp_source_broadcast_sink_t * sink = (a2dp_source_broadcast_sink_t *) btstack_linked_list_iterator_next(&it);
+        a2dp_source_broadcast_sink_cancel_can_send_now(sink);
+    }
+    broadcast->sinks = NULL;
+}
+
+void a2dp_source_rate_control_enable(a2dp_source_rate_control_t * rate_control, uint16_t a2dp_cid, uint8_t local_seid, uint8_t min_bitpool, uint8_t max_bitpool){
+    btstack_assert(min_bitpool <= max_bitpool);
+    memset(rate_control, 0, sizeof(a2dp_source_rate_control_t));
+    rate_control->a2dp_cid = a2dp_cid;
+    rate_control->local_seid = local_seid;
+    rate_control->min_bitpool = min_bitpool;
+    rate_control->max_bitpool = max_bitpool;
+    rate_control->bitpool = max_bitpool;
+    btstack_linked_list_add(&a2dp_source_rate_controls, (btstack_linked_item_t *) rate_control);
+}
+
+void a2dp_source_rate_control_disable(a2dp_source_rate_control_t * rate_control){
+    btstack_linked_list_remove(&a2dp_source_rate_controls, (btstack_linked_item_t *) rate_control);
+}
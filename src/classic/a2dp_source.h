@@ -46,12 +46,55 @@
 #define A2DP_SOURCE_H
 
 #include <stdint.h>
+#include "btstack_linked_list.h"
 #include "classic/avdtp.h"
 
 #if defined __cplusplus
 extern "C" {
 #endif
 
+// header of each media packet stored in broadcast storage: timestamp (4), payload size (2), marker (1)
+#define A2DP_SOURCE_BROADCAST_PACKET_HEADER_SIZE 7
+
+typedef struct {
+    btstack_linked_item_t item;
+    uint16_t a2dp_cid;
+    uint8_t  local_seid;
+    // number of next broadcast packet to send
+    uint32_t packet_nr;
+    // RTP timestamp starts at 0 for each sink
+    uint32_t timestamp_offset;
+    bool     timestamp_offset_set;
+    bool     can_send_now_requested;
+    uint32_t num_packets_dropped;
+} a2dp_source_broadcast_sink_t;
+
+typedef struct {
+    btstack_linked_item_t item;
+    uint16_t a2dp_cid;
+    uint8_t  local_seid;
+    uint8_t  min_bitpool;
+    uint8_t  max_bitpool;
+    // current SBC bitpool
+    uint8_t  bitpool;
+    uint16_t num_good_samples;
+    // samples to wait after decrease
+    uint16_t num_hold_off_samples;
+    // counters
+    uint32_t num_samples;
+    uint32_t num_congested_samples;
+} a2dp_source_rate_control_t;
+
+typedef struct {
+    btstack_linked_item_t item;
+    btstack_linked_list_t sinks;
+    uint8_t *  storage;
+    uint16_t   num_packets;
+    uint16_t   max_payload_size;
+    // number of packets queued since init
+    uint32_t   packet_nr;
+} a2dp_source_broadcast_t;
+
 /* API_START */
 
 /**
@@ -244,6 +287,77 @@ uint8_t a2dp_source_set_config_other(uint16_t a2dp_cid,  uint8_t local_seid, uin
  */
 void a2dp_source_register_media_config_validator(uint8_t (*callback)(const avdtp_stream_endpoint_t * stream_endpoint, const uint8_t * event, uint16_t size));
 
+/**
+ * @brief Init broadcast group that sends each media payload to all its sinks. The application encodes the media
+ * payload once and queues it via a2dp_source_broadcast_send_media_payload_rtp. Sinks need identical codec configuration.
+ * For each sink, the broadcast group keeps track of the next packet to send and the RTP timestamp offset, and sends
+ * queued packets whenever the sink's L2CAP channel can send. The RTP sequence number is maintained by AVDTP per stream. If a sink falls behind by more than the number of stored
+ * packets, its oldest packets are dropped. For sinks in a broadcast group, A2DP_SUBEVENT_STREAMING_CAN_SEND_MEDIA_PACKET_NOW
+ * is not emitted.
+ * @param broadcast
+ * @param storage for queued packets, each packet requires A2DP_SOURCE_BROADCAST_PACKET_HEADER_SIZE + max_payload_size bytes
+ * @param storage_size
+ * @param max_payload_size must not exceed a2dp_max_media_payload_size of any sink
+ * @return status ERROR_CODE_SUCCESS or ERROR_CODE_MEMORY_CAPACITY_EXCEEDED if storage cannot hold a single packet
+ */
+uint8_t a2dp_source_broadcast_init(a2dp_source_broadcast_t * broadcast, uint8_t * storage, uint32_t storage_size, uint16_t max_payload_size);
+
+/**
+ * @brief Add sink to broadcast group. Sink receives packets queued after this call
+ * @param broadcast
+ * @param sink
+ * @param a2dp_cid 			A2DP channel identifier.
+ * @param local_seid  		ID of a local stream endpoint.
+ */
+void a2dp_source_broadcast_add_sink(a2dp_source_broadcast_t * broadcast, a2dp_source_broadcast_sink_t * sink, uint16_t a2dp_cid, uint8_t local_seid);
+
+/**
+ * @brief Remove sink from broadcast group, e.g. when stream was suspended or released.
+ * Pending requests to send the next packet are dropped.
+ * @param broadcast
+ * @param sink
+ */
+void a2dp_source_broadcast_remove_sink(a2dp_source_broadcast_t * broadcast, a2dp_source_broadcast_sink_t * sink);
+
+/**
+ * @brief Queue media payload for all sinks in broadcast group
+ * @param broadcast
+ * @param marker
+ * @param timestamp         in sample rate units
+ * @param payload
+ * @param payload_size
+ * @return status ERROR_CODE_SUCCESS or ERROR_CODE_MEMORY_CAPACITY_EXCEEDED if payload is larger than max_payload_size
+ */
+uint8_t a2dp_source_broadcast_send_media_payload_rtp(a2dp_source_broadcast_t * broadcast, uint8_t marker, uint32_t timestamp,
+                                                     const uint8_t * payload, uint16_t payload_size);
+
+/**
+ * @brief De-Init broadcast group
+ * @param broadcast
+ */
+void a2dp_source_broadcast_deinit(a2dp_source_broadcast_t * broadcast);
+
+/**
+ * @brief Enable rate control for stream. Before each A2DP_SUBEVENT_STREAMING_CAN_SEND_MEDIA_PACKET_NOW, the number of
+ * packets in flight on the ACL connection and, for broadcast sinks, the number of queued packets are sampled.
+ * On congestion, the SBC bitpool is reduced by a quarter, further congestion is ignored for
+ * A2DP_SOURCE_RATE_CONTROL_DECREASE_HOLD_OFF_SAMPLES samples; after a period without congestion, it is increased by one. Changes are reported with A2DP_SUBEVENT_STREAMING_RATE_CHANGED. The application applies the
+ * new bitpool to its SBC encoder (or maps it to the bitrate of other codecs) and fits as many frames into a media
+ * packet as a2dp_max_media_payload_size allows.
+ * @param rate_control
+ * @param a2dp_cid 			A2DP channel identifier.
+ * @param local_seid  		ID of a local stream endpoint.
+ * @param min_bitpool       lowest bitpool, e.g. from configured SBC min bitpool
+ * @param max_bitpool       start and highest bitpool, e.g. from configured SBC max bitpool
+ */
+void a2dp_source_rate_control_enable(a2dp_source_rate_control_t * rate_control, uint16_t a2dp_cid, uint8_t local_seid, uint8_t min_bitpool, uint8_t max_bitpool);
+
+/**
+ * @brief Disable rate control for stream
+ * @param rate_control
+ */
+void a2dp_source_rate_control_disable(a2dp_source_rate_control_t * rate_control);
+
 /**
  * @brief De-Init A2DP Source device.
  */
@@ -476,12 +476,43 @@ static int bnep_filter_multicast(bnep_channel_t *channel, bd_addr_t addr_dest)
 	return 0;
 }
 
+int bnep_frame_passes_filter(uint16_t bnep_cid, const uint8_t *packet, uint16_t len)
+{
+    bnep_channel_t *channel;
+    bd_addr_t       addr_dest;
+    uint16_t        network_protocol_type;
+    uint16_t        pos = 2 * sizeof(bd_addr_t);
 
-/* Send BNEP ethernet packet */
-int bnep_send(uint16_t bnep_cid, uint8_t *packet, uint16_t len)
+    channel = bnep_channel_for_l2cap_cid(bnep_cid);
+    if (channel == NULL) {
+        return 0;
+    }
+
+    if (len < (pos + sizeof(uint16_t))) {
+        return 0;
+    }
+
+    bd_addr_copy(addr_dest, packet);
+    network_protocol_type = big_endian_read_16(packet, pos);
+    pos += sizeof(uint16_t);
+
+    if (network_protocol_type == ETHERTYPE_VLAN) {
+        if ((len - pos) < 4) {
+            return 0;
+        }
+        /* Tag header is sent even if the packet is filtered out */
+        return 1;
+    }
+
+    return bnep_filter_protocol(channel, network_protocol_type) && bnep_filter_multicast(channel, addr_dest);
+}
+
+/* Send BNEP ethernet packet, copy frame data via callback */
+int bnep_send_with_copy_callback(uint16_t bnep_cid, uint16_t len, bnep_frame_copy_callback_t copy_frame, void * context)
 {
     bnep_channel_t *channel;
     uint8_t        *bnep_out_buffer = NULL;
+    uint8_t         header[(2 * sizeof(bd_addr_t)) + 2 + 4];
     uint16_t        pos = 0;
     uint16_t        pos_out = 0;
     uint16_t        payload_len;
@@ -508,13 +539,16 @@ int bnep_send(uint16_t bnep_cid, uint8_t *packet, uint16_t len)
         return BTSTACK_ACL_BUFFERS_FULL;
     }
 
+    /* Get ethernet header incl. optional IEEE 802.1Q tag */
+    (*copy_frame)(context, 0, header, btstack_min(len, sizeof(header)));
+
     /* Extract destination and source address from the ethernet packet */
     pos = 0;
-    bd_addr_copy(addr_dest, &packet[pos]);
+    bd_addr_copy(addr_dest, &header[pos]);
     pos += sizeof(bd_addr_t);
-    bd_addr_copy(addr_source, &packet[pos]);
+    bd_addr_copy(addr_source, &header[pos]);
     pos += sizeof(bd_addr_t);
-    network_protocol_type = big_endian_read_16(packet, pos);
+    network_protocol_type = big_endian_read_16(header, pos);
     pos += sizeof(uint16_t);
 
     payload_len = len - pos;
@@ -525,7 +559,7 @@ int bnep_send(uint16_t bnep_cid, uint8_t *packet, uint16_t len)
 			return 0;
         }
         /* The "real" network protocol type is 4 bytes ahead in a VLAN packet */
-		network_protocol_type = big_endian_read_16(packet, pos + 2);
+		network_protocol_type = big_endian_read_16(header, pos + 2);
 	}
 
     /* Check network protocol and multicast filters before sending */
@@ -545,6 +579,12 @@ int bnep_send(uint16_t bnep_cid, uint8_t *packet, uint16_t len)
         }
     }
 
+    /* Check for MTU limits */
+    if (payload_len > channel->max_frame_size) {
+        log_error("bnep_send: Max frame size (%d) exceeded: %d", channel->max_frame_size, payload_len);
+        return BNEP_DATA_LEN_EXCEEDS_MTU;
+    }
+
     /* Reserve l2cap packet buffer */    
     l2cap_reserve_packet_buffer();
     bnep_out_buffer = l2cap_get_outgoing_buffer();
@@ -556,12 +596,6 @@ int bnep_send(uint16_t bnep_cid, uint8_t *packet, uint16_t len)
     has_source = (memcmp(addr_source, channel->local_addr, ETHER_ADDR_LEN) != 0);
     has_dest = (memcmp(addr_dest, channel->remote_addr, ETHER_ADDR_LEN) != 0);
 
-    /* Check for MTU limits */
-    if (payload_len > channel->max_frame_size) {
-        log_error("bnep_send: Max frame size (%d) exceeded: %d", channel->max_frame_size, payload_len);
-        return BNEP_DATA_LEN_EXCEEDS_MTU;
-    }
-    
     /* Fill in the package type depending on the given source and destination address */
     if (has_source && has_dest) {
         bnep_out_buffer[pos_out++] = BNEP_PKT_TYPE_GENERAL_ETHERNET;
@@ -593,7 +627,7 @@ int bnep_send(uint16_t bnep_cid, uint8_t *packet, uint16_t len)
     
     /* TODO: Add extension headers, if we may support them at a later stage */
     /* Add the payload and then send out the package */
-    (void)memcpy(bnep_out_buffer + pos_out, packet + pos, payload_len);
+    (*copy_frame)(context, pos, bnep_out_buffer + pos_out, payload_len);
     pos_out += payload_len;
 
     err = l2cap_send_prepared(channel->l2cap_cid, pos_out);
@@ -604,6 +638,18 @@ int bnep_send(uint16_t bnep_cid, uint8_t *packet, uint16_t len)
     return err;        
 }
 
+static void bnep_copy_frame_from_buffer(void * context, uint16_t offset, uint8_t * buffer, uint16_t len)
+{
+    const uint8_t * packet = (const uint8_t *) context;
+    (void)memcpy(buffer, &packet[offset], len);
+}
+
+/* Send BNEP ethernet packet */
+int bnep_send(uint16_t bnep_cid, uint8_t *packet, uint16_t len)
+{
+    return bnep_send_with_copy_callback(bnep_cid, len, &bnep_copy_frame_from_buffer, packet);
+}
+
 
 /* Set BNEP network protocol type filter */
 int bnep_set_net_type_filter(uint16_t bnep_cid, bnep_net_filter_t *filter, uint16_t len)
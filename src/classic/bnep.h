@@ -162,6 +162,15 @@ void bnep_packet_handler(uint8_t packet_type, uint16_t channel, uint8_t *packet,
 
 /* API_START */
 
+/**
+ * @brief Callback to copy part of an Ethernet frame into the outgoing buffer
+ * @param context
+ * @param offset in Ethernet frame
+ * @param buffer
+ * @param len
+ */
+typedef void (*bnep_frame_copy_callback_t)(void * context, uint16_t offset, uint8_t * buffer, uint16_t len);
+
 /**
  * @brief Set up BNEP.
  */
@@ -185,6 +194,26 @@ void bnep_request_can_send_now_event(uint16_t bnep_cid);
  */
 int bnep_send(uint16_t bnep_cid, uint8_t *packet, uint16_t len);
 
+/**
+ * @brief Send a data packet that is not stored in a single buffer, e.g. a chain of network buffers.
+ * @note The Ethernet frame is copied via copy_frame directly into the outgoing L2CAP buffer
+ * @param bnep_cid
+ * @param len of Ethernet frame
+ * @param copy_frame callback to copy parts of the Ethernet frame
+ * @param context passed to copy_frame
+ */
+int bnep_send_with_copy_callback(uint16_t bnep_cid, uint16_t len, bnep_frame_copy_callback_t copy_frame, void * context);
+
+/**
+ * @brief Check if an Ethernet frame passes the network protocol and multicast address filters set by the remote device.
+ * @note Allows to skip frames before they are copied or queued. Filtered frames with IEEE 802.1Q tag pass as bnep_send sends the tag.
+ * @param bnep_cid
+ * @param packet with Ethernet header incl. optional IEEE 802.1Q tag
+ * @param len of Ethernet frame
+ * @return 1 if frame passes filters or has IEEE 802.1Q tag
+ */
+int bnep_frame_passes_filter(uint16_t bnep_cid, const uint8_t *packet, uint16_t len);
+
 /**
  * @brief Set the network protocol filter.
  */
@@ -70,6 +70,80 @@ float btstack_cvsd_plc_rcos(int index){
     return rcos[index];
 }
 
+#ifdef ENABLE_PLC_FIXED_POINT
+
+// rcos in Q15
+static const int16_t rcos_q15[CVSD_OLAL] = {
+    32489, 30314, 26258, 20868, 14872, 9081, 4276, 1106
+};
+
+// products are scaled down by log2(CVSD_M) to sum up CVSD_M of them in 32 bit
+#define CVSD_CORRELATION_SHIFT 5
+
+// used for the correlation of template and candidate window, and for the energy of the first candidate window
+static int32_t btstack_cvsd_plc_dot_product(const BTSTACK_CVSD_PLC_SAMPLE_FORMAT *x, const BTSTACK_CVSD_PLC_SAMPLE_FORMAT *y){
+    int32_t acc = 0;
+    int m;
+    for (m=0;m<CVSD_M;m++){
+        acc += (x[m] * y[m]) >> CVSD_CORRELATION_SHIFT;
+    }
+    return acc;
+}
+
+static int32_t btstack_cvsd_plc_energy_term(BTSTACK_CVSD_PLC_SAMPLE_FORMAT x){
+    return (x * x) >> CVSD_CORRELATION_SHIFT;
+}
+
+static BTSTACK_CVSD_PLC_SAMPLE_FORMAT btstack_cvsd_plc_saturate(int32_t value){
+    if (value > 32767)  return 32767;
+    if (value < -32768) return -32768;
+    return (BTSTACK_CVSD_PLC_SAMPLE_FORMAT) value;
+}
+
+static BTSTACK_CVSD_PLC_SAMPLE_FORMAT btstack_cvsd_plc_scale_q15(int32_t sf, BTSTACK_CVSD_PLC_SAMPLE_FORMAT x){
+    return (BTSTACK_CVSD_PLC_SAMPLE_FORMAT) ((sf * x) >> 15);
+}
+
+// weights for left and right are rcos_q15[index] and rcos_q15[CVSD_OLAL-1-index]
+static BTSTACK_CVSD_PLC_SAMPLE_FORMAT btstack_cvsd_plc_overlap_add_q15(BTSTACK_CVSD_PLC_SAMPLE_FORMAT left, BTSTACK_CVSD_PLC_SAMPLE_FORMAT right, int index){
+    int32_t val = (left * rcos_q15[index]) + (right * rcos_q15[CVSD_OLAL-1-index]);
+    return btstack_cvsd_plc_saturate((val + (1 << 14)) >> 15);
+}
+
+// scale factor sumx/sumy limited to [0.75, 1.0] in Q15
+static int32_t btstack_cvsd_plc_amplitude_match_q15(uint16_t num_samples, const BTSTACK_CVSD_PLC_SAMPLE_FORMAT *y, int16_t bestmatch){
+    int32_t sumx = 0;
+    int32_t sumy = 0;
+    int i;
+    for (i=0;i<num_samples;i++){
+        sumx += abs(y[CVSD_LHIST-num_samples+i]);
+        sumy += abs(y[bestmatch+i]);
+    }
+    if (sumx >= sumy) return 0x8000;
+    int32_t sf = (int32_t) (((int64_t) sumx << 15) / sumy);
+    if (sf < 0x6000) sf = 0x6000;
+    return sf;
+}
+
+static void btstack_cvsd_plc_replicate_first_frame_q15(btstack_cvsd_plc_state_t *plc_state, uint16_t num_samples){
+    int16_t * hist = plc_state->hist;
+    const int16_t * match = &plc_state->hist[plc_state->bestlag];
+    int32_t sf = btstack_cvsd_plc_amplitude_match_q15(num_samples, hist, plc_state->bestlag);
+    int i;
+    for (i=0; i<num_samples; i++){
+        hist[CVSD_LHIST+i] = btstack_cvsd_plc_scale_q15(sf, match[i]);
+    }
+    for (i=num_samples; i<(num_samples+CVSD_OLAL); i++){
+        BTSTACK_CVSD_PLC_SAMPLE_FORMAT left = btstack_cvsd_plc_scale_q15(sf, match[i]);
+        hist[CVSD_LHIST+i] = btstack_cvsd_plc_overlap_add_q15(left, match[i], i-num_samples);
+    }
+    for (i=(num_samples+CVSD_OLAL); i<(num_samples+CVSD_RT+CVSD_OLAL); i++){
+        hist[CVSD_LHIST+i] = match[i];
+    }
+}
+#endif
+
+#ifndef ENABLE_PLC_FIXED_POINT
 // taken from http://www.codeproject.com/Articles/69941/Best-Square-Root-Method-Algorithm-Function-Precisi
 // Algorithm: Babylonian Method + some manipulations on IEEE 32 bit floating point representation
 static float sqrt3(const float x){
@@ -88,12 +162,14 @@ static float sqrt3(const float x){
 
     return u.x;
 }
+#endif
 
 static float btstack_cvsd_plc_absolute(float x){
      if (x < 0) x = -x;
      return x;
 }
 
+#ifndef ENABLE_PLC_FIXED_POINT
 static float btstack_cvsd_plc_cross_correlation(BTSTACK_CVSD_PLC_SAMPLE_FORMAT *x, BTSTACK_CVSD_PLC_SAMPLE_FORMAT *y){
     float num = 0.f;
     float den = 0.f;
@@ -108,8 +184,28 @@ static float btstack_cvsd_plc_cross_correlation(BTSTACK_CVSD_PLC_SAMPLE_FORMAT *
     den = (float)sqrt3(x2*y2);
     return num/den;
 }
+#endif
 
 int btstack_cvsd_plc_pattern_match(BTSTACK_CVSD_PLC_SAMPLE_FORMAT *y){
+#ifdef ENABLE_PLC_FIXED_POINT
+    // maximize num / sqrt(energy). Template energy is the same for all candidates, so compare
+    // num * |num| / energy instead and update energy of candidate window incrementally
+    const BTSTACK_CVSD_PLC_SAMPLE_FORMAT * template = &y[CVSD_LHIST-CVSD_M];
+    int64_t best_score = INT64_MIN;
+    int     bestmatch = 0;
+    int32_t energy = btstack_cvsd_plc_dot_product(y, y);
+    int     n;
+    for (n=0;n<CVSD_N;n++){
+        int32_t num = btstack_cvsd_plc_dot_product(template, &y[n]);
+        int64_t score = ((int64_t) num * abs(num)) / (energy + 1);
+        if (score > best_score){
+            bestmatch  = n;
+            best_score = score;
+        }
+        energy += btstack_cvsd_plc_energy_term(y[n+CVSD_M]) - btstack_cvsd_plc_energy_term(y[n]);
+    }
+    return bestmatch;
+#else
     float maxCn = -999999.f;  // large negative number
     int   bestmatch = 0;
     float Cn;
@@ -122,6 +218,7 @@ int btstack_cvsd_plc_pattern_match(BTSTACK_CVSD_PLC_SAMPLE_FORMAT *y){
         }
     }
     return bestmatch;
+#endif
 }
 
 float btstack_cvsd_plc_amplitude_match(btstack_cvsd_plc_state_t *plc_state, uint16_t num_samples, BTSTACK_CVSD_PLC_SAMPLE_FORMAT *y, BTSTACK_CVSD_PLC_SAMPLE_FORMAT bestmatch){
@@ -313,9 +410,11 @@ static void octave_fprintf_plot_output(btstack_cvsd_plc_state_t *plc_state, FILE
 #endif
 
 void btstack_cvsd_plc_bad_frame(btstack_cvsd_plc_state_t *plc_state, uint16_t num_samples, BTSTACK_CVSD_PLC_SAMPLE_FORMAT *out){
+#ifndef ENABLE_PLC_FIXED_POINT
     float val;
-    int   i;
     float sf = 1;
+#endif
+    int   i;
     plc_state->nbf++;
 
     if (plc_state->max_consecutive_bad_frames_nr < plc_state->nbf){
@@ -338,6 +437,9 @@ void btstack_cvsd_plc_bad_frame(btstack_cvsd_plc_state_t *plc_state, uint16_t nu
         // the replication begins after the template match
         plc_state->bestlag += CVSD_M;
 
+#ifdef ENABLE_PLC_FIXED_POINT
+        btstack_cvsd_plc_replicate_first_frame_q15(plc_state, num_samples);
+#else
         // Compute Scale Factor to Match Amplitude of Substitution Packet to that of Preceding Packet
         sf = btstack_cvsd_plc_amplitude_match(plc_state, num_samples, plc_state->hist, plc_state->bestlag);
         for (i=0; i<CVSD_OLAL; i++){
@@ -360,6 +462,7 @@ void btstack_cvsd_plc_bad_frame(btstack_cvsd_plc_state_t *plc_state, uint16_t nu
         for (i=(num_samples+CVSD_OLAL); i<(num_samples+CVSD_RT+CVSD_OLAL); i++){
             plc_state->hist[CVSD_LHIST+i] = plc_state->hist[plc_state->bestlag+i];
         }
+#endif
     } else {
         for (i=0; i<(num_samples+CVSD_RT+CVSD_OLAL); i++){
             plc_state->hist[CVSD_LHIST+i] = plc_state->hist[plc_state->bestlag+i];
@@ -384,7 +487,6 @@ void btstack_cvsd_plc_bad_frame(btstack_cvsd_plc_state_t *plc_state, uint16_t nu
 }
 
 void btstack_cvsd_plc_good_frame(btstack_cvsd_plc_state_t *plc_state, uint16_t num_samples, BTSTACK_CVSD_PLC_SAMPLE_FORMAT *in, BTSTACK_CVSD_PLC_SAMPLE_FORMAT *out){
-    float val;
     int i = 0;
 #ifdef OCTAVE_OUTPUT
     FILE * oct_file = NULL;
@@ -401,10 +503,14 @@ void btstack_cvsd_plc_good_frame(btstack_cvsd_plc_state_t *plc_state, uint16_t n
         }
 
         for (i=CVSD_RT;i<(CVSD_RT+CVSD_OLAL);i++){
+#ifdef ENABLE_PLC_FIXED_POINT
+            out[i] = btstack_cvsd_plc_overlap_add_q15(plc_state->hist[CVSD_LHIST+i], in[i], i-CVSD_RT);
+#else
             float left  = plc_state->hist[CVSD_LHIST+i];
             float right = in[i];
-            val = (left * rcos[i-CVSD_RT]) + (right *rcos[CVSD_OLAL+CVSD_RT-1-i]);
+            float val = (left * rcos[i-CVSD_RT]) + (right *rcos[CVSD_OLAL+CVSD_RT-1-i]);
             out[i] = btstack_cvsd_plc_crop_sample((BTSTACK_CVSD_PLC_SAMPLE_FORMAT)val);
+#endif
         }
     }
 
@@ -51,9 +51,23 @@
 #error "Please set NVM_NUM_LINK_KEYS in btstack_config.h - number of link keys that can be stored in TLV"
 #endif
 
+#define BTSTACK_LINK_KEY_DB_TLV_INDEX_NONE 0xffffu
+
+// RAM index of stored link keys, allows to find slot for bd_addr without reading from TLV
+typedef struct {
+    uint32_t  seq_nr;
+    bd_addr_t bd_addr;
+    bool      valid;
+    // chain of entries in same address hash bucket
+    uint16_t  hash_next;
+} btstack_link_key_db_tlv_index_entry_t;
+
 typedef struct {
     const btstack_tlv_t * btstack_tlv_impl;
     void * btstack_tlv_context;
+    bool   index_loaded;
+    btstack_link_key_db_tlv_index_entry_t index_entries[NVM_NUM_LINK_KEYS];
+    uint16_t index_hash_buckets[NVM_NUM_LINK_KEYS];
 } btstack_link_key_db_tlv_h;
 
 typedef struct link_key_nvm {
@@ -74,95 +88,163 @@ static uint32_t btstack_link_key_db_tag_for_index(uint8_t index){
     return (tag_0 << 24) | (tag_1 << 16) | (tag_2 << 8) | index;
 }
 
-// Device info
-static void btstack_link_key_db_tlv_open(void){
+static uint16_t btstack_link_key_db_tlv_index_hash(const bd_addr_t bd_addr){
+    uint32_t hash = 0;
+    uint8_t i;
+    for (i=0;i<6u;i++){
+        hash = (hash * 31u) + bd_addr[i];
+    }
+    return (uint16_t) (hash % NVM_NUM_LINK_KEYS);
 }
 
-static void btstack_link_key_db_tlv_set_bd_addr(bd_addr_t bd_addr){
-    (void)bd_addr;
+static void btstack_link_key_db_tlv_index_add(uint16_t index, const bd_addr_t bd_addr, uint32_t seq_nr){
+    btstack_link_key_db_tlv_index_entry_t * index_entry = &self->index_entries[index];
+    uint16_t bucket = btstack_link_key_db_tlv_index_hash(bd_addr);
+    index_entry->valid  = true;
+    index_entry->seq_nr = seq_nr;
+    (void)memcpy(index_entry->bd_addr, bd_addr, 6);
+    index_entry->hash_next = self->index_hash_buckets[bucket];
+    self->index_hash_buckets[bucket] = index;
 }
 
-static void btstack_link_key_db_tlv_close(void){ 
+static void btstack_link_key_db_tlv_index_remove(uint16_t index){
+    btstack_link_key_db_tlv_index_entry_t * index_entry = &self->index_entries[index];
+    if (!index_entry->valid) return;
+    uint16_t * link = &self->index_hash_buckets[btstack_link_key_db_tlv_index_hash(index_entry->bd_addr)];
+    while (*link != BTSTACK_LINK_KEY_DB_TLV_INDEX_NONE){
+        if (*link == index){
+            *link = index_entry->hash_next;
+            break;
+        }
+        link = &self->index_entries[*link].hash_next;
+    }
+    index_entry->valid = false;
 }
 
-static int btstack_link_key_db_tlv_get_link_key(bd_addr_t bd_addr, link_key_t link_key, link_key_type_t * link_key_type) {
+static int btstack_link_key_db_tlv_index_lookup(const bd_addr_t bd_addr){
+    uint16_t index = self->index_hash_buckets[btstack_link_key_db_tlv_index_hash(bd_addr)];
+    while (index != BTSTACK_LINK_KEY_DB_TLV_INDEX_NONE){
+        btstack_link_key_db_tlv_index_entry_t * index_entry = &self->index_entries[index];
+        if (memcmp(bd_addr, index_entry->bd_addr, 6) == 0){
+            return index;
+        }
+        index = index_entry->hash_next;
+    }
+    return -1;
+}
+
+static void btstack_link_key_db_tlv_index_load(void){
     int i;
+    for (i=0;i<NVM_NUM_LINK_KEYS;i++){
+        self->index_entries[i].valid = false;
+        self->index_hash_buckets[i] = BTSTACK_LINK_KEY_DB_TLV_INDEX_NONE;
+    }
+    int num_entries = 0;
     for (i=0;i<NVM_NUM_LINK_KEYS;i++){
         link_key_nvm_t entry;
         uint32_t tag = btstack_link_key_db_tag_for_index(i);
         int size = self->btstack_tlv_impl->get_tag(self->btstack_tlv_context, tag, (uint8_t*) &entry, sizeof(entry));
         if (size == 0) continue;
-        log_info("tag %x, addr %s", (unsigned int) tag, bd_addr_to_str(entry.bd_addr));
-        if (memcmp(bd_addr, entry.bd_addr, 6)) continue;
-        // found, pass back
-        (void)memcpy(link_key, entry.link_key, 16);
-        *link_key_type = entry.link_key_type;
-        return 1;
+        btstack_link_key_db_tlv_index_add((uint16_t) i, entry.bd_addr, entry.seq_nr);
+        num_entries++;
+    }
+    self->index_loaded = true;
+    log_info("num link keys %u", num_entries);
+}
+
+// Device info
+static void btstack_link_key_db_tlv_open(void){
+    btstack_link_key_db_tlv_index_load();
+}
+
+static void btstack_link_key_db_tlv_set_bd_addr(bd_addr_t bd_addr){
+    (void)bd_addr;
+}
+
+static void btstack_link_key_db_tlv_close(void){ 
+}
+
+static int btstack_link_key_db_tlv_get_link_key(bd_addr_t bd_addr, link_key_t link_key, link_key_type_t * link_key_type) {
+    if (!self->index_loaded){
+        btstack_link_key_db_tlv_index_load();
+    }
+    int index = btstack_link_key_db_tlv_index_lookup(bd_addr);
+    if (index < 0) return 0;
+
+    link_key_nvm_t entry;
+    uint32_t tag = btstack_link_key_db_tag_for_index(index);
+    int size = self->btstack_tlv_impl->get_tag(self->btstack_tlv_context, tag, (uint8_t*) &entry, sizeof(entry));
+    if (size == 0) {
+        // deleted behind our back
+        btstack_link_key_db_tlv_index_remove((uint16_t) index);
+        return 0;
     }
-	return 0;
+    log_info("tag %x, addr %s", (unsigned int) tag, bd_addr_to_str(entry.bd_addr));
+    // found, pass back
+    (void)memcpy(link_key, entry.link_key, 16);
+    *link_key_type = entry.link_key_type;
+    return 1;
 }
 
 static void btstack_link_key_db_tlv_delete_link_key(bd_addr_t bd_addr){
-    int i;
-    for (i=0;i<NVM_NUM_LINK_KEYS;i++){
-        link_key_nvm_t entry;
-        uint32_t tag = btstack_link_key_db_tag_for_index(i);
-        int size = self->btstack_tlv_impl->get_tag(self->btstack_tlv_context, tag, (uint8_t*) &entry, sizeof(entry));
-        if (size == 0) continue;
-        if (memcmp(bd_addr, entry.bd_addr, 6)) continue;
-        // found, delete tag
-        self->btstack_tlv_impl->delete_tag(self->btstack_tlv_context, tag);
-        break;
+    if (!self->index_loaded){
+        btstack_link_key_db_tlv_index_load();
     }
+    int index = btstack_link_key_db_tlv_index_lookup(bd_addr);
+    if (index < 0) return;
+
+    // found, delete tag
+    uint32_t tag = btstack_link_key_db_tag_for_index(index);
+    self->btstack_tlv_impl->delete_tag(self->btstack_tlv_context, tag);
+    btstack_link_key_db_tlv_index_remove((uint16_t) index);
 }
 
 static void btstack_link_key_db_tlv_put_link_key(bd_addr_t bd_addr, link_key_t link_key, link_key_type_t link_key_type){
+    if (!self->index_loaded){
+        btstack_link_key_db_tlv_index_load();
+    }
+
     int i;
     uint32_t highest_seq_nr = 0;
     uint32_t lowest_seq_nr = 0;
-    uint32_t tag_for_lowest_seq_nr = 0;
-    uint32_t tag_for_addr = 0;
-    uint32_t tag_for_empty = 0;
+    int index_for_lowest_seq_nr = -1;
+    int index_for_addr = btstack_link_key_db_tlv_index_lookup(bd_addr);
+    int index_for_empty = -1;
 
     for (i=0;i<NVM_NUM_LINK_KEYS;i++){
-        link_key_nvm_t entry;
-        uint32_t tag = btstack_link_key_db_tag_for_index(i);
-        int size = self->btstack_tlv_impl->get_tag(self->btstack_tlv_context, tag, (uint8_t*) &entry, sizeof(entry));
+        const btstack_link_key_db_tlv_index_entry_t * index_entry = &self->index_entries[i];
         // empty/deleted tag
-        if (size == 0) {
-            tag_for_empty = tag;
+        if (!index_entry->valid) {
+            index_for_empty = i;
             continue;
         }
-        // found addr?
-        if (memcmp(bd_addr, entry.bd_addr, 6) == 0){
-            tag_for_addr = tag;
-        }
         // update highest seq nr
-        if (entry.seq_nr > highest_seq_nr){
-            highest_seq_nr = entry.seq_nr;
+        if (index_entry->seq_nr > highest_seq_nr){
+            highest_seq_nr = index_entry->seq_nr;
         }
         // find entry with lowest seq nr
-        if ((tag_for_lowest_seq_nr == 0) || (entry.seq_nr < lowest_seq_nr)){
-            tag_for_lowest_seq_nr = tag;
-            lowest_seq_nr = entry.seq_nr;
+        if ((index_for_lowest_seq_nr < 0) || (index_entry->seq_nr < lowest_seq_nr)){
+            index_for_lowest_seq_nr = i;
+            lowest_seq_nr = index_entry->seq_nr;
         }
     }
 
-    log_info("tag_for_addr %x, tag_for_empy %x, tag_for_lowest_seq_nr %x",
-             (unsigned int) tag_for_addr, (unsigned int) tag_for_empty, (unsigned int) tag_for_lowest_seq_nr);
+    log_info("index_for_addr %d, index_for_empty %d, index_for_lowest_seq_nr %d",
+             index_for_addr, index_for_empty, index_for_lowest_seq_nr);
 
-    uint32_t tag_to_use = 0;
-    if (tag_for_addr){
-        tag_to_use = tag_for_addr;
-    } else if (tag_for_empty){
-        tag_to_use = tag_for_empty;
-    } else if (tag_for_lowest_seq_nr){
-        tag_to_use = tag_for_lowest_seq_nr;
+    int index_to_use;
+    if (index_for_addr >= 0){
+        index_to_use = index_for_addr;
+    } else if (index_for_empty >= 0){
+        index_to_use = index_for_empty;
+    } else if (index_for_lowest_seq_nr >= 0){
+        index_to_use = index_for_lowest_seq_nr;
     } else {
         // should not happen
         return;
     }
 
+    uint32_t tag_to_use = btstack_link_key_db_tag_for_index(index_to_use);
     log_info("store with tag %x", (unsigned int) tag_to_use);
 
     link_key_nvm_t entry;
@@ -175,7 +257,12 @@ static void btstack_link_key_db_tlv_put_link_key(bd_addr_t bd_addr, link_key_t l
     int result = self->btstack_tlv_impl->store_tag(self->btstack_tlv_context, tag_to_use, (uint8_t*) &entry, sizeof(entry));
     if (result != 0){
         log_error("store link key failed");
+        return;
     }
+
+    // update index
+    btstack_link_key_db_tlv_index_remove((uint16_t) index_to_use);
+    btstack_link_key_db_tlv_index_add((uint16_t) index_to_use, bd_addr, entry.seq_nr);
 }
 
 static int btstack_link_key_db_tlv_iterator_init(btstack_link_key_iterator_t * it){
@@ -220,6 +307,7 @@ static const btstack_link_key_db_t btstack_link_key_db_tlv = {
 const btstack_link_key_db_t * btstack_link_key_db_tlv_get_instance(const btstack_tlv_t * btstack_tlv_impl, void * btstack_tlv_context){
     self->btstack_tlv_impl = btstack_tlv_impl;
     self->btstack_tlv_context = btstack_tlv_context;
+    self->index_loaded = false;
     return &btstack_link_key_db_tlv;
 }
 
@@ -66,6 +66,102 @@ static uint8_t indices0[] = {
     /*                padding            */   0x00, 0x00, 0x00
 };
 
+#ifdef ENABLE_PLC_FIXED_POINT
+/* Raised COSine table for OLA in Q15 */
+static const int16_t rcos_q15[SBC_OLAL] = {
+    32489, 31662, 30314, 28492, 26258, 23687, 20868, 17896,
+    14872, 11900,  9081,  6510,  4276,  2454,  1106,   279
+};
+
+// products are scaled down by log2(SBC_M) to sum up SBC_M of them in 32 bit
+#define SBC_CORRELATION_SHIFT 6
+
+// correlation of two windows of SBC_M samples in the history buffer, energy if x == y
+static int32_t btstack_sbc_plc_dot_product(const SAMPLE_FORMAT *x, const SAMPLE_FORMAT *y){
+    int32_t acc = 0;
+    int m;
+    for (m=0;m<SBC_M;m++){
+        acc += (x[m] * y[m]) >> SBC_CORRELATION_SHIFT;
+    }
+    return acc;
+}
+
+static int32_t btstack_sbc_plc_energy_term(SAMPLE_FORMAT x){
+    return (x * x) >> SBC_CORRELATION_SHIFT;
+}
+
+static int PatternMatch(SAMPLE_FORMAT *y){
+    // maximize num / sqrt(energy). Template energy is the same for all candidates, so compare
+    // num * |num| / energy instead and update energy of candidate window incrementally
+    const SAMPLE_FORMAT * template = &y[SBC_LHIST-SBC_M];
+    int64_t best_score = INT64_MIN;
+    int     bestmatch = 0;
+    int32_t energy = btstack_sbc_plc_dot_product(y, y);
+    int     n;
+    for (n=0;n<SBC_N;n++){
+        int32_t num = btstack_sbc_plc_dot_product(template, &y[n]);
+        int64_t score = ((int64_t) num * abs(num)) / (energy + 1);
+        if (score > best_score){
+            bestmatch  = n;
+            best_score = score;
+        }
+        energy += btstack_sbc_plc_energy_term(y[n+SBC_M]) - btstack_sbc_plc_energy_term(y[n]);
+    }
+    return bestmatch;
+}
+
+// scale factor sumx/sumy limited to [0.75, 1.0] in Q15
+static int32_t AmplitudeMatch(SAMPLE_FORMAT *y, SAMPLE_FORMAT bestmatch) {
+    int32_t sumx = 0;
+    int32_t sumy = 0;
+    int i;
+    for (i=0;i<SBC_FS;i++){
+        sumx += abs(y[SBC_LHIST-SBC_FS+i]);
+        sumy += abs(y[bestmatch+i]);
+    }
+    if (sumx >= sumy) return 0x8000;
+    int32_t sf = (int32_t) (((int64_t) sumx << 15) / sumy);
+    if (sf < 0x6000) sf = 0x6000;
+    return sf;
+}
+
+static SAMPLE_FORMAT btstack_sbc_plc_saturate(int32_t value){
+    if (value > 32767)  return 32767;
+    if (value < -32768) return -32768;
+    return (SAMPLE_FORMAT) value;
+}
+
+static SAMPLE_FORMAT btstack_sbc_plc_scale_q15(int32_t sf, SAMPLE_FORMAT x){
+    return (SAMPLE_FORMAT) ((sf * x) >> 15);
+}
+
+// weights for left and right are rcos_q15[index] and rcos_q15[SBC_OLAL-1-index]
+static SAMPLE_FORMAT btstack_sbc_plc_overlap_add_q15(SAMPLE_FORMAT left, SAMPLE_FORMAT right, int index){
+    int32_t val = (left * rcos_q15[index]) + (right * rcos_q15[SBC_OLAL-1-index]);
+    return btstack_sbc_plc_saturate((val + (1 << 14)) >> 15);
+}
+
+static void btstack_sbc_plc_replicate_first_frame_q15(btstack_sbc_plc_state_t *plc_state, const SAMPLE_FORMAT *ZIRbuf){
+    SAMPLE_FORMAT * hist = plc_state->hist;
+    const SAMPLE_FORMAT * match = &plc_state->hist[plc_state->bestlag];
+    int32_t sf = AmplitudeMatch(hist, plc_state->bestlag);
+    int i;
+    for (i=0; i<SBC_OLAL; i++){
+        hist[SBC_LHIST+i] = btstack_sbc_plc_overlap_add_q15(ZIRbuf[i], btstack_sbc_plc_scale_q15(sf, match[i]), i);
+    }
+    for (i=SBC_OLAL; i<SBC_FS; i++){
+        hist[SBC_LHIST+i] = btstack_sbc_plc_scale_q15(sf, match[i]);
+    }
+    for (i=SBC_FS; i<(SBC_FS+SBC_OLAL); i++){
+        hist[SBC_LHIST+i] = btstack_sbc_plc_overlap_add_q15(btstack_sbc_plc_scale_q15(sf, match[i]), match[i], i-SBC_FS);
+    }
+    for (i=(SBC_FS+SBC_OLAL); i<(SBC_FS+SBC_RT+SBC_OLAL); i++){
+        hist[SBC_LHIST+i] = match[i];
+    }
+}
+
+#else
+
 /* Raised COSine table for OLA */
 static float rcos[SBC_OLAL] = {
     0.99148655f,0.96623611f,0.92510857f,0.86950446f,
@@ -151,6 +247,7 @@ static SAMPLE_FORMAT crop_sample(float val){
     if (croped_val < -32768.f) croped_val=-32768.f;
     return (SAMPLE_FORMAT) croped_val;
 }
+#endif
 
 uint8_t * btstack_sbc_plc_zero_signal_frame(void){
     return (uint8_t *)&indices0;
@@ -323,9 +420,11 @@ static void octave_fprintf_plot_output(btstack_sbc_plc_state_t *plc_state, FILE
 
 
 void btstack_sbc_plc_bad_frame(btstack_sbc_plc_state_t *plc_state, SAMPLE_FORMAT *ZIRbuf, SAMPLE_FORMAT *out){
+#ifndef ENABLE_PLC_FIXED_POINT
     float val;
-    int   i;
     float sf = 1;
+#endif
+    int   i;
 
     plc_state->nbf++;
     plc_state->bad_frames_nr++;
@@ -352,6 +451,9 @@ void btstack_sbc_plc_bad_frame(btstack_sbc_plc_state_t *plc_state, SAMPLE_FORMAT
         // the replication begins after the template match
         plc_state->bestlag += SBC_M;
 
+#ifdef ENABLE_PLC_FIXED_POINT
+        btstack_sbc_plc_replicate_first_frame_q15(plc_state, ZIRbuf);
+#else
         // Compute Scale Factor to Match Amplitude of Substitution Packet to that of Preceding Packet
         sf = AmplitudeMatch(plc_state->hist, plc_state->bestlag);
         // printf("sf Apmlitude Match %f, new data %d, bestlag+M %d\n", sf, ZIRbuf[0], plc_state->hist[plc_state->bestlag]);
@@ -378,6 +480,7 @@ void btstack_sbc_plc_bad_frame(btstack_sbc_plc_state_t *plc_state, SAMPLE_FORMAT
         for (i=(SBC_FS+SBC_OLAL); i<(SBC_FS+SBC_RT+SBC_OLAL); i++){
             plc_state->hist[SBC_LHIST+i] = plc_state->hist[plc_state->bestlag+i];
         }
+#endif
     } else {
         // printf("succesive bad frame nr %d\n", plc_state->nbf);
         for (i=0; i<(SBC_FS+SBC_RT+SBC_OLAL); i++){
@@ -402,7 +505,6 @@ void btstack_sbc_plc_bad_frame(btstack_sbc_plc_state_t *plc_state, SAMPLE_FORMAT
 }
 
 void btstack_sbc_plc_good_frame(btstack_sbc_plc_state_t *plc_state, SAMPLE_FORMAT *in, SAMPLE_FORMAT *out){
-    float val;
     int i = 0;
     plc_state->good_frames_nr++;
     plc_state->frame_count++;
@@ -423,10 +525,14 @@ void btstack_sbc_plc_good_frame(btstack_sbc_plc_state_t *plc_state, SAMPLE_FORMA
         }
 
         for (i = SBC_RT;i<(SBC_RT+SBC_OLAL);i++){
+#ifdef ENABLE_PLC_FIXED_POINT
+            out[i] = btstack_sbc_plc_overlap_add_q15(plc_state->hist[SBC_LHIST+i], in[i], i-SBC_RT);
+#else
             float left  = plc_state->hist[SBC_LHIST+i];
             float right = in[i];
-            val = (left*rcos[i-SBC_RT]) + (right*rcos[SBC_OLAL+SBC_RT-1-i]);
+            float val = (left*rcos[i-SBC_RT]) + (right*rcos[SBC_OLAL+SBC_RT-1-i]);
             out[i] = crop_sample(val);
+#endif
         }
     }
 
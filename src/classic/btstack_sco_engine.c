@@ -0,0 +1,235 @@
+/*
+ * Copyright (C) 2024 BlueKitchen GmbH
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holders nor the names of
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ * 4. Any redistribution, use, or modification is done solely for
+ *    personal benefit and not for any commercial purpose or for
+ *    monetary gain.
+ *
+ * THIS SOFTWARE IS PROVIDED BY BLUEKITCHEN GMBH AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL BLUEKITCHEN
+ * GMBH OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF
+ * THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ *
+ * Please inquire about commercial licensing options at 
+ * contact@bluekitchen-gmbh.com
+ *
+ */
+
+#define BTSTACK_FILE__ "btstack_sco_engine.c"
+
+// *****************************************************************************
+//
+// SCO Engine
+//
+// *****************************************************************************
+
+#include "btstack_config.h"
+
+#include <string.h>
+
+#include "classic/btstack_sco_engine.h"
+
+#include "btstack_debug.h"
+#include "btstack_event.h"
+#include "btstack_util.h"
+#include "hci.h"
+
+static btstack_linked_list_t    btstack_sco_engine_streams;
+static btstack_packet_handler_t btstack_sco_engine_sco_packet_handler;
+static bool                     btstack_sco_engine_sending;
+
+static btstack_sco_stream_t * btstack_sco_engine_stream_for_handle(hci_con_handle_t con_handle){
+    btstack_linked_list_iterator_t it;
+    btstack_linked_list_iterator_init(&it, &btstack_sco_engine_streams);
+    while (btstack_linked_list_iterator_has_next(&it)){
+        btstack_sco_stream_t * stream = (btstack_sco_stream_t *) btstack_linked_list_iterator_next(&it);
+        if (stream->con_handle == con_handle){
+            return stream;
+        }
+    }
+    return NULL;
+}
+
+static void btstack_sco_engine_send_packet(btstack_sco_stream_t * stream){
+    hci_reserve_packet_buffer();
+    uint8_t * sco_packet = hci_get_outgoing_packet_buffer();
+    uint16_t payload_size = stream->payload_size;
+    if (btstack_ring_buffer_bytes_available(&stream->send_queue) >= payload_size){
+        uint32_t bytes_read = 0;
+        btstack_ring_buffer_read(&stream->send_queue, &sco_packet[3], payload_size, &bytes_read);
+        stream->num_packets_sent++;
+    } else {
+        memset(&sco_packet[3], 0, payload_size);
+        stream->num_packets_silence++;
+    }
+    little_endian_store_16(sco_packet, 0, stream->con_handle);
+    sco_packet[2] = (uint8_t) payload_size;
+    hci_send_sco_packet_buffer(3 + payload_size);
+}
+
+static void btstack_sco_engine_send_packets(void){
+    // avoid recursion as HCI_EVENT_SCO_CAN_SEND_NOW can be emitted during send or request
+    if (btstack_sco_engine_sending) return;
+    btstack_sco_engine_sending = true;
+
+    // send as many packets as controller accepts, round-robin over all streams
+    bool packet_sent = true;
+    while (packet_sent){
+        packet_sent = false;
+        btstack_linked_list_iterator_t it;
+        btstack_linked_list_iterator_init(&it, &btstack_sco_engine_streams);
+        while (btstack_linked_list_iterator_has_next(&it)){
+            btstack_sco_stream_t * stream = (btstack_sco_stream_t *) btstack_linked_list_iterator_next(&it);
+            if (stream->payload_size == 0u){
+                uint16_t sco_packet_length = hci_get_sco_packet_length_for_connection(stream->con_handle);
+                if (sco_packet_length <= 3u) continue;
+                stream->payload_size = btstack_min(sco_packet_length - 3u, 255u);
+            }
+            if (!hci_can_send_sco_packet_now_for_connection(stream->con_handle)) continue;
+            btstack_sco_engine_send_packet(stream);
+            packet_sent = true;
+        }
+    }
+
+    btstack_sco_engine_sending = false;
+
+    // request more blocks
+    btstack_linked_list_iterator_t it;
+    btstack_linked_list_iterator_init(&it, &btstack_sco_engine_streams);
+    while (btstack_linked_list_iterator_has_next(&it)){
+        btstack_sco_stream_t * stream = (btstack_sco_stream_t *) btstack_linked_list_iterator_next(&it);
+        uint32_t num_bytes_free = btstack_ring_buffer_bytes_free(&stream->send_queue);
+        if ((stream->send_block_requested != NULL) && (num_bytes_free >= stream->block_size)){
+            (*stream->send_block_requested)(stream, (uint16_t) btstack_min(num_bytes_free, 0xffffu));
+        }
+    }
+
+    // wait for controller to free SCO buffers. With implicit flow control, connections without credits
+    // get new ones with received SCO packets, which also trigger sending
+    if (btstack_linked_list_empty(&btstack_sco_engine_streams)) return;
+    if (hci_can_send_sco_packet_now()) return;
+    hci_request_sco_can_send_now_event();
+}
+
+static void btstack_sco_engine_handle_sco_packet(uint8_t * packet, uint16_t size){
+    if (size < 3u) return;
+    hci_con_handle_t con_handle = READ_SCO_CONNECTION_HANDLE(packet);
+    btstack_sco_stream_t * stream = btstack_sco_engine_stream_for_handle(con_handle);
+    if (stream == NULL){
+        if (btstack_sco_engine_sco_packet_handler != NULL){
+            (*btstack_sco_engine_sco_packet_handler)(HCI_SCO_DATA_PACKET, 0, packet, size);
+        }
+        return;
+    }
+
+    stream->num_packets_received++;
+    uint8_t packet_status_flag = (packet[1] >> 4) & 3u;
+    if (packet_status_flag != 0u){
+        stream->num_packets_erroneous++;
+    }
+
+    // store payload in receive queue, drop if application does not keep up
+    uint16_t payload_size = btstack_min(packet[2], size - 3u);
+    if (btstack_ring_buffer_bytes_free(&stream->receive_queue) >= payload_size){
+        btstack_ring_buffer_write(&stream->receive_queue, &packet[3], payload_size);
+    } else {
+        stream->num_bytes_dropped += payload_size;
+    }
+
+    uint32_t num_bytes_available = btstack_ring_buffer_bytes_available(&stream->receive_queue);
+    if ((stream->received_block_available != NULL) && (num_bytes_available >= stream->block_size)){
+        (*stream->received_block_available)(stream, (uint16_t) btstack_min(num_bytes_available, 0xffffu));
+    }
+
+    btstack_sco_engine_send_packets();
+}
+
+static void btstack_sco_engine_packet_handler(uint8_t packet_type, uint16_t channel, uint8_t * packet, uint16_t size){
+    switch (packet_type){
+        case HCI_SCO_DATA_PACKET:
+            btstack_sco_engine_handle_sco_packet(packet, size);
+            break;
+        case HCI_EVENT_PACKET:
+            if (hci_event_packet_get_type(packet) == HCI_EVENT_SCO_CAN_SEND_NOW){
+                btstack_sco_engine_send_packets();
+            }
+            if (btstack_sco_engine_sco_packet_handler != NULL){
+                (*btstack_sco_engine_sco_packet_handler)(packet_type, channel, packet, size);
+            }
+            break;
+        default:
+            break;
+    }
+}
+
+void btstack_sco_engine_init(btstack_packet_handler_t sco_packet_handler){
+    btstack_sco_engine_streams = NULL;
+    btstack_sco_engine_sco_packet_handler = sco_packet_handler;
+    btstack_sco_engine_sending = false;
+    hci_register_sco_packet_handler(&btstack_sco_engine_packet_handler);
+}
+
+void btstack_sco_engine_add_stream(btstack_sco_stream_t * stream, hci_con_handle_t sco_con_handle, uint16_t block_size,
+                                   uint8_t * send_storage, uint32_t send_storage_size,
+                                   uint8_t * receive_storage, uint32_t receive_storage_size,
+                                   void (*send_block_requested)(btstack_sco_stream_t * stream, uint16_t num_bytes_free),
+                                   void (*received_block_available)(btstack_sco_stream_t * stream, uint16_t num_bytes_available)){
+    btstack_assert(btstack_sco_engine_stream_for_handle(sco_con_handle) == NULL);
+    memset(stream, 0, sizeof(btstack_sco_stream_t));
+    stream->send_block_requested = send_block_requested;
+    stream->received_block_available = received_block_available;
+    stream->con_handle = sco_con_handle;
+    stream->block_size = block_size;
+    btstack_ring_buffer_init(&stream->send_queue, send_storage, send_storage_size);
+    btstack_ring_buffer_init(&stream->receive_queue, receive_storage, receive_storage_size);
+    btstack_linked_list_add_tail(&btstack_sco_engine_streams, (btstack_linked_item_t *) stream);
+    log_info("SCO Engine: add stream for handle 0x%04x", sco_con_handle);
+
+    // start sending
+    btstack_sco_engine_send_packets();
+}
+
+void btstack_sco_engine_remove_stream(btstack_sco_stream_t * stream){
+    log_info("SCO Engine: remove stream for handle 0x%04x, sent %u, silence %u, received %u, erroneous %u, dropped %u bytes",
+             stream->con_handle, (unsigned int) stream->num_packets_sent, (unsigned int) stream->num_packets_silence,
+             (unsigned int) stream->num_packets_received, (unsigned int) stream->num_packets_erroneous, (unsigned int) stream->num_bytes_dropped);
+    btstack_linked_list_remove(&btstack_sco_engine_streams, (btstack_linked_item_t *) stream);
+}
+
+uint32_t btstack_sco_engine_write(btstack_sco_stream_t * stream, const uint8_t * data, uint32_t size){
+    uint32_t num_bytes = btstack_min(size, btstack_ring_buffer_bytes_free(&stream->send_queue));
+    btstack_ring_buffer_write(&stream->send_queue, (uint8_t *) data, num_bytes);
+    return num_bytes;
+}
+
+uint32_t btstack_sco_engine_read(btstack_sco_stream_t * stream, uint8_t * buffer, uint32_t size){
+    uint32_t num_bytes_read = 0;
+    btstack_ring_buffer_read(&stream->receive_queue, buffer, size, &num_bytes_read);
+    return num_bytes_read;
+}
+
+void btstack_sco_engine_deinit(void){
+    btstack_sco_engine_streams = NULL;
+    btstack_sco_engine_sco_packet_handler = NULL;
+    btstack_sco_engine_sending = false;
+}
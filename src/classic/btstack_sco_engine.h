@@ -0,0 +1,145 @@
+/*
+ * Copyright (C) 2024 BlueKitchen GmbH
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holders nor the names of
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ * 4. Any redistribution, use, or modification is done solely for
+ *    personal benefit and not for any commercial purpose or for
+ *    monetary gain.
+ *
+ * THIS SOFTWARE IS PROVIDED BY BLUEKITCHEN GMBH AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL BLUEKITCHEN
+ * GMBH OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF
+ * THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ *
+ * Please inquire about commercial licensing options at 
+ * contact@bluekitchen-gmbh.com
+ *
+ */
+
+/**
+ * @title SCO Engine
+ * @brief Send and receive audio for multiple SCO connections with per-connection send and receive queues
+ *
+ * The SCO Engine owns the SCO packet handler. For each registered SCO connection, the application writes
+ * SCO payload (CVSD samples or encoded mSBC/LC3-SWB frames) in blocks into the send queue and reads received payload
+ * in blocks from the receive queue. Whenever the controller can accept SCO packets, the engine sends as many packets
+ * as possible for all connections, round-robin, and sends silence (zero bytes) if a send queue runs empty.
+ */
+
+#ifndef BTSTACK_SCO_ENGINE_H
+#define BTSTACK_SCO_ENGINE_H
+
+#include <stdint.h>
+
+#include "bluetooth.h"
+#include "btstack_defines.h"
+#include "btstack_linked_list.h"
+#include "btstack_ring_buffer.h"
+
+#if defined __cplusplus
+extern "C" {
+#endif
+
+typedef struct btstack_sco_stream {
+    btstack_linked_item_t item;
+    hci_con_handle_t con_handle;
+    // SCO payload bytes per packet
+    uint16_t payload_size;
+    // number of bytes handed to/from the application
+    uint16_t block_size;
+    btstack_ring_buffer_t send_queue;
+    btstack_ring_buffer_t receive_queue;
+    // called when send queue can accept a block
+    void (*send_block_requested)(struct btstack_sco_stream * stream, uint16_t num_bytes_free);
+    // called when receive queue contains a block
+    void (*received_block_available)(struct btstack_sco_stream * stream, uint16_t num_bytes_available);
+    // counters
+    uint32_t num_packets_sent;
+    uint32_t num_packets_silence;
+    uint32_t num_packets_received;
+    uint32_t num_packets_erroneous;
+    uint32_t num_bytes_dropped;
+} btstack_sco_stream_t;
+
+/* API_START */
+
+/**
+ * @brief Init SCO Engine. Registers as SCO packet handler with HCI.
+ * @param sco_packet_handler receives SCO packets for connections without SCO stream and HCI_EVENT_SCO_CAN_SEND_NOW
+ *        if requested by the application, can be NULL
+ */
+void btstack_sco_engine_init(btstack_packet_handler_t sco_packet_handler);
+
+/**
+ * @brief Add SCO stream for SCO connection, e.g. on HCI_EVENT_SYNCHRONOUS_CONNECTION_COMPLETE
+ * @param stream
+ * @param sco_con_handle
+ * @param block_size in bytes, callbacks are only called if a complete block can be written or read
+ * @param send_storage for send queue
+ * @param send_storage_size
+ * @param receive_storage for receive queue, used as jitter buffer
+ * @param receive_storage_size
+ * @param send_block_requested called when send queue can accept a block, can be NULL
+ * @param received_block_available called when receive queue contains a block, can be NULL
+ */
+void btstack_sco_engine_add_stream(btstack_sco_stream_t * stream, hci_con_handle_t sco_con_handle, uint16_t block_size,
+                                   uint8_t * send_storage, uint32_t send_storage_size,
+                                   uint8_t * receive_storage, uint32_t receive_storage_size,
+                                   void (*send_block_requested)(btstack_sco_stream_t * stream, uint16_t num_bytes_free),
+                                   void (*received_block_available)(btstack_sco_stream_t * stream, uint16_t num_bytes_available));
+
+/**
+ * @brief Remove SCO stream, e.g. on HCI_EVENT_DISCONNECTION_COMPLETE
+ * @param stream
+ */
+void btstack_sco_engine_remove_stream(btstack_sco_stream_t * stream);
+
+/**
+ * @brief Write SCO payload into send queue
+ * @param stream
+ * @param data
+ * @param size
+ * @return number of bytes stored
+ */
+uint32_t btstack_sco_engine_write(btstack_sco_stream_t * stream, const uint8_t * data, uint32_t size);
+
+/**
+ * @brief Read SCO payload from receive queue
+ * @param stream
+ * @param buffer
+ * @param size
+ * @return number of bytes read
+ */
+uint32_t btstack_sco_engine_read(btstack_sco_stream_t * stream, uint8_t * buffer, uint32_t size);
+
+/**
+ * @brief De-Init SCO Engine
+ */
+void btstack_sco_engine_deinit(void);
+
+/* API_END */
+
+#if defined __cplusplus
+}
+#endif
+
+#endif // BTSTACK_SCO_ENGINE_H
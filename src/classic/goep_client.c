@@ -71,22 +71,46 @@ static btstack_linked_list_t goep_clients;
 static goep_client_t *    goep_client_sdp_active;
 static uint8_t            goep_client_sdp_query_attribute_value[30];
 static const unsigned int goep_client_sdp_query_attribute_value_buffer_size = sizeof(goep_client_sdp_query_attribute_value);
-static uint8_t goep_packet_buffer[150];
+
+// outgoing OBEX packets over L2CAP are assembled here, limits e.g. body size of PUT requests
+#ifndef GOEP_CLIENT_L2CAP_PACKET_BUFFER_SIZE
+#define GOEP_CLIENT_L2CAP_PACKET_BUFFER_SIZE 150
+#endif
+
+static uint8_t goep_packet_buffer[GOEP_CLIENT_L2CAP_PACKET_BUFFER_SIZE];
 
 // singleton instance
 static goep_client_t   goep_client_singleton;
 
 #ifdef ENABLE_GOEP_L2CAP
+
+// L2CAP ERTM configuration for goep_client_create_connection
+// - OBEX packets from the server have to fit into the L2CAP MTU
+// - number of rx buffers is the transmit window of the server, i.e. the number of packets sent without waiting in SRM
+// - buffer size needed: 16 + MTU + num rx buffers * (MPS + 8) + num tx buffers * (MPS + 12), MPS = max segment size
+#ifndef GOEP_CLIENT_ERTM_MTU
+#define GOEP_CLIENT_ERTM_MTU 512
+#endif
+#ifndef GOEP_CLIENT_ERTM_NUM_TX_BUFFERS
+#define GOEP_CLIENT_ERTM_NUM_TX_BUFFERS 2
+#endif
+#ifndef GOEP_CLIENT_ERTM_NUM_RX_BUFFERS
+#define GOEP_CLIENT_ERTM_NUM_RX_BUFFERS 2
+#endif
+#ifndef GOEP_CLIENT_ERTM_BUFFER_SIZE
+#define GOEP_CLIENT_ERTM_BUFFER_SIZE 1000
+#endif
+
 // singleton instance
-static uint8_t goep_client_singleton_ertm_buffer[1000];
+static uint8_t goep_client_singleton_ertm_buffer[GOEP_CLIENT_ERTM_BUFFER_SIZE];
 static l2cap_ertm_config_t goep_client_singleton_ertm_config = {
     1,  // ertm mandatory
     2,  // max transmit, some tests require > 1
     2000,
     12000,
-    512,    // l2cap ertm mtu
-    2,
-    2,
+    GOEP_CLIENT_ERTM_MTU,               // l2cap ertm mtu
+    GOEP_CLIENT_ERTM_NUM_TX_BUFFERS,
+    GOEP_CLIENT_ERTM_NUM_RX_BUFFERS,
     1,      // 16-bit FCS
 };
 #endif
@@ -189,6 +213,7 @@ static void goep_client_packet_handler(uint8_t packet_type, uint16_t channel, ui
                 case L2CAP_EVENT_CHANNEL_OPENED:
                     goep_client = goep_client_for_bearer_cid(l2cap_event_channel_opened_get_local_cid(packet));
                     btstack_assert(goep_client != NULL);
+                    goep_client->bearer_local_mtu = l2cap_event_channel_opened_get_local_mtu(packet);
                     goep_client_handle_connection_opened(goep_client, l2cap_event_channel_opened_get_status(packet),
                                                          btstack_min(l2cap_event_channel_opened_get_remote_mtu(packet), l2cap_event_channel_opened_get_local_mtu(packet)));
                     break;
@@ -427,7 +452,7 @@ static uint8_t * goep_client_get_outgoing_buffer(goep_client_t * goep_client){
 
 static uint16_t goep_client_get_outgoing_buffer_len(goep_client_t * goep_client){
     if (goep_client->l2cap_psm){
-        return sizeof(goep_packet_buffer);
+        return btstack_min(sizeof(goep_packet_buffer), goep_client->bearer_mtu);
     } else {
         return rfcomm_get_max_frame_size(goep_client->bearer_cid);
     }
@@ -640,8 +665,10 @@ void goep_client_request_create_connect(uint16_t goep_cid, uint8_t obex_version_
         return;
     }
     goep_client_packet_init(goep_client, OBEX_OPCODE_CONNECT);
-    // workaround: limit OBEX packet len to L2CAP/RFCOMM MTU to avoid handling of fragemented packets
-    maximum_obex_packet_length = btstack_min(maximum_obex_packet_length, goep_client->bearer_mtu);
+    // OBEX packet has to fit into a single L2CAP SDU, while the OBEX parser handles packets spanning multiple RFCOMM frames
+    if (goep_client->l2cap_psm != 0){
+        maximum_obex_packet_length = btstack_min(maximum_obex_packet_length, goep_client->bearer_local_mtu);
+    }
     
     uint8_t * buffer = goep_client_get_outgoing_buffer(goep_client);
     uint16_t buffer_len = goep_client_get_outgoing_buffer_len(goep_client);
@@ -81,6 +81,7 @@ typedef struct {
     uint16_t         l2cap_psm;
     uint16_t         bearer_cid;
     uint16_t         bearer_mtu;
+    uint16_t         bearer_local_mtu;
 
     uint16_t         record_index;
 
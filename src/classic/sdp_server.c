@@ -56,6 +56,11 @@
 #include "hci_dump.h"
 #include "l2cap.h"
 
+// max number of l2cap connections that are served concurrently, each with its own response buffer
+#ifndef MAX_NR_SDP_SERVER_CONNECTIONS
+#define MAX_NR_SDP_SERVER_CONNECTIONS 1
+#endif
+
 // max number of incoming l2cap connections that can be queued instead of getting rejected
 #ifndef SDP_WAITING_LIST_MAX_COUNT
 #define SDP_WAITING_LIST_MAX_COUNT 8
@@ -69,18 +74,40 @@
 #define SDP_RESPONSE_BUFFER_SIZE (HCI_ACL_PAYLOAD_SIZE-L2CAP_HEADER_SIZE)
 #endif
 
+// cache for complete serialized attribute lists of last Service Attribute or Service Search Attribute request -- disabled by default
+#ifndef SDP_RESPONSE_CACHE_SIZE
+#define SDP_RESPONSE_CACHE_SIZE 0
+#endif
+
+// cached continuation state: database generation (2), offset into cached response (2), request PDU ID (1)
+#define SDP_CACHED_CONTINUATION_STATE_LEN 5
+
 static void sdp_packet_handler(uint8_t packet_type, uint16_t channel, uint8_t *packet, uint16_t size);
 
+typedef struct {
+    uint16_t l2cap_cid;
+    uint16_t response_size;
+    uint8_t  response_buffer[SDP_RESPONSE_BUFFER_SIZE];
+} sdp_server_connection_t;
+
 // registered service records
 static btstack_linked_list_t sdp_server_service_records;
 
 // our handles start after the reserved range
 static uint32_t sdp_server_next_service_record_handle;
 
-static uint8_t sdp_response_buffer[SDP_RESPONSE_BUFFER_SIZE];
+// incremented on every change of the service records, used to detect stale continuation states
+static uint16_t sdp_server_database_generation;
 
-static uint16_t sdp_server_l2cap_cid;
-static uint16_t sdp_server_response_size;
+#if SDP_RESPONSE_CACHE_SIZE > 0
+// cache contains request key (PDU ID, ServiceSearchPattern or ServiceRecordHandle, AttributeIDList) followed by response
+static uint8_t  sdp_response_cache[SDP_RESPONSE_CACHE_SIZE];
+static uint16_t sdp_response_cache_key_len;
+static uint16_t sdp_response_cache_response_len;
+static bool     sdp_response_cache_valid;
+#endif
+
+static sdp_server_connection_t sdp_server_connections[MAX_NR_SDP_SERVER_CONNECTIONS];
 static uint16_t sdp_server_l2cap_waiting_list_cids[SDP_WAITING_LIST_MAX_COUNT];
 static int      sdp_server_l2cap_waiting_list_count;
 
@@ -92,9 +119,19 @@ void sdp_init(void){
 
 void sdp_deinit(void){
     sdp_server_service_records = NULL;
-    sdp_server_l2cap_cid = 0;
-    sdp_server_response_size = 0;
+    memset(sdp_server_connections, 0, sizeof(sdp_server_connections));
     sdp_server_l2cap_waiting_list_count = 0;
+    sdp_server_database_generation = 0;
+#if SDP_RESPONSE_CACHE_SIZE > 0
+    sdp_response_cache_valid = false;
+#endif
+}
+
+static void sdp_server_database_changed(void){
+    sdp_server_database_generation++;
+#if SDP_RESPONSE_CACHE_SIZE > 0
+    sdp_response_cache_valid = false;
+#endif
 }
 
 uint32_t sdp_get_service_record_handle(const uint8_t * record){
@@ -155,10 +192,13 @@ uint8_t sdp_register_service(const uint8_t * record){
     // set handle and record
     newRecordItem->service_record_handle = record_handle;
     newRecordItem->service_record = (uint8_t*) record;
-    
+    memset(newRecordItem->uuid_signature, 0, SDP_UUID_SIGNATURE_SIZE);
+    sdp_add_uuids_to_signature(record, newRecordItem->uuid_signature);
+
     // add to linked list
     btstack_linked_list_add(&sdp_server_service_records, (btstack_linked_item_t *) newRecordItem);
-    
+    sdp_server_database_changed();
+
     return 0;
 }
 
@@ -170,20 +210,35 @@ void sdp_unregister_service(uint32_t service_record_handle){
     if (!record_item) return;
     btstack_linked_list_remove(&sdp_server_service_records, (btstack_linked_item_t *) record_item);
     btstack_memory_service_record_item_free(record_item);
+    sdp_server_database_changed();
+}
+
+// record can only match if all bits of the pattern signature are set in the record signature
+static bool sdp_record_item_matches_service_search_pattern(const service_record_item_t * item, uint8_t * serviceSearchPattern, const uint8_t * pattern_signature){
+    uint8_t i;
+    for (i = 0; i < SDP_UUID_SIGNATURE_SIZE; i++){
+        if ((item->uuid_signature[i] & pattern_signature[i]) != pattern_signature[i]) return false;
+    }
+    return sdp_record_matches_service_search_pattern(item->service_record, serviceSearchPattern);
+}
+
+static void sdp_get_pattern_signature(const uint8_t * serviceSearchPattern, uint8_t * pattern_signature){
+    memset(pattern_signature, 0, SDP_UUID_SIGNATURE_SIZE);
+    sdp_add_uuids_to_signature(serviceSearchPattern, pattern_signature);
 }
 
 // PDU
 // PDU ID (1), Transaction ID (2), Param Length (2), Param 1, Param 2, ..
 
-static int sdp_create_error_response(uint16_t transaction_id, uint16_t error_code){
-    sdp_response_buffer[0] = SDP_ErrorResponse;
-    big_endian_store_16(sdp_response_buffer, 1, transaction_id);
-    big_endian_store_16(sdp_response_buffer, 3, 2);
-    big_endian_store_16(sdp_response_buffer, 5, error_code); // invalid syntax
+static int sdp_create_error_response(uint8_t * response_buffer, uint16_t transaction_id, uint16_t error_code){
+    response_buffer[0] = SDP_ErrorResponse;
+    big_endian_store_16(response_buffer, 1, transaction_id);
+    big_endian_store_16(response_buffer, 3, 2);
+    big_endian_store_16(response_buffer, 5, error_code); // invalid syntax
     return 7;
 }
 
-int sdp_handle_service_search_request(uint8_t * packet, uint16_t remote_mtu){
+int sdp_handle_service_search_request(uint8_t * packet, uint16_t remote_mtu, uint8_t * response_buffer){
     
     // get request details
     uint16_t  transaction_id = big_endian_read_16(packet, 1);
@@ -205,6 +260,9 @@ int sdp_handle_service_search_request(uint8_t * packet, uint16_t remote_mtu){
 
     // calc maximumServiceRecordCount based on remote MTU
     uint16_t maxNrServiceRecordsPerResponse = (remote_mtu - (9+3))/4;
+
+    uint8_t pattern_signature[SDP_UUID_SIGNATURE_SIZE];
+    sdp_get_pattern_signature(serviceSearchPattern, pattern_signature);
     
     // continuation state contains index of next service record to examine
     int      continuation = 0;
@@ -218,7 +276,7 @@ int sdp_handle_service_search_request(uint8_t * packet, uint16_t remote_mtu){
     uint16_t total_service_count   = 0;
     for (it = (btstack_linked_item_t *) sdp_server_service_records; it ; it = it->next){
         service_record_item_t * item = (service_record_item_t *) it;
-        if (!sdp_record_matches_service_search_pattern(item->service_record, serviceSearchPattern)) continue;
+        if (!sdp_record_item_matches_service_search_pattern(item, serviceSearchPattern, pattern_signature)) continue;
         total_service_count++;
     }
     if (total_service_count > maximumServiceRecordCount){
@@ -233,12 +291,12 @@ int sdp_handle_service_search_request(uint8_t * packet, uint16_t remote_mtu){
     for (it = (btstack_linked_item_t *) sdp_server_service_records; it ; it = it->next, ++current_service_index){
         service_record_item_t * item = (service_record_item_t *) it;
 
-        if (!sdp_record_matches_service_search_pattern(item->service_record, serviceSearchPattern)) continue;
+        if (!sdp_record_item_matches_service_search_pattern(item, serviceSearchPattern, pattern_signature)) continue;
         matching_service_count++;
         
         if (current_service_index < continuation_index) continue;
 
-        big_endian_store_32(sdp_response_buffer, pos, item->service_record_handle);
+        big_endian_store_32(response_buffer, pos, item->service_record_handle);
         pos += 4;
         current_service_count++;
         
@@ -253,24 +311,147 @@ int sdp_handle_service_search_request(uint8_t * packet, uint16_t remote_mtu){
     
     // Store continuation state
     if (continuation) {
-        sdp_response_buffer[pos++] = 2;
-        big_endian_store_16(sdp_response_buffer, pos, continuation_index);
+        response_buffer[pos++] = 2;
+        big_endian_store_16(response_buffer, pos, continuation_index);
         pos += 2;
     } else {
-        sdp_response_buffer[pos++] = 0;
+        response_buffer[pos++] = 0;
     }
 
     // header
-    sdp_response_buffer[0] = SDP_ServiceSearchResponse;
-    big_endian_store_16(sdp_response_buffer, 1, transaction_id);
-    big_endian_store_16(sdp_response_buffer, 3, pos - 5); // size of variable payload
-    big_endian_store_16(sdp_response_buffer, 5, total_service_count);
-    big_endian_store_16(sdp_response_buffer, 7, current_service_count);
+    response_buffer[0] = SDP_ServiceSearchResponse;
+    big_endian_store_16(response_buffer, 1, transaction_id);
+    big_endian_store_16(response_buffer, 3, pos - 5); // size of variable payload
+    big_endian_store_16(response_buffer, 5, total_service_count);
+    big_endian_store_16(response_buffer, 7, current_service_count);
     
     return pos;
 }
 
-int sdp_handle_service_attribute_request(uint8_t * packet, uint16_t remote_mtu){
+#if SDP_RESPONSE_CACHE_SIZE > 0
+
+static bool sdp_response_cache_matches(sdp_pdu_id_t pdu_id, const uint8_t * key, uint16_t key_len, const uint8_t * attributeIDList, uint16_t attributeIDListLen){
+    if (!sdp_response_cache_valid) return false;
+    if (sdp_response_cache_key_len != (1u + key_len + attributeIDListLen)) return false;
+    if (sdp_response_cache[0] != (uint8_t) pdu_id) return false;
+    if (memcmp(&sdp_response_cache[1], key, key_len) != 0) return false;
+    return memcmp(&sdp_response_cache[1u + key_len], attributeIDList, attributeIDListLen) == 0;
+}
+
+// serialize complete AttributeList (or AttributeLists) into cache, returns false if it does not fit
+static bool sdp_response_cache_fill(sdp_pdu_id_t pdu_id, uint8_t * key, uint16_t key_len, uint8_t * attributeIDList, uint16_t attributeIDListLen){
+    sdp_response_cache_valid = false;
+
+    // store key and reserve space for outer DES
+    uint32_t response_start = 1u + key_len + attributeIDListLen;
+    if ((response_start + 3u) > SDP_RESPONSE_CACHE_SIZE) return false;
+    sdp_response_cache[0] = (uint8_t) pdu_id;
+    (void)memcpy(&sdp_response_cache[1], key, key_len);
+    (void)memcpy(&sdp_response_cache[1u + key_len], attributeIDList, attributeIDListLen);
+    uint16_t pos = (uint16_t) response_start + 3u;
+
+    service_record_item_t * item;
+    uint16_t bytes_used;
+    uint16_t des_pos;
+    uint8_t  pattern_signature[SDP_UUID_SIGNATURE_SIZE];
+    btstack_linked_item_t * it;
+    switch (pdu_id){
+        case SDP_ServiceAttributeRequest:
+            item = sdp_get_record_item_for_handle(big_endian_read_32(key, 0));
+            if (item == NULL) return false;
+            if (!sdp_filter_attributes_in_attributeIDList(item->service_record, attributeIDList, 0, SDP_RESPONSE_CACHE_SIZE - pos, &bytes_used, &sdp_response_cache[pos])) return false;
+            pos += bytes_used;
+            break;
+        case SDP_ServiceSearchAttributeRequest:
+            sdp_get_pattern_signature(key, pattern_signature);
+            for (it = (btstack_linked_item_t *) sdp_server_service_records; it ; it = it->next){
+                item = (service_record_item_t *) it;
+                if (!sdp_record_item_matches_service_search_pattern(item, key, pattern_signature)) continue;
+                if ((pos + 3u) > SDP_RESPONSE_CACHE_SIZE) return false;
+                des_pos = pos;
+                pos += 3;
+                if (!sdp_filter_attributes_in_attributeIDList(item->service_record, attributeIDList, 0, SDP_RESPONSE_CACHE_SIZE - pos, &bytes_used, &sdp_response_cache[pos])) return false;
+                de_store_descriptor_with_len(&sdp_response_cache[des_pos], DE_DES, DE_SIZE_VAR_16, bytes_used);
+                pos += bytes_used;
+            }
+            break;
+        default:
+            btstack_unreachable();
+            return false;
+    }
+
+    de_store_descriptor_with_len(&sdp_response_cache[response_start], DE_DES, DE_SIZE_VAR_16, pos - response_start - 3u);
+    sdp_response_cache_key_len = (uint16_t) response_start;
+    sdp_response_cache_response_len = pos - (uint16_t) response_start;
+    sdp_response_cache_valid = true;
+    return true;
+}
+
+// serve Service Attribute or Service Search Attribute request from cache
+// key is ServiceRecordHandle or ServiceSearchPattern
+// returns 0 if response is too large for cache or continuation state was created by non-cached response
+static int sdp_handle_cached_request(uint8_t * response_buffer, sdp_pdu_id_t pdu_id, uint16_t transaction_id, uint8_t * key, uint16_t key_len, uint8_t * attributeIDList, uint16_t attributeIDListLen,
+                                     const uint8_t * continuationState, uint16_t maximumAttributeByteCount, uint16_t remote_mtu){
+
+    // continuation state contains database generation, offset into the complete response and the request PDU ID
+    uint16_t continuation_offset = 0;
+    bool continuation = continuationState[0] == SDP_CACHED_CONTINUATION_STATE_LEN;
+    if (continuation){
+        if (big_endian_read_16(continuationState, 1) != sdp_server_database_generation){
+            return sdp_create_error_response(response_buffer, transaction_id, 0x0005); // invalid Continuation State
+        }
+        if (continuationState[5] != (uint8_t) pdu_id){
+            return sdp_create_error_response(response_buffer, transaction_id, 0x0005); // invalid Continuation State
+        }
+        continuation_offset = big_endian_read_16(continuationState, 3);
+    } else if (continuationState[0] != 0){
+        return 0;
+    }
+
+    if (!sdp_response_cache_matches(pdu_id, key, key_len, attributeIDList, attributeIDListLen)){
+        if (!sdp_response_cache_fill(pdu_id, key, key_len, attributeIDList, attributeIDListLen)){
+            return continuation ? sdp_create_error_response(response_buffer, transaction_id, 0x0005) : 0;
+        }
+    }
+
+    if (continuation_offset > sdp_response_cache_response_len){
+        return sdp_create_error_response(response_buffer, transaction_id, 0x0005); // invalid Continuation State
+    }
+
+    // calc maximumAttributeByteCount based on remote MTU, SDP header and cached Continuation State
+    uint16_t maximumAttributeByteCount2 = remote_mtu - (7 + 1 + SDP_CACHED_CONTINUATION_STATE_LEN);
+    if (maximumAttributeByteCount2 < maximumAttributeByteCount) {
+        maximumAttributeByteCount = maximumAttributeByteCount2;
+    }
+
+    // AttributeList(s) - starts at offset 7
+    uint16_t attributeListByteCount = (uint16_t) btstack_min(sdp_response_cache_response_len - continuation_offset, maximumAttributeByteCount);
+    (void)memcpy(&response_buffer[7], &sdp_response_cache[sdp_response_cache_key_len + continuation_offset], attributeListByteCount);
+    uint16_t pos = 7 + attributeListByteCount;
+    continuation_offset += attributeListByteCount;
+
+    if (continuation_offset < sdp_response_cache_response_len){
+        response_buffer[pos++] = SDP_CACHED_CONTINUATION_STATE_LEN;
+        big_endian_store_16(response_buffer, pos, sdp_server_database_generation);
+        pos += 2;
+        big_endian_store_16(response_buffer, pos, continuation_offset);
+        pos += 2;
+        response_buffer[pos++] = (uint8_t) pdu_id;
+    } else {
+        response_buffer[pos++] = 0;
+    }
+
+    // header
+    response_buffer[0] = (pdu_id == SDP_ServiceAttributeRequest) ? SDP_ServiceAttributeResponse : SDP_ServiceSearchAttributeResponse;
+    big_endian_store_16(response_buffer, 1, transaction_id);
+    big_endian_store_16(response_buffer, 3, pos - 5);  // size of variable payload
+    big_endian_store_16(response_buffer, 5, attributeListByteCount);
+
+    return pos;
+}
+#endif
+
+int sdp_handle_service_attribute_request(uint8_t * packet, uint16_t remote_mtu, uint8_t * response_buffer){
     
     // get request details
     uint16_t  transaction_id = big_endian_read_16(packet, 1);
@@ -291,6 +472,15 @@ int sdp_handle_service_attribute_request(uint8_t * packet, uint16_t remote_mtu){
     // assert continuation state is contained in param_len
     if ((1 + continuationState[0]) > param_len) return 0;
     
+#if SDP_RESPONSE_CACHE_SIZE > 0
+    // invalid service record handle is reported below
+    if (sdp_get_record_item_for_handle(serviceRecordHandle) != NULL){
+        int cached_response_size = sdp_handle_cached_request(response_buffer, SDP_ServiceAttributeRequest, transaction_id, &packet[5], 4,
+                                                             attributeIDList, attributeIDListLen, continuationState, maximumAttributeByteCount, remote_mtu);
+        if (cached_response_size > 0) return cached_response_size;
+    }
+#endif
+
     // calc maximumAttributeByteCount based on remote MTU
     uint16_t maximumAttributeByteCount2 = remote_mtu - (7+3);
     if (maximumAttributeByteCount2 < maximumAttributeByteCount) {
@@ -307,7 +497,7 @@ int sdp_handle_service_attribute_request(uint8_t * packet, uint16_t remote_mtu){
     service_record_item_t * item = sdp_get_record_item_for_handle(serviceRecordHandle);
     if (!item){
         // service record handle doesn't exist
-        return sdp_create_error_response(transaction_id, 0x0002); /// invalid Service Record Handle
+        return sdp_create_error_response(response_buffer, transaction_id, 0x0002); /// invalid Service Record Handle
     }
     
     
@@ -320,43 +510,43 @@ int sdp_handle_service_attribute_request(uint8_t * packet, uint16_t remote_mtu){
         uint16_t filtered_attributes_size = sdp_get_filtered_size(item->service_record, attributeIDList);
         
         // store DES
-        de_store_descriptor_with_len(&sdp_response_buffer[pos], DE_DES, DE_SIZE_VAR_16, filtered_attributes_size);
+        de_store_descriptor_with_len(&response_buffer[pos], DE_DES, DE_SIZE_VAR_16, filtered_attributes_size);
         maximumAttributeByteCount -= 3;
         pos += 3;
     }
 
     // copy maximumAttributeByteCount from record
     uint16_t bytes_used;
-    int complete = sdp_filter_attributes_in_attributeIDList(item->service_record, attributeIDList, continuation_offset, maximumAttributeByteCount, &bytes_used, &sdp_response_buffer[pos]);
+    int complete = sdp_filter_attributes_in_attributeIDList(item->service_record, attributeIDList, continuation_offset, maximumAttributeByteCount, &bytes_used, &response_buffer[pos]);
     pos += bytes_used;
     
     uint16_t attributeListByteCount = pos - 7;
 
     if (complete) {
-        sdp_response_buffer[pos++] = 0;
+        response_buffer[pos++] = 0;
     } else {
         continuation_offset += bytes_used;
-        sdp_response_buffer[pos++] = 2;
-        big_endian_store_16(sdp_response_buffer, pos, continuation_offset);
+        response_buffer[pos++] = 2;
+        big_endian_store_16(response_buffer, pos, continuation_offset);
         pos += 2;
     }
 
     // header
-    sdp_response_buffer[0] = SDP_ServiceAttributeResponse;
-    big_endian_store_16(sdp_response_buffer, 1, transaction_id);
-    big_endian_store_16(sdp_response_buffer, 3, pos - 5);  // size of variable payload
-    big_endian_store_16(sdp_response_buffer, 5, attributeListByteCount); 
+    response_buffer[0] = SDP_ServiceAttributeResponse;
+    big_endian_store_16(response_buffer, 1, transaction_id);
+    big_endian_store_16(response_buffer, 3, pos - 5);  // size of variable payload
+    big_endian_store_16(response_buffer, 5, attributeListByteCount); 
     
     return pos;
 }
 
-static uint16_t sdp_get_size_for_service_search_attribute_response(uint8_t * serviceSearchPattern, uint8_t * attributeIDList){
+static uint16_t sdp_get_size_for_service_search_attribute_response(uint8_t * serviceSearchPattern, const uint8_t * pattern_signature, uint8_t * attributeIDList){
     uint16_t total_response_size = 0;
     btstack_linked_item_t *it;
     for (it = (btstack_linked_item_t *) sdp_server_service_records; it ; it = it->next){
         service_record_item_t * item = (service_record_item_t *) it;
         
-        if (!sdp_record_matches_service_search_pattern(item->service_record, serviceSearchPattern)) continue;
+        if (!sdp_record_item_matches_service_search_pattern(item, serviceSearchPattern, pattern_signature)) continue;
         
         // for all service records that match
         total_response_size += 3 + sdp_get_filtered_size(item->service_record, attributeIDList);
@@ -364,7 +554,7 @@ static uint16_t sdp_get_size_for_service_search_attribute_response(uint8_t * ser
     return total_response_size;
 }
 
-int sdp_handle_service_search_attribute_request(uint8_t * packet, uint16_t remote_mtu){
+int sdp_handle_service_search_attribute_request(uint8_t * packet, uint16_t remote_mtu, uint8_t * response_buffer){
     
     // SDP header before attribute sevice list: 7
     // Continuation, worst case: 5
@@ -391,6 +581,12 @@ int sdp_handle_service_search_attribute_request(uint8_t * packet, uint16_t remot
     // assert continuation state is contained in param_len
     if ((1 + continuationState[0]) > param_len) return 0;
 
+#if SDP_RESPONSE_CACHE_SIZE > 0
+    int cached_response_size = sdp_handle_cached_request(response_buffer, SDP_ServiceSearchAttributeRequest, transaction_id, serviceSearchPattern, serviceSearchPatternLen,
+                                                         attributeIDList, attributeIDListLen, continuationState, maximumAttributeByteCount, remote_mtu);
+    if (cached_response_size > 0) return cached_response_size;
+#endif
+
     // calc maximumAttributeByteCount based on remote MTU, SDP header and reserved Continuation block
     uint16_t maximumAttributeByteCount2 = remote_mtu - 12;
     if (maximumAttributeByteCount2 < maximumAttributeByteCount) {
@@ -407,14 +603,17 @@ int sdp_handle_service_search_attribute_request(uint8_t * packet, uint16_t remot
     }
 
     // log_info("--> sdp_handle_service_search_attribute_request, cont %u/%u, max %u", continuation_service_index, continuation_offset, maximumAttributeByteCount);
+
+    uint8_t pattern_signature[SDP_UUID_SIGNATURE_SIZE];
+    sdp_get_pattern_signature(serviceSearchPattern, pattern_signature);
     
     // AttributeLists - starts at offset 7
     uint16_t pos = 7;
     
     // add DES with total size for first request
     if ((continuation_service_index == 0) && (continuation_offset == 0)){
-        uint16_t total_response_size = sdp_get_size_for_service_search_attribute_response(serviceSearchPattern, attributeIDList);
-        de_store_descriptor_with_len(&sdp_response_buffer[pos], DE_DES, DE_SIZE_VAR_16, total_response_size);
+        uint16_t total_response_size = sdp_get_size_for_service_search_attribute_response(serviceSearchPattern, pattern_signature, attributeIDList);
+        de_store_descriptor_with_len(&response_buffer[pos], DE_DES, DE_SIZE_VAR_16, total_response_size);
         // log_info("total response size %u", total_response_size);
         pos += 3;
         maximumAttributeByteCount -= 3;
@@ -429,7 +628,7 @@ int sdp_handle_service_search_attribute_request(uint8_t * packet, uint16_t remot
         service_record_item_t * item = (service_record_item_t *) it;
         
         if (current_service_index < continuation_service_index ) continue;
-        if (!sdp_record_matches_service_search_pattern(item->service_record, serviceSearchPattern)) continue;
+        if (!sdp_record_item_matches_service_search_pattern(item, serviceSearchPattern, pattern_signature)) continue;
 
         if (continuation_offset == 0){
             
@@ -443,7 +642,7 @@ int sdp_handle_service_search_attribute_request(uint8_t * packet, uint16_t remot
             }
             
             // store DES
-            de_store_descriptor_with_len(&sdp_response_buffer[pos], DE_DES, DE_SIZE_VAR_16, filtered_attributes_size);
+            de_store_descriptor_with_len(&response_buffer[pos], DE_DES, DE_SIZE_VAR_16, filtered_attributes_size);
             pos += 3;
             maximumAttributeByteCount -= 3;
         }
@@ -452,7 +651,7 @@ int sdp_handle_service_search_attribute_request(uint8_t * packet, uint16_t remot
     
         // copy maximumAttributeByteCount from record
         uint16_t bytes_used;
-        int complete = sdp_filter_attributes_in_attributeIDList(item->service_record, attributeIDList, continuation_offset, maximumAttributeByteCount, &bytes_used, &sdp_response_buffer[pos]);
+        int complete = sdp_filter_attributes_in_attributeIDList(item->service_record, attributeIDList, continuation_offset, maximumAttributeByteCount, &bytes_used, &response_buffer[pos]);
         pos += bytes_used;
         maximumAttributeByteCount -= bytes_used;
         
@@ -470,35 +669,25 @@ int sdp_handle_service_search_attribute_request(uint8_t * packet, uint16_t remot
     
     // Continuation State
     if (continuation){
-        sdp_response_buffer[pos++] = 4;
-        big_endian_store_16(sdp_response_buffer, pos, (uint16_t) current_service_index);
+        response_buffer[pos++] = 4;
+        big_endian_store_16(response_buffer, pos, (uint16_t) current_service_index);
         pos += 2;
-        big_endian_store_16(sdp_response_buffer, pos, continuation_offset);
+        big_endian_store_16(response_buffer, pos, continuation_offset);
         pos += 2;
     } else {
         // complete
-        sdp_response_buffer[pos++] = 0;
+        response_buffer[pos++] = 0;
     }
         
     // create SDP header
-    sdp_response_buffer[0] = SDP_ServiceSearchAttributeResponse;
-    big_endian_store_16(sdp_response_buffer, 1, transaction_id);
-    big_endian_store_16(sdp_response_buffer, 3, pos - 5);  // size of variable payload
-    big_endian_store_16(sdp_response_buffer, 5, attributeListsByteCount);
+    response_buffer[0] = SDP_ServiceSearchAttributeResponse;
+    big_endian_store_16(response_buffer, 1, transaction_id);
+    big_endian_store_16(response_buffer, 3, pos - 5);  // size of variable payload
+    big_endian_store_16(response_buffer, 5, attributeListsByteCount);
     
     return pos;
 }
 
-static void sdp_respond(void){
-    if (!sdp_server_response_size ) return;
-    if (!sdp_server_l2cap_cid) return;
-    
-    // update state before sending packet (avoid getting called when new l2cap credit gets emitted)
-    uint16_t size = sdp_server_response_size;
-    sdp_server_response_size = 0;
-    l2cap_send(sdp_server_l2cap_cid, sdp_response_buffer, size);
-}
-
 // @pre space in list
 static void sdp_waiting_list_add(uint16_t cid){
     sdp_server_l2cap_waiting_list_cids[sdp_server_l2cap_waiting_list_count++] = cid;
@@ -514,16 +703,60 @@ static uint16_t sdp_waiting_list_get(void){
     return cid;
 }
 
-// we assume that we don't get two requests in a row
+static sdp_server_connection_t * sdp_server_connection_for_cid(uint16_t cid){
+    uint8_t i;
+    for (i = 0; i < MAX_NR_SDP_SERVER_CONNECTIONS; i++){
+        if (sdp_server_connections[i].l2cap_cid == cid){
+            return &sdp_server_connections[i];
+        }
+    }
+    return NULL;
+}
+
+static void sdp_server_connection_accept(sdp_server_connection_t * connection, uint16_t cid){
+    connection->l2cap_cid = cid;
+    connection->response_size = 0;
+    l2cap_accept_connection(cid);
+}
+
+// free connection and accept next queued incoming connection
+static void sdp_server_connection_finalize(sdp_server_connection_t * connection){
+    connection->l2cap_cid = 0;
+
+    // other request queued?
+    if (!sdp_server_l2cap_waiting_list_count) return;
+
+    // get first item
+    uint16_t cid = sdp_waiting_list_get();
+
+    log_info("disconnect, accept queued cid 0x%04x, now %u waiting", cid, sdp_server_l2cap_waiting_list_count);
+
+    // accept connection
+    sdp_server_connection_accept(connection, cid);
+}
+
+static void sdp_respond(sdp_server_connection_t * connection){
+    if (!connection->response_size ) return;
+    
+    // update state before sending packet (avoid getting called when new l2cap credit gets emitted)
+    uint16_t size = connection->response_size;
+    connection->response_size = 0;
+    l2cap_send(connection->l2cap_cid, connection->response_buffer, size);
+}
+
+// we assume that we don't get two requests in a row on the same channel
 static void sdp_packet_handler(uint8_t packet_type, uint16_t channel, uint8_t *packet, uint16_t size){
 	uint16_t transaction_id;
     sdp_pdu_id_t pdu_id;
     uint16_t remote_mtu;
     uint16_t param_len;
+    sdp_server_connection_t * connection;
     
 	switch (packet_type) {
 			
 		case L2CAP_DATA_PACKET:
+            connection = sdp_server_connection_for_cid(channel);
+            if (connection == NULL) break;
             pdu_id = (sdp_pdu_id_t) packet[0];
             transaction_id = big_endian_read_16(packet, 1);
             param_len = big_endian_read_16(packet, 3);
@@ -542,23 +775,23 @@ static void sdp_packet_handler(uint8_t packet_type, uint16_t channel, uint8_t *p
             switch (pdu_id){
                     
                 case SDP_ServiceSearchRequest:
-                    sdp_server_response_size = sdp_handle_service_search_request(packet, remote_mtu);
+                    connection->response_size = sdp_handle_service_search_request(packet, remote_mtu, connection->response_buffer);
                     break;
                                         
                 case SDP_ServiceAttributeRequest:
-                    sdp_server_response_size = sdp_handle_service_attribute_request(packet, remote_mtu);
+                    connection->response_size = sdp_handle_service_attribute_request(packet, remote_mtu, connection->response_buffer);
                     break;
                     
                 case SDP_ServiceSearchAttributeRequest:
-                    sdp_server_response_size = sdp_handle_service_search_attribute_request(packet, remote_mtu);
+                    connection->response_size = sdp_handle_service_search_attribute_request(packet, remote_mtu, connection->response_buffer);
                     break;
                     
                 default:
-                    sdp_server_response_size = sdp_create_error_response(transaction_id, 0x0003); // invalid syntax
+                    connection->response_size = sdp_create_error_response(connection->response_buffer, transaction_id, 0x0003); // invalid syntax
                     break;
             }
-            if (!sdp_server_response_size) break;
-            l2cap_request_can_send_now_event(sdp_server_l2cap_cid);
+            if (!connection->response_size) break;
+            l2cap_request_can_send_now_event(channel);
 			break;
 			
 		case HCI_EVENT_PACKET:
@@ -566,7 +799,8 @@ static void sdp_packet_handler(uint8_t packet_type, uint16_t channel, uint8_t *p
 			switch (hci_event_packet_get_type(packet)) {
 
 				case L2CAP_EVENT_INCOMING_CONNECTION:
-                    if (sdp_server_l2cap_cid) {
+                    connection = sdp_server_connection_for_cid(0);
+                    if (connection == NULL) {
                         // try to queue up
                         if (sdp_server_l2cap_waiting_list_count < SDP_WAITING_LIST_MAX_COUNT){
                             sdp_waiting_list_add(channel);
@@ -579,39 +813,28 @@ static void sdp_packet_handler(uint8_t packet_type, uint16_t channel, uint8_t *p
                         break;
                     }
                     // accept
-                    sdp_server_l2cap_cid = channel;
-                    sdp_server_response_size = 0;
-                    l2cap_accept_connection(sdp_server_l2cap_cid);
+                    sdp_server_connection_accept(connection, channel);
 					break;
                     
                 case L2CAP_EVENT_CHANNEL_OPENED:
                     if (packet[2]) {
                         // open failed -> reset
-                        sdp_server_l2cap_cid = 0;
+                        connection = sdp_server_connection_for_cid(channel);
+                        if (connection == NULL) break;
+                        sdp_server_connection_finalize(connection);
                     }
                     break;
 
                 case L2CAP_EVENT_CAN_SEND_NOW:
-                    sdp_respond();
+                    connection = sdp_server_connection_for_cid(channel);
+                    if (connection == NULL) break;
+                    sdp_respond(connection);
                     break;
                 
                 case L2CAP_EVENT_CHANNEL_CLOSED:
-                    if (channel == sdp_server_l2cap_cid){
-                        // reset
-                        sdp_server_l2cap_cid = 0;
-
-                        // other request queued?
-                        if (!sdp_server_l2cap_waiting_list_count) break;
-
-                        // get first item 
-                        sdp_server_l2cap_cid = sdp_waiting_list_get();
-
-                        log_info("disconnect, accept queued cid 0x%04x, now %u waiting", sdp_server_l2cap_cid, sdp_server_l2cap_waiting_list_count);
-
-                        // accept connection
-                        sdp_server_response_size = 0;
-                        l2cap_accept_connection(sdp_server_l2cap_cid);
-                    }
+                    connection = sdp_server_connection_for_cid(channel);
+                    if (connection == NULL) break;
+                    sdp_server_connection_finalize(connection);
                     break;
 					                    
 				default:
@@ -625,4 +848,3 @@ static void sdp_packet_handler(uint8_t packet_type, uint16_t channel, uint8_t *p
 			break;
 	}
 }
-
@@ -45,6 +45,7 @@
 
 #include <stdint.h>
 #include "btstack_linked_list.h"
+#include "classic/sdp_util.h"
 
 #include "btstack_config.h"
 
@@ -58,11 +59,14 @@ typedef struct {
 
     uint32_t        service_record_handle;
     uint8_t *       service_record;
+
+    // bit field of all UUIDs in service record, see sdp_add_uuids_to_signature
+    uint8_t         uuid_signature[SDP_UUID_SIGNATURE_SIZE];
 } service_record_item_t;
 
-int sdp_handle_service_search_request(uint8_t * packet, uint16_t remote_mtu);
-int sdp_handle_service_attribute_request(uint8_t * packet, uint16_t remote_mtu);
-int sdp_handle_service_search_attribute_request(uint8_t * packet, uint16_t remote_mtu);
+int sdp_handle_service_search_request(uint8_t * packet, uint16_t remote_mtu, uint8_t * response_buffer);
+int sdp_handle_service_attribute_request(uint8_t * packet, uint16_t remote_mtu, uint8_t * response_buffer);
+int sdp_handle_service_search_attribute_request(uint8_t * packet, uint16_t remote_mtu, uint8_t * response_buffer);
 
 /* API_START */
 
@@ -667,6 +667,40 @@ bool sdp_record_matches_service_search_pattern(uint8_t *record, uint8_t *service
     return context.result;
 }
 
+// MARK: UUID Signature
+static void sdp_uuid_signature_add_uuid128(uint8_t * signature, const uint8_t * uuid128){
+    uint32_t hash = big_endian_read_32(uuid128, 0) ^ big_endian_read_32(uuid128, 12);
+    hash ^= hash >> 7;
+    hash ^= hash >> 17;
+    uint8_t bit = (uint8_t) (hash % (SDP_UUID_SIGNATURE_SIZE * 8u));
+    signature[bit >> 3] |= (uint8_t) (1u << (bit & 7u));
+}
+
+static int sdp_traversal_uuid_signature(uint8_t * element, de_type_t de_type, de_size_t de_size, void *my_context){
+    UNUSED(de_size);
+    uint8_t * signature = (uint8_t *) my_context;
+    uint8_t normalizedUUID[16];
+    switch (de_type){
+        case DE_UUID:
+            if (de_get_normalized_uuid(normalizedUUID, element)){
+                sdp_uuid_signature_add_uuid128(signature, normalizedUUID);
+            }
+            break;
+        case DE_DES:
+        case DE_DEA:
+            de_traverse_sequence(element, sdp_traversal_uuid_signature, signature);
+            break;
+        default:
+            break;
+    }
+    return 0;
+}
+
+// include UUIDs in nested sequences and alternatives, so signature of record covers all UUIDs found by sdp_record_contains_UUID128
+void sdp_add_uuids_to_signature(const uint8_t * element, uint8_t * signature){
+    de_traverse_sequence((uint8_t *) element, sdp_traversal_uuid_signature, signature);
+}
+
 // MARK: Dump DataElement
 // context { indent }
 #ifdef ENABLE_SDP_DES_DUMP
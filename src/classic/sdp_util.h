@@ -146,6 +146,10 @@ uint16_t  sdp_get_filtered_size(uint8_t *record, uint8_t *attributeIDList);
 bool      sdp_filter_attributes_in_attributeIDList(uint8_t *record, uint8_t *attributeIDList, uint16_t startOffset, uint16_t maxBytes, uint16_t *usedBytes, uint8_t *buffer);
 bool      sdp_attribute_list_contains_id(uint8_t *attributeIDList, uint16_t attributeID);
 
+// UUID signature: bit field with one bit set for each UUID contained in a data element, used to skip non-matching records
+#define SDP_UUID_SIGNATURE_SIZE 8
+void      sdp_add_uuids_to_signature(const uint8_t * element, uint8_t * signature);
+
 /*
  * @brief Returns service search pattern for given UUID-16
  * @note Uses fixed buffer
@@ -248,6 +248,8 @@ static hci_iso_stream_t * hci_iso_stream_create(hci_iso_type_t iso_type, hci_iso
 static void hci_iso_stream_finalize(hci_iso_stream_t * iso_stream);
 static void hci_iso_stream_finalize_by_type_and_group_id(hci_iso_type_t iso_type, uint8_t group_id);
 static hci_iso_stream_t * hci_iso_stream_for_con_handle(hci_con_handle_t con_handle);
+static void hci_iso_stream_set_con_handle(hci_iso_stream_t * iso_stream, hci_con_handle_t con_handle);
+static void hci_iso_stream_free(hci_iso_stream_t * iso_stream);
 static void hci_iso_stream_requested_finalize(uint8_t big_handle);
 static void hci_iso_stream_requested_confirm(uint8_t big_handle);
 static void hci_iso_packet_handler(hci_iso_stream_t *iso_stream, uint8_t *packet, uint16_t size);
@@ -714,6 +716,15 @@ int hci_number_free_acl_slots_for_handle(hci_con_handle_t con_handle){
     return hci_number_free_acl_slots_for_connection_type(connection->address_type);
 }
 
+int hci_number_outgoing_acl_packets_for_handle(hci_con_handle_t con_handle){
+    hci_connection_t * connection = hci_connection_for_handle(con_handle);
+    if (!connection){
+        log_error("hci_number_outgoing_acl_packets: handle 0x%04x not in connection list", con_handle);
+        return 0;
+    }
+    return connection->num_packets_sent;
+}
+
 #ifdef ENABLE_CLASSIC
 static int hci_number_free_sco_slots(void){
     unsigned int num_sco_packets_sent  = 0;
@@ -809,6 +820,15 @@ bool hci_can_send_sco_packet_now(void){
     return hci_can_send_prepared_sco_packet_now();
 }
 
+bool hci_can_send_sco_packet_now_for_connection(hci_con_handle_t sco_con_handle){
+    if (!hci_can_send_sco_packet_now()) return false;
+    if (hci_have_usb_transport() || hci_stack->synchronous_flow_control_enabled) return true;
+    // implicit flow control
+    hci_connection_t * connection = hci_connection_for_handle(sco_con_handle);
+    if (connection == NULL) return false;
+    return connection->sco_tx_ready > 0u;
+}
+
 void hci_request_sco_can_send_now_event(void){
     hci_stack->sco_waiting_for_can_send_now = 1;
     hci_notify_if_sco_can_send_now();
@@ -1554,6 +1574,24 @@ void gap_le_get_own_connection_address(uint8_t * addr_type, bd_addr_t addr){
     hci_get_own_address_for_addr_type(hci_stack->le_connection_own_addr_type, addr);
 }
 
+void hci_set_le_advertising_report_handler(const hci_le_advertising_report_handler_t * handler){
+    hci_stack->le_advertising_report_handler = handler;
+}
+
+static void hci_emit_advertising_report(uint8_t * event, uint16_t size){
+    if (hci_stack->le_advertising_report_handler != NULL){
+        (*hci_stack->le_advertising_report_handler->handle_report)(event, size);
+    } else {
+        hci_emit_btstack_event(event, size, 1);
+    }
+}
+
+static void hci_advertising_reports_complete(void){
+    if (hci_stack->le_advertising_report_handler != NULL){
+        (*hci_stack->le_advertising_report_handler->reports_complete)();
+    }
+}
+
 void le_handle_advertisement_report(uint8_t *packet, uint16_t size){
 
     uint16_t offset = 3;
@@ -1565,8 +1603,8 @@ void le_handle_advertisement_report(uint8_t *packet, uint16_t size){
     for (i=0; (i<num_reports) && (offset < size);i++){
         // sanity checks on data_length:
         uint8_t data_length = packet[offset + 8];
-        if (data_length > LE_ADVERTISING_DATA_SIZE) return;
-        if ((offset + 9u + data_length + 1u) > size)    return;
+        if (data_length > LE_ADVERTISING_DATA_SIZE) break;
+        if ((offset + 9u + data_length + 1u) > size)    break;
         // setup event
         uint8_t event_size = 10u + data_length;
         uint16_t pos = 0;
@@ -1581,8 +1619,9 @@ void le_handle_advertisement_report(uint8_t *packet, uint16_t size){
         (void)memcpy(&event[pos], &packet[offset], data_length);
         pos +=    data_length;
         offset += data_length + 1u; // rssi
-        hci_emit_btstack_event(event, pos, 1);
+        hci_emit_advertising_report(event, pos);
     }
+    hci_advertising_reports_complete();
 }
 
 #ifdef ENABLE_LE_EXTENDED_ADVERTISING
@@ -1594,8 +1633,8 @@ static void le_handle_extended_advertisement_report(uint8_t *packet, uint16_t si
     for (i=0; (i<num_reports) && (offset < size);i++){
         // sanity checks on data_length:
         uint16_t data_length = packet[offset + 23];
-        if (data_length > LE_EXTENDED_ADVERTISING_DATA_SIZE) return;
-        if ((offset + 24u + data_length) > size)    return;
+        if (data_length > LE_EXTENDED_ADVERTISING_DATA_SIZE) break;
+        if ((offset + 24u + data_length) > size)    break;
         uint16_t event_type = little_endian_read_16(packet, offset);
         offset += 2;
         if ((event_type & 0x10) != 0) {
@@ -1645,7 +1684,7 @@ static void le_handle_extended_advertisement_report(uint8_t *packet, uint16_t si
             (void) memcpy(&event[pos], &packet[offset], 1 + data_length);
             pos    += 1 +data_length;
             offset += 1+ data_length;
-            hci_emit_btstack_event(event, pos, 1);
+            hci_emit_advertising_report(event, pos);
         } else {
             event[0] = GAP_EVENT_EXTENDED_ADVERTISING_REPORT;
             uint8_t report_len = 24 + data_length;
@@ -1653,9 +1692,10 @@ static void le_handle_extended_advertisement_report(uint8_t *packet, uint16_t si
             little_endian_store_16(event, 2, event_type);
             memcpy(&event[4], &packet[offset], report_len);
             offset += report_len;
-            hci_emit_btstack_event(event, 2 + report_len, 1);
+            hci_emit_advertising_report(event, 2 + report_len);
         }
     }
+    hci_advertising_reports_complete();
 }
 #endif
 
@@ -3062,7 +3102,7 @@ static void handle_command_complete_event(uint8_t * packet, uint16_t size){
                         if ((iso_stream->group_id == hci_stack->iso_active_operation_group_id) &&
                             (iso_stream->iso_type == HCI_ISO_TYPE_CIS)){
                             hci_con_handle_t cis_handle = little_endian_read_16(packet, OFFSET_OF_DATA_IN_COMMAND_COMPLETE+3+(2*i));
-                            iso_stream->cis_handle  = cis_handle;
+                            hci_iso_stream_set_con_handle(iso_stream, cis_handle);
                             cig->cis_con_handles[i] = cis_handle;
                             i++;
                         }
@@ -4461,7 +4501,7 @@ static void event_handler(uint8_t *packet, uint16_t size){
                                                        hci_subevent_le_cis_request_get_cis_id(packet));
                     // if there's no memory, gap_cis_accept/gap_cis_reject will fail
                     if (iso_stream != NULL){
-                        iso_stream->cis_handle = hci_subevent_le_cis_request_get_cis_connection_handle(packet);
+                        hci_iso_stream_set_con_handle(iso_stream, hci_subevent_le_cis_request_get_cis_connection_handle(packet));
                         iso_stream->acl_handle = hci_subevent_le_cis_request_get_acl_connection_handle(packet);
                     }
                     break;
@@ -4547,7 +4587,7 @@ static void event_handler(uint8_t *packet, uint16_t size){
                                     iso_stream = (hci_iso_stream_t *) btstack_linked_list_iterator_next(&it);
                                     if ((iso_stream->state == HCI_ISO_STREAM_STATE_REQUESTED ) &&
                                         (iso_stream->group_id == big->big_handle)){
-                                        iso_stream->cis_handle = bis_handle;
+                                        hci_iso_stream_set_con_handle(iso_stream, bis_handle);
                                         iso_stream->state = HCI_ISO_STREAM_STATE_ESTABLISHED;
                                         break;
                                     }
@@ -4575,7 +4615,7 @@ static void event_handler(uint8_t *packet, uint16_t size){
                             if (iso_stream->group_id == big->big_handle){
                                 log_info("BIG Terminated, big_handle 0x%02x, con handle 0x%04x", iso_stream->group_id, iso_stream->cis_handle);
                                 btstack_linked_list_iterator_remove(&it);
-                                btstack_memory_hci_iso_stream_free(iso_stream);
+                                hci_iso_stream_free(iso_stream);
                             }
                         }
                         btstack_linked_list_remove(&hci_stack->le_audio_bigs, (btstack_linked_item_t *) big);
@@ -4606,7 +4646,7 @@ static void event_handler(uint8_t *packet, uint16_t size){
                                     iso_stream = (hci_iso_stream_t *) btstack_linked_list_iterator_next(&it);
                                     if ((iso_stream->state == HCI_ISO_STREAM_STATE_REQUESTED ) &&
                                         (iso_stream->group_id == big_sync->big_handle)){
-                                        iso_stream->cis_handle = bis_handle;
+                                        hci_iso_stream_set_con_handle(iso_stream, bis_handle);
                                         iso_stream->state = HCI_ISO_STREAM_STATE_ESTABLISHED;
                                         break;
                                     }
@@ -4877,6 +4917,17 @@ static void hci_state_reset(void){
     if (hci_stack->le_advertisements_data != NULL){
         hci_stack->le_advertisements_todo |= LE_ADVERTISEMENT_TASKS_SET_ADV_DATA;
     }
+#ifdef ENABLE_LE_EXTENDED_ADVERTISING
+    // Controller does not have any advertising sets after reset, drop sets removed while off
+    btstack_linked_list_iterator_t it;
+    btstack_linked_list_iterator_init(&it, &hci_stack->le_advertising_sets);
+    while (btstack_linked_list_iterator_has_next(&it)){
+        le_advertising_set_t * advertising_set = (le_advertising_set_t *) btstack_linked_list_iterator_next(&it);
+        if ((advertising_set->tasks & LE_ADVERTISEMENT_TASKS_REMOVE_SET) != 0){
+            btstack_linked_list_iterator_remove(&it);
+        }
+    }
+#endif
 #endif
 #ifdef ENABLE_LE_PRIVACY_ADDRESS_RESOLUTION
     hci_stack->le_resolving_list_state = LE_RESOLVING_LIST_SEND_ENABLE_ADDRESS_RESOLUTION;
@@ -10076,22 +10127,67 @@ hci_iso_stream_create(hci_iso_type_t iso_type, hci_iso_stream_state_t state, uin
     return iso_stream;
 }
 
+static hci_iso_stream_t ** hci_iso_stream_bucket_for_con_handle(hci_con_handle_t con_handle){
+    return &hci_stack->iso_stream_buckets[con_handle % HCI_ISO_STREAM_HASH_BUCKETS];
+}
+
 static hci_iso_stream_t * hci_iso_stream_for_con_handle(hci_con_handle_t con_handle){
-    btstack_linked_list_iterator_t it;
-    btstack_linked_list_iterator_init(&it, &hci_stack->iso_streams);
-    while (btstack_linked_list_iterator_has_next(&it)){
-        hci_iso_stream_t * iso_stream = (hci_iso_stream_t *) btstack_linked_list_iterator_next(&it);
-        if (iso_stream->cis_handle == con_handle ) {
+    if (con_handle == HCI_CON_HANDLE_INVALID){
+        return NULL;
+    }
+    hci_iso_stream_t * iso_stream = *hci_iso_stream_bucket_for_con_handle(con_handle);
+    while (iso_stream != NULL){
+        if (iso_stream->cis_handle == con_handle) {
             return iso_stream;
         }
+        iso_stream = iso_stream->hash_next;
     }
     return NULL;
 }
 
+static void hci_iso_stream_unlink_con_handle(hci_iso_stream_t * iso_stream){
+    if (iso_stream->cis_handle == HCI_CON_HANDLE_INVALID){
+        return;
+    }
+    hci_iso_stream_t ** it = hci_iso_stream_bucket_for_con_handle(iso_stream->cis_handle);
+    while (*it != NULL){
+        if (*it == iso_stream){
+            *it = iso_stream->hash_next;
+            break;
+        }
+        it = &(*it)->hash_next;
+    }
+    iso_stream->hash_next = NULL;
+}
+
+static void hci_iso_stream_set_con_handle(hci_iso_stream_t * iso_stream, hci_con_handle_t con_handle){
+    hci_iso_stream_unlink_con_handle(iso_stream);
+    iso_stream->cis_handle = con_handle;
+    if (con_handle != HCI_CON_HANDLE_INVALID){
+        hci_iso_stream_t ** bucket = hci_iso_stream_bucket_for_con_handle(con_handle);
+        iso_stream->hash_next = *bucket;
+        *bucket = iso_stream;
+    }
+}
+
+// free iso stream after it has been removed from hci_stack->iso_streams
+static void hci_iso_stream_free(hci_iso_stream_t * iso_stream){
+    hci_iso_stream_unlink_con_handle(iso_stream);
+    // return queued SDUs to pool
+    while (btstack_linked_queue_empty(&iso_stream->sdu_queue) == false){
+        btstack_linked_item_t * sdu_buffer = btstack_linked_queue_dequeue(&iso_stream->sdu_queue);
+        btstack_linked_list_add(&hci_stack->iso_sdu_buffers, sdu_buffer);
+    }
+    if (hci_stack->iso_sdu_last_stream == iso_stream){
+        hci_stack->iso_sdu_last_stream = NULL;
+    }
+    btstack_memory_hci_iso_stream_free(iso_stream);
+}
+
 static void hci_iso_stream_finalize(hci_iso_stream_t * iso_stream){
     log_info("hci_iso_stream_finalize con_handle 0x%04x, group_id 0x%02x", iso_stream->cis_handle, iso_stream->group_id);
     btstack_linked_list_remove(&hci_stack->iso_streams, (btstack_linked_item_t*) iso_stream);
-    btstack_memory_hci_iso_stream_free(iso_stream);
+    hci_iso_stream_free(iso_stream);
 }
 
 static void hci_iso_stream_finalize_by_type_and_group_id(hci_iso_type_t iso_type, uint8_t group_id) {
@@ -10102,7 +10198,7 @@ static void hci_iso_stream_finalize_by_type_and_group_id(hci_iso_type_t iso_type
         if ((iso_stream->group_id == group_id) &&
             (iso_stream->iso_type == iso_type)){
             btstack_linked_list_iterator_remove(&it);
-            btstack_memory_hci_iso_stream_free(iso_stream);
+            hci_iso_stream_free(iso_stream);
         }
     }
 }
@@ -10115,7 +10211,7 @@ static void hci_iso_stream_requested_finalize(uint8_t group_id) {
         if ((iso_stream->state == HCI_ISO_STREAM_STATE_REQUESTED ) &&
             (iso_stream->group_id == group_id)){
             btstack_linked_list_iterator_remove(&it);
-            btstack_memory_hci_iso_stream_free(iso_stream);
+            hci_iso_stream_free(iso_stream);
         }
     }
 }
@@ -10370,6 +10466,78 @@ static le_audio_cig_t * hci_cig_for_id(uint8_t cig_id){
     return NULL;
 }
 
+static bool hci_iso_sdu_ready_to_send(hci_iso_stream_t * iso_stream){
+    if (btstack_linked_queue_empty(&iso_stream->sdu_queue)){
+        return false;
+    }
+    return iso_stream->num_packets_sent < hci_stack->iso_packets_to_queue;
+}
+
+// round-robin: select first stream with queued SDU after the one that sent last
+static hci_iso_stream_t * hci_iso_sdu_next_stream(void){
+    hci_iso_stream_t * first_ready = NULL;
+    hci_iso_stream_t * next_ready  = NULL;
+    bool after_last_stream = hci_stack->iso_sdu_last_stream == NULL;
+    uint16_t num_packets_in_controller = 0;
+    btstack_linked_list_iterator_t it;
+    btstack_linked_list_iterator_init(&it, &hci_stack->iso_streams);
+    while (btstack_linked_list_iterator_has_next(&it)){
+        hci_iso_stream_t * iso_stream = (hci_iso_stream_t *) btstack_linked_list_iterator_next(&it);
+        num_packets_in_controller += iso_stream->num_packets_sent;
+        if (hci_iso_sdu_ready_to_send(iso_stream)){
+            if (first_ready == NULL){
+                first_ready = iso_stream;
+            }
+            if (after_last_stream && (next_ready == NULL)){
+                next_ready = iso_stream;
+            }
+        }
+        if (iso_stream == hci_stack->iso_sdu_last_stream){
+            after_last_stream = true;
+        }
+    }
+    // respect Controller buffers if known
+    if ((hci_stack->le_iso_packets_total_num > 0) && (num_packets_in_controller >= hci_stack->le_iso_packets_total_num)){
+        return NULL;
+    }
+    return (next_ready != NULL) ? next_ready : first_ready;
+}
+
+static void hci_iso_sdu_send(hci_iso_stream_t * iso_stream){
+    hci_iso_sdu_buffer_t * sdu_buffer = (hci_iso_sdu_buffer_t *) btstack_linked_queue_dequeue(&iso_stream->sdu_queue);
+    hci_stack->iso_sdu_last_stream = iso_stream;
+
+    hci_reserve_packet_buffer();
+    uint8_t * packet = hci_stack->hci_packet_buffer;
+    uint16_t pos = 0;
+    // handle, pb = complete SDU, ts flag
+    uint16_t handle_and_flags = iso_stream->cis_handle | (0x02u << 12);
+    if (sdu_buffer->time_stamp_valid){
+        handle_and_flags |= 1u << 14;
+    }
+    little_endian_store_16(packet, pos, handle_and_flags);
+    pos += 4;
+    if (sdu_buffer->time_stamp_valid){
+        little_endian_store_32(packet, pos, sdu_buffer->time_stamp);
+        pos += 4;
+    }
+    little_endian_store_16(packet, pos, sdu_buffer->packet_sequence_number);
+    pos += 2;
+    little_endian_store_16(packet, pos, sdu_buffer->sdu_len);
+    pos += 2;
+    (void) memcpy(&packet[pos], sdu_buffer->sdu, sdu_buffer->sdu_len);
+    pos += sdu_buffer->sdu_len;
+    little_endian_store_16(packet, 2, pos - HCI_ISO_HEADER_SIZE);
+
+    btstack_linked_list_add(&hci_stack->iso_sdu_buffers, (btstack_linked_item_t *) sdu_buffer);
+
+    uint8_t status = hci_send_iso_packet_buffer(pos);
+    if (status != ERROR_CODE_SUCCESS){
+        log_error("Send ISO SDU for con handle 0x%04x failed, status 0x%02x", iso_stream->cis_handle, status);
+        iso_stream->num_sdus_failed++;
+    }
+}
+
 static void hci_iso_notify_can_send_now(void){
 
     // BIG
@@ -10437,6 +10605,14 @@ static void hci_iso_notify_can_send_now(void){
 
     if (hci_stack->hci_packet_buffer_reserved) return;
 
+    // send queued SDUs, on synchronous transports the packet buffer is free again after each one
+    while (hci_transport_can_send_prepared_packet_now(HCI_ISO_DATA_PACKET)){
+        hci_iso_stream_t * iso_stream = hci_iso_sdu_next_stream();
+        if (iso_stream == NULL) break;
+        hci_iso_sdu_send(iso_stream);
+        if (hci_stack->hci_packet_buffer_reserved) return;
+    }
+
     btstack_linked_list_iterator_init(&it, &hci_stack->le_audio_bigs);
     while (btstack_linked_list_iterator_has_next(&it)){
         le_audio_big_t * big = (le_audio_big_t *) btstack_linked_list_iterator_next(&it);
@@ -10612,6 +10788,71 @@ uint8_t hci_request_cis_can_send_now_events(hci_con_handle_t cis_con_handle){
     return ERROR_CODE_SUCCESS;
 }
 
+uint8_t hci_set_iso_sdu_buffers(hci_iso_sdu_buffer_t * buffers, uint16_t num_buffers){
+    // queued SDUs use buffers of current pool
+    btstack_linked_list_iterator_t it;
+    btstack_linked_list_iterator_init(&it, &hci_stack->iso_streams);
+    while (btstack_linked_list_iterator_has_next(&it)){
+        hci_iso_stream_t * iso_stream = (hci_iso_stream_t *) btstack_linked_list_iterator_next(&it);
+        if (btstack_linked_queue_empty(&iso_stream->sdu_queue) == false){
+            return ERROR_CODE_COMMAND_DISALLOWED;
+        }
+    }
+    hci_stack->iso_sdu_buffers = NULL;
+    uint16_t i;
+    for (i=0;i<num_buffers;i++){
+        btstack_linked_list_add(&hci_stack->iso_sdu_buffers, (btstack_linked_item_t *) &buffers[i]);
+    }
+    return ERROR_CODE_SUCCESS;
+}
+
+uint16_t hci_get_num_free_iso_sdu_buffers(void){
+    return (uint16_t) btstack_linked_list_count(&hci_stack->iso_sdu_buffers);
+}
+
+uint8_t hci_send_iso_sdu(hci_con_handle_t con_handle, const uint8_t * sdu, uint16_t sdu_len, uint16_t packet_sequence_number,
+                         bool time_stamp_valid, uint32_t time_stamp){
+    hci_iso_stream_t * iso_stream = hci_iso_stream_for_con_handle(con_handle);
+    if (iso_stream == NULL){
+        return ERROR_CODE_UNKNOWN_CONNECTION_IDENTIFIER;
+    }
+    if (iso_stream->state != HCI_ISO_STREAM_STATE_ESTABLISHED){
+        return ERROR_CODE_COMMAND_DISALLOWED;
+    }
+    // ISO header + time stamp + packet sequence number + sdu len
+    if ((sdu_len > HCI_ISO_PAYLOAD_SIZE) || ((HCI_ISO_HEADER_SIZE + 8u + sdu_len) > HCI_OUTGOING_PACKET_BUFFER_SIZE)){
+        return ERROR_CODE_INVALID_HCI_COMMAND_PARAMETERS;
+    }
+    hci_iso_sdu_buffer_t * sdu_buffer = (hci_iso_sdu_buffer_t *) btstack_linked_list_pop(&hci_stack->iso_sdu_buffers);
+    if (sdu_buffer == NULL){
+        return ERROR_CODE_MEMORY_CAPACITY_EXCEEDED;
+    }
+    sdu_buffer->time_stamp_valid = time_stamp_valid;
+    sdu_buffer->time_stamp = time_stamp;
+    sdu_buffer->packet_sequence_number = packet_sequence_number;
+    sdu_buffer->sdu_len = sdu_len;
+    (void) memcpy(sdu_buffer->sdu, sdu, sdu_len);
+    btstack_linked_queue_enqueue(&iso_stream->sdu_queue, (btstack_linked_item_t *) sdu_buffer);
+    hci_iso_notify_can_send_now();
+    return ERROR_CODE_SUCCESS;
+}
+
+uint16_t hci_get_num_queued_iso_sdus(hci_con_handle_t con_handle){
+    hci_iso_stream_t * iso_stream = hci_iso_stream_for_con_handle(con_handle);
+    if (iso_stream == NULL){
+        return 0;
+    }
+    return (uint16_t) btstack_linked_list_count(&iso_stream->sdu_queue.head);
+}
+
+uint32_t hci_get_num_failed_iso_sdus(hci_con_handle_t con_handle){
+    hci_iso_stream_t * iso_stream = hci_iso_stream_for_con_handle(con_handle);
+    if (iso_stream == NULL){
+        return 0;
+    }
+    return iso_stream->num_sdus_failed;
+}
+
 uint8_t gap_cig_create(le_audio_cig_t * storage, le_audio_cig_params_t * cig_params){
     if (hci_cig_for_id(cig_params->cig_id) != NULL){
         return ERROR_CODE_ACL_CONNECTION_ALREADY_EXISTS;
@@ -10849,6 +11090,21 @@ void hci_setup_test_connections_fuzz(void){
     conn->state = OPEN;
     conn->sm_connection.sm_role = HCI_ROLE_SLAVE;
     conn->sm_connection.sm_connection_encrypted = 1;
+
+#ifdef ENABLE_LE_ISOCHRONOUS_STREAMS
+    // setup established CIS with con handles 0x0006 and 0x0007 on LE ACL connection 0x0005
+    hci_stack->le_iso_packets_length = HCI_ISO_PAYLOAD_SIZE;
+    hci_stack->le_iso_packets_total_num = 255;
+    uint8_t cis_id;
+    for (cis_id = 0; cis_id < 2; cis_id++){
+        hci_iso_stream_t * iso_stream = hci_iso_stream_create(HCI_ISO_TYPE_CIS, HCI_ISO_STREAM_STATE_ESTABLISHED,
+                                                              HCI_ISO_GROUP_ID_SINGLE_CIS, cis_id);
+        if (iso_stream != NULL){
+            hci_iso_stream_set_con_handle(iso_stream, 0x06 + cis_id);
+            iso_stream->acl_handle = 0x05;
+        }
+    }
+#endif
 }
 
 void hci_free_connections_fuzz(void){
@@ -49,6 +49,7 @@
 #include "btstack_chipset.h"
 #include "btstack_control.h"
 #include "btstack_linked_list.h"
+#include "btstack_linked_queue.h"
 #include "btstack_util.h"
 #include "hci_cmd.h"
 #include "gap.h"
@@ -90,6 +91,11 @@ extern "C" {
 #define HCI_ISO_PAYLOAD_SIZE 310
 #endif
 
+// number of buckets to lookup ISO streams by con handle
+#ifndef HCI_ISO_STREAM_HASH_BUCKETS
+#define HCI_ISO_STREAM_HASH_BUCKETS 8
+#endif
+
 // Max HCI Command LE payload size:
 // 64 from LE Generate DHKey command
 // 32 from LE Encrypt command
@@ -725,10 +731,13 @@ typedef enum{
     HCI_ISO_STREAM_STATE_W4_DISCONNECTED,
 } hci_iso_stream_state_t;
 
-typedef struct {
+typedef struct hci_iso_stream {
     // linked list - assert: first field
     btstack_linked_item_t    item;
 
+    // next stream in hash bucket for con handle
+    struct hci_iso_stream * hash_next;
+
     // state
     hci_iso_stream_state_t state;
 
@@ -771,9 +780,28 @@ typedef struct {
     // ready to send
     bool emit_ready_to_send;
 
+    // outgoing SDUs queued with hci_send_iso_sdu
+    btstack_linked_queue_t sdu_queue;
+
+    // queued SDUs that could not be sent
+    uint32_t num_sdus_failed;
+
 } hci_iso_stream_t;
 #endif
 
+typedef struct {
+    // linked list - assert: first field
+    btstack_linked_item_t item;
+
+    // SDU info
+    bool     time_stamp_valid;
+    uint32_t time_stamp;
+    uint16_t packet_sequence_number;
+    uint16_t sdu_len;
+
+    uint8_t  sdu[HCI_ISO_PAYLOAD_SIZE];
+} hci_iso_sdu_buffer_t;
+
 /**
  * HCI Initialization State Machine
  */
@@ -990,6 +1018,18 @@ typedef enum {
     LE_RESOLVING_LIST_DONE
 } le_resolving_list_state_t;
 
+#ifdef ENABLE_LE_CENTRAL
+/**
+ * Handler for GAP Advertising Reports, used to bypass event emission, e.g. by le_scan_pipeline
+ */
+typedef struct {
+    // called for each GAP_EVENT_ADVERTISING_REPORT and GAP_EVENT_EXTENDED_ADVERTISING_REPORT
+    void (*handle_report)(const uint8_t * event, uint16_t size);
+    // called after all reports of a single HCI LE Advertising Report event have been handled
+    void (*reports_complete)(void);
+} hci_le_advertising_report_handler_t;
+#endif
+
 /**
  * main data structure
  */
@@ -1049,6 +1089,15 @@ typedef struct {
     // list of iso streams
     btstack_linked_list_t iso_streams;
 
+    // iso streams by con handle
+    hci_iso_stream_t * iso_stream_buckets[HCI_ISO_STREAM_HASH_BUCKETS];
+
+    // free SDU buffers for hci_send_iso_sdu
+    btstack_linked_list_t iso_sdu_buffers;
+
+    // stream that sent the last queued SDU, used for round-robin
+    hci_iso_stream_t * iso_sdu_last_stream;
+
     // list of BIGs and BIG Syncs
     btstack_linked_list_t le_audio_bigs;
     btstack_linked_list_t le_audio_big_syncs;
@@ -1226,6 +1275,8 @@ typedef struct {
     bool   le_scanning_enabled;
     bool   le_scanning_active;
 
+    const hci_le_advertising_report_handler_t * le_advertising_report_handler;
+
     le_connecting_state_t le_connecting_state;
     le_connecting_state_t le_connecting_request;
 
@@ -1500,6 +1551,14 @@ void hci_request_sco_can_send_now_event(void);
  */
 bool hci_can_send_sco_packet_now(void);
 
+/**
+ * @brief Check HCI packet buffer and if SCO packet can be sent to controller for given SCO connection
+ * @note With implicit SCO flow control, packets can only be sent on connections that have received packets
+ * @param sco_con_handle
+ * @return true if sco packet can be sent
+ */
+bool hci_can_send_sco_packet_now_for_connection(hci_con_handle_t sco_con_handle);
+
 /**
  * @brief Check if SCO packet can be sent to controller
  * @return true if sco packet can be sent
@@ -1532,6 +1591,50 @@ uint8_t hci_request_cis_can_send_now_events(hci_con_handle_t cis_con_handle);
  */
 uint8_t hci_send_iso_packet_buffer(uint16_t size);
 
+/**
+ * @brief Provide pool of SDU buffers for hci_send_iso_sdu, shared by all ISO streams
+ * @param buffers
+ * @param num_buffers
+ * @return status ERROR_CODE_SUCCESS or ERROR_CODE_COMMAND_DISALLOWED if SDUs are queued
+ */
+uint8_t hci_set_iso_sdu_buffers(hci_iso_sdu_buffer_t * buffers, uint16_t num_buffers);
+
+/**
+ * @brief Get number of free SDU buffers
+ * @return num_buffers
+ */
+uint16_t hci_get_num_free_iso_sdu_buffers(void);
+
+/**
+ * @brief Queue SDU for BIS/CIS. Queued SDUs are sent in order per stream and interleaved round-robin
+ *        across streams as soon as the stream and the Controller can accept them.
+ * @note Streams with queued SDUs count towards hci_set_num_iso_packets_to_queue like packets sent directly
+ * @param con_handle of BIS/CIS
+ * @param sdu
+ * @param sdu_len
+ * @param packet_sequence_number
+ * @param time_stamp_valid
+ * @param time_stamp in us, only used if time_stamp_valid
+ * @return status ERROR_CODE_SUCCESS, ERROR_CODE_UNKNOWN_CONNECTION_IDENTIFIER, ERROR_CODE_COMMAND_DISALLOWED if not established,
+ *                ERROR_CODE_INVALID_HCI_COMMAND_PARAMETERS if SDU too large, ERROR_CODE_MEMORY_CAPACITY_EXCEEDED if no SDU buffer free
+ */
+uint8_t hci_send_iso_sdu(hci_con_handle_t con_handle, const uint8_t * sdu, uint16_t sdu_len, uint16_t packet_sequence_number,
+                         bool time_stamp_valid, uint32_t time_stamp);
+
+/**
+ * @brief Get number of SDUs queued for BIS/CIS
+ * @param con_handle
+ * @return num_sdus
+ */
+uint16_t hci_get_num_queued_iso_sdus(hci_con_handle_t con_handle);
+
+/**
+ * @brief Get number of queued SDUs for BIS/CIS that could not be sent to the Controller
+ * @param con_handle
+ * @return num_sdus
+ */
+uint32_t hci_get_num_failed_iso_sdus(hci_con_handle_t con_handle);
+
 /**
  * Reserves outgoing packet buffer.
  * @note Must only be called after a 'can send now' check or event
@@ -1597,6 +1700,15 @@ bool hci_is_le_identity_address_type(bd_addr_type_t address_type);
  */
 uint8_t hci_send_cmd_va_arg(const hci_cmd_t * cmd, va_list argptr);
 
+#ifdef ENABLE_LE_CENTRAL
+/**
+ * Set handler for GAP Advertising Reports. If set, reports are passed to the handler instead of being
+ * emitted to all registered event handlers. Used by le_scan_pipeline
+ * @param handler or NULL to restore regular event emission
+ */
+void hci_set_le_advertising_report_handler(const hci_le_advertising_report_handler_t * handler);
+#endif
+
 /**
  * Get connection iterator. Only used by l2cap.c and sm.c
  */
@@ -1743,6 +1855,11 @@ void hci_disconnect_all(void);
  */
 int hci_number_free_acl_slots_for_handle(hci_con_handle_t con_handle);
 
+/**
+ * Get number of ACL packets sent to Controller for given handle and not completed yet
+ */
+int hci_number_outgoing_acl_packets_for_handle(hci_con_handle_t con_handle);
+
 /**
  * @brief Set Advertisement Parameters
  * @param adv_int_min
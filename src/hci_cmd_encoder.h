@@ -0,0 +1,4239 @@
+/*
+ * Copyright (C) 2024 BlueKitchen GmbH
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holders nor the names of
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ * 4. Any redistribution, use, or modification is done solely for
+ *    personal benefit and not for any commercial purpose or for
+ *    monetary gain.
+ *
+ * THIS SOFTWARE IS PROVIDED BY BLUEKITCHEN GMBH AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL BLUEKITCHEN
+ * GMBH OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF
+ * THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ *
+ * Please inquire about commercial licensing options at
+ * contact@bluekitchen-gmbh.com
+ *
+ */
+
+/**
+ * HCI Command Encoder
+ *
+ * Typed encoders for HCI Commands with fixed-size parameters. Each encoder writes the complete
+ * HCI Command packet (opcode, parameter length, parameters) into the provided buffer and returns
+ * its size. The result is identical to hci_cmd_create_from_template for the same command.
+ *
+ * Note: Don't edit this file. It is generated by tool/btstack_hci_cmd_encoder_generator.py
+ *
+ */
+
+#ifndef HCI_CMD_ENCODER_H
+#define HCI_CMD_ENCODER_H
+
+#if defined __cplusplus
+extern "C" {
+#endif
+
+#include "hci_cmd.h"
+#include "btstack_util.h"
+
+#include <stdint.h>
+#include <string.h>
+
+/* API_START */
+
+/**
+ * @brief Encode hci_inquiry command
+ * @param buffer for HCI Command packet with 8 bytes
+ * @param lap
+ * @param inquiry_length
+ * @param num_responses
+ * @return size of HCI Command packet
+ * @note: format '311'
+ */
+static inline uint16_t hci_cmd_inquiry_encode(uint8_t * buffer, uint32_t lap, uint8_t inquiry_length, uint8_t num_responses){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_INQUIRY);
+    buffer[2] = 5;
+    little_endian_store_24(buffer, 3, lap);
+    buffer[6] = inquiry_length;
+    buffer[7] = num_responses;
+    return 8;
+}
+
+/**
+ * @brief Encode hci_inquiry_cancel command
+ * @param buffer for HCI Command packet with 3 bytes
+ * @return size of HCI Command packet
+ * @note: format ''
+ */
+static inline uint16_t hci_cmd_inquiry_cancel_encode(uint8_t * buffer){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_INQUIRY_CANCEL);
+    buffer[2] = 0;
+    return 3;
+}
+
+/**
+ * @brief Encode hci_periodic_inquiry_mode command
+ * @param buffer for HCI Command packet with 12 bytes
+ * @param max_period_length
+ * @param min_period_length
+ * @param lap
+ * @param inquiry_length
+ * @param num_responses
+ * @return size of HCI Command packet
+ * @note: format '22311'
+ */
+static inline uint16_t hci_cmd_periodic_inquiry_mode_encode(uint8_t * buffer, uint16_t max_period_length, uint16_t min_period_length, uint32_t lap, uint8_t inquiry_length, uint8_t num_responses){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_PERIODIC_INQUIRY_MODE);
+    buffer[2] = 9;
+    little_endian_store_16(buffer, 3, max_period_length);
+    little_endian_store_16(buffer, 5, min_period_length);
+    little_endian_store_24(buffer, 7, lap);
+    buffer[10] = inquiry_length;
+    buffer[11] = num_responses;
+    return 12;
+}
+
+/**
+ * @brief Encode hci_exit_periodic_inquiry_mode command
+ * @param buffer for HCI Command packet with 3 bytes
+ * @return size of HCI Command packet
+ * @note: format ''
+ */
+static inline uint16_t hci_cmd_exit_periodic_inquiry_mode_encode(uint8_t * buffer){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_EXIT_PERIODIC_INQUIRY_MODE);
+    buffer[2] = 0;
+    return 3;
+}
+
+/**
+ * @brief Encode hci_create_connection command
+ * @param buffer for HCI Command packet with 16 bytes
+ * @param bd_addr
+ * @param packet_type
+ * @param page_scan_repetition_mode
+ * @param reserved
+ * @param clock_offset
+ * @param allow_role_switch
+ * @return size of HCI Command packet
+ * @note: format 'B21121'
+ */
+static inline uint16_t hci_cmd_create_connection_encode(uint8_t * buffer, const bd_addr_t bd_addr, uint16_t packet_type, uint8_t page_scan_repetition_mode, uint8_t reserved, uint16_t clock_offset, uint8_t allow_role_switch){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_CREATE_CONNECTION);
+    buffer[2] = 13;
+    reverse_bd_addr(bd_addr, &buffer[3]);
+    little_endian_store_16(buffer, 9, packet_type);
+    buffer[11] = page_scan_repetition_mode;
+    buffer[12] = reserved;
+    little_endian_store_16(buffer, 13, clock_offset);
+    buffer[15] = allow_role_switch;
+    return 16;
+}
+
+/**
+ * @brief Encode hci_disconnect command
+ * @param buffer for HCI Command packet with 6 bytes
+ * @param handle
+ * @param reason
+ * @return size of HCI Command packet
+ * @note: format 'H1'
+ */
+static inline uint16_t hci_cmd_disconnect_encode(uint8_t * buffer, hci_con_handle_t handle, uint8_t reason){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_DISCONNECT);
+    buffer[2] = 3;
+    little_endian_store_16(buffer, 3, handle);
+    buffer[5] = reason;
+    return 6;
+}
+
+/**
+ * @brief Encode hci_create_connection_cancel command
+ * @param buffer for HCI Command packet with 9 bytes
+ * @param bd_addr
+ * @return size of HCI Command packet
+ * @note: format 'B'
+ */
+static inline uint16_t hci_cmd_create_connection_cancel_encode(uint8_t * buffer, const bd_addr_t bd_addr){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_CREATE_CONNECTION_CANCEL);
+    buffer[2] = 6;
+    reverse_bd_addr(bd_addr, &buffer[3]);
+    return 9;
+}
+
+/**
+ * @brief Encode hci_accept_connection_request command
+ * @param buffer for HCI Command packet with 10 bytes
+ * @param bd_addr
+ * @param role
+ * @return size of HCI Command packet
+ * @note: format 'B1'
+ */
+static inline uint16_t hci_cmd_accept_connection_request_encode(uint8_t * buffer, const bd_addr_t bd_addr, uint8_t role){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_ACCEPT_CONNECTION_REQUEST);
+    buffer[2] = 7;
+    reverse_bd_addr(bd_addr, &buffer[3]);
+    buffer[9] = role;
+    return 10;
+}
+
+/**
+ * @brief Encode hci_reject_connection_request command
+ * @param buffer for HCI Command packet with 10 bytes
+ * @param bd_addr
+ * @param reason
+ * @return size of HCI Command packet
+ * @note: format 'B1'
+ */
+static inline uint16_t hci_cmd_reject_connection_request_encode(uint8_t * buffer, const bd_addr_t bd_addr, uint8_t reason){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_REJECT_CONNECTION_REQUEST);
+    buffer[2] = 7;
+    reverse_bd_addr(bd_addr, &buffer[3]);
+    buffer[9] = reason;
+    return 10;
+}
+
+/**
+ * @brief Encode hci_link_key_request_reply command
+ * @param buffer for HCI Command packet with 25 bytes
+ * @param bd_addr
+ * @param link_key
+ * @return size of HCI Command packet
+ * @note: format 'BP'
+ */
+static inline uint16_t hci_cmd_link_key_request_reply_encode(uint8_t * buffer, const bd_addr_t bd_addr, const uint8_t *link_key){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_LINK_KEY_REQUEST_REPLY);
+    buffer[2] = 22;
+    reverse_bd_addr(bd_addr, &buffer[3]);
+    (void)memcpy(&buffer[9], link_key, 16);
+    return 25;
+}
+
+/**
+ * @brief Encode hci_link_key_request_negative_reply command
+ * @param buffer for HCI Command packet with 9 bytes
+ * @param bd_addr
+ * @return size of HCI Command packet
+ * @note: format 'B'
+ */
+static inline uint16_t hci_cmd_link_key_request_negative_reply_encode(uint8_t * buffer, const bd_addr_t bd_addr){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_LINK_KEY_REQUEST_NEGATIVE_REPLY);
+    buffer[2] = 6;
+    reverse_bd_addr(bd_addr, &buffer[3]);
+    return 9;
+}
+
+/**
+ * @brief Encode hci_pin_code_request_reply command
+ * @param buffer for HCI Command packet with 26 bytes
+ * @param bd_addr
+ * @param pin_length
+ * @param pin
+ * @return size of HCI Command packet
+ * @note: format 'B1P'
+ */
+static inline uint16_t hci_cmd_pin_code_request_reply_encode(uint8_t * buffer, const bd_addr_t bd_addr, uint8_t pin_length, const uint8_t *pin){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_PIN_CODE_REQUEST_REPLY);
+    buffer[2] = 23;
+    reverse_bd_addr(bd_addr, &buffer[3]);
+    buffer[9] = pin_length;
+    (void)memcpy(&buffer[10], pin, 16);
+    return 26;
+}
+
+/**
+ * @brief Encode hci_pin_code_request_negative_reply command
+ * @param buffer for HCI Command packet with 9 bytes
+ * @param bd_addr
+ * @return size of HCI Command packet
+ * @note: format 'B'
+ */
+static inline uint16_t hci_cmd_pin_code_request_negative_reply_encode(uint8_t * buffer, const bd_addr_t bd_addr){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_PIN_CODE_REQUEST_NEGATIVE_REPLY);
+    buffer[2] = 6;
+    reverse_bd_addr(bd_addr, &buffer[3]);
+    return 9;
+}
+
+/**
+ * @brief Encode hci_change_connection_packet_type command
+ * @param buffer for HCI Command packet with 7 bytes
+ * @param handle
+ * @param packet_type
+ * @return size of HCI Command packet
+ * @note: format 'H2'
+ */
+static inline uint16_t hci_cmd_change_connection_packet_type_encode(uint8_t * buffer, hci_con_handle_t handle, uint16_t packet_type){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_CHANGE_CONNECTION_PACKET_TYPE);
+    buffer[2] = 4;
+    little_endian_store_16(buffer, 3, handle);
+    little_endian_store_16(buffer, 5, packet_type);
+    return 7;
+}
+
+/**
+ * @brief Encode hci_authentication_requested command
+ * @param buffer for HCI Command packet with 5 bytes
+ * @param handle
+ * @return size of HCI Command packet
+ * @note: format 'H'
+ */
+static inline uint16_t hci_cmd_authentication_requested_encode(uint8_t * buffer, hci_con_handle_t handle){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_AUTHENTICATION_REQUESTED);
+    buffer[2] = 2;
+    little_endian_store_16(buffer, 3, handle);
+    return 5;
+}
+
+/**
+ * @brief Encode hci_set_connection_encryption command
+ * @param buffer for HCI Command packet with 6 bytes
+ * @param handle
+ * @param encryption_enable
+ * @return size of HCI Command packet
+ * @note: format 'H1'
+ */
+static inline uint16_t hci_cmd_set_connection_encryption_encode(uint8_t * buffer, hci_con_handle_t handle, uint8_t encryption_enable){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_SET_CONNECTION_ENCRYPTION);
+    buffer[2] = 3;
+    little_endian_store_16(buffer, 3, handle);
+    buffer[5] = encryption_enable;
+    return 6;
+}
+
+/**
+ * @brief Encode hci_change_connection_link_key command
+ * @param buffer for HCI Command packet with 5 bytes
+ * @param handle
+ * @return size of HCI Command packet
+ * @note: format 'H'
+ */
+static inline uint16_t hci_cmd_change_connection_link_key_encode(uint8_t * buffer, hci_con_handle_t handle){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_CHANGE_CONNECTION_LINK_KEY);
+    buffer[2] = 2;
+    little_endian_store_16(buffer, 3, handle);
+    return 5;
+}
+
+/**
+ * @brief Encode hci_remote_name_request command
+ * @param buffer for HCI Command packet with 13 bytes
+ * @param bd_addr
+ * @param page_scan_repetition_mode
+ * @param reserved
+ * @param clock_offset
+ * @return size of HCI Command packet
+ * @note: format 'B112'
+ */
+static inline uint16_t hci_cmd_remote_name_request_encode(uint8_t * buffer, const bd_addr_t bd_addr, uint8_t page_scan_repetition_mode, uint8_t reserved, uint16_t clock_offset){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_REMOTE_NAME_REQUEST);
+    buffer[2] = 10;
+    reverse_bd_addr(bd_addr, &buffer[3]);
+    buffer[9] = page_scan_repetition_mode;
+    buffer[10] = reserved;
+    little_endian_store_16(buffer, 11, clock_offset);
+    return 13;
+}
+
+/**
+ * @brief Encode hci_remote_name_request_cancel command
+ * @param buffer for HCI Command packet with 9 bytes
+ * @param bd_addr
+ * @return size of HCI Command packet
+ * @note: format 'B'
+ */
+static inline uint16_t hci_cmd_remote_name_request_cancel_encode(uint8_t * buffer, const bd_addr_t bd_addr){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_REMOTE_NAME_REQUEST_CANCEL);
+    buffer[2] = 6;
+    reverse_bd_addr(bd_addr, &buffer[3]);
+    return 9;
+}
+
+/**
+ * @brief Encode hci_read_remote_supported_features_command command
+ * @param buffer for HCI Command packet with 5 bytes
+ * @param handle
+ * @return size of HCI Command packet
+ * @note: format 'H'
+ */
+static inline uint16_t hci_cmd_read_remote_supported_features_command_encode(uint8_t * buffer, hci_con_handle_t handle){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_READ_REMOTE_SUPPORTED_FEATURES_COMMAND);
+    buffer[2] = 2;
+    little_endian_store_16(buffer, 3, handle);
+    return 5;
+}
+
+/**
+ * @brief Encode hci_read_remote_extended_features_command command
+ * @param buffer for HCI Command packet with 6 bytes
+ * @param arg1
+ * @param arg2
+ * @return size of HCI Command packet
+ * @note: format 'H1'
+ */
+static inline uint16_t hci_cmd_read_remote_extended_features_command_encode(uint8_t * buffer, hci_con_handle_t arg1, uint8_t arg2){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_READ_REMOTE_EXTENDED_FEATURES_COMMAND);
+    buffer[2] = 3;
+    little_endian_store_16(buffer, 3, arg1);
+    buffer[5] = arg2;
+    return 6;
+}
+
+/**
+ * @brief Encode hci_read_remote_version_information command
+ * @param buffer for HCI Command packet with 5 bytes
+ * @param handle
+ * @return size of HCI Command packet
+ * @note: format 'H'
+ */
+static inline uint16_t hci_cmd_read_remote_version_information_encode(uint8_t * buffer, hci_con_handle_t handle){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_READ_REMOTE_VERSION_INFORMATION);
+    buffer[2] = 2;
+    little_endian_store_16(buffer, 3, handle);
+    return 5;
+}
+
+/**
+ * @brief Encode hci_read_clock_offset command
+ * @param buffer for HCI Command packet with 5 bytes
+ * @param handle
+ * @return size of HCI Command packet
+ * @note: format 'H'
+ */
+static inline uint16_t hci_cmd_read_clock_offset_encode(uint8_t * buffer, hci_con_handle_t handle){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_READ_CLOCK_OFFSET);
+    buffer[2] = 2;
+    little_endian_store_16(buffer, 3, handle);
+    return 5;
+}
+
+/**
+ * @brief Encode hci_setup_synchronous_connection command
+ * @param buffer for HCI Command packet with 20 bytes
+ * @param handle
+ * @param transmit_bandwidth
+ * @param receive_bandwidth
+ * @param max_latency
+ * @param voice_settings
+ * @param retransmission_effort
+ * @param packet_type
+ * @return size of HCI Command packet
+ * @note: format 'H442212'
+ */
+static inline uint16_t hci_cmd_setup_synchronous_connection_encode(uint8_t * buffer, hci_con_handle_t handle, uint32_t transmit_bandwidth, uint32_t receive_bandwidth, uint16_t max_latency, uint16_t voice_settings, uint8_t retransmission_effort, uint16_t packet_type){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_SETUP_SYNCHRONOUS_CONNECTION);
+    buffer[2] = 17;
+    little_endian_store_16(buffer, 3, handle);
+    little_endian_store_32(buffer, 5, transmit_bandwidth);
+    little_endian_store_32(buffer, 9, receive_bandwidth);
+    little_endian_store_16(buffer, 13, max_latency);
+    little_endian_store_16(buffer, 15, voice_settings);
+    buffer[17] = retransmission_effort;
+    little_endian_store_16(buffer, 18, packet_type);
+    return 20;
+}
+
+/**
+ * @brief Encode hci_accept_synchronous_connection command
+ * @param buffer for HCI Command packet with 24 bytes
+ * @param bd_addr
+ * @param transmit_bandwidth
+ * @param receive_bandwidth
+ * @param max_latency
+ * @param voice_settings
+ * @param retransmission_effort
+ * @param packet_type
+ * @return size of HCI Command packet
+ * @note: format 'B442212'
+ */
+static inline uint16_t hci_cmd_accept_synchronous_connection_encode(uint8_t * buffer, const bd_addr_t bd_addr, uint32_t transmit_bandwidth, uint32_t receive_bandwidth, uint16_t max_latency, uint16_t voice_settings, uint8_t retransmission_effort, uint16_t packet_type){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_ACCEPT_SYNCHRONOUS_CONNECTION);
+    buffer[2] = 21;
+    reverse_bd_addr(bd_addr, &buffer[3]);
+    little_endian_store_32(buffer, 9, transmit_bandwidth);
+    little_endian_store_32(buffer, 13, receive_bandwidth);
+    little_endian_store_16(buffer, 17, max_latency);
+    little_endian_store_16(buffer, 19, voice_settings);
+    buffer[21] = retransmission_effort;
+    little_endian_store_16(buffer, 22, packet_type);
+    return 24;
+}
+
+/**
+ * @brief Encode hci_io_capability_request_reply command
+ * @param buffer for HCI Command packet with 12 bytes
+ * @param bd_addr
+ * @param io_capability
+ * @param oob_data_present
+ * @param authentication_requirements
+ * @return size of HCI Command packet
+ * @note: format 'B111'
+ */
+static inline uint16_t hci_cmd_io_capability_request_reply_encode(uint8_t * buffer, const bd_addr_t bd_addr, uint8_t io_capability, uint8_t oob_data_present, uint8_t authentication_requirements){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_IO_CAPABILITY_REQUEST_REPLY);
+    buffer[2] = 9;
+    reverse_bd_addr(bd_addr, &buffer[3]);
+    buffer[9] = io_capability;
+    buffer[10] = oob_data_present;
+    buffer[11] = authentication_requirements;
+    return 12;
+}
+
+/**
+ * @brief Encode hci_user_confirmation_request_reply command
+ * @param buffer for HCI Command packet with 9 bytes
+ * @param bd_addr
+ * @return size of HCI Command packet
+ * @note: format 'B'
+ */
+static inline uint16_t hci_cmd_user_confirmation_request_reply_encode(uint8_t * buffer, const bd_addr_t bd_addr){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_USER_CONFIRMATION_REQUEST_REPLY);
+    buffer[2] = 6;
+    reverse_bd_addr(bd_addr, &buffer[3]);
+    return 9;
+}
+
+/**
+ * @brief Encode hci_user_confirmation_request_negative_reply command
+ * @param buffer for HCI Command packet with 9 bytes
+ * @param bd_addr
+ * @return size of HCI Command packet
+ * @note: format 'B'
+ */
+static inline uint16_t hci_cmd_user_confirmation_request_negative_reply_encode(uint8_t * buffer, const bd_addr_t bd_addr){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_USER_CONFIRMATION_REQUEST_NEGATIVE_REPLY);
+    buffer[2] = 6;
+    reverse_bd_addr(bd_addr, &buffer[3]);
+    return 9;
+}
+
+/**
+ * @brief Encode hci_user_passkey_request_reply command
+ * @param buffer for HCI Command packet with 13 bytes
+ * @param bd_addr
+ * @param numeric_value
+ * @return size of HCI Command packet
+ * @note: format 'B4'
+ */
+static inline uint16_t hci_cmd_user_passkey_request_reply_encode(uint8_t * buffer, const bd_addr_t bd_addr, uint32_t numeric_value){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_USER_PASSKEY_REQUEST_REPLY);
+    buffer[2] = 10;
+    reverse_bd_addr(bd_addr, &buffer[3]);
+    little_endian_store_32(buffer, 9, numeric_value);
+    return 13;
+}
+
+/**
+ * @brief Encode hci_user_passkey_request_negative_reply command
+ * @param buffer for HCI Command packet with 9 bytes
+ * @param bd_addr
+ * @return size of HCI Command packet
+ * @note: format 'B'
+ */
+static inline uint16_t hci_cmd_user_passkey_request_negative_reply_encode(uint8_t * buffer, const bd_addr_t bd_addr){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_USER_PASSKEY_REQUEST_NEGATIVE_REPLY);
+    buffer[2] = 6;
+    reverse_bd_addr(bd_addr, &buffer[3]);
+    return 9;
+}
+
+/**
+ * @brief Encode hci_remote_oob_data_request_reply command
+ * @param buffer for HCI Command packet with 41 bytes
+ * @param bd_addr
+ * @param c
+ * @param r
+ * @return size of HCI Command packet
+ * @note: format 'BKK'
+ */
+static inline uint16_t hci_cmd_remote_oob_data_request_reply_encode(uint8_t * buffer, const bd_addr_t bd_addr, const uint8_t *c, const uint8_t *r){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_REMOTE_OOB_DATA_REQUEST_REPLY);
+    buffer[2] = 38;
+    reverse_bd_addr(bd_addr, &buffer[3]);
+    reverse_128(c, &buffer[9]);
+    reverse_128(r, &buffer[25]);
+    return 41;
+}
+
+/**
+ * @brief Encode hci_remote_oob_data_request_negative_reply command
+ * @param buffer for HCI Command packet with 9 bytes
+ * @param bd_addr
+ * @return size of HCI Command packet
+ * @note: format 'B'
+ */
+static inline uint16_t hci_cmd_remote_oob_data_request_negative_reply_encode(uint8_t * buffer, const bd_addr_t bd_addr){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_REMOTE_OOB_DATA_REQUEST_NEGATIVE_REPLY);
+    buffer[2] = 6;
+    reverse_bd_addr(bd_addr, &buffer[3]);
+    return 9;
+}
+
+/**
+ * @brief Encode hci_io_capability_request_negative_reply command
+ * @param buffer for HCI Command packet with 10 bytes
+ * @param bd_addr
+ * @param reason
+ * @return size of HCI Command packet
+ * @note: format 'B1'
+ */
+static inline uint16_t hci_cmd_io_capability_request_negative_reply_encode(uint8_t * buffer, const bd_addr_t bd_addr, uint8_t reason){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_IO_CAPABILITY_REQUEST_NEGATIVE_REPLY);
+    buffer[2] = 7;
+    reverse_bd_addr(bd_addr, &buffer[3]);
+    buffer[9] = reason;
+    return 10;
+}
+
+/**
+ * @brief Encode hci_enhanced_setup_synchronous_connection command
+ * @param buffer for HCI Command packet with 62 bytes
+ * @param handle
+ * @param transmit_bandwidth
+ * @param receive_bandwidth
+ * @param transmit_coding_format_type
+ * @param transmit_coding_format_company
+ * @param transmit_coding_format_codec
+ * @param receive_coding_format_type
+ * @param receive_coding_format_company
+ * @param receive_coding_format_codec
+ * @param transmit_coding_frame_size
+ * @param receive_coding_frame_size
+ * @param input_bandwidth
+ * @param output_bandwidth
+ * @param input_coding_format_type
+ * @param input_coding_format_company
+ * @param input_coding_format_codec
+ * @param output_coding_format_type
+ * @param output_coding_format_company
+ * @param output_coding_format_codec
+ * @param input_coded_data_size
+ * @param outupt_coded_data_size
+ * @param input_pcm_data_format
+ * @param output_pcm_data_format
+ * @param input_pcm_sample_payload_msb_position
+ * @param output_pcm_sample_payload_msb_position
+ * @param input_data_path
+ * @param output_data_path
+ * @param input_transport_unit_size
+ * @param output_transport_unit_size
+ * @param max_latency
+ * @param packet_type
+ * @param retransmission_effort
+ * @return size of HCI Command packet
+ * @note: format 'H4412212222441221222211111111221'
+ */
+static inline uint16_t hci_cmd_enhanced_setup_synchronous_connection_encode(uint8_t * buffer, hci_con_handle_t handle, uint32_t transmit_bandwidth, uint32_t receive_bandwidth, uint8_t transmit_coding_format_type, uint16_t transmit_coding_format_company, uint16_t transmit_coding_format_codec, uint8_t receive_coding_format_type, uint16_t receive_coding_format_company, uint16_t receive_coding_format_codec, uint16_t transmit_coding_frame_size, uint16_t receive_coding_frame_size, uint32_t input_bandwidth, uint32_t output_bandwidth, uint8_t input_coding_format_type, uint16_t input_coding_format_company, uint16_t input_coding_format_codec, uint8_t output_coding_format_type, uint16_t output_coding_format_company, uint16_t output_coding_format_codec, uint16_t input_coded_data_size, uint16_t outupt_coded_data_size, uint8_t input_pcm_data_format, uint8_t output_pcm_data_format, uint8_t input_pcm_sample_payload_msb_position, uint8_t output_pcm_sample_payload_msb_position, uint8_t input_data_path, uint8_t output_data_path, uint8_t input_transport_unit_size, uint8_t output_transport_unit_size, uint16_t max_latency, uint16_t packet_type, uint8_t retransmission_effort){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_ENHANCED_SETUP_SYNCHRONOUS_CONNECTION);
+    buffer[2] = 59;
+    little_endian_store_16(buffer, 3, handle);
+    little_endian_store_32(buffer, 5, transmit_bandwidth);
+    little_endian_store_32(buffer, 9, receive_bandwidth);
+    buffer[13] = transmit_coding_format_type;
+    little_endian_store_16(buffer, 14, transmit_coding_format_company);
+    little_endian_store_16(buffer, 16, transmit_coding_format_codec);
+    buffer[18] = receive_coding_format_type;
+    little_endian_store_16(buffer, 19, receive_coding_format_company);
+    little_endian_store_16(buffer, 21, receive_coding_format_codec);
+    little_endian_store_16(buffer, 23, transmit_coding_frame_size);
+    little_endian_store_16(buffer, 25, receive_coding_frame_size);
+    little_endian_store_32(buffer, 27, input_bandwidth);
+    little_endian_store_32(buffer, 31, output_bandwidth);
+    buffer[35] = input_coding_format_type;
+    little_endian_store_16(buffer, 36, input_coding_format_company);
+    little_endian_store_16(buffer, 38, input_coding_format_codec);
+    buffer[40] = output_coding_format_type;
+    little_endian_store_16(buffer, 41, output_coding_format_company);
+    little_endian_store_16(buffer, 43, output_coding_format_codec);
+    little_endian_store_16(buffer, 45, input_coded_data_size);
+    little_endian_store_16(buffer, 47, outupt_coded_data_size);
+    buffer[49] = input_pcm_data_format;
+    buffer[50] = output_pcm_data_format;
+    buffer[51] = input_pcm_sample_payload_msb_position;
+    buffer[52] = output_pcm_sample_payload_msb_position;
+    buffer[53] = input_data_path;
+    buffer[54] = output_data_path;
+    buffer[55] = input_transport_unit_size;
+    buffer[56] = output_transport_unit_size;
+    little_endian_store_16(buffer, 57, max_latency);
+    little_endian_store_16(buffer, 59, packet_type);
+    buffer[61] = retransmission_effort;
+    return 62;
+}
+
+/**
+ * @brief Encode hci_enhanced_accept_synchronous_connection command
+ * @param buffer for HCI Command packet with 66 bytes
+ * @param bd_addr
+ * @param transmit_bandwidth
+ * @param receive_bandwidth
+ * @param transmit_coding_format_type
+ * @param transmit_coding_format_company
+ * @param transmit_coding_format_codec
+ * @param receive_coding_format_type
+ * @param receive_coding_format_company
+ * @param receive_coding_format_codec
+ * @param transmit_coding_frame_size
+ * @param receive_coding_frame_size
+ * @param input_bandwidth
+ * @param output_bandwidth
+ * @param input_coding_format_type
+ * @param input_coding_format_company
+ * @param input_coding_format_codec
+ * @param output_coding_format_type
+ * @param output_coding_format_company
+ * @param output_coding_format_codec
+ * @param input_coded_data_size
+ * @param outupt_coded_data_size
+ * @param input_pcm_data_format
+ * @param output_pcm_data_format
+ * @param input_pcm_sample_payload_msb_position
+ * @param output_pcm_sample_payload_msb_position
+ * @param input_data_path
+ * @param output_data_path
+ * @param input_transport_unit_size
+ * @param output_transport_unit_size
+ * @param max_latency
+ * @param packet_type
+ * @param retransmission_effort
+ * @return size of HCI Command packet
+ * @note: format 'B4412212222441221222211111111221'
+ */
+static inline uint16_t hci_cmd_enhanced_accept_synchronous_connection_encode(uint8_t * buffer, const bd_addr_t bd_addr, uint32_t transmit_bandwidth, uint32_t receive_bandwidth, uint8_t transmit_coding_format_type, uint16_t transmit_coding_format_company, uint16_t transmit_coding_format_codec, uint8_t receive_coding_format_type, uint16_t receive_coding_format_company, uint16_t receive_coding_format_codec, uint16_t transmit_coding_frame_size, uint16_t receive_coding_frame_size, uint32_t input_bandwidth, uint32_t output_bandwidth, uint8_t input_coding_format_type, uint16_t input_coding_format_company, uint16_t input_coding_format_codec, uint8_t output_coding_format_type, uint16_t output_coding_format_company, uint16_t output_coding_format_codec, uint16_t input_coded_data_size, uint16_t outupt_coded_data_size, uint8_t input_pcm_data_format, uint8_t output_pcm_data_format, uint8_t input_pcm_sample_payload_msb_position, uint8_t output_pcm_sample_payload_msb_position, uint8_t input_data_path, uint8_t output_data_path, uint8_t input_transport_unit_size, uint8_t output_transport_unit_size, uint16_t max_latency, uint16_t packet_type, uint8_t retransmission_effort){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_ENHANCED_ACCEPT_SYNCHRONOUS_CONNECTION);
+    buffer[2] = 63;
+    reverse_bd_addr(bd_addr, &buffer[3]);
+    little_endian_store_32(buffer, 9, transmit_bandwidth);
+    little_endian_store_32(buffer, 13, receive_bandwidth);
+    buffer[17] = transmit_coding_format_type;
+    little_endian_store_16(buffer, 18, transmit_coding_format_company);
+    little_endian_store_16(buffer, 20, transmit_coding_format_codec);
+    buffer[22] = receive_coding_format_type;
+    little_endian_store_16(buffer, 23, receive_coding_format_company);
+    little_endian_store_16(buffer, 25, receive_coding_format_codec);
+    little_endian_store_16(buffer, 27, transmit_coding_frame_size);
+    little_endian_store_16(buffer, 29, receive_coding_frame_size);
+    little_endian_store_32(buffer, 31, input_bandwidth);
+    little_endian_store_32(buffer, 35, output_bandwidth);
+    buffer[39] = input_coding_format_type;
+    little_endian_store_16(buffer, 40, input_coding_format_company);
+    little_endian_store_16(buffer, 42, input_coding_format_codec);
+    buffer[44] = output_coding_format_type;
+    little_endian_store_16(buffer, 45, output_coding_format_company);
+    little_endian_store_16(buffer, 47, output_coding_format_codec);
+    little_endian_store_16(buffer, 49, input_coded_data_size);
+    little_endian_store_16(buffer, 51, outupt_coded_data_size);
+    buffer[53] = input_pcm_data_format;
+    buffer[54] = output_pcm_data_format;
+    buffer[55] = input_pcm_sample_payload_msb_position;
+    buffer[56] = output_pcm_sample_payload_msb_position;
+    buffer[57] = input_data_path;
+    buffer[58] = output_data_path;
+    buffer[59] = input_transport_unit_size;
+    buffer[60] = output_transport_unit_size;
+    little_endian_store_16(buffer, 61, max_latency);
+    little_endian_store_16(buffer, 63, packet_type);
+    buffer[65] = retransmission_effort;
+    return 66;
+}
+
+/**
+ * @brief Encode hci_remote_oob_extended_data_request_reply command
+ * @param buffer for HCI Command packet with 73 bytes
+ * @param bd_addr
+ * @param c_192
+ * @param r_192
+ * @param c_256
+ * @param r_256
+ * @return size of HCI Command packet
+ * @note: format 'BKKKK'
+ */
+static inline uint16_t hci_cmd_remote_oob_extended_data_request_reply_encode(uint8_t * buffer, const bd_addr_t bd_addr, const uint8_t *c_192, const uint8_t *r_192, const uint8_t *c_256, const uint8_t *r_256){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_REMOTE_OOB_EXTENDED_DATA_REQUEST_REPLY);
+    buffer[2] = 70;
+    reverse_bd_addr(bd_addr, &buffer[3]);
+    reverse_128(c_192, &buffer[9]);
+    reverse_128(r_192, &buffer[25]);
+    reverse_128(c_256, &buffer[41]);
+    reverse_128(r_256, &buffer[57]);
+    return 73;
+}
+
+/**
+ * @brief Encode hci_hold_mode command
+ * @param buffer for HCI Command packet with 9 bytes
+ * @param handle
+ * @param hold_mode_max_interval
+ * @param hold_mode_min_interval
+ * @return size of HCI Command packet
+ * @note: format 'H22'
+ */
+static inline uint16_t hci_cmd_hold_mode_encode(uint8_t * buffer, hci_con_handle_t handle, uint16_t hold_mode_max_interval, uint16_t hold_mode_min_interval){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_HOLD_MODE);
+    buffer[2] = 6;
+    little_endian_store_16(buffer, 3, handle);
+    little_endian_store_16(buffer, 5, hold_mode_max_interval);
+    little_endian_store_16(buffer, 7, hold_mode_min_interval);
+    return 9;
+}
+
+/**
+ * @brief Encode hci_sniff_mode command
+ * @param buffer for HCI Command packet with 13 bytes
+ * @param handle
+ * @param sniff_max_interval
+ * @param sniff_min_interval
+ * @param sniff_attempt
+ * @param sniff_timeout
+ * @return size of HCI Command packet
+ * @note: format 'H2222'
+ */
+static inline uint16_t hci_cmd_sniff_mode_encode(uint8_t * buffer, hci_con_handle_t handle, uint16_t sniff_max_interval, uint16_t sniff_min_interval, uint16_t sniff_attempt, uint16_t sniff_timeout){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_SNIFF_MODE);
+    buffer[2] = 10;
+    little_endian_store_16(buffer, 3, handle);
+    little_endian_store_16(buffer, 5, sniff_max_interval);
+    little_endian_store_16(buffer, 7, sniff_min_interval);
+    little_endian_store_16(buffer, 9, sniff_attempt);
+    little_endian_store_16(buffer, 11, sniff_timeout);
+    return 13;
+}
+
+/**
+ * @brief Encode hci_exit_sniff_mode command
+ * @param buffer for HCI Command packet with 5 bytes
+ * @param handle
+ * @return size of HCI Command packet
+ * @note: format 'H'
+ */
+static inline uint16_t hci_cmd_exit_sniff_mode_encode(uint8_t * buffer, hci_con_handle_t handle){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_EXIT_SNIFF_MODE);
+    buffer[2] = 2;
+    little_endian_store_16(buffer, 3, handle);
+    return 5;
+}
+
+/**
+ * @brief Encode hci_park_state command
+ * @param buffer for HCI Command packet with 9 bytes
+ * @param arg1
+ * @param arg2
+ * @param arg3
+ * @return size of HCI Command packet
+ * @note: format 'H22'
+ */
+static inline uint16_t hci_cmd_park_state_encode(uint8_t * buffer, hci_con_handle_t arg1, uint16_t arg2, uint16_t arg3){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_PARK_STATE);
+    buffer[2] = 6;
+    little_endian_store_16(buffer, 3, arg1);
+    little_endian_store_16(buffer, 5, arg2);
+    little_endian_store_16(buffer, 7, arg3);
+    return 9;
+}
+
+/**
+ * @brief Encode hci_exit_park_state command
+ * @param buffer for HCI Command packet with 5 bytes
+ * @param handle
+ * @return size of HCI Command packet
+ * @note: format 'H'
+ */
+static inline uint16_t hci_cmd_exit_park_state_encode(uint8_t * buffer, hci_con_handle_t handle){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_EXIT_PARK_STATE);
+    buffer[2] = 2;
+    little_endian_store_16(buffer, 3, handle);
+    return 5;
+}
+
+/**
+ * @brief Encode hci_qos_setup command
+ * @param buffer for HCI Command packet with 23 bytes
+ * @param handle
+ * @param flags
+ * @param service_type
+ * @param token_rate
+ * @param peak_bandwith
+ * @param latency
+ * @param delay_variation
+ * @return size of HCI Command packet
+ * @note: format 'H114444'
+ */
+static inline uint16_t hci_cmd_qos_setup_encode(uint8_t * buffer, hci_con_handle_t handle, uint8_t flags, uint8_t service_type, uint32_t token_rate, uint32_t peak_bandwith, uint32_t latency, uint32_t delay_variation){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_QOS_SETUP);
+    buffer[2] = 20;
+    little_endian_store_16(buffer, 3, handle);
+    buffer[5] = flags;
+    buffer[6] = service_type;
+    little_endian_store_32(buffer, 7, token_rate);
+    little_endian_store_32(buffer, 11, peak_bandwith);
+    little_endian_store_32(buffer, 15, latency);
+    little_endian_store_32(buffer, 19, delay_variation);
+    return 23;
+}
+
+/**
+ * @brief Encode hci_role_discovery command
+ * @param buffer for HCI Command packet with 5 bytes
+ * @param handle
+ * @return size of HCI Command packet
+ * @note: format 'H'
+ */
+static inline uint16_t hci_cmd_role_discovery_encode(uint8_t * buffer, hci_con_handle_t handle){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_ROLE_DISCOVERY);
+    buffer[2] = 2;
+    little_endian_store_16(buffer, 3, handle);
+    return 5;
+}
+
+/**
+ * @brief Encode hci_switch_role_command command
+ * @param buffer for HCI Command packet with 10 bytes
+ * @param bd_addr
+ * @param role
+ * @return size of HCI Command packet
+ * @note: format 'B1'
+ */
+static inline uint16_t hci_cmd_switch_role_command_encode(uint8_t * buffer, const bd_addr_t bd_addr, uint8_t role){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_SWITCH_ROLE_COMMAND);
+    buffer[2] = 7;
+    reverse_bd_addr(bd_addr, &buffer[3]);
+    buffer[9] = role;
+    return 10;
+}
+
+/**
+ * @brief Encode hci_read_link_policy_settings command
+ * @param buffer for HCI Command packet with 5 bytes
+ * @param handle
+ * @return size of HCI Command packet
+ * @note: format 'H'
+ */
+static inline uint16_t hci_cmd_read_link_policy_settings_encode(uint8_t * buffer, hci_con_handle_t handle){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_READ_LINK_POLICY_SETTINGS);
+    buffer[2] = 2;
+    little_endian_store_16(buffer, 3, handle);
+    return 5;
+}
+
+/**
+ * @brief Encode hci_write_link_policy_settings command
+ * @param buffer for HCI Command packet with 7 bytes
+ * @param handle
+ * @param settings
+ * @return size of HCI Command packet
+ * @note: format 'H2'
+ */
+static inline uint16_t hci_cmd_write_link_policy_settings_encode(uint8_t * buffer, hci_con_handle_t handle, uint16_t settings){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_WRITE_LINK_POLICY_SETTINGS);
+    buffer[2] = 4;
+    little_endian_store_16(buffer, 3, handle);
+    little_endian_store_16(buffer, 5, settings);
+    return 7;
+}
+
+/**
+ * @brief Encode hci_sniff_subrating command
+ * @param buffer for HCI Command packet with 11 bytes
+ * @param handle
+ * @param max_latency
+ * @param min_remote_timeout
+ * @param min_local_timeout
+ * @return size of HCI Command packet
+ * @note: format 'H222'
+ */
+static inline uint16_t hci_cmd_sniff_subrating_encode(uint8_t * buffer, hci_con_handle_t handle, uint16_t max_latency, uint16_t min_remote_timeout, uint16_t min_local_timeout){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_SNIFF_SUBRATING);
+    buffer[2] = 8;
+    little_endian_store_16(buffer, 3, handle);
+    little_endian_store_16(buffer, 5, max_latency);
+    little_endian_store_16(buffer, 7, min_remote_timeout);
+    little_endian_store_16(buffer, 9, min_local_timeout);
+    return 11;
+}
+
+/**
+ * @brief Encode hci_write_default_link_policy_setting command
+ * @param buffer for HCI Command packet with 5 bytes
+ * @param policy
+ * @return size of HCI Command packet
+ * @note: format '2'
+ */
+static inline uint16_t hci_cmd_write_default_link_policy_setting_encode(uint8_t * buffer, uint16_t policy){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_WRITE_DEFAULT_LINK_POLICY_SETTING);
+    buffer[2] = 2;
+    little_endian_store_16(buffer, 3, policy);
+    return 5;
+}
+
+/**
+ * @brief Encode hci_flow_specification command
+ * @param buffer for HCI Command packet with 24 bytes
+ * @param handle
+ * @param unused
+ * @param flow_direction
+ * @param service_type
+ * @param token_rate
+ * @param token_bucket_size
+ * @param peak_bandwidth
+ * @param access_latency
+ * @return size of HCI Command packet
+ * @note: format 'H1114444'
+ */
+static inline uint16_t hci_cmd_flow_specification_encode(uint8_t * buffer, hci_con_handle_t handle, uint8_t unused, uint8_t flow_direction, uint8_t service_type, uint32_t token_rate, uint32_t token_bucket_size, uint32_t peak_bandwidth, uint32_t access_latency){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_FLOW_SPECIFICATION);
+    buffer[2] = 21;
+    little_endian_store_16(buffer, 3, handle);
+    buffer[5] = unused;
+    buffer[6] = flow_direction;
+    buffer[7] = service_type;
+    little_endian_store_32(buffer, 8, token_rate);
+    little_endian_store_32(buffer, 12, token_bucket_size);
+    little_endian_store_32(buffer, 16, peak_bandwidth);
+    little_endian_store_32(buffer, 20, access_latency);
+    return 24;
+}
+
+/**
+ * @brief Encode hci_set_event_mask command
+ * @param buffer for HCI Command packet with 11 bytes
+ * @param event_mask_lower_octets
+ * @param event_mask_higher_octets
+ * @return size of HCI Command packet
+ * @note: format '44'
+ */
+static inline uint16_t hci_cmd_set_event_mask_encode(uint8_t * buffer, uint32_t event_mask_lower_octets, uint32_t event_mask_higher_octets){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_SET_EVENT_MASK);
+    buffer[2] = 8;
+    little_endian_store_32(buffer, 3, event_mask_lower_octets);
+    little_endian_store_32(buffer, 7, event_mask_higher_octets);
+    return 11;
+}
+
+/**
+ * @brief Encode hci_reset command
+ * @param buffer for HCI Command packet with 3 bytes
+ * @return size of HCI Command packet
+ * @note: format ''
+ */
+static inline uint16_t hci_cmd_reset_encode(uint8_t * buffer){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_RESET);
+    buffer[2] = 0;
+    return 3;
+}
+
+/**
+ * @brief Encode hci_flush command
+ * @param buffer for HCI Command packet with 5 bytes
+ * @param handle
+ * @return size of HCI Command packet
+ * @note: format 'H'
+ */
+static inline uint16_t hci_cmd_flush_encode(uint8_t * buffer, hci_con_handle_t handle){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_FLUSH);
+    buffer[2] = 2;
+    little_endian_store_16(buffer, 3, handle);
+    return 5;
+}
+
+/**
+ * @brief Encode hci_read_pin_type command
+ * @param buffer for HCI Command packet with 3 bytes
+ * @return size of HCI Command packet
+ * @note: format ''
+ */
+static inline uint16_t hci_cmd_read_pin_type_encode(uint8_t * buffer){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_READ_PIN_TYPE);
+    buffer[2] = 0;
+    return 3;
+}
+
+/**
+ * @brief Encode hci_write_pin_type command
+ * @param buffer for HCI Command packet with 4 bytes
+ * @param handle
+ * @return size of HCI Command packet
+ * @note: format '1'
+ */
+static inline uint16_t hci_cmd_write_pin_type_encode(uint8_t * buffer, uint8_t handle){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_WRITE_PIN_TYPE);
+    buffer[2] = 1;
+    buffer[3] = handle;
+    return 4;
+}
+
+/**
+ * @brief Encode hci_delete_stored_link_key command
+ * @param buffer for HCI Command packet with 10 bytes
+ * @param bd_addr
+ * @param delete_all_flags
+ * @return size of HCI Command packet
+ * @note: format 'B1'
+ */
+static inline uint16_t hci_cmd_delete_stored_link_key_encode(uint8_t * buffer, const bd_addr_t bd_addr, uint8_t delete_all_flags){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_DELETE_STORED_LINK_KEY);
+    buffer[2] = 7;
+    reverse_bd_addr(bd_addr, &buffer[3]);
+    buffer[9] = delete_all_flags;
+    return 10;
+}
+
+/**
+ * @brief Encode hci_write_local_name command
+ * @param buffer for HCI Command packet with 251 bytes
+ * @param local_name
+ * @return size of HCI Command packet
+ * @note: format 'N'
+ */
+static inline uint16_t hci_cmd_write_local_name_encode(uint8_t * buffer, const char *local_name){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_WRITE_LOCAL_NAME);
+    buffer[2] = 248;
+    uint16_t local_name_len = (uint16_t) btstack_min((uint32_t) strlen(local_name), 248u);
+    (void)memcpy(&buffer[3], local_name, local_name_len);
+    memset(&buffer[3 + local_name_len], 0, 248u - local_name_len);
+    return 251;
+}
+
+/**
+ * @brief Encode hci_read_local_name command
+ * @param buffer for HCI Command packet with 3 bytes
+ * @return size of HCI Command packet
+ * @note: format ''
+ */
+static inline uint16_t hci_cmd_read_local_name_encode(uint8_t * buffer){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_READ_LOCAL_NAME);
+    buffer[2] = 0;
+    return 3;
+}
+
+/**
+ * @brief Encode hci_read_page_timeout command
+ * @param buffer for HCI Command packet with 3 bytes
+ * @return size of HCI Command packet
+ * @note: format ''
+ */
+static inline uint16_t hci_cmd_read_page_timeout_encode(uint8_t * buffer){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_READ_PAGE_TIMEOUT);
+    buffer[2] = 0;
+    return 3;
+}
+
+/**
+ * @brief Encode hci_write_page_timeout command
+ * @param buffer for HCI Command packet with 5 bytes
+ * @param page_timeout
+ * @return size of HCI Command packet
+ * @note: format '2'
+ */
+static inline uint16_t hci_cmd_write_page_timeout_encode(uint8_t * buffer, uint16_t page_timeout){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_WRITE_PAGE_TIMEOUT);
+    buffer[2] = 2;
+    little_endian_store_16(buffer, 3, page_timeout);
+    return 5;
+}
+
+/**
+ * @brief Encode hci_write_scan_enable command
+ * @param buffer for HCI Command packet with 4 bytes
+ * @param scan_enable
+ * @return size of HCI Command packet
+ * @note: format '1'
+ */
+static inline uint16_t hci_cmd_write_scan_enable_encode(uint8_t * buffer, uint8_t scan_enable){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_WRITE_SCAN_ENABLE);
+    buffer[2] = 1;
+    buffer[3] = scan_enable;
+    return 4;
+}
+
+/**
+ * @brief Encode hci_read_page_scan_activity command
+ * @param buffer for HCI Command packet with 3 bytes
+ * @return size of HCI Command packet
+ * @note: format ''
+ */
+static inline uint16_t hci_cmd_read_page_scan_activity_encode(uint8_t * buffer){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_READ_PAGE_SCAN_ACTIVITY);
+    buffer[2] = 0;
+    return 3;
+}
+
+/**
+ * @brief Encode hci_write_page_scan_activity command
+ * @param buffer for HCI Command packet with 7 bytes
+ * @param page_scan_interval
+ * @param page_scan_window
+ * @return size of HCI Command packet
+ * @note: format '22'
+ */
+static inline uint16_t hci_cmd_write_page_scan_activity_encode(uint8_t * buffer, uint16_t page_scan_interval, uint16_t page_scan_window){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_WRITE_PAGE_SCAN_ACTIVITY);
+    buffer[2] = 4;
+    little_endian_store_16(buffer, 3, page_scan_interval);
+    little_endian_store_16(buffer, 5, page_scan_window);
+    return 7;
+}
+
+/**
+ * @brief Encode hci_read_inquiry_scan_activity command
+ * @param buffer for HCI Command packet with 3 bytes
+ * @return size of HCI Command packet
+ * @note: format ''
+ */
+static inline uint16_t hci_cmd_read_inquiry_scan_activity_encode(uint8_t * buffer){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_READ_INQUIRY_SCAN_ACTIVITY);
+    buffer[2] = 0;
+    return 3;
+}
+
+/**
+ * @brief Encode hci_write_inquiry_scan_activity command
+ * @param buffer for HCI Command packet with 7 bytes
+ * @param inquiry_scan_interval
+ * @param inquiry_scan_window
+ * @return size of HCI Command packet
+ * @note: format '22'
+ */
+static inline uint16_t hci_cmd_write_inquiry_scan_activity_encode(uint8_t * buffer, uint16_t inquiry_scan_interval, uint16_t inquiry_scan_window){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_WRITE_INQUIRY_SCAN_ACTIVITY);
+    buffer[2] = 4;
+    little_endian_store_16(buffer, 3, inquiry_scan_interval);
+    little_endian_store_16(buffer, 5, inquiry_scan_window);
+    return 7;
+}
+
+/**
+ * @brief Encode hci_write_authentication_enable command
+ * @param buffer for HCI Command packet with 4 bytes
+ * @param authentication_enable
+ * @return size of HCI Command packet
+ * @note: format '1'
+ */
+static inline uint16_t hci_cmd_write_authentication_enable_encode(uint8_t * buffer, uint8_t authentication_enable){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_WRITE_AUTHENTICATION_ENABLE);
+    buffer[2] = 1;
+    buffer[3] = authentication_enable;
+    return 4;
+}
+
+/**
+ * @brief Encode hci_write_automatic_flush_timeout command
+ * @param buffer for HCI Command packet with 7 bytes
+ * @param handle
+ * @param timeout
+ * @return size of HCI Command packet
+ * @note: format 'H2'
+ */
+static inline uint16_t hci_cmd_write_automatic_flush_timeout_encode(uint8_t * buffer, hci_con_handle_t handle, uint16_t timeout){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_WRITE_AUTOMATIC_FLUSH_TIMEOUT);
+    buffer[2] = 4;
+    little_endian_store_16(buffer, 3, handle);
+    little_endian_store_16(buffer, 5, timeout);
+    return 7;
+}
+
+/**
+ * @brief Encode hci_write_class_of_device command
+ * @param buffer for HCI Command packet with 6 bytes
+ * @param class_of_device
+ * @return size of HCI Command packet
+ * @note: format '3'
+ */
+static inline uint16_t hci_cmd_write_class_of_device_encode(uint8_t * buffer, uint32_t class_of_device){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_WRITE_CLASS_OF_DEVICE);
+    buffer[2] = 3;
+    little_endian_store_24(buffer, 3, class_of_device);
+    return 6;
+}
+
+/**
+ * @brief Encode hci_read_num_broadcast_retransmissions command
+ * @param buffer for HCI Command packet with 3 bytes
+ * @return size of HCI Command packet
+ * @note: format ''
+ */
+static inline uint16_t hci_cmd_read_num_broadcast_retransmissions_encode(uint8_t * buffer){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_READ_NUM_BROADCAST_RETRANSMISSIONS);
+    buffer[2] = 0;
+    return 3;
+}
+
+/**
+ * @brief Encode hci_write_num_broadcast_retransmissions command
+ * @param buffer for HCI Command packet with 4 bytes
+ * @param num_broadcast_retransmissions
+ * @return size of HCI Command packet
+ * @note: format '1'
+ */
+static inline uint16_t hci_cmd_write_num_broadcast_retransmissions_encode(uint8_t * buffer, uint8_t num_broadcast_retransmissions){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_WRITE_NUM_BROADCAST_RETRANSMISSIONS);
+    buffer[2] = 1;
+    buffer[3] = num_broadcast_retransmissions;
+    return 4;
+}
+
+/**
+ * @brief Encode hci_read_transmit_power_level command
+ * @param buffer for HCI Command packet with 6 bytes
+ * @param connection_handle
+ * @param type
+ * @return size of HCI Command packet
+ * @note: format 'H1'
+ */
+static inline uint16_t hci_cmd_read_transmit_power_level_encode(uint8_t * buffer, hci_con_handle_t connection_handle, uint8_t type){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_READ_TRANSMIT_POWER_LEVEL);
+    buffer[2] = 3;
+    little_endian_store_16(buffer, 3, connection_handle);
+    buffer[5] = type;
+    return 6;
+}
+
+/**
+ * @brief Encode hci_write_synchronous_flow_control_enable command
+ * @param buffer for HCI Command packet with 4 bytes
+ * @param synchronous_flow_control_enable
+ * @return size of HCI Command packet
+ * @note: format '1'
+ */
+static inline uint16_t hci_cmd_write_synchronous_flow_control_enable_encode(uint8_t * buffer, uint8_t synchronous_flow_control_enable){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_WRITE_SYNCHRONOUS_FLOW_CONTROL_ENABLE);
+    buffer[2] = 1;
+    buffer[3] = synchronous_flow_control_enable;
+    return 4;
+}
+
+/**
+ * @brief Encode hci_set_controller_to_host_flow_control command
+ * @param buffer for HCI Command packet with 4 bytes
+ * @param flow_control_enable
+ * @return size of HCI Command packet
+ * @note: format '1'
+ */
+static inline uint16_t hci_cmd_set_controller_to_host_flow_control_encode(uint8_t * buffer, uint8_t flow_control_enable){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_SET_CONTROLLER_TO_HOST_FLOW_CONTROL);
+    buffer[2] = 1;
+    buffer[3] = flow_control_enable;
+    return 4;
+}
+
+/**
+ * @brief Encode hci_host_buffer_size command
+ * @param buffer for HCI Command packet with 10 bytes
+ * @param host_acl_data_packet_length
+ * @param host_synchronous_data_packet_length
+ * @param host_total_num_acl_data_packets
+ * @param host_total_num_synchronous_data_packets
+ * @return size of HCI Command packet
+ * @note: format '2122'
+ */
+static inline uint16_t hci_cmd_host_buffer_size_encode(uint8_t * buffer, uint16_t host_acl_data_packet_length, uint8_t host_synchronous_data_packet_length, uint16_t host_total_num_acl_data_packets, uint16_t host_total_num_synchronous_data_packets){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_HOST_BUFFER_SIZE);
+    buffer[2] = 7;
+    little_endian_store_16(buffer, 3, host_acl_data_packet_length);
+    buffer[5] = host_synchronous_data_packet_length;
+    little_endian_store_16(buffer, 6, host_total_num_acl_data_packets);
+    little_endian_store_16(buffer, 8, host_total_num_synchronous_data_packets);
+    return 10;
+}
+
+/**
+ * @brief Encode hci_read_link_supervision_timeout command
+ * @param buffer for HCI Command packet with 5 bytes
+ * @param handle
+ * @return size of HCI Command packet
+ * @note: format 'H'
+ */
+static inline uint16_t hci_cmd_read_link_supervision_timeout_encode(uint8_t * buffer, hci_con_handle_t handle){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_READ_LINK_SUPERVISION_TIMEOUT);
+    buffer[2] = 2;
+    little_endian_store_16(buffer, 3, handle);
+    return 5;
+}
+
+/**
+ * @brief Encode hci_write_link_supervision_timeout command
+ * @param buffer for HCI Command packet with 7 bytes
+ * @param handle
+ * @param timeout
+ * @return size of HCI Command packet
+ * @note: format 'H2'
+ */
+static inline uint16_t hci_cmd_write_link_supervision_timeout_encode(uint8_t * buffer, hci_con_handle_t handle, uint16_t timeout){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_WRITE_LINK_SUPERVISION_TIMEOUT);
+    buffer[2] = 4;
+    little_endian_store_16(buffer, 3, handle);
+    little_endian_store_16(buffer, 5, timeout);
+    return 7;
+}
+
+/**
+ * @brief Encode hci_write_current_iac_lap_two_iacs command
+ * @param buffer for HCI Command packet with 10 bytes
+ * @param num_current_iac
+ * @param iac_lap1
+ * @param iac_lap2
+ * @return size of HCI Command packet
+ * @note: format '133'
+ */
+static inline uint16_t hci_cmd_write_current_iac_lap_two_iacs_encode(uint8_t * buffer, uint8_t num_current_iac, uint32_t iac_lap1, uint32_t iac_lap2){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_WRITE_CURRENT_IAC_LAP_TWO_IACS);
+    buffer[2] = 7;
+    buffer[3] = num_current_iac;
+    little_endian_store_24(buffer, 4, iac_lap1);
+    little_endian_store_24(buffer, 7, iac_lap2);
+    return 10;
+}
+
+/**
+ * @brief Encode hci_write_inquiry_scan_type command
+ * @param buffer for HCI Command packet with 4 bytes
+ * @param inquiry_scan_type
+ * @return size of HCI Command packet
+ * @note: format '1'
+ */
+static inline uint16_t hci_cmd_write_inquiry_scan_type_encode(uint8_t * buffer, uint8_t inquiry_scan_type){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_WRITE_INQUIRY_SCAN_TYPE);
+    buffer[2] = 1;
+    buffer[3] = inquiry_scan_type;
+    return 4;
+}
+
+/**
+ * @brief Encode hci_write_inquiry_mode command
+ * @param buffer for HCI Command packet with 4 bytes
+ * @param inquiry_mode
+ * @return size of HCI Command packet
+ * @note: format '1'
+ */
+static inline uint16_t hci_cmd_write_inquiry_mode_encode(uint8_t * buffer, uint8_t inquiry_mode){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_WRITE_INQUIRY_MODE);
+    buffer[2] = 1;
+    buffer[3] = inquiry_mode;
+    return 4;
+}
+
+/**
+ * @brief Encode hci_write_page_scan_type command
+ * @param buffer for HCI Command packet with 4 bytes
+ * @param page_scan_type
+ * @return size of HCI Command packet
+ * @note: format '1'
+ */
+static inline uint16_t hci_cmd_write_page_scan_type_encode(uint8_t * buffer, uint8_t page_scan_type){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_WRITE_PAGE_SCAN_TYPE);
+    buffer[2] = 1;
+    buffer[3] = page_scan_type;
+    return 4;
+}
+
+/**
+ * @brief Encode hci_write_extended_inquiry_response command
+ * @param buffer for HCI Command packet with 244 bytes
+ * @param fec_required
+ * @param exstended_inquiry_response
+ * @return size of HCI Command packet
+ * @note: format '1E'
+ */
+static inline uint16_t hci_cmd_write_extended_inquiry_response_encode(uint8_t * buffer, uint8_t fec_required, const uint8_t *exstended_inquiry_response){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_WRITE_EXTENDED_INQUIRY_RESPONSE);
+    buffer[2] = 241;
+    buffer[3] = fec_required;
+    (void)memcpy(&buffer[4], exstended_inquiry_response, 240);
+    return 244;
+}
+
+/**
+ * @brief Encode hci_write_simple_pairing_mode command
+ * @param buffer for HCI Command packet with 4 bytes
+ * @param mode
+ * @return size of HCI Command packet
+ * @note: format '1'
+ */
+static inline uint16_t hci_cmd_write_simple_pairing_mode_encode(uint8_t * buffer, uint8_t mode){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_WRITE_SIMPLE_PAIRING_MODE);
+    buffer[2] = 1;
+    buffer[3] = mode;
+    return 4;
+}
+
+/**
+ * @brief Encode hci_read_local_oob_data command
+ * @param buffer for HCI Command packet with 3 bytes
+ * @return size of HCI Command packet
+ * @note: format ''
+ */
+static inline uint16_t hci_cmd_read_local_oob_data_encode(uint8_t * buffer){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_READ_LOCAL_OOB_DATA);
+    buffer[2] = 0;
+    return 3;
+}
+
+/**
+ * @brief Encode hci_read_inquiry_response_transmit_power_level command
+ * @param buffer for HCI Command packet with 3 bytes
+ * @return size of HCI Command packet
+ * @note: format ''
+ */
+static inline uint16_t hci_cmd_read_inquiry_response_transmit_power_level_encode(uint8_t * buffer){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_READ_INQUIRY_RESPONSE_TRANSMIT_POWER_LEVEL);
+    buffer[2] = 0;
+    return 3;
+}
+
+/**
+ * @brief Encode hci_write_inquiry_transmit_power_level command
+ * @param buffer for HCI Command packet with 4 bytes
+ * @param arg1
+ * @return size of HCI Command packet
+ * @note: format '1'
+ */
+static inline uint16_t hci_cmd_write_inquiry_transmit_power_level_encode(uint8_t * buffer, uint8_t arg1){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_WRITE_INQUIRY_TRANSMIT_POWER_LEVEL);
+    buffer[2] = 1;
+    buffer[3] = arg1;
+    return 4;
+}
+
+/**
+ * @brief Encode hci_write_default_erroneous_data_reporting command
+ * @param buffer for HCI Command packet with 4 bytes
+ * @param mode
+ * @return size of HCI Command packet
+ * @note: format '1'
+ */
+static inline uint16_t hci_cmd_write_default_erroneous_data_reporting_encode(uint8_t * buffer, uint8_t mode){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_WRITE_DEFAULT_ERRONEOUS_DATA_REPORTING);
+    buffer[2] = 1;
+    buffer[3] = mode;
+    return 4;
+}
+
+/**
+ * @brief Encode hci_set_event_mask_2 command
+ * @param buffer for HCI Command packet with 11 bytes
+ * @param event_mask_page_2_lower_octets
+ * @param event_mask_page_2_higher_octets
+ * @return size of HCI Command packet
+ * @note: format '44'
+ */
+static inline uint16_t hci_cmd_set_event_mask_2_encode(uint8_t * buffer, uint32_t event_mask_page_2_lower_octets, uint32_t event_mask_page_2_higher_octets){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_SET_EVENT_MASK_2);
+    buffer[2] = 8;
+    little_endian_store_32(buffer, 3, event_mask_page_2_lower_octets);
+    little_endian_store_32(buffer, 7, event_mask_page_2_higher_octets);
+    return 11;
+}
+
+/**
+ * @brief Encode hci_read_le_host_supported command
+ * @param buffer for HCI Command packet with 3 bytes
+ * @return size of HCI Command packet
+ * @note: format ''
+ */
+static inline uint16_t hci_cmd_read_le_host_supported_encode(uint8_t * buffer){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_READ_LE_HOST_SUPPORTED);
+    buffer[2] = 0;
+    return 3;
+}
+
+/**
+ * @brief Encode hci_write_le_host_supported command
+ * @param buffer for HCI Command packet with 5 bytes
+ * @param le_supported_host
+ * @param simultaneous_le_host
+ * @return size of HCI Command packet
+ * @note: format '11'
+ */
+static inline uint16_t hci_cmd_write_le_host_supported_encode(uint8_t * buffer, uint8_t le_supported_host, uint8_t simultaneous_le_host){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_WRITE_LE_HOST_SUPPORTED);
+    buffer[2] = 2;
+    buffer[3] = le_supported_host;
+    buffer[4] = simultaneous_le_host;
+    return 5;
+}
+
+/**
+ * @brief Encode hci_write_secure_connections_host_support command
+ * @param buffer for HCI Command packet with 4 bytes
+ * @param secure_connections_host_support
+ * @return size of HCI Command packet
+ * @note: format '1'
+ */
+static inline uint16_t hci_cmd_write_secure_connections_host_support_encode(uint8_t * buffer, uint8_t secure_connections_host_support){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_WRITE_SECURE_CONNECTIONS_HOST_SUPPORT);
+    buffer[2] = 1;
+    buffer[3] = secure_connections_host_support;
+    return 4;
+}
+
+/**
+ * @brief Encode hci_read_local_extended_oob_data command
+ * @param buffer for HCI Command packet with 3 bytes
+ * @return size of HCI Command packet
+ * @note: format ''
+ */
+static inline uint16_t hci_cmd_read_local_extended_oob_data_encode(uint8_t * buffer){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_READ_LOCAL_EXTENDED_OOB_DATA);
+    buffer[2] = 0;
+    return 3;
+}
+
+/**
+ * @brief Encode hci_read_extended_page_timeout command
+ * @param buffer for HCI Command packet with 3 bytes
+ * @return size of HCI Command packet
+ * @note: format ''
+ */
+static inline uint16_t hci_cmd_read_extended_page_timeout_encode(uint8_t * buffer){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_READ_EXTENDED_PAGE_TIMEOUT);
+    buffer[2] = 0;
+    return 3;
+}
+
+/**
+ * @brief Encode hci_write_extended_page_timeout command
+ * @param buffer for HCI Command packet with 5 bytes
+ * @param extended_page_timeout
+ * @return size of HCI Command packet
+ * @note: format '2'
+ */
+static inline uint16_t hci_cmd_write_extended_page_timeout_encode(uint8_t * buffer, uint16_t extended_page_timeout){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_WRITE_EXTENDED_PAGE_TIMEOUT);
+    buffer[2] = 2;
+    little_endian_store_16(buffer, 3, extended_page_timeout);
+    return 5;
+}
+
+/**
+ * @brief Encode hci_read_extended_inquiry_length command
+ * @param buffer for HCI Command packet with 3 bytes
+ * @return size of HCI Command packet
+ * @note: format ''
+ */
+static inline uint16_t hci_cmd_read_extended_inquiry_length_encode(uint8_t * buffer){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_READ_EXTENDED_INQUIRY_LENGTH);
+    buffer[2] = 0;
+    return 3;
+}
+
+/**
+ * @brief Encode hci_write_extended_inquiry_length command
+ * @param buffer for HCI Command packet with 5 bytes
+ * @param extended_inquiry_length
+ * @return size of HCI Command packet
+ * @note: format '2'
+ */
+static inline uint16_t hci_cmd_write_extended_inquiry_length_encode(uint8_t * buffer, uint16_t extended_inquiry_length){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_WRITE_EXTENDED_INQUIRY_LENGTH);
+    buffer[2] = 2;
+    little_endian_store_16(buffer, 3, extended_inquiry_length);
+    return 5;
+}
+
+/**
+ * @brief Encode hci_set_ecosystem_base_interval command
+ * @param buffer for HCI Command packet with 5 bytes
+ * @param interval
+ * @return size of HCI Command packet
+ * @note: format '2'
+ */
+static inline uint16_t hci_cmd_set_ecosystem_base_interval_encode(uint8_t * buffer, uint16_t interval){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_SET_ECOSYSTEM_BASE_INTERVAL);
+    buffer[2] = 2;
+    little_endian_store_16(buffer, 3, interval);
+    return 5;
+}
+
+/**
+ * @brief Encode hci_set_min_encryption_key_size command
+ * @param buffer for HCI Command packet with 4 bytes
+ * @param min_encryption_key_size
+ * @return size of HCI Command packet
+ * @note: format '1'
+ */
+static inline uint16_t hci_cmd_set_min_encryption_key_size_encode(uint8_t * buffer, uint8_t min_encryption_key_size){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_SET_MIN_ENCRYPTION_KEY_SIZE);
+    buffer[2] = 1;
+    buffer[3] = min_encryption_key_size;
+    return 4;
+}
+
+/**
+ * @brief Encode hci_read_loopback_mode command
+ * @param buffer for HCI Command packet with 3 bytes
+ * @return size of HCI Command packet
+ * @note: format ''
+ */
+static inline uint16_t hci_cmd_read_loopback_mode_encode(uint8_t * buffer){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_READ_LOOPBACK_MODE);
+    buffer[2] = 0;
+    return 3;
+}
+
+/**
+ * @brief Encode hci_write_loopback_mode command
+ * @param buffer for HCI Command packet with 4 bytes
+ * @param loopback_mode
+ * @return size of HCI Command packet
+ * @note: format '1'
+ */
+static inline uint16_t hci_cmd_write_loopback_mode_encode(uint8_t * buffer, uint8_t loopback_mode){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_WRITE_LOOPBACK_MODE);
+    buffer[2] = 1;
+    buffer[3] = loopback_mode;
+    return 4;
+}
+
+/**
+ * @brief Encode hci_enable_device_under_test_mode command
+ * @param buffer for HCI Command packet with 3 bytes
+ * @return size of HCI Command packet
+ * @note: format ''
+ */
+static inline uint16_t hci_cmd_enable_device_under_test_mode_encode(uint8_t * buffer){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_ENABLE_DEVICE_UNDER_TEST_MODE);
+    buffer[2] = 0;
+    return 3;
+}
+
+/**
+ * @brief Encode hci_write_simple_pairing_debug_mode command
+ * @param buffer for HCI Command packet with 4 bytes
+ * @param simple_pairing_debug_mode
+ * @return size of HCI Command packet
+ * @note: format '1'
+ */
+static inline uint16_t hci_cmd_write_simple_pairing_debug_mode_encode(uint8_t * buffer, uint8_t simple_pairing_debug_mode){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_WRITE_SIMPLE_PAIRING_DEBUG_MODE);
+    buffer[2] = 1;
+    buffer[3] = simple_pairing_debug_mode;
+    return 4;
+}
+
+/**
+ * @brief Encode hci_write_secure_connections_test_mode command
+ * @param buffer for HCI Command packet with 7 bytes
+ * @param handle
+ * @param dm1_acl_u_mode
+ * @param esco_loopback_mode
+ * @return size of HCI Command packet
+ * @note: format 'H11'
+ */
+static inline uint16_t hci_cmd_write_secure_connections_test_mode_encode(uint8_t * buffer, hci_con_handle_t handle, uint8_t dm1_acl_u_mode, uint8_t esco_loopback_mode){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_WRITE_SECURE_CONNECTIONS_TEST_MODE);
+    buffer[2] = 4;
+    little_endian_store_16(buffer, 3, handle);
+    buffer[5] = dm1_acl_u_mode;
+    buffer[6] = esco_loopback_mode;
+    return 7;
+}
+
+/**
+ * @brief Encode hci_read_local_version_information command
+ * @param buffer for HCI Command packet with 3 bytes
+ * @return size of HCI Command packet
+ * @note: format ''
+ */
+static inline uint16_t hci_cmd_read_local_version_information_encode(uint8_t * buffer){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_READ_LOCAL_VERSION_INFORMATION);
+    buffer[2] = 0;
+    return 3;
+}
+
+/**
+ * @brief Encode hci_read_local_supported_commands command
+ * @param buffer for HCI Command packet with 3 bytes
+ * @return size of HCI Command packet
+ * @note: format ''
+ */
+static inline uint16_t hci_cmd_read_local_supported_commands_encode(uint8_t * buffer){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_READ_LOCAL_SUPPORTED_COMMANDS);
+    buffer[2] = 0;
+    return 3;
+}
+
+/**
+ * @brief Encode hci_read_local_supported_features command
+ * @param buffer for HCI Command packet with 3 bytes
+ * @return size of HCI Command packet
+ * @note: format ''
+ */
+static inline uint16_t hci_cmd_read_local_supported_features_encode(uint8_t * buffer){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_READ_LOCAL_SUPPORTED_FEATURES);
+    buffer[2] = 0;
+    return 3;
+}
+
+/**
+ * @brief Encode hci_read_buffer_size command
+ * @param buffer for HCI Command packet with 3 bytes
+ * @return size of HCI Command packet
+ * @note: format ''
+ */
+static inline uint16_t hci_cmd_read_buffer_size_encode(uint8_t * buffer){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_READ_BUFFER_SIZE);
+    buffer[2] = 0;
+    return 3;
+}
+
+/**
+ * @brief Encode hci_read_bd_addr command
+ * @param buffer for HCI Command packet with 3 bytes
+ * @return size of HCI Command packet
+ * @note: format ''
+ */
+static inline uint16_t hci_cmd_read_bd_addr_encode(uint8_t * buffer){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_READ_BD_ADDR);
+    buffer[2] = 0;
+    return 3;
+}
+
+/**
+ * @brief Encode hci_read_failed_contact_counter command
+ * @param buffer for HCI Command packet with 5 bytes
+ * @param handle
+ * @return size of HCI Command packet
+ * @note: format 'H'
+ */
+static inline uint16_t hci_cmd_read_failed_contact_counter_encode(uint8_t * buffer, hci_con_handle_t handle){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_READ_FAILED_CONTACT_COUNTER);
+    buffer[2] = 2;
+    little_endian_store_16(buffer, 3, handle);
+    return 5;
+}
+
+/**
+ * @brief Encode hci_reset_failed_contact_counter command
+ * @param buffer for HCI Command packet with 5 bytes
+ * @param handle
+ * @return size of HCI Command packet
+ * @note: format 'H'
+ */
+static inline uint16_t hci_cmd_reset_failed_contact_counter_encode(uint8_t * buffer, hci_con_handle_t handle){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_RESET_FAILED_CONTACT_COUNTER);
+    buffer[2] = 2;
+    little_endian_store_16(buffer, 3, handle);
+    return 5;
+}
+
+/**
+ * @brief Encode hci_read_link_quality command
+ * @param buffer for HCI Command packet with 5 bytes
+ * @param handle
+ * @return size of HCI Command packet
+ * @note: format 'H'
+ */
+static inline uint16_t hci_cmd_read_link_quality_encode(uint8_t * buffer, hci_con_handle_t handle){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_READ_LINK_QUALITY);
+    buffer[2] = 2;
+    little_endian_store_16(buffer, 3, handle);
+    return 5;
+}
+
+/**
+ * @brief Encode hci_read_rssi command
+ * @param buffer for HCI Command packet with 5 bytes
+ * @param handle
+ * @return size of HCI Command packet
+ * @note: format 'H'
+ */
+static inline uint16_t hci_cmd_read_rssi_encode(uint8_t * buffer, hci_con_handle_t handle){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_READ_RSSI);
+    buffer[2] = 2;
+    little_endian_store_16(buffer, 3, handle);
+    return 5;
+}
+
+/**
+ * @brief Encode hci_read_clock command
+ * @param buffer for HCI Command packet with 6 bytes
+ * @param handle
+ * @param which_clock
+ * @return size of HCI Command packet
+ * @note: format 'H1'
+ */
+static inline uint16_t hci_cmd_read_clock_encode(uint8_t * buffer, hci_con_handle_t handle, uint8_t which_clock){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_READ_CLOCK);
+    buffer[2] = 3;
+    little_endian_store_16(buffer, 3, handle);
+    buffer[5] = which_clock;
+    return 6;
+}
+
+/**
+ * @brief Encode hci_read_encryption_key_size command
+ * @param buffer for HCI Command packet with 5 bytes
+ * @param handle
+ * @return size of HCI Command packet
+ * @note: format 'H'
+ */
+static inline uint16_t hci_cmd_read_encryption_key_size_encode(uint8_t * buffer, hci_con_handle_t handle){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_READ_ENCRYPTION_KEY_SIZE);
+    buffer[2] = 2;
+    little_endian_store_16(buffer, 3, handle);
+    return 5;
+}
+
+/**
+ * @brief Encode hci_le_set_event_mask command
+ * @param buffer for HCI Command packet with 11 bytes
+ * @param event_mask_lower_octets
+ * @param event_mask_higher_octets
+ * @return size of HCI Command packet
+ * @note: format '44'
+ */
+static inline uint16_t hci_cmd_le_set_event_mask_encode(uint8_t * buffer, uint32_t event_mask_lower_octets, uint32_t event_mask_higher_octets){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_LE_SET_EVENT_MASK);
+    buffer[2] = 8;
+    little_endian_store_32(buffer, 3, event_mask_lower_octets);
+    little_endian_store_32(buffer, 7, event_mask_higher_octets);
+    return 11;
+}
+
+/**
+ * @brief Encode hci_le_read_buffer_size command
+ * @param buffer for HCI Command packet with 3 bytes
+ * @return size of HCI Command packet
+ * @note: format ''
+ */
+static inline uint16_t hci_cmd_le_read_buffer_size_encode(uint8_t * buffer){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_LE_READ_BUFFER_SIZE);
+    buffer[2] = 0;
+    return 3;
+}
+
+/**
+ * @brief Encode hci_le_read_local_supported_features command
+ * @param buffer for HCI Command packet with 3 bytes
+ * @return size of HCI Command packet
+ * @note: format ''
+ */
+static inline uint16_t hci_cmd_le_read_local_supported_features_encode(uint8_t * buffer){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_LE_READ_LOCAL_SUPPORTED_FEATURES);
+    buffer[2] = 0;
+    return 3;
+}
+
+/**
+ * @brief Encode hci_le_set_random_address command
+ * @param buffer for HCI Command packet with 9 bytes
+ * @param random_bd_addr
+ * @return size of HCI Command packet
+ * @note: format 'B'
+ */
+static inline uint16_t hci_cmd_le_set_random_address_encode(uint8_t * buffer, const bd_addr_t random_bd_addr){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_LE_SET_RANDOM_ADDRESS);
+    buffer[2] = 6;
+    reverse_bd_addr(random_bd_addr, &buffer[3]);
+    return 9;
+}
+
+/**
+ * @brief Encode hci_le_set_advertising_parameters command
+ * @param buffer for HCI Command packet with 18 bytes
+ * @param advertising_interval_min
+ * @param advertising_interval_max
+ * @param advertising_type
+ * @param own_address_type
+ * @param direct_address_type
+ * @param direct_address
+ * @param advertising_channel_map
+ * @param advertising_filter_policy
+ * @return size of HCI Command packet
+ * @note: format '22111B11'
+ */
+static inline uint16_t hci_cmd_le_set_advertising_parameters_encode(uint8_t * buffer, uint16_t advertising_interval_min, uint16_t advertising_interval_max, uint8_t advertising_type, uint8_t own_address_type, uint8_t direct_address_type, const bd_addr_t direct_address, uint8_t advertising_channel_map, uint8_t advertising_filter_policy){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_LE_SET_ADVERTISING_PARAMETERS);
+    buffer[2] = 15;
+    little_endian_store_16(buffer, 3, advertising_interval_min);
+    little_endian_store_16(buffer, 5, advertising_interval_max);
+    buffer[7] = advertising_type;
+    buffer[8] = own_address_type;
+    buffer[9] = direct_address_type;
+    reverse_bd_addr(direct_address, &buffer[10]);
+    buffer[16] = advertising_channel_map;
+    buffer[17] = advertising_filter_policy;
+    return 18;
+}
+
+/**
+ * @brief Encode hci_le_read_advertising_channel_tx_power command
+ * @param buffer for HCI Command packet with 3 bytes
+ * @return size of HCI Command packet
+ * @note: format ''
+ */
+static inline uint16_t hci_cmd_le_read_advertising_channel_tx_power_encode(uint8_t * buffer){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_LE_READ_ADVERTISING_CHANNEL_TX_POWER);
+    buffer[2] = 0;
+    return 3;
+}
+
+/**
+ * @brief Encode hci_le_set_advertising_data command
+ * @param buffer for HCI Command packet with 35 bytes
+ * @param advertising_data_length
+ * @param advertising_data
+ * @return size of HCI Command packet
+ * @note: format '1A'
+ */
+static inline uint16_t hci_cmd_le_set_advertising_data_encode(uint8_t * buffer, uint8_t advertising_data_length, const uint8_t *advertising_data){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_LE_SET_ADVERTISING_DATA);
+    buffer[2] = 32;
+    buffer[3] = advertising_data_length;
+    (void)memcpy(&buffer[4], advertising_data, 31);
+    return 35;
+}
+
+/**
+ * @brief Encode hci_le_set_scan_response_data command
+ * @param buffer for HCI Command packet with 35 bytes
+ * @param scan_response_data_length
+ * @param scan_response_data
+ * @return size of HCI Command packet
+ * @note: format '1A'
+ */
+static inline uint16_t hci_cmd_le_set_scan_response_data_encode(uint8_t * buffer, uint8_t scan_response_data_length, const uint8_t *scan_response_data){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_LE_SET_SCAN_RESPONSE_DATA);
+    buffer[2] = 32;
+    buffer[3] = scan_response_data_length;
+    (void)memcpy(&buffer[4], scan_response_data, 31);
+    return 35;
+}
+
+/**
+ * @brief Encode hci_le_set_advertise_enable command
+ * @param buffer for HCI Command packet with 4 bytes
+ * @param advertise_enable
+ * @return size of HCI Command packet
+ * @note: format '1'
+ */
+static inline uint16_t hci_cmd_le_set_advertise_enable_encode(uint8_t * buffer, uint8_t advertise_enable){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_LE_SET_ADVERTISE_ENABLE);
+    buffer[2] = 1;
+    buffer[3] = advertise_enable;
+    return 4;
+}
+
+/**
+ * @brief Encode hci_le_set_scan_parameters command
+ * @param buffer for HCI Command packet with 10 bytes
+ * @param le_scan_type
+ * @param le_scan_interval
+ * @param le_scan_window
+ * @param own_address_type
+ * @param scanning_filter_policy
+ * @return size of HCI Command packet
+ * @note: format '12211'
+ */
+static inline uint16_t hci_cmd_le_set_scan_parameters_encode(uint8_t * buffer, uint8_t le_scan_type, uint16_t le_scan_interval, uint16_t le_scan_window, uint8_t own_address_type, uint8_t scanning_filter_policy){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_LE_SET_SCAN_PARAMETERS);
+    buffer[2] = 7;
+    buffer[3] = le_scan_type;
+    little_endian_store_16(buffer, 4, le_scan_interval);
+    little_endian_store_16(buffer, 6, le_scan_window);
+    buffer[8] = own_address_type;
+    buffer[9] = scanning_filter_policy;
+    return 10;
+}
+
+/**
+ * @brief Encode hci_le_set_scan_enable command
+ * @param buffer for HCI Command packet with 5 bytes
+ * @param le_scan_enable
+ * @param filter_duplices
+ * @return size of HCI Command packet
+ * @note: format '11'
+ */
+static inline uint16_t hci_cmd_le_set_scan_enable_encode(uint8_t * buffer, uint8_t le_scan_enable, uint8_t filter_duplices){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_LE_SET_SCAN_ENABLE);
+    buffer[2] = 2;
+    buffer[3] = le_scan_enable;
+    buffer[4] = filter_duplices;
+    return 5;
+}
+
+/**
+ * @brief Encode hci_le_create_connection command
+ * @param buffer for HCI Command packet with 28 bytes
+ * @param le_scan_interval
+ * @param le_scan_window
+ * @param initiator_filter_policy
+ * @param peer_address_type
+ * @param peer_address
+ * @param own_address_type
+ * @param conn_interval_min
+ * @param conn_interval_max
+ * @param conn_latency
+ * @param supervision_timeout
+ * @param minimum_ce_length
+ * @param maximum_ce_length
+ * @return size of HCI Command packet
+ * @note: format '2211B1222222'
+ */
+static inline uint16_t hci_cmd_le_create_connection_encode(uint8_t * buffer, uint16_t le_scan_interval, uint16_t le_scan_window, uint8_t initiator_filter_policy, uint8_t peer_address_type, const bd_addr_t peer_address, uint8_t own_address_type, uint16_t conn_interval_min, uint16_t conn_interval_max, uint16_t conn_latency, uint16_t supervision_timeout, uint16_t minimum_ce_length, uint16_t maximum_ce_length){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_LE_CREATE_CONNECTION);
+    buffer[2] = 25;
+    little_endian_store_16(buffer, 3, le_scan_interval);
+    little_endian_store_16(buffer, 5, le_scan_window);
+    buffer[7] = initiator_filter_policy;
+    buffer[8] = peer_address_type;
+    reverse_bd_addr(peer_address, &buffer[9]);
+    buffer[15] = own_address_type;
+    little_endian_store_16(buffer, 16, conn_interval_min);
+    little_endian_store_16(buffer, 18, conn_interval_max);
+    little_endian_store_16(buffer, 20, conn_latency);
+    little_endian_store_16(buffer, 22, supervision_timeout);
+    little_endian_store_16(buffer, 24, minimum_ce_length);
+    little_endian_store_16(buffer, 26, maximum_ce_length);
+    return 28;
+}
+
+/**
+ * @brief Encode hci_le_create_connection_cancel command
+ * @param buffer for HCI Command packet with 3 bytes
+ * @return size of HCI Command packet
+ * @note: format ''
+ */
+static inline uint16_t hci_cmd_le_create_connection_cancel_encode(uint8_t * buffer){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_LE_CREATE_CONNECTION_CANCEL);
+    buffer[2] = 0;
+    return 3;
+}
+
+/**
+ * @brief Encode hci_le_read_white_list_size command
+ * @param buffer for HCI Command packet with 3 bytes
+ * @return size of HCI Command packet
+ * @note: format ''
+ */
+static inline uint16_t hci_cmd_le_read_white_list_size_encode(uint8_t * buffer){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_LE_READ_WHITE_LIST_SIZE);
+    buffer[2] = 0;
+    return 3;
+}
+
+/**
+ * @brief Encode hci_le_clear_white_list command
+ * @param buffer for HCI Command packet with 3 bytes
+ * @return size of HCI Command packet
+ * @note: format ''
+ */
+static inline uint16_t hci_cmd_le_clear_white_list_encode(uint8_t * buffer){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_LE_CLEAR_WHITE_LIST);
+    buffer[2] = 0;
+    return 3;
+}
+
+/**
+ * @brief Encode hci_le_add_device_to_white_list command
+ * @param buffer for HCI Command packet with 10 bytes
+ * @param address_type
+ * @param bd_addr
+ * @return size of HCI Command packet
+ * @note: format '1B'
+ */
+static inline uint16_t hci_cmd_le_add_device_to_white_list_encode(uint8_t * buffer, uint8_t address_type, const bd_addr_t bd_addr){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_LE_ADD_DEVICE_TO_WHITE_LIST);
+    buffer[2] = 7;
+    buffer[3] = address_type;
+    reverse_bd_addr(bd_addr, &buffer[4]);
+    return 10;
+}
+
+/**
+ * @brief Encode hci_le_remove_device_from_white_list command
+ * @param buffer for HCI Command packet with 10 bytes
+ * @param address_type
+ * @param bd_addr
+ * @return size of HCI Command packet
+ * @note: format '1B'
+ */
+static inline uint16_t hci_cmd_le_remove_device_from_white_list_encode(uint8_t * buffer, uint8_t address_type, const bd_addr_t bd_addr){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_LE_REMOVE_DEVICE_FROM_WHITE_LIST);
+    buffer[2] = 7;
+    buffer[3] = address_type;
+    reverse_bd_addr(bd_addr, &buffer[4]);
+    return 10;
+}
+
+/**
+ * @brief Encode hci_le_connection_update command
+ * @param buffer for HCI Command packet with 17 bytes
+ * @param conn_handle
+ * @param conn_interval_min
+ * @param conn_interval_max
+ * @param conn_latency
+ * @param supervision_timeout
+ * @param minimum_ce_length
+ * @param maximum_ce_length
+ * @return size of HCI Command packet
+ * @note: format 'H222222'
+ */
+static inline uint16_t hci_cmd_le_connection_update_encode(uint8_t * buffer, hci_con_handle_t conn_handle, uint16_t conn_interval_min, uint16_t conn_interval_max, uint16_t conn_latency, uint16_t supervision_timeout, uint16_t minimum_ce_length, uint16_t maximum_ce_length){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_LE_CONNECTION_UPDATE);
+    buffer[2] = 14;
+    little_endian_store_16(buffer, 3, conn_handle);
+    little_endian_store_16(buffer, 5, conn_interval_min);
+    little_endian_store_16(buffer, 7, conn_interval_max);
+    little_endian_store_16(buffer, 9, conn_latency);
+    little_endian_store_16(buffer, 11, supervision_timeout);
+    little_endian_store_16(buffer, 13, minimum_ce_length);
+    little_endian_store_16(buffer, 15, maximum_ce_length);
+    return 17;
+}
+
+/**
+ * @brief Encode hci_le_set_host_channel_classification command
+ * @param buffer for HCI Command packet with 8 bytes
+ * @param channel_map_lower_32bits
+ * @param channel_map_higher_5bits
+ * @return size of HCI Command packet
+ * @note: format '41'
+ */
+static inline uint16_t hci_cmd_le_set_host_channel_classification_encode(uint8_t * buffer, uint32_t channel_map_lower_32bits, uint8_t channel_map_higher_5bits){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_LE_SET_HOST_CHANNEL_CLASSIFICATION);
+    buffer[2] = 5;
+    little_endian_store_32(buffer, 3, channel_map_lower_32bits);
+    buffer[7] = channel_map_higher_5bits;
+    return 8;
+}
+
+/**
+ * @brief Encode hci_le_read_channel_map command
+ * @param buffer for HCI Command packet with 5 bytes
+ * @param conn_handle
+ * @return size of HCI Command packet
+ * @note: format 'H'
+ */
+static inline uint16_t hci_cmd_le_read_channel_map_encode(uint8_t * buffer, hci_con_handle_t conn_handle){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_LE_READ_CHANNEL_MAP);
+    buffer[2] = 2;
+    little_endian_store_16(buffer, 3, conn_handle);
+    return 5;
+}
+
+/**
+ * @brief Encode hci_le_read_remote_used_features command
+ * @param buffer for HCI Command packet with 5 bytes
+ * @param conn_handle
+ * @return size of HCI Command packet
+ * @note: format 'H'
+ */
+static inline uint16_t hci_cmd_le_read_remote_used_features_encode(uint8_t * buffer, hci_con_handle_t conn_handle){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_LE_READ_REMOTE_USED_FEATURES);
+    buffer[2] = 2;
+    little_endian_store_16(buffer, 3, conn_handle);
+    return 5;
+}
+
+/**
+ * @brief Encode hci_le_encrypt command
+ * @param buffer for HCI Command packet with 35 bytes
+ * @param key
+ * @param plain_text
+ * @return size of HCI Command packet
+ * @note: format 'PP'
+ */
+static inline uint16_t hci_cmd_le_encrypt_encode(uint8_t * buffer, const uint8_t *key, const uint8_t *plain_text){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_LE_ENCRYPT);
+    buffer[2] = 32;
+    (void)memcpy(&buffer[3], key, 16);
+    (void)memcpy(&buffer[19], plain_text, 16);
+    return 35;
+}
+
+/**
+ * @brief Encode hci_le_rand command
+ * @param buffer for HCI Command packet with 3 bytes
+ * @return size of HCI Command packet
+ * @note: format ''
+ */
+static inline uint16_t hci_cmd_le_rand_encode(uint8_t * buffer){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_LE_RAND);
+    buffer[2] = 0;
+    return 3;
+}
+
+/**
+ * @brief Encode hci_le_start_encryption command
+ * @param buffer for HCI Command packet with 31 bytes
+ * @param conn_handle
+ * @param random_number_lower_32bits
+ * @param random_number_higher_32bits
+ * @param encryption_diversifier
+ * @param long_term_key
+ * @return size of HCI Command packet
+ * @note: format 'H442P'
+ */
+static inline uint16_t hci_cmd_le_start_encryption_encode(uint8_t * buffer, hci_con_handle_t conn_handle, uint32_t random_number_lower_32bits, uint32_t random_number_higher_32bits, uint16_t encryption_diversifier, const uint8_t *long_term_key){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_LE_START_ENCRYPTION);
+    buffer[2] = 28;
+    little_endian_store_16(buffer, 3, conn_handle);
+    little_endian_store_32(buffer, 5, random_number_lower_32bits);
+    little_endian_store_32(buffer, 9, random_number_higher_32bits);
+    little_endian_store_16(buffer, 13, encryption_diversifier);
+    (void)memcpy(&buffer[15], long_term_key, 16);
+    return 31;
+}
+
+/**
+ * @brief Encode hci_le_long_term_key_request_reply command
+ * @param buffer for HCI Command packet with 21 bytes
+ * @param connection_handle
+ * @param long_term_key
+ * @return size of HCI Command packet
+ * @note: format 'HP'
+ */
+static inline uint16_t hci_cmd_le_long_term_key_request_reply_encode(uint8_t * buffer, hci_con_handle_t connection_handle, const uint8_t *long_term_key){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_LE_LONG_TERM_KEY_REQUEST_REPLY);
+    buffer[2] = 18;
+    little_endian_store_16(buffer, 3, connection_handle);
+    (void)memcpy(&buffer[5], long_term_key, 16);
+    return 21;
+}
+
+/**
+ * @brief Encode hci_le_long_term_key_negative_reply command
+ * @param buffer for HCI Command packet with 5 bytes
+ * @param conn_handle
+ * @return size of HCI Command packet
+ * @note: format 'H'
+ */
+static inline uint16_t hci_cmd_le_long_term_key_negative_reply_encode(uint8_t * buffer, hci_con_handle_t conn_handle){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_LE_LONG_TERM_KEY_NEGATIVE_REPLY);
+    buffer[2] = 2;
+    little_endian_store_16(buffer, 3, conn_handle);
+    return 5;
+}
+
+/**
+ * @brief Encode hci_le_read_supported_states command
+ * @param buffer for HCI Command packet with 5 bytes
+ * @param conn_handle
+ * @return size of HCI Command packet
+ * @note: format 'H'
+ */
+static inline uint16_t hci_cmd_le_read_supported_states_encode(uint8_t * buffer, hci_con_handle_t conn_handle){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_LE_READ_SUPPORTED_STATES);
+    buffer[2] = 2;
+    little_endian_store_16(buffer, 3, conn_handle);
+    return 5;
+}
+
+/**
+ * @brief Encode hci_le_receiver_test command
+ * @param buffer for HCI Command packet with 4 bytes
+ * @param rx_frequency
+ * @return size of HCI Command packet
+ * @note: format '1'
+ */
+static inline uint16_t hci_cmd_le_receiver_test_encode(uint8_t * buffer, uint8_t rx_frequency){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_LE_RECEIVER_TEST);
+    buffer[2] = 1;
+    buffer[3] = rx_frequency;
+    return 4;
+}
+
+/**
+ * @brief Encode hci_le_transmitter_test command
+ * @param buffer for HCI Command packet with 6 bytes
+ * @param tx_frequency
+ * @param test_payload_lengh
+ * @param packet_payload
+ * @return size of HCI Command packet
+ * @note: format '111'
+ */
+static inline uint16_t hci_cmd_le_transmitter_test_encode(uint8_t * buffer, uint8_t tx_frequency, uint8_t test_payload_lengh, uint8_t packet_payload){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_LE_TRANSMITTER_TEST);
+    buffer[2] = 3;
+    buffer[3] = tx_frequency;
+    buffer[4] = test_payload_lengh;
+    buffer[5] = packet_payload;
+    return 6;
+}
+
+/**
+ * @brief Encode hci_le_test_end command
+ * @param buffer for HCI Command packet with 4 bytes
+ * @param end_test_cmd
+ * @return size of HCI Command packet
+ * @note: format '1'
+ */
+static inline uint16_t hci_cmd_le_test_end_encode(uint8_t * buffer, uint8_t end_test_cmd){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_LE_TEST_END);
+    buffer[2] = 1;
+    buffer[3] = end_test_cmd;
+    return 4;
+}
+
+/**
+ * @brief Encode hci_le_remote_connection_parameter_request_reply command
+ * @param buffer for HCI Command packet with 17 bytes
+ * @param conn_handle
+ * @param conn_interval_min
+ * @param conn_interval_max
+ * @param conn_latency
+ * @param supervision_timeout
+ * @param minimum_ce_length
+ * @param maximum_ce_length
+ * @return size of HCI Command packet
+ * @note: format 'H222222'
+ */
+static inline uint16_t hci_cmd_le_remote_connection_parameter_request_reply_encode(uint8_t * buffer, hci_con_handle_t conn_handle, uint16_t conn_interval_min, uint16_t conn_interval_max, uint16_t conn_latency, uint16_t supervision_timeout, uint16_t minimum_ce_length, uint16_t maximum_ce_length){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_LE_REMOTE_CONNECTION_PARAMETER_REQUEST_REPLY);
+    buffer[2] = 14;
+    little_endian_store_16(buffer, 3, conn_handle);
+    little_endian_store_16(buffer, 5, conn_interval_min);
+    little_endian_store_16(buffer, 7, conn_interval_max);
+    little_endian_store_16(buffer, 9, conn_latency);
+    little_endian_store_16(buffer, 11, supervision_timeout);
+    little_endian_store_16(buffer, 13, minimum_ce_length);
+    little_endian_store_16(buffer, 15, maximum_ce_length);
+    return 17;
+}
+
+/**
+ * @brief Encode hci_le_remote_connection_parameter_request_negative_reply command
+ * @param buffer for HCI Command packet with 6 bytes
+ * @param con_handle
+ * @param reason
+ * @return size of HCI Command packet
+ * @note: format 'H1'
+ */
+static inline uint16_t hci_cmd_le_remote_connection_parameter_request_negative_reply_encode(uint8_t * buffer, hci_con_handle_t con_handle, uint8_t reason){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_LE_REMOTE_CONNECTION_PARAMETER_REQUEST_NEGATIVE_REPLY);
+    buffer[2] = 3;
+    little_endian_store_16(buffer, 3, con_handle);
+    buffer[5] = reason;
+    return 6;
+}
+
+/**
+ * @brief Encode hci_le_set_data_length command
+ * @param buffer for HCI Command packet with 9 bytes
+ * @param con_handle
+ * @param tx_octets
+ * @param tx_time
+ * @return size of HCI Command packet
+ * @note: format 'H22'
+ */
+static inline uint16_t hci_cmd_le_set_data_length_encode(uint8_t * buffer, hci_con_handle_t con_handle, uint16_t tx_octets, uint16_t tx_time){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_LE_SET_DATA_LENGTH);
+    buffer[2] = 6;
+    little_endian_store_16(buffer, 3, con_handle);
+    little_endian_store_16(buffer, 5, tx_octets);
+    little_endian_store_16(buffer, 7, tx_time);
+    return 9;
+}
+
+/**
+ * @brief Encode hci_le_read_suggested_default_data_length command
+ * @param buffer for HCI Command packet with 3 bytes
+ * @return size of HCI Command packet
+ * @note: format ''
+ */
+static inline uint16_t hci_cmd_le_read_suggested_default_data_length_encode(uint8_t * buffer){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_LE_READ_SUGGESTED_DEFAULT_DATA_LENGTH);
+    buffer[2] = 0;
+    return 3;
+}
+
+/**
+ * @brief Encode hci_le_write_suggested_default_data_length command
+ * @param buffer for HCI Command packet with 7 bytes
+ * @param suggested_max_tx_octets
+ * @param suggested_max_tx_time
+ * @return size of HCI Command packet
+ * @note: format '22'
+ */
+static inline uint16_t hci_cmd_le_write_suggested_default_data_length_encode(uint8_t * buffer, uint16_t suggested_max_tx_octets, uint16_t suggested_max_tx_time){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_LE_WRITE_SUGGESTED_DEFAULT_DATA_LENGTH);
+    buffer[2] = 4;
+    little_endian_store_16(buffer, 3, suggested_max_tx_octets);
+    little_endian_store_16(buffer, 5, suggested_max_tx_time);
+    return 7;
+}
+
+/**
+ * @brief Encode hci_le_read_local_p256_public_key command
+ * @param buffer for HCI Command packet with 3 bytes
+ * @return size of HCI Command packet
+ * @note: format ''
+ */
+static inline uint16_t hci_cmd_le_read_local_p256_public_key_encode(uint8_t * buffer){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_LE_READ_LOCAL_P256_PUBLIC_KEY);
+    buffer[2] = 0;
+    return 3;
+}
+
+/**
+ * @brief Encode hci_le_generate_dhkey command
+ * @param buffer for HCI Command packet with 67 bytes
+ * @param arg1
+ * @param arg2
+ * @return size of HCI Command packet
+ * @note: format 'QQ'
+ */
+static inline uint16_t hci_cmd_le_generate_dhkey_encode(uint8_t * buffer, const uint8_t *arg1, const uint8_t *arg2){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_LE_GENERATE_DHKEY);
+    buffer[2] = 64;
+    reverse_256(arg1, &buffer[3]);
+    reverse_256(arg2, &buffer[35]);
+    return 67;
+}
+
+/**
+ * @brief Encode hci_le_add_device_to_resolving_list command
+ * @param buffer for HCI Command packet with 42 bytes
+ * @param peer_identity_address_type
+ * @param peer_identity_address
+ * @param peer_irk
+ * @param local_irk
+ * @return size of HCI Command packet
+ * @note: format '1BPP'
+ */
+static inline uint16_t hci_cmd_le_add_device_to_resolving_list_encode(uint8_t * buffer, uint8_t peer_identity_address_type, const bd_addr_t peer_identity_address, const uint8_t *peer_irk, const uint8_t *local_irk){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_LE_ADD_DEVICE_TO_RESOLVING_LIST);
+    buffer[2] = 39;
+    buffer[3] = peer_identity_address_type;
+    reverse_bd_addr(peer_identity_address, &buffer[4]);
+    (void)memcpy(&buffer[10], peer_irk, 16);
+    (void)memcpy(&buffer[26], local_irk, 16);
+    return 42;
+}
+
+/**
+ * @brief Encode hci_le_remove_device_from_resolving_list command
+ * @param buffer for HCI Command packet with 10 bytes
+ * @param peer_identity_address_type
+ * @param peer_identity_address
+ * @return size of HCI Command packet
+ * @note: format '1B'
+ */
+static inline uint16_t hci_cmd_le_remove_device_from_resolving_list_encode(uint8_t * buffer, uint8_t peer_identity_address_type, const bd_addr_t peer_identity_address){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_LE_REMOVE_DEVICE_FROM_RESOLVING_LIST);
+    buffer[2] = 7;
+    buffer[3] = peer_identity_address_type;
+    reverse_bd_addr(peer_identity_address, &buffer[4]);
+    return 10;
+}
+
+/**
+ * @brief Encode hci_le_clear_resolving_list command
+ * @param buffer for HCI Command packet with 3 bytes
+ * @return size of HCI Command packet
+ * @note: format ''
+ */
+static inline uint16_t hci_cmd_le_clear_resolving_list_encode(uint8_t * buffer){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_LE_CLEAR_RESOLVING_LIST);
+    buffer[2] = 0;
+    return 3;
+}
+
+/**
+ * @brief Encode hci_le_read_resolving_list_size command
+ * @param buffer for HCI Command packet with 3 bytes
+ * @return size of HCI Command packet
+ * @note: format ''
+ */
+static inline uint16_t hci_cmd_le_read_resolving_list_size_encode(uint8_t * buffer){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_LE_READ_RESOLVING_LIST_SIZE);
+    buffer[2] = 0;
+    return 3;
+}
+
+/**
+ * @brief Encode hci_le_read_peer_resolvable_address command
+ * @param buffer for HCI Command packet with 3 bytes
+ * @return size of HCI Command packet
+ * @note: format ''
+ */
+static inline uint16_t hci_cmd_le_read_peer_resolvable_address_encode(uint8_t * buffer){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_LE_READ_PEER_RESOLVABLE_ADDRESS);
+    buffer[2] = 0;
+    return 3;
+}
+
+/**
+ * @brief Encode hci_le_read_local_resolvable_address command
+ * @param buffer for HCI Command packet with 3 bytes
+ * @return size of HCI Command packet
+ * @note: format ''
+ */
+static inline uint16_t hci_cmd_le_read_local_resolvable_address_encode(uint8_t * buffer){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_LE_READ_LOCAL_RESOLVABLE_ADDRESS);
+    buffer[2] = 0;
+    return 3;
+}
+
+/**
+ * @brief Encode hci_le_set_address_resolution_enabled command
+ * @param buffer for HCI Command packet with 4 bytes
+ * @param address_resolution_enable
+ * @return size of HCI Command packet
+ * @note: format '1'
+ */
+static inline uint16_t hci_cmd_le_set_address_resolution_enabled_encode(uint8_t * buffer, uint8_t address_resolution_enable){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_LE_SET_ADDRESS_RESOLUTION_ENABLED);
+    buffer[2] = 1;
+    buffer[3] = address_resolution_enable;
+    return 4;
+}
+
+/**
+ * @brief Encode hci_le_set_resolvable_private_address_timeout command
+ * @param buffer for HCI Command packet with 5 bytes
+ * @param rpa_timeout
+ * @return size of HCI Command packet
+ * @note: format '2'
+ */
+static inline uint16_t hci_cmd_le_set_resolvable_private_address_timeout_encode(uint8_t * buffer, uint16_t rpa_timeout){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_LE_SET_RESOLVABLE_PRIVATE_ADDRESS_TIMEOUT);
+    buffer[2] = 2;
+    little_endian_store_16(buffer, 3, rpa_timeout);
+    return 5;
+}
+
+/**
+ * @brief Encode hci_le_read_maximum_data_length command
+ * @param buffer for HCI Command packet with 3 bytes
+ * @return size of HCI Command packet
+ * @note: format ''
+ */
+static inline uint16_t hci_cmd_le_read_maximum_data_length_encode(uint8_t * buffer){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_LE_READ_MAXIMUM_DATA_LENGTH);
+    buffer[2] = 0;
+    return 3;
+}
+
+/**
+ * @brief Encode hci_le_read_phy command
+ * @param buffer for HCI Command packet with 5 bytes
+ * @param con_handle
+ * @return size of HCI Command packet
+ * @note: format 'H'
+ */
+static inline uint16_t hci_cmd_le_read_phy_encode(uint8_t * buffer, hci_con_handle_t con_handle){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_LE_READ_PHY);
+    buffer[2] = 2;
+    little_endian_store_16(buffer, 3, con_handle);
+    return 5;
+}
+
+/**
+ * @brief Encode hci_le_set_default_phy command
+ * @param buffer for HCI Command packet with 6 bytes
+ * @param all_phys
+ * @param tx_phys
+ * @param rx_phys
+ * @return size of HCI Command packet
+ * @note: format '111'
+ */
+static inline uint16_t hci_cmd_le_set_default_phy_encode(uint8_t * buffer, uint8_t all_phys, uint8_t tx_phys, uint8_t rx_phys){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_LE_SET_DEFAULT_PHY);
+    buffer[2] = 3;
+    buffer[3] = all_phys;
+    buffer[4] = tx_phys;
+    buffer[5] = rx_phys;
+    return 6;
+}
+
+/**
+ * @brief Encode hci_le_set_phy command
+ * @param buffer for HCI Command packet with 10 bytes
+ * @param con_handle
+ * @param all_phys
+ * @param tx_phys
+ * @param rx_phys
+ * @param phy_options
+ * @return size of HCI Command packet
+ * @note: format 'H1112'
+ */
+static inline uint16_t hci_cmd_le_set_phy_encode(uint8_t * buffer, hci_con_handle_t con_handle, uint8_t all_phys, uint8_t tx_phys, uint8_t rx_phys, uint16_t phy_options){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_LE_SET_PHY);
+    buffer[2] = 7;
+    little_endian_store_16(buffer, 3, con_handle);
+    buffer[5] = all_phys;
+    buffer[6] = tx_phys;
+    buffer[7] = rx_phys;
+    little_endian_store_16(buffer, 8, phy_options);
+    return 10;
+}
+
+/**
+ * @brief Encode hci_le_receiver_test_v2 command
+ * @param buffer for HCI Command packet with 6 bytes
+ * @param rx_channel
+ * @param phy
+ * @param modulation_index
+ * @return size of HCI Command packet
+ * @note: format '111'
+ */
+static inline uint16_t hci_cmd_le_receiver_test_v2_encode(uint8_t * buffer, uint8_t rx_channel, uint8_t phy, uint8_t modulation_index){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_LE_RECEIVER_TEST_V2);
+    buffer[2] = 3;
+    buffer[3] = rx_channel;
+    buffer[4] = phy;
+    buffer[5] = modulation_index;
+    return 6;
+}
+
+/**
+ * @brief Encode hci_le_transmitter_test_v2 command
+ * @param buffer for HCI Command packet with 7 bytes
+ * @param tx_channel
+ * @param test_data_length
+ * @param packet_payload
+ * @param phy
+ * @return size of HCI Command packet
+ * @note: format '1111'
+ */
+static inline uint16_t hci_cmd_le_transmitter_test_v2_encode(uint8_t * buffer, uint8_t tx_channel, uint8_t test_data_length, uint8_t packet_payload, uint8_t phy){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_LE_TRANSMITTER_TEST_V2);
+    buffer[2] = 4;
+    buffer[3] = tx_channel;
+    buffer[4] = test_data_length;
+    buffer[5] = packet_payload;
+    buffer[6] = phy;
+    return 7;
+}
+
+/**
+ * @brief Encode hci_le_set_advertising_set_random_address command
+ * @param buffer for HCI Command packet with 10 bytes
+ * @param advertising_handle
+ * @param random_address
+ * @return size of HCI Command packet
+ * @note: format '1B'
+ */
+static inline uint16_t hci_cmd_le_set_advertising_set_random_address_encode(uint8_t * buffer, uint8_t advertising_handle, const bd_addr_t random_address){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_LE_SET_ADVERTISING_SET_RANDOM_ADDRESS);
+    buffer[2] = 7;
+    buffer[3] = advertising_handle;
+    reverse_bd_addr(random_address, &buffer[4]);
+    return 10;
+}
+
+/**
+ * @brief Encode hci_le_set_extended_advertising_parameters command
+ * @param buffer for HCI Command packet with 28 bytes
+ * @param advertising_handle
+ * @param advertising_event_properties
+ * @param primary_advertising_interval_min
+ * @param primary_advertising_interval_max
+ * @param primary_advertising_channel_map
+ * @param own_address_type
+ * @param peer_address_type
+ * @param peer_address
+ * @param advertising_filter_policy
+ * @param advertising_tx_power
+ * @param primary_advertising_phy
+ * @param secondary_advertising_max_skip
+ * @param secondary_advertising_phy
+ * @param advertising_sid
+ * @param scan_request_notification_enable
+ * @return size of HCI Command packet
+ * @note: format '1233111B1111111'
+ */
+static inline uint16_t hci_cmd_le_set_extended_advertising_parameters_encode(uint8_t * buffer, uint8_t advertising_handle, uint16_t advertising_event_properties, uint32_t primary_advertising_interval_min, uint32_t primary_advertising_interval_max, uint8_t primary_advertising_channel_map, uint8_t own_address_type, uint8_t peer_address_type, const bd_addr_t peer_address, uint8_t advertising_filter_policy, uint8_t advertising_tx_power, uint8_t primary_advertising_phy, uint8_t secondary_advertising_max_skip, uint8_t secondary_advertising_phy, uint8_t advertising_sid, uint8_t scan_request_notification_enable){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_LE_SET_EXTENDED_ADVERTISING_PARAMETERS);
+    buffer[2] = 25;
+    buffer[3] = advertising_handle;
+    little_endian_store_16(buffer, 4, advertising_event_properties);
+    little_endian_store_24(buffer, 6, primary_advertising_interval_min);
+    little_endian_store_24(buffer, 9, primary_advertising_interval_max);
+    buffer[12] = primary_advertising_channel_map;
+    buffer[13] = own_address_type;
+    buffer[14] = peer_address_type;
+    reverse_bd_addr(peer_address, &buffer[15]);
+    buffer[21] = advertising_filter_policy;
+    buffer[22] = advertising_tx_power;
+    buffer[23] = primary_advertising_phy;
+    buffer[24] = secondary_advertising_max_skip;
+    buffer[25] = secondary_advertising_phy;
+    buffer[26] = advertising_sid;
+    buffer[27] = scan_request_notification_enable;
+    return 28;
+}
+
+/**
+ * @brief Encode hci_le_read_maximum_advertising_data_length command
+ * @param buffer for HCI Command packet with 3 bytes
+ * @return size of HCI Command packet
+ * @note: format ''
+ */
+static inline uint16_t hci_cmd_le_read_maximum_advertising_data_length_encode(uint8_t * buffer){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_LE_READ_MAXIMUM_ADVERTISING_DATA_LENGTH);
+    buffer[2] = 0;
+    return 3;
+}
+
+/**
+ * @brief Encode hci_le_read_number_of_supported_advertising_sets command
+ * @param buffer for HCI Command packet with 3 bytes
+ * @return size of HCI Command packet
+ * @note: format ''
+ */
+static inline uint16_t hci_cmd_le_read_number_of_supported_advertising_sets_encode(uint8_t * buffer){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_LE_READ_NUMBER_OF_SUPPORTED_ADVERTISING_SETS);
+    buffer[2] = 0;
+    return 3;
+}
+
+/**
+ * @brief Encode hci_le_remove_advertising_set command
+ * @param buffer for HCI Command packet with 4 bytes
+ * @param advertising_handle
+ * @return size of HCI Command packet
+ * @note: format '1'
+ */
+static inline uint16_t hci_cmd_le_remove_advertising_set_encode(uint8_t * buffer, uint8_t advertising_handle){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_LE_REMOVE_ADVERTISING_SET);
+    buffer[2] = 1;
+    buffer[3] = advertising_handle;
+    return 4;
+}
+
+/**
+ * @brief Encode hci_le_clear_advertising_sets command
+ * @param buffer for HCI Command packet with 3 bytes
+ * @return size of HCI Command packet
+ * @note: format ''
+ */
+static inline uint16_t hci_cmd_le_clear_advertising_sets_encode(uint8_t * buffer){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_LE_CLEAR_ADVERTISING_SETS);
+    buffer[2] = 0;
+    return 3;
+}
+
+/**
+ * @brief Encode hci_le_set_periodic_advertising_parameters command
+ * @param buffer for HCI Command packet with 10 bytes
+ * @param advertising_handle
+ * @param periodic_advertising_interval_min
+ * @param periodic_advertising_interval_max
+ * @param periodic_advertising_properties
+ * @return size of HCI Command packet
+ * @note: format '1222'
+ */
+static inline uint16_t hci_cmd_le_set_periodic_advertising_parameters_encode(uint8_t * buffer, uint8_t advertising_handle, uint16_t periodic_advertising_interval_min, uint16_t periodic_advertising_interval_max, uint16_t periodic_advertising_properties){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_LE_SET_PERIODIC_ADVERTISING_PARAMETERS);
+    buffer[2] = 7;
+    buffer[3] = advertising_handle;
+    little_endian_store_16(buffer, 4, periodic_advertising_interval_min);
+    little_endian_store_16(buffer, 6, periodic_advertising_interval_max);
+    little_endian_store_16(buffer, 8, periodic_advertising_properties);
+    return 10;
+}
+
+/**
+ * @brief Encode hci_le_set_periodic_advertising_enable command
+ * @param buffer for HCI Command packet with 5 bytes
+ * @param enable
+ * @param advertising_handle
+ * @return size of HCI Command packet
+ * @note: format '11'
+ */
+static inline uint16_t hci_cmd_le_set_periodic_advertising_enable_encode(uint8_t * buffer, uint8_t enable, uint8_t advertising_handle){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_LE_SET_PERIODIC_ADVERTISING_ENABLE);
+    buffer[2] = 2;
+    buffer[3] = enable;
+    buffer[4] = advertising_handle;
+    return 5;
+}
+
+/**
+ * @brief Encode hci_le_set_extended_scan_enable command
+ * @param buffer for HCI Command packet with 9 bytes
+ * @param arg1
+ * @param arg2
+ * @param arg3
+ * @param arg4
+ * @return size of HCI Command packet
+ * @note: format '1122'
+ */
+static inline uint16_t hci_cmd_le_set_extended_scan_enable_encode(uint8_t * buffer, uint8_t arg1, uint8_t arg2, uint16_t arg3, uint16_t arg4){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_LE_SET_EXTENDED_SCAN_ENABLE);
+    buffer[2] = 6;
+    buffer[3] = arg1;
+    buffer[4] = arg2;
+    little_endian_store_16(buffer, 5, arg3);
+    little_endian_store_16(buffer, 7, arg4);
+    return 9;
+}
+
+/**
+ * @brief Encode hci_le_periodic_advertising_create_sync command
+ * @param buffer for HCI Command packet with 17 bytes
+ * @param arg1
+ * @param arg2
+ * @param arg3
+ * @param arg4
+ * @param arg5
+ * @param arg6
+ * @param arg7
+ * @return size of HCI Command packet
+ * @note: format '111B221'
+ */
+static inline uint16_t hci_cmd_le_periodic_advertising_create_sync_encode(uint8_t * buffer, uint8_t arg1, uint8_t arg2, uint8_t arg3, const bd_addr_t arg4, uint16_t arg5, uint16_t arg6, uint8_t arg7){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_LE_PERIODIC_ADVERTISING_CREATE_SYNC);
+    buffer[2] = 14;
+    buffer[3] = arg1;
+    buffer[4] = arg2;
+    buffer[5] = arg3;
+    reverse_bd_addr(arg4, &buffer[6]);
+    little_endian_store_16(buffer, 12, arg5);
+    little_endian_store_16(buffer, 14, arg6);
+    buffer[16] = arg7;
+    return 17;
+}
+
+/**
+ * @brief Encode hci_le_periodic_advertising_create_sync_cancel command
+ * @param buffer for HCI Command packet with 3 bytes
+ * @return size of HCI Command packet
+ * @note: format ''
+ */
+static inline uint16_t hci_cmd_le_periodic_advertising_create_sync_cancel_encode(uint8_t * buffer){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_LE_PERIODIC_ADVERTISING_CREATE_SYNC_CANCEL);
+    buffer[2] = 0;
+    return 3;
+}
+
+/**
+ * @brief Encode hci_le_periodic_advertising_terminate_sync command
+ * @param buffer for HCI Command packet with 5 bytes
+ * @param sync_handle
+ * @return size of HCI Command packet
+ * @note: format '2'
+ */
+static inline uint16_t hci_cmd_le_periodic_advertising_terminate_sync_encode(uint8_t * buffer, uint16_t sync_handle){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_LE_PERIODIC_ADVERTISING_TERMINATE_SYNC);
+    buffer[2] = 2;
+    little_endian_store_16(buffer, 3, sync_handle);
+    return 5;
+}
+
+/**
+ * @brief Encode hci_le_add_device_to_periodic_advertiser_list command
+ * @param buffer for HCI Command packet with 11 bytes
+ * @param advertiser_address_type
+ * @param advertiser_address
+ * @param advertising_sid
+ * @return size of HCI Command packet
+ * @note: format '1B1'
+ */
+static inline uint16_t hci_cmd_le_add_device_to_periodic_advertiser_list_encode(uint8_t * buffer, uint8_t advertiser_address_type, const bd_addr_t advertiser_address, uint8_t advertising_sid){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_LE_ADD_DEVICE_TO_PERIODIC_ADVERTISER_LIST);
+    buffer[2] = 8;
+    buffer[3] = advertiser_address_type;
+    reverse_bd_addr(advertiser_address, &buffer[4]);
+    buffer[10] = advertising_sid;
+    return 11;
+}
+
+/**
+ * @brief Encode hci_le_remove_device_from_periodic_advertiser_list command
+ * @param buffer for HCI Command packet with 11 bytes
+ * @param advertiser_address_type
+ * @param advertiser_address
+ * @param advertising_sid
+ * @return size of HCI Command packet
+ * @note: format '1B1'
+ */
+static inline uint16_t hci_cmd_le_remove_device_from_periodic_advertiser_list_encode(uint8_t * buffer, uint8_t advertiser_address_type, const bd_addr_t advertiser_address, uint8_t advertising_sid){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_LE_REMOVE_DEVICE_FROM_PERIODIC_ADVERTISER_LIST);
+    buffer[2] = 8;
+    buffer[3] = advertiser_address_type;
+    reverse_bd_addr(advertiser_address, &buffer[4]);
+    buffer[10] = advertising_sid;
+    return 11;
+}
+
+/**
+ * @brief Encode hci_le_clear_periodic_advertiser_list command
+ * @param buffer for HCI Command packet with 3 bytes
+ * @return size of HCI Command packet
+ * @note: format ''
+ */
+static inline uint16_t hci_cmd_le_clear_periodic_advertiser_list_encode(uint8_t * buffer){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_LE_CLEAR_PERIODIC_ADVERTISER_LIST);
+    buffer[2] = 0;
+    return 3;
+}
+
+/**
+ * @brief Encode hci_le_read_periodic_advertiser_list_size command
+ * @param buffer for HCI Command packet with 3 bytes
+ * @return size of HCI Command packet
+ * @note: format ''
+ */
+static inline uint16_t hci_cmd_le_read_periodic_advertiser_list_size_encode(uint8_t * buffer){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_LE_READ_PERIODIC_ADVERTISER_LIST_SIZE);
+    buffer[2] = 0;
+    return 3;
+}
+
+/**
+ * @brief Encode hci_le_read_transmit_power command
+ * @param buffer for HCI Command packet with 3 bytes
+ * @return size of HCI Command packet
+ * @note: format ''
+ */
+static inline uint16_t hci_cmd_le_read_transmit_power_encode(uint8_t * buffer){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_LE_READ_TRANSMIT_POWER);
+    buffer[2] = 0;
+    return 3;
+}
+
+/**
+ * @brief Encode hci_le_read_rf_path_compensation command
+ * @param buffer for HCI Command packet with 3 bytes
+ * @return size of HCI Command packet
+ * @note: format ''
+ */
+static inline uint16_t hci_cmd_le_read_rf_path_compensation_encode(uint8_t * buffer){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_LE_READ_RF_PATH_COMPENSATION);
+    buffer[2] = 0;
+    return 3;
+}
+
+/**
+ * @brief Encode hci_le_write_rf_path_compensation command
+ * @param buffer for HCI Command packet with 7 bytes
+ * @param rf_tx_path_compensation_value
+ * @param rf_rx_path_compensation_value
+ * @return size of HCI Command packet
+ * @note: format '22'
+ */
+static inline uint16_t hci_cmd_le_write_rf_path_compensation_encode(uint8_t * buffer, uint16_t rf_tx_path_compensation_value, uint16_t rf_rx_path_compensation_value){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_LE_WRITE_RF_PATH_COMPENSATION);
+    buffer[2] = 4;
+    little_endian_store_16(buffer, 3, rf_tx_path_compensation_value);
+    little_endian_store_16(buffer, 5, rf_rx_path_compensation_value);
+    return 7;
+}
+
+/**
+ * @brief Encode hci_le_set_privacy_mode command
+ * @param buffer for HCI Command packet with 11 bytes
+ * @param peer_identity_address_type
+ * @param peer_identity_address
+ * @param privacy_mode
+ * @return size of HCI Command packet
+ * @note: format '1B1'
+ */
+static inline uint16_t hci_cmd_le_set_privacy_mode_encode(uint8_t * buffer, uint8_t peer_identity_address_type, const bd_addr_t peer_identity_address, uint8_t privacy_mode){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_LE_SET_PRIVACY_MODE);
+    buffer[2] = 8;
+    buffer[3] = peer_identity_address_type;
+    reverse_bd_addr(peer_identity_address, &buffer[4]);
+    buffer[10] = privacy_mode;
+    return 11;
+}
+
+/**
+ * @brief Encode hci_le_set_connectionless_cte_transmit_enable command
+ * @param buffer for HCI Command packet with 5 bytes
+ * @param arg1
+ * @param arg2
+ * @return size of HCI Command packet
+ * @note: format '11'
+ */
+static inline uint16_t hci_cmd_le_set_connectionless_cte_transmit_enable_encode(uint8_t * buffer, uint8_t arg1, uint8_t arg2){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_LE_SET_CONNECTIONLESS_CTE_TRANSMIT_ENABLE);
+    buffer[2] = 2;
+    buffer[3] = arg1;
+    buffer[4] = arg2;
+    return 5;
+}
+
+/**
+ * @brief Encode hci_le_connection_cte_request_enable command
+ * @param buffer for HCI Command packet with 10 bytes
+ * @param arg1
+ * @param arg2
+ * @param arg3
+ * @param arg4
+ * @param arg5
+ * @return size of HCI Command packet
+ * @note: format 'H1211'
+ */
+static inline uint16_t hci_cmd_le_connection_cte_request_enable_encode(uint8_t * buffer, hci_con_handle_t arg1, uint8_t arg2, uint16_t arg3, uint8_t arg4, uint8_t arg5){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_LE_CONNECTION_CTE_REQUEST_ENABLE);
+    buffer[2] = 7;
+    little_endian_store_16(buffer, 3, arg1);
+    buffer[5] = arg2;
+    little_endian_store_16(buffer, 6, arg3);
+    buffer[8] = arg4;
+    buffer[9] = arg5;
+    return 10;
+}
+
+/**
+ * @brief Encode hci_le_connection_cte_response_enable command
+ * @param buffer for HCI Command packet with 6 bytes
+ * @param connection_handle
+ * @param enable
+ * @return size of HCI Command packet
+ * @note: format 'H1'
+ */
+static inline uint16_t hci_cmd_le_connection_cte_response_enable_encode(uint8_t * buffer, hci_con_handle_t connection_handle, uint8_t enable){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_LE_CONNECTION_CTE_RESPONSE_ENABLE);
+    buffer[2] = 3;
+    little_endian_store_16(buffer, 3, connection_handle);
+    buffer[5] = enable;
+    return 6;
+}
+
+/**
+ * @brief Encode hci_le_read_antenna_information command
+ * @param buffer for HCI Command packet with 3 bytes
+ * @return size of HCI Command packet
+ * @note: format ''
+ */
+static inline uint16_t hci_cmd_le_read_antenna_information_encode(uint8_t * buffer){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_LE_READ_ANTENNA_INFORMATION);
+    buffer[2] = 0;
+    return 3;
+}
+
+/**
+ * @brief Encode hci_le_set_periodic_advertising_receive_enable command
+ * @param buffer for HCI Command packet with 6 bytes
+ * @param sync_handle
+ * @param enable
+ * @return size of HCI Command packet
+ * @note: format 'H1'
+ */
+static inline uint16_t hci_cmd_le_set_periodic_advertising_receive_enable_encode(uint8_t * buffer, hci_con_handle_t sync_handle, uint8_t enable){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_LE_SET_PERIODIC_ADVERTISING_RECEIVE_ENABLE);
+    buffer[2] = 3;
+    little_endian_store_16(buffer, 3, sync_handle);
+    buffer[5] = enable;
+    return 6;
+}
+
+/**
+ * @brief Encode hci_le_periodic_advertising_sync_transfer command
+ * @param buffer for HCI Command packet with 9 bytes
+ * @param connection_handle
+ * @param service_data
+ * @param sync_handle
+ * @return size of HCI Command packet
+ * @note: format 'H22'
+ */
+static inline uint16_t hci_cmd_le_periodic_advertising_sync_transfer_encode(uint8_t * buffer, hci_con_handle_t connection_handle, uint16_t service_data, uint16_t sync_handle){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_LE_PERIODIC_ADVERTISING_SYNC_TRANSFER);
+    buffer[2] = 6;
+    little_endian_store_16(buffer, 3, connection_handle);
+    little_endian_store_16(buffer, 5, service_data);
+    little_endian_store_16(buffer, 7, sync_handle);
+    return 9;
+}
+
+/**
+ * @brief Encode hci_le_periodic_advertising_set_info_transfer command
+ * @param buffer for HCI Command packet with 8 bytes
+ * @param connection_handle
+ * @param service_data
+ * @param advertising_handle
+ * @return size of HCI Command packet
+ * @note: format 'H21'
+ */
+static inline uint16_t hci_cmd_le_periodic_advertising_set_info_transfer_encode(uint8_t * buffer, hci_con_handle_t connection_handle, uint16_t service_data, uint8_t advertising_handle){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_LE_PERIODIC_ADVERTISING_SET_INFO_TRANSFER);
+    buffer[2] = 5;
+    little_endian_store_16(buffer, 3, connection_handle);
+    little_endian_store_16(buffer, 5, service_data);
+    buffer[7] = advertising_handle;
+    return 8;
+}
+
+/**
+ * @brief Encode hci_le_set_periodic_advertising_sync_transfer_parameters command
+ * @param buffer for HCI Command packet with 11 bytes
+ * @param connection_handle
+ * @param mode
+ * @param skip
+ * @param sync_timeout
+ * @param cte_type
+ * @return size of HCI Command packet
+ * @note: format 'H1221'
+ */
+static inline uint16_t hci_cmd_le_set_periodic_advertising_sync_transfer_parameters_encode(uint8_t * buffer, hci_con_handle_t connection_handle, uint8_t mode, uint16_t skip, uint16_t sync_timeout, uint8_t cte_type){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_LE_SET_PERIODIC_ADVERTISING_SYNC_TRANSFER_PARAMETERS);
+    buffer[2] = 8;
+    little_endian_store_16(buffer, 3, connection_handle);
+    buffer[5] = mode;
+    little_endian_store_16(buffer, 6, skip);
+    little_endian_store_16(buffer, 8, sync_timeout);
+    buffer[10] = cte_type;
+    return 11;
+}
+
+/**
+ * @brief Encode hci_le_set_default_periodic_advertising_sync_transfer_parameters command
+ * @param buffer for HCI Command packet with 9 bytes
+ * @param mode
+ * @param skip
+ * @param sync_timeout
+ * @param cte_type
+ * @return size of HCI Command packet
+ * @note: format '1221'
+ */
+static inline uint16_t hci_cmd_le_set_default_periodic_advertising_sync_transfer_parameters_encode(uint8_t * buffer, uint8_t mode, uint16_t skip, uint16_t sync_timeout, uint8_t cte_type){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_LE_SET_DEFAULT_PERIODIC_ADVERTISING_SYNC_TRANSFER_PARAMETERS);
+    buffer[2] = 6;
+    buffer[3] = mode;
+    little_endian_store_16(buffer, 4, skip);
+    little_endian_store_16(buffer, 6, sync_timeout);
+    buffer[8] = cte_type;
+    return 9;
+}
+
+/**
+ * @brief Encode hci_le_generate_dhkey_v2 command
+ * @param buffer for HCI Command packet with 68 bytes
+ * @param arg1
+ * @param arg2
+ * @param arg3
+ * @return size of HCI Command packet
+ * @note: format 'QQ1'
+ */
+static inline uint16_t hci_cmd_le_generate_dhkey_v2_encode(uint8_t * buffer, const uint8_t *arg1, const uint8_t *arg2, uint8_t arg3){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_LE_GENERATE_DHKEY_V2);
+    buffer[2] = 65;
+    reverse_256(arg1, &buffer[3]);
+    reverse_256(arg2, &buffer[35]);
+    buffer[67] = arg3;
+    return 68;
+}
+
+/**
+ * @brief Encode hci_le_modify_sleep_clock_accuracy command
+ * @param buffer for HCI Command packet with 4 bytes
+ * @param action
+ * @return size of HCI Command packet
+ * @note: format '1'
+ */
+static inline uint16_t hci_cmd_le_modify_sleep_clock_accuracy_encode(uint8_t * buffer, uint8_t action){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_LE_MODIFY_SLEEP_CLOCK_ACCURACY);
+    buffer[2] = 1;
+    buffer[3] = action;
+    return 4;
+}
+
+/**
+ * @brief Encode hci_le_read_buffer_size_v2 command
+ * @param buffer for HCI Command packet with 3 bytes
+ * @return size of HCI Command packet
+ * @note: format ''
+ */
+static inline uint16_t hci_cmd_le_read_buffer_size_v2_encode(uint8_t * buffer){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_LE_READ_BUFFER_SIZE_V2);
+    buffer[2] = 0;
+    return 3;
+}
+
+/**
+ * @brief Encode hci_le_read_iso_tx_sync command
+ * @param buffer for HCI Command packet with 5 bytes
+ * @param connection_handle
+ * @return size of HCI Command packet
+ * @note: format 'H'
+ */
+static inline uint16_t hci_cmd_le_read_iso_tx_sync_encode(uint8_t * buffer, hci_con_handle_t connection_handle){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_LE_READ_ISO_TX_SYNC);
+    buffer[2] = 2;
+    little_endian_store_16(buffer, 3, connection_handle);
+    return 5;
+}
+
+/**
+ * @brief Encode hci_le_remove_cig command
+ * @param buffer for HCI Command packet with 4 bytes
+ * @param arg1
+ * @return size of HCI Command packet
+ * @note: format '1'
+ */
+static inline uint16_t hci_cmd_le_remove_cig_encode(uint8_t * buffer, uint8_t arg1){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_LE_REMOVE_CIG);
+    buffer[2] = 1;
+    buffer[3] = arg1;
+    return 4;
+}
+
+/**
+ * @brief Encode hci_le_accept_cis_request command
+ * @param buffer for HCI Command packet with 5 bytes
+ * @param connection_handle
+ * @return size of HCI Command packet
+ * @note: format 'H'
+ */
+static inline uint16_t hci_cmd_le_accept_cis_request_encode(uint8_t * buffer, hci_con_handle_t connection_handle){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_LE_ACCEPT_CIS_REQUEST);
+    buffer[2] = 2;
+    little_endian_store_16(buffer, 3, connection_handle);
+    return 5;
+}
+
+/**
+ * @brief Encode hci_le_reject_cis_request command
+ * @param buffer for HCI Command packet with 6 bytes
+ * @param arg1
+ * @param arg2
+ * @return size of HCI Command packet
+ * @note: format 'H1'
+ */
+static inline uint16_t hci_cmd_le_reject_cis_request_encode(uint8_t * buffer, hci_con_handle_t arg1, uint8_t arg2){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_LE_REJECT_CIS_REQUEST);
+    buffer[2] = 3;
+    little_endian_store_16(buffer, 3, arg1);
+    buffer[5] = arg2;
+    return 6;
+}
+
+/**
+ * @brief Encode hci_le_create_big command
+ * @param buffer for HCI Command packet with 34 bytes
+ * @param big_handle
+ * @param advertising_handle
+ * @param num_bis
+ * @param sdu_interval
+ * @param max_sdu
+ * @param max_transport_latency
+ * @param rtn
+ * @param phy
+ * @param packing
+ * @param framing
+ * @param encryption
+ * @param broadcast_code
+ * @return size of HCI Command packet
+ * @note: format '11132211111K'
+ */
+static inline uint16_t hci_cmd_le_create_big_encode(uint8_t * buffer, uint8_t big_handle, uint8_t advertising_handle, uint8_t num_bis, uint32_t sdu_interval, uint16_t max_sdu, uint16_t max_transport_latency, uint8_t rtn, uint8_t phy, uint8_t packing, uint8_t framing, uint8_t encryption, const uint8_t *broadcast_code){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_LE_CREATE_BIG);
+    buffer[2] = 31;
+    buffer[3] = big_handle;
+    buffer[4] = advertising_handle;
+    buffer[5] = num_bis;
+    little_endian_store_24(buffer, 6, sdu_interval);
+    little_endian_store_16(buffer, 9, max_sdu);
+    little_endian_store_16(buffer, 11, max_transport_latency);
+    buffer[13] = rtn;
+    buffer[14] = phy;
+    buffer[15] = packing;
+    buffer[16] = framing;
+    buffer[17] = encryption;
+    reverse_128(broadcast_code, &buffer[18]);
+    return 34;
+}
+
+/**
+ * @brief Encode hci_le_create_big_test command
+ * @param buffer for HCI Command packet with 39 bytes
+ * @param big_handle
+ * @param advertising_handle
+ * @param num_bis
+ * @param sdu_interval
+ * @param iso_interval
+ * @param nse
+ * @param max_sdu
+ * @param max_pdu
+ * @param phy
+ * @param packing
+ * @param framing
+ * @param bn
+ * @param irc
+ * @param pto
+ * @param encryption
+ * @param broadcast_code
+ * @return size of HCI Command packet
+ * @note: format '111321221111111K'
+ */
+static inline uint16_t hci_cmd_le_create_big_test_encode(uint8_t * buffer, uint8_t big_handle, uint8_t advertising_handle, uint8_t num_bis, uint32_t sdu_interval, uint16_t iso_interval, uint8_t nse, uint16_t max_sdu, uint16_t max_pdu, uint8_t phy, uint8_t packing, uint8_t framing, uint8_t bn, uint8_t irc, uint8_t pto, uint8_t encryption, const uint8_t *broadcast_code){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_LE_CREATE_BIG_TEST);
+    buffer[2] = 36;
+    buffer[3] = big_handle;
+    buffer[4] = advertising_handle;
+    buffer[5] = num_bis;
+    little_endian_store_24(buffer, 6, sdu_interval);
+    little_endian_store_16(buffer, 9, iso_interval);
+    buffer[11] = nse;
+    little_endian_store_16(buffer, 12, max_sdu);
+    little_endian_store_16(buffer, 14, max_pdu);
+    buffer[16] = phy;
+    buffer[17] = packing;
+    buffer[18] = framing;
+    buffer[19] = bn;
+    buffer[20] = irc;
+    buffer[21] = pto;
+    buffer[22] = encryption;
+    reverse_128(broadcast_code, &buffer[23]);
+    return 39;
+}
+
+/**
+ * @brief Encode hci_le_terminate_big command
+ * @param buffer for HCI Command packet with 5 bytes
+ * @param big_handle
+ * @param reason
+ * @return size of HCI Command packet
+ * @note: format '11'
+ */
+static inline uint16_t hci_cmd_le_terminate_big_encode(uint8_t * buffer, uint8_t big_handle, uint8_t reason){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_LE_TERMINATE_BIG);
+    buffer[2] = 2;
+    buffer[3] = big_handle;
+    buffer[4] = reason;
+    return 5;
+}
+
+/**
+ * @brief Encode hci_le_big_terminate_sync command
+ * @param buffer for HCI Command packet with 4 bytes
+ * @param arg1
+ * @return size of HCI Command packet
+ * @note: format '1'
+ */
+static inline uint16_t hci_cmd_le_big_terminate_sync_encode(uint8_t * buffer, uint8_t arg1){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_LE_BIG_TERMINATE_SYNC);
+    buffer[2] = 1;
+    buffer[3] = arg1;
+    return 4;
+}
+
+/**
+ * @brief Encode hci_le_request_peer_sca command
+ * @param buffer for HCI Command packet with 5 bytes
+ * @param connection_handle
+ * @return size of HCI Command packet
+ * @note: format 'H'
+ */
+static inline uint16_t hci_cmd_le_request_peer_sca_encode(uint8_t * buffer, hci_con_handle_t connection_handle){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_LE_REQUEST_PEER_SCA);
+    buffer[2] = 2;
+    little_endian_store_16(buffer, 3, connection_handle);
+    return 5;
+}
+
+/**
+ * @brief Encode hci_le_remove_iso_data_path command
+ * @param buffer for HCI Command packet with 6 bytes
+ * @param arg1
+ * @param arg2
+ * @return size of HCI Command packet
+ * @note: format 'H1'
+ */
+static inline uint16_t hci_cmd_le_remove_iso_data_path_encode(uint8_t * buffer, hci_con_handle_t arg1, uint8_t arg2){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_LE_REMOVE_ISO_DATA_PATH);
+    buffer[2] = 3;
+    little_endian_store_16(buffer, 3, arg1);
+    buffer[5] = arg2;
+    return 6;
+}
+
+/**
+ * @brief Encode hci_le_iso_transmit_test command
+ * @param buffer for HCI Command packet with 6 bytes
+ * @param connection_handle
+ * @param paylaod_type
+ * @return size of HCI Command packet
+ * @note: format 'H1'
+ */
+static inline uint16_t hci_cmd_le_iso_transmit_test_encode(uint8_t * buffer, hci_con_handle_t connection_handle, uint8_t paylaod_type){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_LE_ISO_TRANSMIT_TEST);
+    buffer[2] = 3;
+    little_endian_store_16(buffer, 3, connection_handle);
+    buffer[5] = paylaod_type;
+    return 6;
+}
+
+/**
+ * @brief Encode hci_le_iso_receive_test command
+ * @param buffer for HCI Command packet with 6 bytes
+ * @param connection_handle
+ * @param paylaod_type
+ * @return size of HCI Command packet
+ * @note: format 'H1'
+ */
+static inline uint16_t hci_cmd_le_iso_receive_test_encode(uint8_t * buffer, hci_con_handle_t connection_handle, uint8_t paylaod_type){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_LE_ISO_RECEIVE_TEST);
+    buffer[2] = 3;
+    little_endian_store_16(buffer, 3, connection_handle);
+    buffer[5] = paylaod_type;
+    return 6;
+}
+
+/**
+ * @brief Encode hci_le_iso_read_test_counters command
+ * @param buffer for HCI Command packet with 5 bytes
+ * @param connection_handle
+ * @return size of HCI Command packet
+ * @note: format 'H'
+ */
+static inline uint16_t hci_cmd_le_iso_read_test_counters_encode(uint8_t * buffer, hci_con_handle_t connection_handle){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_LE_ISO_READ_TEST_COUNTERS);
+    buffer[2] = 2;
+    little_endian_store_16(buffer, 3, connection_handle);
+    return 5;
+}
+
+/**
+ * @brief Encode hci_le_iso_test_end command
+ * @param buffer for HCI Command packet with 5 bytes
+ * @param connection_handle
+ * @return size of HCI Command packet
+ * @note: format 'H'
+ */
+static inline uint16_t hci_cmd_le_iso_test_end_encode(uint8_t * buffer, hci_con_handle_t connection_handle){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_LE_ISO_TEST_END);
+    buffer[2] = 2;
+    little_endian_store_16(buffer, 3, connection_handle);
+    return 5;
+}
+
+/**
+ * @brief Encode hci_le_set_host_feature command
+ * @param buffer for HCI Command packet with 5 bytes
+ * @param bit_number
+ * @param bit_value
+ * @return size of HCI Command packet
+ * @note: format '11'
+ */
+static inline uint16_t hci_cmd_le_set_host_feature_encode(uint8_t * buffer, uint8_t bit_number, uint8_t bit_value){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_LE_SET_HOST_FEATURE);
+    buffer[2] = 2;
+    buffer[3] = bit_number;
+    buffer[4] = bit_value;
+    return 5;
+}
+
+/**
+ * @brief Encode hci_le_read_iso_link_quality command
+ * @param buffer for HCI Command packet with 5 bytes
+ * @param connection_handle
+ * @return size of HCI Command packet
+ * @note: format 'H'
+ */
+static inline uint16_t hci_cmd_le_read_iso_link_quality_encode(uint8_t * buffer, hci_con_handle_t connection_handle){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_LE_READ_ISO_LINK_QUALITY);
+    buffer[2] = 2;
+    little_endian_store_16(buffer, 3, connection_handle);
+    return 5;
+}
+
+/**
+ * @brief Encode hci_le_enhanced_read_transmit_power_level command
+ * @param buffer for HCI Command packet with 6 bytes
+ * @param connection_handle
+ * @param phy
+ * @return size of HCI Command packet
+ * @note: format 'H1'
+ */
+static inline uint16_t hci_cmd_le_enhanced_read_transmit_power_level_encode(uint8_t * buffer, hci_con_handle_t connection_handle, uint8_t phy){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_LE_ENHANCED_READ_TRANSMIT_POWER_LEVEL);
+    buffer[2] = 3;
+    little_endian_store_16(buffer, 3, connection_handle);
+    buffer[5] = phy;
+    return 6;
+}
+
+/**
+ * @brief Encode hci_le_read_remote_transmit_power_level command
+ * @param buffer for HCI Command packet with 6 bytes
+ * @param connection_handle
+ * @param phy
+ * @return size of HCI Command packet
+ * @note: format 'H1'
+ */
+static inline uint16_t hci_cmd_le_read_remote_transmit_power_level_encode(uint8_t * buffer, hci_con_handle_t connection_handle, uint8_t phy){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_LE_READ_REMOTE_TRANSMIT_POWER_LEVEL);
+    buffer[2] = 3;
+    little_endian_store_16(buffer, 3, connection_handle);
+    buffer[5] = phy;
+    return 6;
+}
+
+/**
+ * @brief Encode hci_le_set_path_loss_reporting_parameters command
+ * @param buffer for HCI Command packet with 11 bytes
+ * @param connection_handle
+ * @param high_threshold
+ * @param high_hysteresis
+ * @param low_threshold
+ * @param low_hysteresis
+ * @param min_time_spent
+ * @return size of HCI Command packet
+ * @note: format '211112'
+ */
+static inline uint16_t hci_cmd_le_set_path_loss_reporting_parameters_encode(uint8_t * buffer, uint16_t connection_handle, uint8_t high_threshold, uint8_t high_hysteresis, uint8_t low_threshold, uint8_t low_hysteresis, uint16_t min_time_spent){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_LE_SET_PATH_LOSS_REPORTING_PARAMETERS);
+    buffer[2] = 8;
+    little_endian_store_16(buffer, 3, connection_handle);
+    buffer[5] = high_threshold;
+    buffer[6] = high_hysteresis;
+    buffer[7] = low_threshold;
+    buffer[8] = low_hysteresis;
+    little_endian_store_16(buffer, 9, min_time_spent);
+    return 11;
+}
+
+/**
+ * @brief Encode hci_le_set_path_loss_reporting_enable command
+ * @param buffer for HCI Command packet with 6 bytes
+ * @param connection_handle
+ * @param enable
+ * @return size of HCI Command packet
+ * @note: format 'H1'
+ */
+static inline uint16_t hci_cmd_le_set_path_loss_reporting_enable_encode(uint8_t * buffer, hci_con_handle_t connection_handle, uint8_t enable){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_LE_SET_PATH_LOSS_REPORTING_ENABLE);
+    buffer[2] = 3;
+    little_endian_store_16(buffer, 3, connection_handle);
+    buffer[5] = enable;
+    return 6;
+}
+
+/**
+ * @brief Encode hci_le_set_transmit_power_reporting_enable command
+ * @param buffer for HCI Command packet with 7 bytes
+ * @param connection_handle
+ * @param local_enable
+ * @param remote_enable
+ * @return size of HCI Command packet
+ * @note: format 'H11'
+ */
+static inline uint16_t hci_cmd_le_set_transmit_power_reporting_enable_encode(uint8_t * buffer, hci_con_handle_t connection_handle, uint8_t local_enable, uint8_t remote_enable){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_LE_SET_TRANSMIT_POWER_REPORTING_ENABLE);
+    buffer[2] = 4;
+    little_endian_store_16(buffer, 3, connection_handle);
+    buffer[5] = local_enable;
+    buffer[6] = remote_enable;
+    return 7;
+}
+
+/**
+ * @brief Encode hci_bcm_enable_wbs command
+ * @param buffer for HCI Command packet with 6 bytes
+ * @param arg1
+ * @param arg2
+ * @return size of HCI Command packet
+ * @note: format '12'
+ */
+static inline uint16_t hci_cmd_bcm_enable_wbs_encode(uint8_t * buffer, uint8_t arg1, uint16_t arg2){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_BCM_ENABLE_WBS);
+    buffer[2] = 3;
+    buffer[3] = arg1;
+    little_endian_store_16(buffer, 4, arg2);
+    return 6;
+}
+
+/**
+ * @brief Encode hci_bcm_pcm2_setup command
+ * @param buffer for HCI Command packet with 29 bytes
+ * @param action
+ * @param test_options
+ * @param op_mode
+ * @param sync_and_clock_options
+ * @param pcm_clock_freq
+ * @param sync_signal_width
+ * @param slot_width
+ * @param number_of_slots
+ * @param bank_0_fill_mode
+ * @param bank_0_number_of_fill_bits
+ * @param bank_0_programmable_fill_data
+ * @param bank_1_fill_mode
+ * @param bank_1_number_of_fill_bits
+ * @param bank_1_programmable_fill_data
+ * @param data_justify_and_bit_order_options
+ * @param ch_0_slot_number
+ * @param ch_1_slot_number
+ * @param ch_2_slot_number
+ * @param ch_3_slot_number
+ * @param ch_4_slot_number
+ * @param ch_0_period
+ * @param ch_1_period
+ * @param ch_2_period
+ * @return size of HCI Command packet
+ * @note: format '11114111111111111111111'
+ */
+static inline uint16_t hci_cmd_bcm_pcm2_setup_encode(uint8_t * buffer, uint8_t action, uint8_t test_options, uint8_t op_mode, uint8_t sync_and_clock_options, uint32_t pcm_clock_freq, uint8_t sync_signal_width, uint8_t slot_width, uint8_t number_of_slots, uint8_t bank_0_fill_mode, uint8_t bank_0_number_of_fill_bits, uint8_t bank_0_programmable_fill_data, uint8_t bank_1_fill_mode, uint8_t bank_1_number_of_fill_bits, uint8_t bank_1_programmable_fill_data, uint8_t data_justify_and_bit_order_options, uint8_t ch_0_slot_number, uint8_t ch_1_slot_number, uint8_t ch_2_slot_number, uint8_t ch_3_slot_number, uint8_t ch_4_slot_number, uint8_t ch_0_period, uint8_t ch_1_period, uint8_t ch_2_period){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_BCM_PCM2_SETUP);
+    buffer[2] = 26;
+    buffer[3] = action;
+    buffer[4] = test_options;
+    buffer[5] = op_mode;
+    buffer[6] = sync_and_clock_options;
+    little_endian_store_32(buffer, 7, pcm_clock_freq);
+    buffer[11] = sync_signal_width;
+    buffer[12] = slot_width;
+    buffer[13] = number_of_slots;
+    buffer[14] = bank_0_fill_mode;
+    buffer[15] = bank_0_number_of_fill_bits;
+    buffer[16] = bank_0_programmable_fill_data;
+    buffer[17] = bank_1_fill_mode;
+    buffer[18] = bank_1_number_of_fill_bits;
+    buffer[19] = bank_1_programmable_fill_data;
+    buffer[20] = data_justify_and_bit_order_options;
+    buffer[21] = ch_0_slot_number;
+    buffer[22] = ch_1_slot_number;
+    buffer[23] = ch_2_slot_number;
+    buffer[24] = ch_3_slot_number;
+    buffer[25] = ch_4_slot_number;
+    buffer[26] = ch_0_period;
+    buffer[27] = ch_1_period;
+    buffer[28] = ch_2_period;
+    return 29;
+}
+
+/**
+ * @brief Encode hci_bcm_write_sco_pcm_int command
+ * @param buffer for HCI Command packet with 8 bytes
+ * @param sco_routing
+ * @param pcm_interface_rate
+ * @param frame_type
+ * @param sync_mode
+ * @param clock_mode
+ * @return size of HCI Command packet
+ * @note: format '11111'
+ */
+static inline uint16_t hci_cmd_bcm_write_sco_pcm_int_encode(uint8_t * buffer, uint8_t sco_routing, uint8_t pcm_interface_rate, uint8_t frame_type, uint8_t sync_mode, uint8_t clock_mode){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_BCM_WRITE_SCO_PCM_INT);
+    buffer[2] = 5;
+    buffer[3] = sco_routing;
+    buffer[4] = pcm_interface_rate;
+    buffer[5] = frame_type;
+    buffer[6] = sync_mode;
+    buffer[7] = clock_mode;
+    return 8;
+}
+
+/**
+ * @brief Encode hci_bcm_write_pcm_data_format_param command
+ * @param buffer for HCI Command packet with 8 bytes
+ * @param lsb_position
+ * @param fill_bits_value
+ * @param fill_data_selection
+ * @param number_of_fill_bits
+ * @param right_left_justification
+ * @return size of HCI Command packet
+ * @note: format '11111'
+ */
+static inline uint16_t hci_cmd_bcm_write_pcm_data_format_param_encode(uint8_t * buffer, uint8_t lsb_position, uint8_t fill_bits_value, uint8_t fill_data_selection, uint8_t number_of_fill_bits, uint8_t right_left_justification){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_BCM_WRITE_PCM_DATA_FORMAT_PARAM);
+    buffer[2] = 5;
+    buffer[3] = lsb_position;
+    buffer[4] = fill_bits_value;
+    buffer[5] = fill_data_selection;
+    buffer[6] = number_of_fill_bits;
+    buffer[7] = right_left_justification;
+    return 8;
+}
+
+/**
+ * @brief Encode hci_bcm_write_i2spcm_interface_param command
+ * @param buffer for HCI Command packet with 7 bytes
+ * @param i2s_enable
+ * @param is_master
+ * @param sample_rate
+ * @param clock_rate
+ * @return size of HCI Command packet
+ * @note: format '1111'
+ */
+static inline uint16_t hci_cmd_bcm_write_i2spcm_interface_param_encode(uint8_t * buffer, uint8_t i2s_enable, uint8_t is_master, uint8_t sample_rate, uint8_t clock_rate){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_BCM_WRITE_I2SPCM_INTERFACE_PARAM);
+    buffer[2] = 4;
+    buffer[3] = i2s_enable;
+    buffer[4] = is_master;
+    buffer[5] = sample_rate;
+    buffer[6] = clock_rate;
+    return 7;
+}
+
+/**
+ * @brief Encode hci_bcm_set_sleep_mode command
+ * @param buffer for HCI Command packet with 15 bytes
+ * @param sleep_mode
+ * @param idle_threshold_host
+ * @param idle_threshold_controller
+ * @param bt_wake_active_mode
+ * @param host_wake_active_mode
+ * @param allow_host_sleep_during_sco
+ * @param combine_sleep_mode_and_lpm
+ * @param enable_tristate_control_of_uart_tx_line
+ * @param active_connection_handling_on_suspend
+ * @param resume_timeout
+ * @param enable_break_to_host
+ * @param pulsed_host_wake
+ * @return size of HCI Command packet
+ * @note: format '111111111111'
+ */
+static inline uint16_t hci_cmd_bcm_set_sleep_mode_encode(uint8_t * buffer, uint8_t sleep_mode, uint8_t idle_threshold_host, uint8_t idle_threshold_controller, uint8_t bt_wake_active_mode, uint8_t host_wake_active_mode, uint8_t allow_host_sleep_during_sco, uint8_t combine_sleep_mode_and_lpm, uint8_t enable_tristate_control_of_uart_tx_line, uint8_t active_connection_handling_on_suspend, uint8_t resume_timeout, uint8_t enable_break_to_host, uint8_t pulsed_host_wake){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_BCM_SET_SLEEP_MODE);
+    buffer[2] = 12;
+    buffer[3] = sleep_mode;
+    buffer[4] = idle_threshold_host;
+    buffer[5] = idle_threshold_controller;
+    buffer[6] = bt_wake_active_mode;
+    buffer[7] = host_wake_active_mode;
+    buffer[8] = allow_host_sleep_during_sco;
+    buffer[9] = combine_sleep_mode_and_lpm;
+    buffer[10] = enable_tristate_control_of_uart_tx_line;
+    buffer[11] = active_connection_handling_on_suspend;
+    buffer[12] = resume_timeout;
+    buffer[13] = enable_break_to_host;
+    buffer[14] = pulsed_host_wake;
+    return 15;
+}
+
+/**
+ * @brief Encode hci_bcm_write_tx_power_table command
+ * @param buffer for HCI Command packet with 5 bytes
+ * @param is_le
+ * @param chip_max_tx_pwr_db
+ * @return size of HCI Command packet
+ * @note: format '11'
+ */
+static inline uint16_t hci_cmd_bcm_write_tx_power_table_encode(uint8_t * buffer, uint8_t is_le, uint8_t chip_max_tx_pwr_db){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_BCM_WRITE_TX_POWER_TABLE);
+    buffer[2] = 2;
+    buffer[3] = is_le;
+    buffer[4] = chip_max_tx_pwr_db;
+    return 5;
+}
+
+/**
+ * @brief Encode hci_bcm_set_tx_pwr command
+ * @param buffer for HCI Command packet with 7 bytes
+ * @param arg1
+ * @param arg2
+ * @param arg3
+ * @return size of HCI Command packet
+ * @note: format '11H'
+ */
+static inline uint16_t hci_cmd_bcm_set_tx_pwr_encode(uint8_t * buffer, uint8_t arg1, uint8_t arg2, hci_con_handle_t arg3){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_BCM_SET_TX_PWR);
+    buffer[2] = 4;
+    buffer[3] = arg1;
+    buffer[4] = arg2;
+    little_endian_store_16(buffer, 5, arg3);
+    return 7;
+}
+
+/**
+ * @brief Encode hci_ti_drpb_tester_con_rx command
+ * @param buffer for HCI Command packet with 5 bytes
+ * @param frequency
+ * @param adpll
+ * @return size of HCI Command packet
+ * @note: format '11'
+ */
+static inline uint16_t hci_cmd_ti_drpb_tester_con_rx_encode(uint8_t * buffer, uint8_t frequency, uint8_t adpll){
+    little_endian_store_16(buffer, 0, 0xFD17);
+    buffer[2] = 2;
+    buffer[3] = frequency;
+    buffer[4] = adpll;
+    return 5;
+}
+
+/**
+ * @brief Encode hci_ti_drpb_tester_con_tx command
+ * @param buffer for HCI Command packet with 15 bytes
+ * @param modulation
+ * @param test_pattern
+ * @param frequency
+ * @param power_level
+ * @param reserved1
+ * @param reserved2
+ * @return size of HCI Command packet
+ * @note: format '111144'
+ */
+static inline uint16_t hci_cmd_ti_drpb_tester_con_tx_encode(uint8_t * buffer, uint8_t modulation, uint8_t test_pattern, uint8_t frequency, uint8_t power_level, uint32_t reserved1, uint32_t reserved2){
+    little_endian_store_16(buffer, 0, 0xFD84);
+    buffer[2] = 12;
+    buffer[3] = modulation;
+    buffer[4] = test_pattern;
+    buffer[5] = frequency;
+    buffer[6] = power_level;
+    little_endian_store_32(buffer, 7, reserved1);
+    little_endian_store_32(buffer, 11, reserved2);
+    return 15;
+}
+
+/**
+ * @brief Encode hci_ti_drpb_tester_packet_tx_rx command
+ * @param buffer for HCI Command packet with 15 bytes
+ * @param arg1
+ * @param arg2
+ * @param arg3
+ * @param arg4
+ * @param arg5
+ * @param arg6
+ * @param arg7
+ * @param arg8
+ * @param arg9
+ * @param arg10
+ * @return size of HCI Command packet
+ * @note: format '1111112112'
+ */
+static inline uint16_t hci_cmd_ti_drpb_tester_packet_tx_rx_encode(uint8_t * buffer, uint8_t arg1, uint8_t arg2, uint8_t arg3, uint8_t arg4, uint8_t arg5, uint8_t arg6, uint16_t arg7, uint8_t arg8, uint8_t arg9, uint16_t arg10){
+    little_endian_store_16(buffer, 0, 0xFD85);
+    buffer[2] = 12;
+    buffer[3] = arg1;
+    buffer[4] = arg2;
+    buffer[5] = arg3;
+    buffer[6] = arg4;
+    buffer[7] = arg5;
+    buffer[8] = arg6;
+    little_endian_store_16(buffer, 9, arg7);
+    buffer[11] = arg8;
+    buffer[12] = arg9;
+    little_endian_store_16(buffer, 13, arg10);
+    return 15;
+}
+
+/**
+ * @brief Encode hci_ti_configure_ddip command
+ * @param buffer for HCI Command packet with 10 bytes
+ * @param arg1
+ * @param arg2
+ * @param arg3
+ * @param arg4
+ * @param arg5
+ * @param arg6
+ * @param arg7
+ * @return size of HCI Command packet
+ * @note: format '1111111'
+ */
+static inline uint16_t hci_cmd_ti_configure_ddip_encode(uint8_t * buffer, uint8_t arg1, uint8_t arg2, uint8_t arg3, uint8_t arg4, uint8_t arg5, uint8_t arg6, uint8_t arg7){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_TI_VS_CONFIGURE_DDIP);
+    buffer[2] = 7;
+    buffer[3] = arg1;
+    buffer[4] = arg2;
+    buffer[5] = arg3;
+    buffer[6] = arg4;
+    buffer[7] = arg5;
+    buffer[8] = arg6;
+    buffer[9] = arg7;
+    return 10;
+}
+
+/**
+ * @brief Encode hci_ti_avrp_enable command
+ * @param buffer for HCI Command packet with 8 bytes
+ * @param enable
+ * @param a3dp_role
+ * @param code_upload
+ * @param reserved
+ * @return size of HCI Command packet
+ * @note: format '1112'
+ */
+static inline uint16_t hci_cmd_ti_avrp_enable_encode(uint8_t * buffer, uint8_t enable, uint8_t a3dp_role, uint8_t code_upload, uint16_t reserved){
+    little_endian_store_16(buffer, 0, 0xFD92);
+    buffer[2] = 5;
+    buffer[3] = enable;
+    buffer[4] = a3dp_role;
+    buffer[5] = code_upload;
+    little_endian_store_16(buffer, 6, reserved);
+    return 8;
+}
+
+/**
+ * @brief Encode hci_ti_wbs_associate command
+ * @param buffer for HCI Command packet with 5 bytes
+ * @param acl_con_handle
+ * @return size of HCI Command packet
+ * @note: format 'H'
+ */
+static inline uint16_t hci_cmd_ti_wbs_associate_encode(uint8_t * buffer, hci_con_handle_t acl_con_handle){
+    little_endian_store_16(buffer, 0, 0xFD78);
+    buffer[2] = 2;
+    little_endian_store_16(buffer, 3, acl_con_handle);
+    return 5;
+}
+
+/**
+ * @brief Encode hci_ti_wbs_disassociate command
+ * @param buffer for HCI Command packet with 3 bytes
+ * @return size of HCI Command packet
+ * @note: format ''
+ */
+static inline uint16_t hci_cmd_ti_wbs_disassociate_encode(uint8_t * buffer){
+    little_endian_store_16(buffer, 0, 0xFD79);
+    buffer[2] = 0;
+    return 3;
+}
+
+/**
+ * @brief Encode hci_ti_write_codec_config command
+ * @param buffer for HCI Command packet with 37 bytes
+ * @param clock_rate
+ * @param clock_direction
+ * @param frame_sync_frequency
+ * @param frame_sync_duty_cycle
+ * @param frame_sync_edge
+ * @param frame_sync_polariy
+ * @param reserved1
+ * @param channel_1_data_out_size
+ * @param channel_1_data_out_offset
+ * @param channel_1_data_out_edge
+ * @param channel_1_data_in_size
+ * @param channel_1_data_in_offset
+ * @param channel_1_data_in_edge
+ * @param fsync_multiplier
+ * @param channel_2_data_out_size
+ * @param channel_2_data_out_offset
+ * @param channel_2_data_out_edge
+ * @param channel_2_data_in_size
+ * @param channel_2_data_in_offset
+ * @param channel_2_data_in_edge
+ * @param reserved2
+ * @return size of HCI Command packet
+ * @note: format '214211122122112212211'
+ */
+static inline uint16_t hci_cmd_ti_write_codec_config_encode(uint8_t * buffer, uint16_t clock_rate, uint8_t clock_direction, uint32_t frame_sync_frequency, uint16_t frame_sync_duty_cycle, uint8_t frame_sync_edge, uint8_t frame_sync_polariy, uint8_t reserved1, uint16_t channel_1_data_out_size, uint16_t channel_1_data_out_offset, uint8_t channel_1_data_out_edge, uint16_t channel_1_data_in_size, uint16_t channel_1_data_in_offset, uint8_t channel_1_data_in_edge, uint8_t fsync_multiplier, uint16_t channel_2_data_out_size, uint16_t channel_2_data_out_offset, uint8_t channel_2_data_out_edge, uint16_t channel_2_data_in_size, uint16_t channel_2_data_in_offset, uint8_t channel_2_data_in_edge, uint8_t reserved2){
+    little_endian_store_16(buffer, 0, 0xFD06);
+    buffer[2] = 34;
+    little_endian_store_16(buffer, 3, clock_rate);
+    buffer[5] = clock_direction;
+    little_endian_store_32(buffer, 6, frame_sync_frequency);
+    little_endian_store_16(buffer, 10, frame_sync_duty_cycle);
+    buffer[12] = frame_sync_edge;
+    buffer[13] = frame_sync_polariy;
+    buffer[14] = reserved1;
+    little_endian_store_16(buffer, 15, channel_1_data_out_size);
+    little_endian_store_16(buffer, 17, channel_1_data_out_offset);
+    buffer[19] = channel_1_data_out_edge;
+    little_endian_store_16(buffer, 20, channel_1_data_in_size);
+    little_endian_store_16(buffer, 22, channel_1_data_in_offset);
+    buffer[24] = channel_1_data_in_edge;
+    buffer[25] = fsync_multiplier;
+    little_endian_store_16(buffer, 26, channel_2_data_out_size);
+    little_endian_store_16(buffer, 28, channel_2_data_out_offset);
+    buffer[30] = channel_2_data_out_edge;
+    little_endian_store_16(buffer, 31, channel_2_data_in_size);
+    little_endian_store_16(buffer, 33, channel_2_data_in_offset);
+    buffer[35] = channel_2_data_in_edge;
+    buffer[36] = reserved2;
+    return 37;
+}
+
+/**
+ * @brief Encode hci_ti_drpb_enable_rf_calibration command
+ * @param buffer for HCI Command packet with 9 bytes
+ * @param arg1
+ * @param arg2
+ * @param arg3
+ * @return size of HCI Command packet
+ * @note: format '141'
+ */
+static inline uint16_t hci_cmd_ti_drpb_enable_rf_calibration_encode(uint8_t * buffer, uint8_t arg1, uint32_t arg2, uint8_t arg3){
+    little_endian_store_16(buffer, 0, 0xFD80);
+    buffer[2] = 6;
+    buffer[3] = arg1;
+    little_endian_store_32(buffer, 4, arg2);
+    buffer[8] = arg3;
+    return 9;
+}
+
+/**
+ * @brief Encode hci_ti_write_hardware_register command
+ * @param buffer for HCI Command packet with 9 bytes
+ * @param frequency
+ * @param adpll
+ * @return size of HCI Command packet
+ * @note: format '42'
+ */
+static inline uint16_t hci_cmd_ti_write_hardware_register_encode(uint8_t * buffer, uint32_t frequency, uint16_t adpll){
+    little_endian_store_16(buffer, 0, 0xFF01);
+    buffer[2] = 6;
+    little_endian_store_32(buffer, 3, frequency);
+    little_endian_store_16(buffer, 7, adpll);
+    return 9;
+}
+
+/**
+ * @brief Encode hci_rtk_configure_sco_routing command
+ * @param buffer for HCI Command packet with 12 bytes
+ * @param arg1
+ * @param arg2
+ * @param arg3
+ * @param arg4
+ * @param arg5
+ * @param arg6
+ * @param arg7
+ * @param arg8
+ * @param arg9
+ * @return size of HCI Command packet
+ * @note: format '111111111'
+ */
+static inline uint16_t hci_cmd_rtk_configure_sco_routing_encode(uint8_t * buffer, uint8_t arg1, uint8_t arg2, uint8_t arg3, uint8_t arg4, uint8_t arg5, uint8_t arg6, uint8_t arg7, uint8_t arg8, uint8_t arg9){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_RTK_CONFIGURE_SCO_ROUTING);
+    buffer[2] = 9;
+    buffer[3] = arg1;
+    buffer[4] = arg2;
+    buffer[5] = arg3;
+    buffer[6] = arg4;
+    buffer[7] = arg5;
+    buffer[8] = arg6;
+    buffer[9] = arg7;
+    buffer[10] = arg8;
+    buffer[11] = arg9;
+    return 12;
+}
+
+/**
+ * @brief Encode hci_rtk_read_card_info command
+ * @param buffer for HCI Command packet with 8 bytes
+ * @param arg1
+ * @param arg2
+ * @param arg3
+ * @param arg4
+ * @param arg5
+ * @return size of HCI Command packet
+ * @note: format '11111'
+ */
+static inline uint16_t hci_cmd_rtk_read_card_info_encode(uint8_t * buffer, uint8_t arg1, uint8_t arg2, uint8_t arg3, uint8_t arg4, uint8_t arg5){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_RTK_READ_CARD_INFO);
+    buffer[2] = 5;
+    buffer[3] = arg1;
+    buffer[4] = arg2;
+    buffer[5] = arg3;
+    buffer[6] = arg4;
+    buffer[7] = arg5;
+    return 8;
+}
+
+/**
+ * @brief Encode hci_nxp_set_sco_data_path command
+ * @param buffer for HCI Command packet with 4 bytes
+ * @param voice_path
+ * @return size of HCI Command packet
+ * @note: format '1'
+ */
+static inline uint16_t hci_cmd_nxp_set_sco_data_path_encode(uint8_t * buffer, uint8_t voice_path){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_NXP_SET_SCO_DATA_PATH);
+    buffer[2] = 1;
+    buffer[3] = voice_path;
+    return 4;
+}
+
+/**
+ * @brief Encode hci_nxp_write_pcm_i2s_settings command
+ * @param buffer for HCI Command packet with 4 bytes
+ * @param settings
+ * @return size of HCI Command packet
+ * @note: format '1'
+ */
+static inline uint16_t hci_cmd_nxp_write_pcm_i2s_settings_encode(uint8_t * buffer, uint8_t settings){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_NXP_WRITE_PCM_I2S_SETTINGS);
+    buffer[2] = 1;
+    buffer[3] = settings;
+    return 4;
+}
+
+/**
+ * @brief Encode hci_nxp_write_pcm_i2s_sync_settings command
+ * @param buffer for HCI Command packet with 6 bytes
+ * @param sync_settings_1
+ * @param sync_settings_2
+ * @return size of HCI Command packet
+ * @note: format '12'
+ */
+static inline uint16_t hci_cmd_nxp_write_pcm_i2s_sync_settings_encode(uint8_t * buffer, uint8_t sync_settings_1, uint16_t sync_settings_2){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_NXP_WRITE_PCM_I2S_SYNC_SETTINGS);
+    buffer[2] = 3;
+    buffer[3] = sync_settings_1;
+    little_endian_store_16(buffer, 4, sync_settings_2);
+    return 6;
+}
+
+/**
+ * @brief Encode hci_nxp_write_pcm_link_settings command
+ * @param buffer for HCI Command packet with 5 bytes
+ * @param settings
+ * @return size of HCI Command packet
+ * @note: format '2'
+ */
+static inline uint16_t hci_cmd_nxp_write_pcm_link_settings_encode(uint8_t * buffer, uint16_t settings){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_NXP_WRITE_PCM_LINK_SETTINGS);
+    buffer[2] = 2;
+    little_endian_store_16(buffer, 3, settings);
+    return 5;
+}
+
+/**
+ * @brief Encode hci_nxp_set_wbs_connection command
+ * @param buffer for HCI Command packet with 4 bytes
+ * @param next_connection_wbs
+ * @return size of HCI Command packet
+ * @note: format '1'
+ */
+static inline uint16_t hci_cmd_nxp_set_wbs_connection_encode(uint8_t * buffer, uint8_t next_connection_wbs){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_NXP_SET_WBS_CONNECTION);
+    buffer[2] = 1;
+    buffer[3] = next_connection_wbs;
+    return 4;
+}
+
+/**
+ * @brief Encode hci_nxp_host_pcm_i2s_audio_config command
+ * @param buffer for HCI Command packet with 9 bytes
+ * @param action
+ * @param operation
+ * @param sco_handle_1
+ * @param sco_handle_2
+ * @return size of HCI Command packet
+ * @note: format '11HH'
+ */
+static inline uint16_t hci_cmd_nxp_host_pcm_i2s_audio_config_encode(uint8_t * buffer, uint8_t action, uint8_t operation, hci_con_handle_t sco_handle_1, hci_con_handle_t sco_handle_2){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_NXP_HOST_PCM_I2S_AUDIO_CONFIG);
+    buffer[2] = 6;
+    buffer[3] = action;
+    buffer[4] = operation;
+    little_endian_store_16(buffer, 5, sco_handle_1);
+    little_endian_store_16(buffer, 7, sco_handle_2);
+    return 9;
+}
+
+/**
+ * @brief Encode hci_nxp_host_pcm_i2s_control_enable command
+ * @param buffer for HCI Command packet with 4 bytes
+ * @param action
+ * @return size of HCI Command packet
+ * @note: format '1'
+ */
+static inline uint16_t hci_cmd_nxp_host_pcm_i2s_control_enable_encode(uint8_t * buffer, uint8_t action){
+    little_endian_store_16(buffer, 0, HCI_OPCODE_HCI_NXP_HOST_PCM_I2S_CONTROL_ENABLE);
+    buffer[2] = 1;
+    buffer[3] = action;
+    return 4;
+}
+
+
+/* API_END */
+
+#if defined __cplusplus
+}
+#endif
+
+#endif // HCI_CMD_ENCODER_H
@@ -47,12 +47,49 @@
 #include "btstack_debug.h"
 #include "btstack_bool.h"
 #include "btstack_util.h"
+#include "l2cap_signaling.h"
 
 static const hci_dump_t * hci_dump_implementation;
 static int  max_nr_packets;
 static int  nr_packets;
 static bool packet_log_enabled;
 
+#ifdef ENABLE_HCI_DUMP_FILTER
+
+// max number of connection handles, L2CAP CIDs and PSMs that can be filtered
+#ifndef HCI_DUMP_FILTER_MAX_ENTRIES
+#define HCI_DUMP_FILTER_MAX_ENTRIES 4
+#endif
+
+// max number of L2CAP channels for filtered PSMs that are tracked
+#ifndef HCI_DUMP_FILTER_MAX_CHANNELS
+#define HCI_DUMP_FILTER_MAX_CHANNELS 8
+#endif
+
+// L2CAP channel of filtered PSM, dynamic CIDs are learned from L2CAP signaling
+typedef struct {
+    hci_con_handle_t con_handle;
+    uint16_t local_cid;
+    uint16_t remote_cid;
+    // identifier of connection request, used to match response
+    uint8_t  identifier;
+} hci_dump_filter_channel_t;
+
+// filters are stored as disabled items, all packets are logged by default
+static uint8_t                   hci_dump_filter_packet_types_disabled;
+static uint8_t                   hci_dump_filter_events_disabled[32];
+static hci_con_handle_t          hci_dump_filter_con_handles[HCI_DUMP_FILTER_MAX_ENTRIES];
+static uint16_t                  hci_dump_filter_cids[HCI_DUMP_FILTER_MAX_ENTRIES];
+static uint16_t                  hci_dump_filter_psms[HCI_DUMP_FILTER_MAX_ENTRIES];
+static hci_dump_filter_channel_t hci_dump_filter_channels[HCI_DUMP_FILTER_MAX_CHANNELS];
+static uint8_t                   hci_dump_filter_channels_next;
+// connections where the continuation fragments of the current L2CAP PDU are dropped
+static hci_con_handle_t          hci_dump_filter_dropped_pdus[HCI_DUMP_FILTER_MAX_ENTRIES];
+static uint16_t                  hci_dump_filter_max_payload_len;
+static uint16_t                  hci_dump_filter_sampling_interval;
+static uint16_t                  hci_dump_filter_sampling_counter;
+#endif
+
 // levels: debug, info, error
 static bool log_level_enabled[3] = { 1, 1, 1};
 
@@ -63,11 +100,294 @@ static bool hci_dump_log_level_active(int log_level){
     return log_level_enabled[log_level];
 }
 
+#ifdef ENABLE_HCI_DUMP_FILTER
+static void hci_dump_filter_reset(void){
+    uint8_t i;
+    hci_dump_filter_packet_types_disabled = 0;
+    memset(hci_dump_filter_events_disabled, 0, sizeof(hci_dump_filter_events_disabled));
+    for (i = 0; i < HCI_DUMP_FILTER_MAX_ENTRIES; i++){
+        hci_dump_filter_con_handles[i] = HCI_CON_HANDLE_INVALID;
+        hci_dump_filter_dropped_pdus[i] = HCI_CON_HANDLE_INVALID;
+        hci_dump_filter_cids[i] = 0;
+        hci_dump_filter_psms[i] = 0;
+    }
+    memset(hci_dump_filter_channels, 0, sizeof(hci_dump_filter_channels));
+    hci_dump_filter_channels_next = 0;
+    hci_dump_filter_max_payload_len = 0xffff;
+    hci_dump_filter_sampling_interval = 0;
+    hci_dump_filter_sampling_counter = 0;
+}
+
+// add or remove value from list, 'unused' marks free entries
+static void hci_dump_filter_list_update(uint16_t * list, uint16_t value, uint16_t unused, bool add){
+    uint8_t i;
+    for (i = 0; i < HCI_DUMP_FILTER_MAX_ENTRIES; i++){
+        if (list[i] == value){
+            if (!add){
+                list[i] = unused;
+            }
+            return;
+        }
+    }
+    if (!add) return;
+    for (i = 0; i < HCI_DUMP_FILTER_MAX_ENTRIES; i++){
+        if (list[i] == unused){
+            list[i] = value;
+            return;
+        }
+    }
+    log_error("hci_dump filter: no space for 0x%04x", value);
+}
+
+static bool hci_dump_filter_list_contains(const uint16_t * list, uint16_t value){
+    uint8_t i;
+    for (i = 0; i < HCI_DUMP_FILTER_MAX_ENTRIES; i++){
+        if (list[i] == value) return true;
+    }
+    return false;
+}
+
+void hci_dump_filter_enable_packet_type(uint8_t packet_type, bool enabled){
+    if (packet_type >= 8) return;
+    if (enabled){
+        hci_dump_filter_packet_types_disabled &= ~(1u << packet_type);
+    } else {
+        hci_dump_filter_packet_types_disabled |= 1u << packet_type;
+    }
+}
+
+void hci_dump_filter_enable_event(uint8_t event_code, bool enabled){
+    if (enabled){
+        hci_dump_filter_events_disabled[event_code >> 3] &= ~(1u << (event_code & 7u));
+    } else {
+        hci_dump_filter_events_disabled[event_code >> 3] |= 1u << (event_code & 7u);
+    }
+}
+
+void hci_dump_filter_enable_con_handle(hci_con_handle_t con_handle, bool enabled){
+    hci_dump_filter_list_update(hci_dump_filter_con_handles, con_handle, HCI_CON_HANDLE_INVALID, !enabled);
+}
+
+void hci_dump_filter_enable_l2cap_cid(uint16_t cid, bool enabled){
+    hci_dump_filter_list_update(hci_dump_filter_cids, cid, 0, !enabled);
+}
+
+void hci_dump_filter_enable_l2cap_psm(uint16_t psm, bool enabled){
+    hci_dump_filter_list_update(hci_dump_filter_psms, psm, 0, !enabled);
+}
+
+void hci_dump_filter_set_max_payload_len(uint16_t max_payload_len){
+    hci_dump_filter_max_payload_len = max_payload_len;
+}
+
+void hci_dump_filter_set_sampling_interval(uint16_t interval){
+    hci_dump_filter_sampling_interval = interval;
+    hci_dump_filter_sampling_counter = 0;
+}
+
+// incoming packets are sent to local cid, outgoing packets to remote cid
+static hci_dump_filter_channel_t * hci_dump_filter_channel_for_cid(hci_con_handle_t con_handle, uint8_t in, uint16_t cid){
+    if (cid == 0) return NULL;
+    uint8_t i;
+    for (i = 0; i < HCI_DUMP_FILTER_MAX_CHANNELS; i++){
+        hci_dump_filter_channel_t * channel = &hci_dump_filter_channels[i];
+        uint16_t channel_cid = in ? channel->local_cid : channel->remote_cid;
+        if ((channel_cid == cid) && (channel->con_handle == con_handle)) return channel;
+    }
+    return NULL;
+}
+
+// pending channel that waits for the cid of the responder
+static hci_dump_filter_channel_t * hci_dump_filter_channel_for_response(hci_con_handle_t con_handle, uint8_t in, uint8_t identifier){
+    uint8_t i;
+    for (i = 0; i < HCI_DUMP_FILTER_MAX_CHANNELS; i++){
+        hci_dump_filter_channel_t * channel = &hci_dump_filter_channels[i];
+        if (channel->con_handle != con_handle) continue;
+        if (channel->identifier != identifier) continue;
+        if (in){
+            if ((channel->local_cid != 0) && (channel->remote_cid == 0)) return channel;
+        } else {
+            if ((channel->remote_cid != 0) && (channel->local_cid == 0)) return channel;
+        }
+    }
+    return NULL;
+}
+
+// oldest entry gets replaced if all are in use
+static void hci_dump_filter_channel_add(hci_con_handle_t con_handle, uint8_t in, uint16_t source_cid, uint8_t identifier){
+    if (source_cid == 0) return;
+    // source cid of incoming request is remote cid
+    if (hci_dump_filter_channel_for_cid(con_handle, in ? 0 : 1, source_cid) != NULL) return;
+    hci_dump_filter_channel_t * channel = &hci_dump_filter_channels[hci_dump_filter_channels_next];
+    hci_dump_filter_channels_next = (hci_dump_filter_channels_next + 1u) % HCI_DUMP_FILTER_MAX_CHANNELS;
+    channel->con_handle = con_handle;
+    channel->local_cid  = in ? 0 : source_cid;
+    channel->remote_cid = in ? source_cid : 0;
+    channel->identifier = identifier;
+}
+
+static void hci_dump_filter_channel_set_destination_cid(hci_con_handle_t con_handle, uint8_t in, uint8_t identifier, uint16_t destination_cid){
+    // refused or pending
+    if (destination_cid == 0) return;
+    hci_dump_filter_channel_t * channel = hci_dump_filter_channel_for_response(con_handle, in, identifier);
+    if (channel == NULL) return;
+    // destination cid of incoming response is remote cid
+    if (in){
+        channel->remote_cid = destination_cid;
+    } else {
+        channel->local_cid = destination_cid;
+    }
+}
+
+static void hci_dump_filter_channels_remove_for_con_handle(hci_con_handle_t con_handle){
+    uint8_t i;
+    for (i = 0; i < HCI_DUMP_FILTER_MAX_CHANNELS; i++){
+        if (hci_dump_filter_channels[i].con_handle == con_handle){
+            hci_dump_filter_channels[i].local_cid  = 0;
+            hci_dump_filter_channels[i].remote_cid = 0;
+        }
+    }
+}
+
+// track channels for filtered PSMs, only the first command of a signaling packet is inspected
+static void hci_dump_filter_handle_signaling(hci_con_handle_t con_handle, uint8_t in, const uint8_t * command, uint16_t size){
+    if (size < 8) return;
+    uint8_t  code       = command[0];
+    uint8_t  identifier = command[1];
+    uint16_t command_len = btstack_min(little_endian_read_16(command, 2), size - 4u);
+    uint16_t psm;
+    uint16_t pos;
+    hci_dump_filter_channel_t * channel;
+    switch (code){
+        case CONNECTION_REQUEST:
+        case LE_CREDIT_BASED_CONNECTION_REQUEST:
+            // PSM, Source CID
+            psm = little_endian_read_16(command, 4);
+            if (!hci_dump_filter_list_contains(hci_dump_filter_psms, psm)) break;
+            hci_dump_filter_channel_add(con_handle, in, little_endian_read_16(command, 6), identifier);
+            break;
+        case CONNECTION_RESPONSE:
+        case LE_CREDIT_BASED_CONNECTION_RESPONSE:
+            // Destination CID of responder
+            hci_dump_filter_channel_set_destination_cid(con_handle, in, identifier, little_endian_read_16(command, 4));
+            break;
+        case L2CAP_CREDIT_BASED_CONNECTION_REQUEST:
+            // SPSM, MTU, MPS, Initial Credits, Source CIDs
+            psm = little_endian_read_16(command, 4);
+            if (!hci_dump_filter_list_contains(hci_dump_filter_psms, psm)) break;
+            for (pos = 12; (pos + 2u) <= (4u + command_len); pos += 2u){
+                hci_dump_filter_channel_add(con_handle, in, little_endian_read_16(command, pos), identifier);
+            }
+            break;
+        case L2CAP_CREDIT_BASED_CONNECTION_RESPONSE:
+            // MTU, MPS, Initial Credits, Result, Destination CIDs in order of Source CIDs in request
+            for (pos = 12; (pos + 2u) <= (4u + command_len); pos += 2u){
+                hci_dump_filter_channel_set_destination_cid(con_handle, in, identifier, little_endian_read_16(command, pos));
+            }
+            break;
+        case DISCONNECTION_REQUEST:
+            // Destination CID, Source CID - local cid is destination cid of incoming request
+            channel = hci_dump_filter_channel_for_cid(con_handle, 1, little_endian_read_16(command, in ? 4 : 6));
+            if (channel != NULL){
+                channel->local_cid  = 0;
+                channel->remote_cid = 0;
+            }
+            break;
+        default:
+            break;
+    }
+}
+
+static bool hci_dump_filter_sample(void){
+    if (hci_dump_filter_sampling_interval <= 1) return true;
+    bool log_packet = hci_dump_filter_sampling_counter == 0;
+    hci_dump_filter_sampling_counter++;
+    if (hci_dump_filter_sampling_counter >= hci_dump_filter_sampling_interval){
+        hci_dump_filter_sampling_counter = 0;
+    }
+    return log_packet;
+}
+
+static bool hci_dump_filter_acl_packet(uint8_t in, const uint8_t * packet, uint16_t len){
+    if (len < 4) return true;
+    hci_con_handle_t con_handle = little_endian_read_16(packet, 0) & 0x0fffu;
+    if (hci_dump_filter_list_contains(hci_dump_filter_con_handles, con_handle)) return false;
+
+    // continuation fragment
+    uint8_t pb = (packet[1] >> 4) & 3u;
+    bool pdu_dropped = hci_dump_filter_list_contains(hci_dump_filter_dropped_pdus, con_handle);
+    if (pb == 1){
+        return !pdu_dropped;
+    }
+    if (pdu_dropped){
+        hci_dump_filter_list_update(hci_dump_filter_dropped_pdus, con_handle, HCI_CON_HANDLE_INVALID, false);
+    }
+
+    // first fragment with L2CAP header
+    if (len < 8) return true;
+    uint16_t cid = little_endian_read_16(packet, 6);
+    if ((cid == L2CAP_CID_SIGNALING) || (cid == L2CAP_CID_SIGNALING_LE)){
+        hci_dump_filter_handle_signaling(con_handle, in, &packet[8], len - 8u);
+        return true;
+    }
+    bool log_packet = true;
+    if (hci_dump_filter_list_contains(hci_dump_filter_cids, cid)) {
+        log_packet = false;
+    } else if (hci_dump_filter_channel_for_cid(con_handle, in, cid) != NULL){
+        log_packet = false;
+    } else {
+        log_packet = hci_dump_filter_sample();
+    }
+    if (!log_packet){
+        hci_dump_filter_list_update(hci_dump_filter_dropped_pdus, con_handle, HCI_CON_HANDLE_INVALID, true);
+    }
+    return log_packet;
+}
+
+// returns number of bytes to log, 0 if packet is dropped
+static uint16_t hci_dump_filter_packet(uint8_t packet_type, uint8_t in, const uint8_t * packet, uint16_t len){
+    if ((packet_type < 8u) && ((hci_dump_filter_packet_types_disabled & (1u << packet_type)) != 0u)) return 0;
+
+    uint16_t header_len;
+    switch (packet_type){
+        case HCI_EVENT_PACKET:
+            if (len < 2) return len;
+            if ((hci_dump_filter_events_disabled[packet[0] >> 3] & (1u << (packet[0] & 7u))) != 0u) return 0;
+            if ((packet[0] == HCI_EVENT_DISCONNECTION_COMPLETE) && (len >= 5)){
+                hci_dump_filter_channels_remove_for_con_handle(little_endian_read_16(packet, 3) & 0x0fffu);
+            }
+            return len;
+        case HCI_ACL_DATA_PACKET:
+            if (!hci_dump_filter_acl_packet(in, packet, len)) return 0;
+            header_len = 4;
+            break;
+        case HCI_SCO_DATA_PACKET:
+        case HCI_ISO_DATA_PACKET:
+            if (len < 2) return len;
+            if (hci_dump_filter_list_contains(hci_dump_filter_con_handles, little_endian_read_16(packet, 0) & 0x0fffu)) return 0;
+            if (!hci_dump_filter_sample()) return 0;
+            header_len = (packet_type == HCI_SCO_DATA_PACKET) ? 3 : 4;
+            break;
+        default:
+            return len;
+    }
+
+    // truncate payload of data packets
+    if (len > header_len){
+        len = header_len + btstack_min(len - header_len, hci_dump_filter_max_payload_len);
+    }
+    return len;
+}
+#endif
+
 void hci_dump_init(const hci_dump_t * hci_dump_impl){
     max_nr_packets = -1;
     nr_packets = 0;
     hci_dump_implementation = hci_dump_impl;
     packet_log_enabled = true;
+#ifdef ENABLE_HCI_DUMP_FILTER
+    hci_dump_filter_reset();
+#endif
 }
 
 void hci_dump_set_max_packets(int packets){
@@ -86,6 +406,14 @@ void hci_dump_packet(uint8_t packet_type, uint8_t in, uint8_t *packet, uint16_t
         return;
     }
 
+    uint16_t original_len = len;
+#ifdef ENABLE_HCI_DUMP_FILTER
+    len = hci_dump_filter_packet(packet_type, in, packet, len);
+    if (len == 0){
+        return;
+    }
+#endif
+
     if (max_nr_packets > 0){
         if ((nr_packets >= max_nr_packets) && (hci_dump_implementation->reset != NULL)) {
             nr_packets = 0;
@@ -93,7 +421,11 @@ void hci_dump_packet(uint8_t packet_type, uint8_t in, uint8_t *packet, uint16_t
         }
         nr_packets++;
     }
-    (*hci_dump_implementation->log_packet)(packet_type, in, packet, len);
+    if ((len < original_len) && (hci_dump_implementation->log_truncated_packet != NULL)){
+        (*hci_dump_implementation->log_truncated_packet)(packet_type, in, packet, len, original_len);
+    } else {
+        (*hci_dump_implementation->log_packet)(packet_type, in, packet, len);
+    }
 }
 
 void hci_dump_log(int log_level, const char * format, ...){
@@ -169,6 +501,10 @@ void hci_dump_setup_header_bluez(uint8_t * buffer, uint32_t tv_sec, uint32_t tv_
 
 // From https://fte.com/webhelpii/hsu/Content/Technical_Information/BT_Snoop_File_Format.htm
 void hci_dump_setup_header_btsnoop(uint8_t * buffer, uint32_t ts_usec_high, uint32_t ts_usec_low, uint32_t cumulative_drops, uint8_t packet_type, uint8_t in, uint16_t len) {
+    hci_dump_setup_header_btsnoop_truncated(buffer, ts_usec_high, ts_usec_low, cumulative_drops, packet_type, in, len, len);
+}
+
+void hci_dump_setup_header_btsnoop_truncated(uint8_t * buffer, uint32_t ts_usec_high, uint32_t ts_usec_low, uint32_t cumulative_drops, uint8_t packet_type, uint8_t in, uint16_t len, uint16_t original_len) {
     uint32_t packet_flags = 0;
     if (in){
         packet_flags |= 1;
@@ -180,7 +516,7 @@ void hci_dump_setup_header_btsnoop(uint8_t * buffer, uint32_t ts_usec_high, uint
         default:
             break;
     }
-    big_endian_store_32(buffer,  0, len);               // Original Length
+    big_endian_store_32(buffer,  0, original_len);      // Original Length
     big_endian_store_32(buffer,  4, len);               // Included Length
     big_endian_store_32(buffer,  8, packet_flags);      // Packet Flags
     big_endian_store_32(buffer, 12, cumulative_drops);  // Cumulativ Drops
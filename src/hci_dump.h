@@ -45,9 +45,12 @@
 #ifndef HCI_DUMP_H
 #define HCI_DUMP_H
 
+#include "btstack_config.h"
+
 #include <stdint.h>
 #include <stdarg.h>       // for va_list
 #include "btstack_bool.h"
+#include "bluetooth.h"
 
 #ifdef __AVR__
 #include <avr/pgmspace.h>
@@ -88,6 +91,8 @@ typedef struct {
     // log message - AVR
     void (*log_message_P)(int log_level, PGM_P * format, va_list argptr);
 #endif
+    // log packet truncated by hci dump filter, optional - log_packet is used if NULL
+    void (*log_truncated_packet)(uint8_t packet_type, uint8_t in, uint8_t *packet, uint16_t len, uint16_t original_len);
 } hci_dump_t;
 
 /**
@@ -112,6 +117,63 @@ void hci_dump_enable_log_level(int log_level, int enable);
  */
 void hci_dump_set_max_packets(int packets); // -1 for unlimited
 
+#ifdef ENABLE_HCI_DUMP_FILTER
+/**
+ * @brief Enable/disable logging of packet type, e.g. HCI_SCO_DATA_PACKET
+ * @note requires ENABLE_HCI_DUMP_FILTER, all filter settings are reset by hci_dump_init
+ * @param packet_type
+ * @param enabled default: true
+ */
+void hci_dump_filter_enable_packet_type(uint8_t packet_type, bool enabled);
+
+/**
+ * @brief Enable/disable logging of HCI Event
+ * @note requires ENABLE_HCI_DUMP_FILTER
+ * @param event_code
+ * @param enabled default: true
+ */
+void hci_dump_filter_enable_event(uint8_t event_code, bool enabled);
+
+/**
+ * @brief Enable/disable logging of ACL, SCO and ISO packets for connection handle
+ * @note requires ENABLE_HCI_DUMP_FILTER
+ * @param con_handle
+ * @param enabled default: true
+ */
+void hci_dump_filter_enable_con_handle(hci_con_handle_t con_handle, bool enabled);
+
+/**
+ * @brief Enable/disable logging of L2CAP packets with given channel id on all connections
+ * @note requires ENABLE_HCI_DUMP_FILTER
+ * @param cid
+ * @param enabled default: true
+ */
+void hci_dump_filter_enable_l2cap_cid(uint16_t cid, bool enabled);
+
+/**
+ * @brief Enable/disable logging of L2CAP channels for PSM. Channels are detected from L2CAP signaling,
+ *        including LE and enhanced credit-based connections
+ * @note requires ENABLE_HCI_DUMP_FILTER
+ * @param psm
+ * @param enabled default: true
+ */
+void hci_dump_filter_enable_l2cap_psm(uint16_t psm, bool enabled);
+
+/**
+ * @brief Truncate payload of ACL, SCO and ISO packets
+ * @note requires ENABLE_HCI_DUMP_FILTER, original length is provided via log_truncated_packet if supported by hci_dump_t implementation
+ * @param max_payload_len default: 0xffff
+ */
+void hci_dump_filter_set_max_payload_len(uint16_t max_payload_len);
+
+/**
+ * @brief Log only every n-th SCO, ISO and L2CAP data packet. L2CAP signaling is always logged
+ * @note requires ENABLE_HCI_DUMP_FILTER
+ * @param interval, 0 or 1 logs all packets
+ */
+void hci_dump_filter_set_sampling_interval(uint16_t interval);
+#endif
+
 /**
  * @brief Dump Packet
  * @param packet_type
@@ -187,6 +249,19 @@ void hci_dump_setup_header_bluez(uint8_t * buffer, uint32_t tv_sec, uint32_t tv_
  */
 void hci_dump_setup_header_btsnoop(uint8_t * buffer, uint32_t ts_usec_high, uint32_t ts_usec_low, uint32_t cumulative_drops, uint8_t packet_type, uint8_t in, uint16_t len);
 
+/**
+ * @brief Setup header for BT Snoop format for truncated packet
+ * @param buffer
+ * @param ts_usec_high upper 32-bit of 64-bit microsecond timestamp
+ * @param ts_usec_low  lower 2-bit of 64-bit microsecond timestamp
+ * @param cumulative_drops since last packet was recorded
+ * @param packet_type
+ * @param in
+ * @param len included in log
+ * @param original_len of packet
+ */
+void hci_dump_setup_header_btsnoop_truncated(uint8_t * buffer, uint32_t ts_usec_high, uint32_t ts_usec_low, uint32_t cumulative_drops, uint8_t packet_type, uint8_t in, uint16_t len, uint16_t original_len);
+
 /* API_END */
 
 
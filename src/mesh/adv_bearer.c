@@ -51,6 +51,11 @@
 #include "btstack_run_loop.h"
 #include "btstack_event.h"
 #include "gap.h"
+#include "hci.h"
+
+#if defined(ENABLE_MESH_ADV_BEARER_EXTENDED_ADVERTISING) && !defined(ENABLE_LE_EXTENDED_ADVERTISING)
+#error "ENABLE_MESH_ADV_BEARER_EXTENDED_ADVERTISING requires ENABLE_LE_EXTENDED_ADVERTISING"
+#endif
 
 // issue: gap adv control in hci might be slow to update advertisements fast enough. for now add 10 ms extra to ADVERTISING_INTERVAL_CONNECTABLE_MIN_MS
 // todo: track adv enable/disable events before next step
@@ -63,6 +68,9 @@
 #define ADVERTISING_INTERVAL_NONCONNECTABLE_MIN 0xa0
 #define ADVERTISING_INTERVAL_NONCONNECTABLE_MIN_MS (ADVERTISING_INTERVAL_NONCONNECTABLE_MIN * 625 / 1000)
 
+// min advertising interval 20 ms for non-connectable advertisements (5.0+ controllers)
+#define ADVERTISING_INTERVAL_NONCONNECTABLE_EXTENDED_MIN 0x20
+
 // num adv bearer message types
 #define NUM_TYPES 3
 
@@ -82,6 +90,7 @@ typedef enum {
 
 // prototypes
 static void adv_bearer_run(void);
+static void adv_bearer_set_timeout(uint32_t time_ms);
 
 // globals
 
@@ -117,6 +126,46 @@ static uint8_t   gap_filter_policy  = 0;
 
 static btstack_linked_list_t gap_connectable_advertisements;
 
+#ifdef ENABLE_MESH_ADV_BEARER_EXTENDED_ADVERTISING
+// with extended advertising, each message type and the connectable advertisements get their own advertising set
+#define ADV_SET_GAP  NUM_TYPES
+#define NUM_ADV_SETS (NUM_TYPES + 1)
+
+typedef struct {
+    le_advertising_set_t storage;
+    uint8_t  buffer[31];
+    uint8_t  buffer_length;
+    uint8_t  handle;
+    bool     active;
+} adv_bearer_advertising_set_t;
+
+static bool adv_bearer_extended_advertising;
+static adv_bearer_advertising_set_t adv_bearer_advertising_sets[NUM_ADV_SETS];
+static adv_bearer_connectable_advertisement_data_item_t * gap_adv_current_item;
+
+static void adv_bearer_extended_send(message_type_id_t type_id, const uint8_t * data, uint16_t data_len, uint8_t type, uint8_t count, uint16_t interval);
+static void adv_bearer_extended_set_terminated(uint8_t advertising_handle);
+#endif
+
+static message_type_id_t adv_bearer_type_id_for_ad_type(uint8_t ad_type){
+    switch(ad_type){
+        case BLUETOOTH_DATA_TYPE_MESH_MESSAGE:
+            return MESH_NETWORK_ID;
+        case BLUETOOTH_DATA_TYPE_MESH_BEACON:
+            return MESH_BEACON_ID;
+        case BLUETOOTH_DATA_TYPE_PB_ADV:
+            return PB_ADV_ID;
+        default:
+            return INVALID_ID;
+    }
+}
+
+static void adv_bearer_emit_can_send_now(void);
+#ifdef ENABLE_MESH_ADV_BEARER_EXTENDED_ADVERTISING
+static bool adv_bearer_extended_setup(void);
+static void adv_bearer_extended_reset(void);
+#endif
+
 // dispatch advertising events
 static void adv_bearer_packet_handler (uint8_t packet_type, uint16_t channel, uint8_t *packet, uint16_t size){
     const uint8_t * data;
@@ -127,28 +176,41 @@ static void adv_bearer_packet_handler (uint8_t packet_type, uint16_t channel, ui
         case HCI_EVENT_PACKET:
             switch(packet[0]){
                 case BTSTACK_EVENT_STATE:
+#ifdef ENABLE_MESH_ADV_BEARER_EXTENDED_ADVERTISING
+                    if (btstack_event_state_get_state(packet) == HCI_STATE_OFF){
+                        adv_bearer_extended_reset();
+                        break;
+                    }
+#endif
                     if (btstack_event_state_get_state(packet) != HCI_STATE_WORKING) break;
+#ifdef ENABLE_MESH_ADV_BEARER_EXTENDED_ADVERTISING
+                    if (hci_le_extended_advertising_supported() && (adv_bearer_extended_advertising == false)){
+                        adv_bearer_extended_advertising = adv_bearer_extended_setup();
+                        if (adv_bearer_extended_advertising && (adv_bearer_count > 0)){
+                            // hand over message queued before HCI was ready
+                            adv_bearer_extended_send(adv_bearer_type_id_for_ad_type(adv_bearer_buffer[1]), &adv_bearer_buffer[2],
+                                                     adv_bearer_buffer_length - 2, adv_bearer_buffer[1], adv_bearer_count, adv_bearer_interval);
+                            adv_bearer_count = 0;
+                        }
+                        adv_bearer_emit_can_send_now();
+                    }
+#endif
                     adv_bearer_run();
                     break;
+#ifdef ENABLE_MESH_ADV_BEARER_EXTENDED_ADVERTISING
+                case HCI_EVENT_LE_META:
+                    if (hci_event_le_meta_get_subevent_code(packet) != HCI_SUBEVENT_LE_ADVERTISING_SET_TERMINATED) break;
+                    adv_bearer_extended_set_terminated(hci_subevent_le_advertising_set_terminated_get_advertising_handle(packet));
+                    break;
+#endif
                 case GAP_EVENT_ADVERTISING_REPORT:
                     // only non-connectable ind
                     if (gap_event_advertising_report_get_advertising_event_type(packet) != 0x03) break;
                     data = gap_event_advertising_report_get_data(packet);
                     data_len = gap_event_advertising_report_get_data_length(packet);
 
-                    switch(data[1]){
-                        case BLUETOOTH_DATA_TYPE_MESH_MESSAGE:
-                            type_id = MESH_NETWORK_ID;
-                            break;
-                        case BLUETOOTH_DATA_TYPE_MESH_BEACON:
-                            type_id = MESH_BEACON_ID;
-                            break;
-                        case BLUETOOTH_DATA_TYPE_PB_ADV:
-                            type_id = PB_ADV_ID;
-                            break;
-                        default:
-                            return;
-                    }
+                    type_id = adv_bearer_type_id_for_ad_type(data[1]);
+                    if (type_id == INVALID_ID) return;
                     if (client_callbacks[type_id]){
                         switch (type_id){
                             case PB_ADV_ID:
@@ -174,9 +236,33 @@ static void adv_bearer_packet_handler (uint8_t packet_type, uint16_t channel, ui
     }
 }
 
+static void adv_bearer_emit_can_send_now_for_type(message_type_id_t type_id){
+    request_can_send_now[type_id] = 0;
+    // emit can send now
+    log_debug("can send now");
+    uint8_t event[3];
+    event[0] = HCI_EVENT_MESH_META;
+    event[1] = 1;
+    event[2] = MESH_SUBEVENT_CAN_SEND_NOW;
+    (*client_callbacks[type_id])(HCI_EVENT_PACKET, 0, &event[0], sizeof(event));
+}
+
 // round-robin
 static void adv_bearer_emit_can_send_now(void){
 
+#ifdef ENABLE_MESH_ADV_BEARER_EXTENDED_ADVERTISING
+    if (adv_bearer_extended_advertising){
+        // message types are sent independently
+        int type_id;
+        for (type_id = 0; type_id < NUM_TYPES; type_id++){
+            if (request_can_send_now[type_id] == 0) continue;
+            if (adv_bearer_advertising_sets[type_id].active) continue;
+            adv_bearer_emit_can_send_now_for_type((message_type_id_t) type_id);
+        }
+        return;
+    }
+#endif
+
     if (adv_bearer_count > 0) return;
 
     int countdown = NUM_TYPES;
@@ -186,19 +272,172 @@ static void adv_bearer_emit_can_send_now(void){
             last_sender = 0;
         }
         if (request_can_send_now[last_sender]){
-            request_can_send_now[last_sender] = 0;
-            // emit can send now
-            log_debug("can send now");
-            uint8_t event[3];
-            event[0] = HCI_EVENT_MESH_META;
-            event[1] = 1;
-            event[2] = MESH_SUBEVENT_CAN_SEND_NOW;
-            (*client_callbacks[last_sender])(HCI_EVENT_PACKET, 0, &event[0], sizeof(event));
+            adv_bearer_emit_can_send_now_for_type((message_type_id_t) last_sender);
             return;
         }
     }
 }
 
+#ifdef ENABLE_MESH_ADV_BEARER_EXTENDED_ADVERTISING
+static void adv_bearer_extended_gap_params(le_extended_advertising_parameters_t * params){
+    // map advertisement type to legacy advertising event properties
+    const uint16_t mapping[] = { 0b00010011, 0b00010101, 0b00011101, 0b00010010, 0b00010000};
+    params->advertising_event_properties = mapping[0];
+    if (gap_adv_type < (sizeof(mapping)/sizeof(uint16_t))){
+        params->advertising_event_properties = mapping[gap_adv_type];
+    }
+    params->primary_advertising_interval_min = gap_adv_int_min;
+    params->primary_advertising_interval_max = gap_adv_int_max;
+    params->primary_advertising_channel_map  = gap_channel_map;
+    params->peer_address_type = (bd_addr_type_t) gap_direct_address_typ;
+    (void)memcpy(params->peer_address, gap_direct_address, 6);
+    params->advertising_filter_policy = gap_filter_policy;
+}
+
+static bool adv_bearer_extended_setup(void){
+    uint8_t own_address_type;
+    bd_addr_t own_address;
+    gap_le_get_own_address(&own_address_type, own_address);
+
+    le_extended_advertising_parameters_t params;
+    memset(&params, 0, sizeof(params));
+    params.own_address_type          = (bd_addr_type_t) own_address_type;
+    params.advertising_tx_power      = 0x7f; // no preference
+    params.primary_advertising_phy   = 0x01; // LE 1M
+    params.secondary_advertising_phy = 0x01;
+
+    // mesh messages use legacy ADV_NONCONN_IND PDUs
+    uint8_t i;
+    for (i = 0; i < NUM_ADV_SETS; i++){
+        adv_bearer_advertising_set_t * adv_set = &adv_bearer_advertising_sets[i];
+        if (i == ADV_SET_GAP){
+            adv_bearer_extended_gap_params(&params);
+        } else {
+            params.advertising_event_properties = 0b00010000;
+            params.primary_advertising_interval_min = ADVERTISING_INTERVAL_NONCONNECTABLE_EXTENDED_MIN;
+            params.primary_advertising_interval_max = ADVERTISING_INTERVAL_NONCONNECTABLE_EXTENDED_MIN;
+            params.primary_advertising_channel_map  = 0x07;
+        }
+        uint8_t status = gap_extended_advertising_setup(&adv_set->storage, &params, &adv_set->handle);
+        if (status != ERROR_CODE_SUCCESS){
+            log_error("Setup of advertising set %u failed, status 0x%02x - use legacy advertising", i, status);
+            while (i > 0){
+                i--;
+                gap_extended_advertising_remove(adv_bearer_advertising_sets[i].handle);
+            }
+            return false;
+        }
+        if (own_address_type != BD_ADDR_TYPE_LE_PUBLIC){
+            gap_extended_advertising_set_random_address(adv_set->handle, own_address);
+        }
+        adv_set->active = false;
+    }
+    log_info("Using %u advertising sets", NUM_ADV_SETS);
+    return true;
+}
+
+// Controller drops advertising sets on power off, set up again on next HCI_STATE_WORKING
+static void adv_bearer_extended_reset(void){
+    if (adv_bearer_extended_advertising == false) return;
+    adv_bearer_extended_advertising = false;
+    if (adv_timer_active){
+        btstack_run_loop_remove_timer(&adv_timer);
+        adv_timer_active = 0;
+    }
+    gap_adv_current_item = NULL;
+    uint8_t i;
+    for (i = 0; i < NUM_ADV_SETS; i++){
+        gap_extended_advertising_remove(adv_bearer_advertising_sets[i].handle);
+        adv_bearer_advertising_sets[i].active = false;
+    }
+}
+
+static void adv_bearer_extended_send(message_type_id_t type_id, const uint8_t * data, uint16_t data_len, uint8_t type, uint8_t count, uint16_t interval){
+    btstack_assert(type_id != INVALID_ID);
+    adv_bearer_advertising_set_t * adv_set = &adv_bearer_advertising_sets[type_id];
+    log_debug("adv bearer message, type 0x%x, set %u\n", type, adv_set->handle);
+
+    // prepare message
+    adv_set->buffer[0] = data_len+1;
+    adv_set->buffer[1] = type;
+    (void)memcpy(&adv_set->buffer[2], data, data_len);
+    adv_set->buffer_length = data_len + 2;
+
+    // update interval if needed, interval in ms -> 0.625 ms units
+    uint16_t adv_interval = btstack_max(interval * 8 / 5, ADVERTISING_INTERVAL_NONCONNECTABLE_EXTENDED_MIN);
+    le_extended_advertising_parameters_t params;
+    gap_extended_advertising_get_params(adv_set->handle, &params);
+    if (params.primary_advertising_interval_min != adv_interval){
+        params.primary_advertising_interval_min = adv_interval;
+        params.primary_advertising_interval_max = adv_interval;
+        gap_extended_advertising_set_params(adv_set->handle, &params);
+    }
+
+    // Controller repeats advertisement count times and reports completion with Advertising Set Terminated
+    gap_extended_advertising_set_adv_data(adv_set->handle, adv_set->buffer_length, adv_set->buffer);
+    gap_extended_advertising_start(adv_set->handle, 0, btstack_max(count, 1));
+    adv_set->active = true;
+}
+
+static void adv_bearer_extended_set_terminated(uint8_t advertising_handle){
+    uint8_t i;
+    for (i = 0; i < NUM_ADV_SETS; i++){
+        adv_bearer_advertising_set_t * adv_set = &adv_bearer_advertising_sets[i];
+        if (adv_set->handle != advertising_handle) continue;
+        adv_set->active = false;
+        if (i == ADV_SET_GAP){
+            // connectable advertisement restarted by next timeout
+            log_debug("Connectable advertising set terminated");
+        } else {
+            adv_bearer_emit_can_send_now();
+        }
+        return;
+    }
+}
+
+// connectable advertisements
+static void adv_bearer_extended_run(void){
+    adv_bearer_advertising_set_t * gap_set = &adv_bearer_advertising_sets[ADV_SET_GAP];
+    if (gap_advertising_enabled == 0){
+        if (adv_timer_active){
+            btstack_run_loop_remove_timer(&adv_timer);
+            adv_timer_active = 0;
+        }
+        gap_adv_current_item = NULL;
+        if (gap_set->active){
+            gap_extended_advertising_stop(gap_set->handle);
+            gap_set->active = false;
+        }
+        return;
+    }
+
+    if (adv_timer_active) return;
+
+    // rotate through connectable advertisements, Controller takes care of the advertising interval
+    adv_bearer_connectable_advertisement_data_item_t * item = (adv_bearer_connectable_advertisement_data_item_t *) btstack_linked_list_pop(&gap_connectable_advertisements);
+    if (item == NULL){
+        gap_adv_current_item = NULL;
+        if (gap_set->active){
+            gap_extended_advertising_stop(gap_set->handle);
+            gap_set->active = false;
+        }
+    } else {
+        // queue again
+        btstack_linked_list_add_tail(&gap_connectable_advertisements, (void*) item);
+        if (item != gap_adv_current_item){
+            log_debug("Set GAP ADV, %p", item);
+            gap_adv_current_item = item;
+            gap_extended_advertising_set_adv_data(gap_set->handle, item->adv_length, item->adv_data);
+        }
+        if (gap_set->active == false){
+            gap_extended_advertising_start(gap_set->handle, 0, 0);
+            gap_set->active = true;
+        }
+    }
+    adv_bearer_set_timeout(btstack_max(gap_adv_int_ms, ADVERTISING_INTERVAL_CONNECTABLE_MIN_MS));
+}
+#endif
+
 static void adv_bearer_timeout_handler(btstack_timer_source_t * ts){
     UNUSED(ts);
     adv_timer_active = 0;
@@ -239,6 +478,14 @@ static void adv_bearer_set_timeout(uint32_t time_ms){
 static void adv_bearer_run(void){
 
     if (hci_get_state() != HCI_STATE_WORKING) return;
+
+#ifdef ENABLE_MESH_ADV_BEARER_EXTENDED_ADVERTISING
+    if (adv_bearer_extended_advertising){
+        adv_bearer_extended_run();
+        return;
+    }
+#endif
+
     if (adv_timer_active) return;
     
     uint32_t now = btstack_run_loop_get_time_ms();
@@ -302,6 +549,19 @@ static void adv_bearer_prepare_message(const uint8_t * data, uint16_t data_len,
     adv_bearer_interval = interval;
 }
 
+static void adv_bearer_send_message(message_type_id_t type_id, const uint8_t * data, uint16_t data_len, uint8_t type, uint8_t count, uint16_t interval){
+#ifdef ENABLE_MESH_ADV_BEARER_EXTENDED_ADVERTISING
+    if (adv_bearer_extended_advertising){
+        adv_bearer_extended_send(type_id, data, data_len, type, count, interval);
+        return;
+    }
+#else
+    UNUSED(type_id);
+#endif
+    adv_bearer_prepare_message(data, data_len, type, count, interval);
+    adv_bearer_run();
+}
+
 //////
 
 static void adv_bearer_request(message_type_id_t type_id){
@@ -346,24 +606,27 @@ void adv_bearer_request_can_send_now_for_provisioning_pdu(void){
 
 void adv_bearer_send_network_pdu(const uint8_t * data, uint16_t data_len, uint8_t count, uint16_t interval){
     btstack_assert(data_len <= (sizeof(adv_bearer_buffer)-2));
-    adv_bearer_prepare_message(data, data_len, BLUETOOTH_DATA_TYPE_MESH_MESSAGE, count, interval);
-    adv_bearer_run();
+    adv_bearer_send_message(MESH_NETWORK_ID, data, data_len, BLUETOOTH_DATA_TYPE_MESH_MESSAGE, count, interval);
 }
 void adv_bearer_send_beacon(const uint8_t * data, uint16_t data_len){
     btstack_assert(data_len <= (sizeof(adv_bearer_buffer)-2));
-    adv_bearer_prepare_message(data, data_len, BLUETOOTH_DATA_TYPE_MESH_BEACON, 3, 100);
-    adv_bearer_run();
+    adv_bearer_send_message(MESH_BEACON_ID, data, data_len, BLUETOOTH_DATA_TYPE_MESH_BEACON, 3, 100);
 }
 void adv_bearer_send_provisioning_pdu(const uint8_t * data, uint16_t data_len){
     btstack_assert(data_len <= (sizeof(adv_bearer_buffer)-2));
-    adv_bearer_prepare_message(data, data_len, BLUETOOTH_DATA_TYPE_PB_ADV, 3, 100);
-    adv_bearer_run();
+    adv_bearer_send_message(PB_ADV_ID, data, data_len, BLUETOOTH_DATA_TYPE_PB_ADV, 3, 100);
 }
 
 // gap advertising
 
 void adv_bearer_advertisements_enable(int enabled){
     gap_advertising_enabled = enabled;
+#ifdef ENABLE_MESH_ADV_BEARER_EXTENDED_ADVERTISING
+    if (adv_bearer_extended_advertising){
+        adv_bearer_run();
+        return;
+    }
+#endif
     if (!gap_advertising_enabled) return;
 
     // start right away
@@ -377,6 +640,17 @@ void adv_bearer_advertisements_add_item(adv_bearer_connectable_advertisement_dat
 
 void adv_bearer_advertisements_remove_item(adv_bearer_connectable_advertisement_data_item_t * item){
     btstack_linked_list_remove(&gap_connectable_advertisements, (void*) item);
+#ifdef ENABLE_MESH_ADV_BEARER_EXTENDED_ADVERTISING
+    if (adv_bearer_extended_advertising && (item == gap_adv_current_item)){
+        // switch to next item right away
+        gap_adv_current_item = NULL;
+        if (adv_timer_active){
+            btstack_run_loop_remove_timer(&adv_timer);
+            adv_timer_active = 0;
+        }
+        adv_bearer_run();
+    }
+#endif
 }
 
 void adv_bearer_advertisements_set_params(uint16_t adv_int_min, uint16_t adv_int_max, uint8_t adv_type,
@@ -394,4 +668,14 @@ void adv_bearer_advertisements_set_params(uint16_t adv_int_min, uint16_t adv_int
     gap_filter_policy      = filter_policy; 
 
     log_info("GAP Adv interval %u ms", gap_adv_int_ms);
+
+#ifdef ENABLE_MESH_ADV_BEARER_EXTENDED_ADVERTISING
+    if (adv_bearer_extended_advertising){
+        le_extended_advertising_parameters_t params;
+        uint8_t handle = adv_bearer_advertising_sets[ADV_SET_GAP].handle;
+        gap_extended_advertising_get_params(handle, &params);
+        adv_bearer_extended_gap_params(&params);
+        gap_extended_advertising_set_params(handle, &params);
+    }
+#endif
 }
@@ -734,26 +734,6 @@ static const mesh_operation_t * mesh_model_lookup_operation_by_opcode(mesh_model
     return NULL;
 }
 
-static const mesh_operation_t * mesh_model_lookup_operation(mesh_model_t * model, mesh_pdu_t * pdu){
-
-    uint32_t opcode = 0;
-    uint16_t opcode_size = 0;
-    int ok = mesh_access_pdu_get_opcode( pdu, &opcode, &opcode_size);
-    if (!ok) return NULL;
-
-    uint16_t len = mesh_pdu_len(pdu);
-
-    // find opcode in table
-    const mesh_operation_t * operation = model->operations;
-    if (operation == NULL) return NULL;
-    for ( ; operation->handler != NULL ; operation++){
-        if (operation->opcode != opcode) continue;
-        if ((opcode_size + operation->minimum_length) > len) continue;
-        return operation;
-    }
-    return NULL;
-}
-
 static int mesh_access_validate_appkey_index(mesh_model_t * model, uint16_t appkey_index){
     // DeviceKey is valid for all models
     if (appkey_index == MESH_DEVICE_KEY_INDEX) return 1;
@@ -771,6 +751,29 @@ void mesh_access_message_processed(mesh_pdu_t * pdu){
     }
 }
 
+// deliver to models of element that support opcode, if subscription_dst is set only to models subscribed to it
+static void mesh_access_message_deliver_to_element(mesh_element_t * element, mesh_pdu_t * pdu, uint32_t opcode, uint16_t opcode_size, uint16_t subscription_dst){
+    uint16_t src = mesh_pdu_src(pdu);
+    uint16_t len = mesh_pdu_len(pdu);
+    uint16_t appkey_index = mesh_pdu_appkey_index(pdu);
+    mesh_model_t * last_model = NULL;
+    mesh_element_operation_iterator_t it;
+    mesh_element_operation_iterator_init(&it, element, opcode);
+    while (mesh_element_operation_iterator_has_next(&it)){
+        mesh_model_t * model;
+        const mesh_operation_t * operation = mesh_element_operation_iterator_next(&it, &model);
+        // only first matching operation per model
+        if (model == last_model) continue;
+        if ((opcode_size + operation->minimum_length) > len) continue;
+        if ((subscription_dst != MESH_ADDRESS_UNSASSIGNED) && !mesh_model_contains_subscription(model, subscription_dst)) continue;
+        if (mesh_access_validate_appkey_index(model, appkey_index) == 0) continue;
+        last_model = model;
+        mesh_access_acknowledged_received(src, opcode);
+        mesh_access_received_pdu_refcount++;
+        operation->handler(model, pdu);
+    }
+}
+
 static void mesh_access_message_process_handler(mesh_pdu_t * pdu){
 
     // init use count
@@ -790,26 +793,12 @@ static void mesh_access_message_process_handler(mesh_pdu_t * pdu){
     printf("MESH Access Message, Opcode = %08" PRIx32 ": ", opcode);
     printf_hexdump(mesh_pdu_data(pdu), len);
 
-    uint16_t src = mesh_pdu_src(pdu);
     uint16_t dst = mesh_pdu_dst(pdu);
-    uint16_t appkey_index = mesh_pdu_appkey_index(pdu);
     if (mesh_network_address_unicast(dst)){
         // loookup element by unicast address
         mesh_element_t * element = mesh_node_element_for_unicast_address(dst);
         if (element != NULL){
-            // iterate over models, look for operation
-            mesh_model_iterator_t model_it;
-            mesh_model_iterator_init(&model_it, element);
-            while (mesh_model_iterator_has_next(&model_it)){
-                mesh_model_t * model = mesh_model_iterator_next(&model_it);
-                // find opcode in table
-                const mesh_operation_t * operation = mesh_model_lookup_operation(model, pdu);
-                if (operation == NULL) continue;
-                if (mesh_access_validate_appkey_index(model, appkey_index) == 0) continue;
-                mesh_access_acknowledged_received(src, opcode);
-                mesh_access_received_pdu_refcount++;
-                operation->handler(model, pdu);
-            }
+            mesh_access_message_deliver_to_element(element, pdu, opcode, opcode_size, MESH_ADDRESS_UNSASSIGNED);
         }
     }
     else if (mesh_network_address_group(dst)){
@@ -838,18 +827,7 @@ static void mesh_access_message_process_handler(mesh_pdu_t * pdu){
                     break;
             }
             if (deliver_to_primary_element){
-                mesh_model_iterator_t model_it;
-                mesh_model_iterator_init(&model_it, mesh_node_get_primary_element());
-                while (mesh_model_iterator_has_next(&model_it)){
-                    mesh_model_t * model = mesh_model_iterator_next(&model_it);
-                    // find opcode in table
-                    const mesh_operation_t * operation = mesh_model_lookup_operation(model, pdu);
-                    if (operation == NULL) continue;
-                    if (mesh_access_validate_appkey_index(model, appkey_index) == 0) continue;
-                    mesh_access_acknowledged_received(src, opcode);
-                    mesh_access_received_pdu_refcount++;
-                    operation->handler(model, pdu);
-                }
+                mesh_access_message_deliver_to_element(mesh_node_get_primary_element(), pdu, opcode, opcode_size, MESH_ADDRESS_UNSASSIGNED);
             }
         }
         else {
@@ -858,20 +836,7 @@ static void mesh_access_message_process_handler(mesh_pdu_t * pdu){
             mesh_element_iterator_init(&it);
             while (mesh_element_iterator_has_next(&it)){
                 mesh_element_t * element = (mesh_element_t *) mesh_element_iterator_next(&it);
-                mesh_model_iterator_t model_it;
-                mesh_model_iterator_init(&model_it, element);
-                while (mesh_model_iterator_has_next(&model_it)){
-                    mesh_model_t * model = mesh_model_iterator_next(&model_it);
-                    if (mesh_model_contains_subscription(model, dst)){
-                        // find opcode in table
-                        const mesh_operation_t * operation = mesh_model_lookup_operation(model, pdu);
-                        if (operation == NULL) continue;
-                        if (mesh_access_validate_appkey_index(model, appkey_index) == 0) continue;
-                        mesh_access_acknowledged_received(src, opcode);
-                        mesh_access_received_pdu_refcount++;
-                        operation->handler(model, pdu);
-                    }
-                }
+                mesh_access_message_deliver_to_element(element, pdu, opcode, opcode_size, dst);
             }
         }
     }
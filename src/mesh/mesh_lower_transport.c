@@ -479,25 +479,50 @@ static void mesh_lower_transport_outgoing_setup_block_ack(mesh_segmented_pdu_t *
     }
 }
 
-static mesh_segmented_pdu_t * mesh_lower_transport_outgoing_message_for_dst(uint16_t dst){
-    if (lower_transport_outgoing_message != NULL && lower_transport_outgoing_message->dst == dst){
-        return lower_transport_outgoing_message;
+static mesh_segmented_pdu_t * mesh_lower_transport_outgoing_message_in_list(btstack_linked_list_t * list, uint16_t dst, uint16_t seq_zero){
+    btstack_linked_list_iterator_t it;
+    btstack_linked_list_iterator_init(&it, list);
+    while (btstack_linked_list_iterator_has_next(&it)){
+        mesh_pdu_t * pdu = (mesh_pdu_t *) btstack_linked_list_iterator_next(&it);
+        if (pdu->pdu_type != MESH_PDU_TYPE_SEGMENTED) continue;
+        mesh_segmented_pdu_t * segmented_pdu = (mesh_segmented_pdu_t *) pdu;
+        if ((segmented_pdu->dst == dst) && ((segmented_pdu->seq & 0x1fff) == seq_zero)){
+            return segmented_pdu;
+        }
     }
     return NULL;
 }
 
-static void mesh_lower_transport_outgoing_process_segment_acknowledgement_message(mesh_network_pdu_t *network_pdu){
-    mesh_segmented_pdu_t * segmented_pdu = mesh_lower_transport_outgoing_message_for_dst( mesh_network_src(network_pdu));
-    if (segmented_pdu == NULL) return;
+// find outgoing segmented message for segment acknowledgement: active, waiting for ack, or queued for retransmission
+static mesh_segmented_pdu_t * mesh_lower_transport_outgoing_message_for_dst(uint16_t dst, uint16_t seq_zero){
+    if ((lower_transport_outgoing_message != NULL) && (lower_transport_outgoing_message->dst == dst)
+    && ((lower_transport_outgoing_message->seq & 0x1fff) == seq_zero)){
+        return lower_transport_outgoing_message;
+    }
+    mesh_segmented_pdu_t * segmented_pdu = mesh_lower_transport_outgoing_message_in_list(&lower_transport_outgoing_waiting, dst, seq_zero);
+    if (segmented_pdu != NULL){
+        return segmented_pdu;
+    }
+    return mesh_lower_transport_outgoing_message_in_list(&lower_transport_outgoing_ready, dst, seq_zero);
+}
 
+static void mesh_lower_transport_outgoing_process_segment_acknowledgement_message(mesh_network_pdu_t *network_pdu){
     uint8_t * lower_transport_pdu     = mesh_network_pdu_data(network_pdu);
-    uint16_t seq_zero_pdu = big_endian_read_16(lower_transport_pdu, 1) >> 2;
-    uint16_t seq_zero_out = lower_transport_outgoing_message->seq & 0x1fff;
+    uint16_t seq_zero_pdu = (big_endian_read_16(lower_transport_pdu, 1) >> 2) & 0x1fff;
     uint32_t block_ack = big_endian_read_32(lower_transport_pdu, 3);
 
+    // each outgoing segmented message has its own block ack state, match by destination and SeqZero
+    mesh_segmented_pdu_t * segmented_pdu = mesh_lower_transport_outgoing_message_for_dst(mesh_network_src(network_pdu), seq_zero_pdu);
+    if (segmented_pdu == NULL) {
+#ifdef LOG_LOWER_TRANSPORT
+        printf("[!] Segment Acknowledgment message with seq_zero %06x for unknown outgoing message\n", seq_zero_pdu);
+#endif
+        return;
+    }
+
 #ifdef LOG_LOWER_TRANSPORT
-    printf("[+] Segment Acknowledgment message with seq_zero %06x, block_ack %08" PRIx32 " - outgoing seq %06x, block_ack %08" PRIx32 "\n",
-           seq_zero_pdu, block_ack, seq_zero_out, segmented_pdu->block_ack);
+    printf("[+] Segment Acknowledgment message with seq_zero %06x, block_ack %08" PRIx32 " - outgoing %p, block_ack %08" PRIx32 "\n",
+           seq_zero_pdu, block_ack, segmented_pdu, segmented_pdu->block_ack);
 #endif
 
     if (block_ack == 0){
@@ -515,13 +540,6 @@ static void mesh_lower_transport_outgoing_process_segment_acknowledgement_messag
         }
         return;
     }
-    if (seq_zero_pdu != seq_zero_out){
-
-#ifdef LOG_LOWER_TRANSPORT
-        printf("[!] Seq Zero doesn't match\n");
-#endif
-        return;
-    }
 
     segmented_pdu->block_ack &= ~block_ack;
 #ifdef LOG_LOWER_TRANSPORT
@@ -552,7 +570,7 @@ static void mesh_lower_transport_outgoing_restart_segment_transmission_timer(mes
     // - "This timer shall be set to a minimum of 200 + 50 * TTL milliseconds."
     uint32_t timeout = 200 + 50 * (segmented_pdu->ctl_ttl & 0x7f);
     if ((segmented_pdu->flags & MESH_TRANSPORT_FLAG_ACK_TIMER) != 0){
-        btstack_run_loop_remove_timer(&lower_transport_outgoing_message->acknowledgement_timer);
+        btstack_run_loop_remove_timer(&segmented_pdu->acknowledgement_timer);
     }
 
 #ifdef LOG_LOWER_TRANSPORT
@@ -562,7 +580,7 @@ static void mesh_lower_transport_outgoing_restart_segment_transmission_timer(mes
 
     btstack_run_loop_set_timer(&segmented_pdu->acknowledgement_timer, timeout);
     btstack_run_loop_set_timer_handler(&segmented_pdu->acknowledgement_timer, &mesh_lower_transport_outgoing_segment_transmission_timeout);
-    btstack_run_loop_set_timer_context(&segmented_pdu->acknowledgement_timer, lower_transport_outgoing_message);
+    btstack_run_loop_set_timer_context(&segmented_pdu->acknowledgement_timer, segmented_pdu);
     btstack_run_loop_add_timer(&segmented_pdu->acknowledgement_timer);
     segmented_pdu->flags |= MESH_TRANSPORT_FLAG_ACK_TIMER;
 }
@@ -977,25 +995,37 @@ void mesh_lower_transport_reset_network_pdus(btstack_linked_list_t *list){
     }
 }
 
+static bool mesh_lower_transport_outgoing_count_messages_in_list(btstack_linked_list_t * list, uint16_t dest, uint16_t * num_messages){
+    btstack_linked_list_iterator_t it;
+    btstack_linked_list_iterator_init(&it, list);
+    while (btstack_linked_list_iterator_has_next(&it)){
+        mesh_pdu_t * pdu = (mesh_pdu_t *) btstack_linked_list_iterator_next(&it);
+        if (pdu->pdu_type != MESH_PDU_TYPE_SEGMENTED) continue;
+        (*num_messages)++;
+        if (((mesh_segmented_pdu_t *) pdu)->dst == dest){
+            return false;
+        }
+    }
+    return true;
+}
+
 bool mesh_lower_transport_can_send_to_dest(uint16_t dest){
-    UNUSED(dest);
-    // check current
+    // segmented messages to different destinations are sent in parallel, each with its own
+    // segment transmission timer and block ack, but only one message per destination
     uint16_t num_messages = 0;
+    // check current
     if (lower_transport_outgoing_message != NULL) {
         if (lower_transport_outgoing_message->dst == dest) {
             return false;
         }
         num_messages++;
     }
-    // check waiting
-    btstack_linked_list_iterator_t it;
-    btstack_linked_list_iterator_init(&it, &lower_transport_outgoing_waiting);
-    while (btstack_linked_list_iterator_has_next(&it)){
-        mesh_segmented_pdu_t * segmented_pdu = (mesh_segmented_pdu_t *) btstack_linked_list_iterator_next(&it);
-        num_messages++;
-        if (segmented_pdu->dst == dest){
-            return false;
-        }
+    // check waiting for ack and queued for (re-)transmission
+    if (mesh_lower_transport_outgoing_count_messages_in_list(&lower_transport_outgoing_waiting, dest, &num_messages) == false){
+        return false;
+    }
+    if (mesh_lower_transport_outgoing_count_messages_in_list(&lower_transport_outgoing_ready, dest, &num_messages) == false){
+        return false;
     }
 #ifdef MAX_NR_MESH_OUTGOING_SEGMENTED_MESSAGES
     // limit number of parallel outgoing messages if configured
@@ -42,6 +42,7 @@
 
 #include "mesh/mesh_node.h"
 
+#include "btstack_debug.h"
 #include "btstack_util.h"
 
 #include <stddef.h>
@@ -64,6 +65,50 @@ static uint16_t mesh_node_company_id;
 static uint16_t mesh_node_product_id;
 static uint16_t mesh_node_product_version_id;
 
+#ifdef MAX_NR_MESH_OPCODE_TABLE_ENTRIES
+// opcode table: (element, opcode) -> (model, operation), open addressing with linear probing
+typedef struct {
+    mesh_model_t * model;
+    const mesh_operation_t * operation;
+} mesh_opcode_table_entry_t;
+
+static mesh_opcode_table_entry_t mesh_opcode_table[MAX_NR_MESH_OPCODE_TABLE_ENTRIES];
+static uint16_t mesh_opcode_table_count;
+// set if table was too small, fall back to iterating over models
+static bool     mesh_opcode_table_overflow;
+
+// hash element by address, as element index might be assigned after models have been added
+static uint16_t mesh_opcode_table_hash(const mesh_element_t * element, uint32_t opcode){
+    uint32_t hash = (opcode ^ (uint32_t) (uintptr_t) element) * 2654435761u;
+    return (uint16_t) ((hash >> 16) % MAX_NR_MESH_OPCODE_TABLE_ENTRIES);
+}
+
+static void mesh_opcode_table_reset(void){
+    memset(mesh_opcode_table, 0, sizeof(mesh_opcode_table));
+    mesh_opcode_table_count = 0;
+    mesh_opcode_table_overflow = false;
+}
+
+static void mesh_opcode_table_add_model(mesh_model_t * mesh_model){
+    const mesh_operation_t * operation = mesh_model->operations;
+    if (operation == NULL) return;
+    for ( ; operation->handler != NULL ; operation++){
+        if (mesh_opcode_table_count >= MAX_NR_MESH_OPCODE_TABLE_ENTRIES){
+            log_error("MAX_NR_MESH_OPCODE_TABLE_ENTRIES too small, fall back to linear opcode lookup");
+            mesh_opcode_table_overflow = true;
+            return;
+        }
+        uint16_t slot = mesh_opcode_table_hash(mesh_model->element, operation->opcode);
+        while (mesh_opcode_table[slot].model != NULL){
+            slot = (slot + 1) % MAX_NR_MESH_OPCODE_TABLE_ENTRIES;
+        }
+        mesh_opcode_table[slot].model     = mesh_model;
+        mesh_opcode_table[slot].operation = operation;
+        mesh_opcode_table_count++;
+    }
+}
+#endif
+
 void mesh_node_primary_element_address_set(uint16_t unicast_address){
     primary_element_address = unicast_address;
 }
@@ -73,6 +118,9 @@ uint16_t mesh_node_get_primary_element_address(void){
 }
 
 void mesh_node_init(void){
+#ifdef MAX_NR_MESH_OPCODE_TABLE_ENTRIES
+    mesh_opcode_table_reset();
+#endif
     // dd Primary Element to list of elements
     mesh_node_add_element(&primary_element);
 }
@@ -203,6 +251,67 @@ void mesh_element_add_model(mesh_element_t * element, mesh_model_t * mesh_model)
     mesh_model->mid = mid_counter++;
     mesh_model->element = element;
     btstack_linked_list_add_tail(&element->models, (btstack_linked_item_t *) mesh_model);
+
+#ifdef MAX_NR_MESH_OPCODE_TABLE_ENTRIES
+    mesh_opcode_table_add_model(mesh_model);
+#endif
+}
+
+static void mesh_element_operation_iterator_advance(mesh_element_operation_iterator_t * iterator){
+    iterator->model     = NULL;
+    iterator->operation = NULL;
+#ifdef MAX_NR_MESH_OPCODE_TABLE_ENTRIES
+    if (mesh_opcode_table_overflow == false){
+        // probe until empty slot
+        while (iterator->probes < MAX_NR_MESH_OPCODE_TABLE_ENTRIES){
+            const mesh_opcode_table_entry_t * entry = &mesh_opcode_table[iterator->slot];
+            if (entry->model == NULL) return;
+            iterator->slot = (iterator->slot + 1) % MAX_NR_MESH_OPCODE_TABLE_ENTRIES;
+            iterator->probes++;
+            if (entry->model->element != iterator->element) continue;
+            if (entry->operation->opcode != iterator->opcode) continue;
+            iterator->model     = entry->model;
+            iterator->operation = entry->operation;
+            return;
+        }
+        return;
+    }
+#endif
+    // linear search over all operations of all models
+    while (btstack_linked_list_iterator_has_next(&iterator->model_it)){
+        mesh_model_t * mesh_model = (mesh_model_t *) btstack_linked_list_iterator_next(&iterator->model_it);
+        const mesh_operation_t * operation = mesh_model->operations;
+        if (operation == NULL) continue;
+        for ( ; operation->handler != NULL ; operation++){
+            if (operation->opcode != iterator->opcode) continue;
+            iterator->model     = mesh_model;
+            iterator->operation = operation;
+            return;
+        }
+    }
+}
+
+void mesh_element_operation_iterator_init(mesh_element_operation_iterator_t * iterator, mesh_element_t * element, uint32_t opcode){
+    iterator->element = element;
+    iterator->opcode  = opcode;
+    iterator->probes  = 0;
+    iterator->slot    = 0;
+#ifdef MAX_NR_MESH_OPCODE_TABLE_ENTRIES
+    iterator->slot    = mesh_opcode_table_hash(element, opcode);
+#endif
+    btstack_linked_list_iterator_init(&iterator->model_it, &element->models);
+    mesh_element_operation_iterator_advance(iterator);
+}
+
+int mesh_element_operation_iterator_has_next(mesh_element_operation_iterator_t * iterator){
+    return iterator->operation != NULL;
+}
+
+const mesh_operation_t * mesh_element_operation_iterator_next(mesh_element_operation_iterator_t * iterator, mesh_model_t ** mesh_model){
+    const mesh_operation_t * operation = iterator->operation;
+    *mesh_model = iterator->model;
+    mesh_element_operation_iterator_advance(iterator);
+    return operation;
 }
 
 void mesh_model_iterator_init(mesh_model_iterator_t * iterator, mesh_element_t * element){
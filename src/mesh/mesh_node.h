@@ -177,6 +177,19 @@ typedef struct {
     btstack_linked_list_iterator_t it;
 } mesh_element_iterator_t;
 
+typedef struct {
+    mesh_element_t * element;
+    uint32_t opcode;
+    // opcode table position
+    uint16_t slot;
+    uint16_t probes;
+    // model list position if opcode table is not used
+    btstack_linked_list_iterator_t model_it;
+    // next model and operation
+    mesh_model_t * model;
+    const mesh_operation_t * operation;
+} mesh_element_operation_iterator_t;
+
 
 void mesh_node_init(void);
 
@@ -260,6 +273,13 @@ int mesh_element_iterator_has_next(mesh_element_iterator_t * iterator);
 
 mesh_element_t * mesh_element_iterator_next(mesh_element_iterator_t * iterator);
 
+// Mesh Element Operation Iterator - all models of element with operation for given opcode, in order of mesh_element_add_model
+void mesh_element_operation_iterator_init(mesh_element_operation_iterator_t * iterator, mesh_element_t * element, uint32_t opcode);
+
+int mesh_element_operation_iterator_has_next(mesh_element_operation_iterator_t * iterator);
+
+const mesh_operation_t * mesh_element_operation_iterator_next(mesh_element_operation_iterator_t * iterator, mesh_model_t ** mesh_model);
+
 // Mesh Model Iterator
 
 void mesh_model_iterator_init(mesh_model_iterator_t * iterator, mesh_element_t * element);
@@ -76,6 +76,26 @@ typedef struct {
     // key info
 } mesh_transport_key_and_virtual_address_iterator_t;
 
+// cache of last key and virtual address that successfully decrypted a message from a given src and AID
+#ifndef MESH_UPPER_TRANSPORT_KEY_CACHE_SIZE
+#define MESH_UPPER_TRANSPORT_KEY_CACHE_SIZE 4
+#endif
+
+typedef struct {
+    uint16_t src;
+    uint16_t netkey_index;
+    uint16_t appkey_index;
+    // pseudo dst of virtual address or MESH_ADDRESS_UNSASSIGNED
+    uint16_t pseudo_dst;
+    uint8_t  akf_aid;
+} mesh_upper_transport_key_cache_entry_t;
+
+typedef enum {
+    MESH_UPPER_TRANSPORT_KEY_PASS_ALL,
+    MESH_UPPER_TRANSPORT_KEY_PASS_CACHED,
+    MESH_UPPER_TRANSPORT_KEY_PASS_REMAINING,
+} mesh_upper_transport_key_pass_t;
+
 static void mesh_upper_transport_run(void);
 static void mesh_upper_transport_schedule_send_requests(void);
 static void mesh_upper_transport_validate_access_message(void);
@@ -90,6 +110,12 @@ static uint8_t application_nonce[13];
 static btstack_crypto_ccm_t ccm;
 static mesh_transport_key_and_virtual_address_iterator_t mesh_transport_key_it;
 
+// key cache
+static mesh_upper_transport_key_cache_entry_t mesh_upper_transport_key_cache[MESH_UPPER_TRANSPORT_KEY_CACHE_SIZE];
+static uint8_t mesh_upper_transport_key_cache_next;
+static const mesh_upper_transport_key_cache_entry_t * mesh_upper_transport_key_cache_hit;
+static mesh_upper_transport_key_pass_t mesh_upper_transport_key_pass;
+
 // incoming segmented (mesh_segmented_pdu_t) or unsegmented (network_pdu_t)
 static mesh_pdu_t *          incoming_access_encrypted;
 
@@ -186,6 +212,75 @@ static void mesh_transport_key_and_virtual_address_iterator_next(mesh_transport_
     }
 }
 
+// key cache: try key (and virtual address) that worked for the last message with same src and AID first
+
+static void mesh_upper_transport_key_cache_reset(void){
+    memset(mesh_upper_transport_key_cache, 0, sizeof(mesh_upper_transport_key_cache));
+    mesh_upper_transport_key_cache_next = 0;
+}
+
+static mesh_upper_transport_key_cache_entry_t * mesh_upper_transport_key_cache_lookup(uint16_t src, uint16_t netkey_index, uint8_t akf_aid){
+    uint8_t i;
+    for (i = 0; i < MESH_UPPER_TRANSPORT_KEY_CACHE_SIZE; i++){
+        mesh_upper_transport_key_cache_entry_t * entry = &mesh_upper_transport_key_cache[i];
+        if ((entry->src == src) && (src != MESH_ADDRESS_UNSASSIGNED) && (entry->netkey_index == netkey_index) && (entry->akf_aid == akf_aid)){
+            return entry;
+        }
+    }
+    return NULL;
+}
+
+static void mesh_upper_transport_key_cache_store(const mesh_access_pdu_t * access_pdu, const mesh_transport_key_t * key, const mesh_virtual_address_t * address){
+    uint8_t akf_aid = access_pdu->akf_aid_control & 0x7f;
+    mesh_upper_transport_key_cache_entry_t * entry = mesh_upper_transport_key_cache_lookup(access_pdu->src, access_pdu->netkey_index, akf_aid);
+    if (entry == NULL){
+        // replace oldest entry
+        entry = &mesh_upper_transport_key_cache[mesh_upper_transport_key_cache_next];
+        mesh_upper_transport_key_cache_next = (mesh_upper_transport_key_cache_next + 1) % MESH_UPPER_TRANSPORT_KEY_CACHE_SIZE;
+    }
+    entry->src          = access_pdu->src;
+    entry->netkey_index = access_pdu->netkey_index;
+    entry->akf_aid      = akf_aid;
+    entry->appkey_index = key->appkey_index;
+    entry->pseudo_dst   = (address != NULL) ? address->pseudo_dst : MESH_ADDRESS_UNSASSIGNED;
+}
+
+static bool mesh_upper_transport_key_cache_matches(const mesh_upper_transport_key_cache_entry_t * entry, const mesh_transport_key_t * key, const mesh_virtual_address_t * address){
+    if (entry->appkey_index != key->appkey_index) return false;
+    if (address == NULL) return true;
+    return entry->pseudo_dst == address->pseudo_dst;
+}
+
+static void mesh_upper_transport_key_iterator_init(void){
+    uint8_t aid = incoming_access_decrypted->akf_aid_control & 0x3f;
+    uint8_t akf = (incoming_access_decrypted->akf_aid_control & 0x40) >> 6;
+    mesh_transport_key_and_virtual_address_iterator_init(&mesh_transport_key_it, incoming_access_decrypted->dst,
+                                                         incoming_access_decrypted->netkey_index, akf, aid);
+}
+
+// get next key and virtual address to try: in case of cache hit, first the cached ones, then all others
+static bool mesh_upper_transport_key_iterator_next(void){
+    while (true){
+        if (!mesh_transport_key_and_virtual_address_iterator_has_more(&mesh_transport_key_it)){
+            if (mesh_upper_transport_key_pass != MESH_UPPER_TRANSPORT_KEY_PASS_CACHED){
+                return false;
+            }
+            // cached candidates failed, restart with remaining ones
+            mesh_upper_transport_key_pass = MESH_UPPER_TRANSPORT_KEY_PASS_REMAINING;
+            mesh_upper_transport_key_iterator_init();
+            continue;
+        }
+        mesh_transport_key_and_virtual_address_iterator_next(&mesh_transport_key_it);
+        if (mesh_upper_transport_key_pass == MESH_UPPER_TRANSPORT_KEY_PASS_ALL){
+            return true;
+        }
+        bool cached = mesh_upper_transport_key_cache_matches(mesh_upper_transport_key_cache_hit, mesh_transport_key_it.key, mesh_transport_key_it.address);
+        if (cached == (mesh_upper_transport_key_pass == MESH_UPPER_TRANSPORT_KEY_PASS_CACHED)){
+            return true;
+        }
+    }
+}
+
 // UPPER TRANSPORT
 
 static void mesh_segmented_pdu_flatten(btstack_linked_list_t * segments, uint8_t segment_len, uint8_t * buffer) {
@@ -279,6 +374,7 @@ void mesh_upper_transport_dump(void){
 
 void mesh_upper_transport_reset(void){
     crypto_active = 0;
+    mesh_upper_transport_key_cache_reset();
     mesh_upper_transport_reset_pdus(&upper_transport_incoming);
     mesh_upper_transport_reset_pdus(&upper_transport_outgoing);
     message_builder_num_network_pdus_reserved = 0;
@@ -491,6 +587,9 @@ static void mesh_upper_transport_validate_access_message_ccm(void * arg){
         // remove TransMIC from payload
         incoming_access_decrypted->len -= transmic_len;
 
+        // remember key and virtual address for next message from this src
+        mesh_upper_transport_key_cache_store(incoming_access_decrypted, mesh_transport_key_it.key, mesh_transport_key_it.address);
+
         // if virtual address, update dst to pseudo_dst
         if (mesh_network_address_virtual(incoming_access_decrypted->dst)){
             incoming_access_decrypted->dst = mesh_transport_key_it.address->pseudo_dst;
@@ -547,12 +646,11 @@ static void mesh_upper_transport_validate_access_message(void){
     uint8_t * upper_transport_pdu_data =  incoming_access_decrypted->data;
     uint8_t   upper_transport_pdu_len  = incoming_access_decrypted->len - transmic_len;
 
-    if (!mesh_transport_key_and_virtual_address_iterator_has_more(&mesh_transport_key_it)){
+    if (!mesh_upper_transport_key_iterator_next()){
         printf("No valid transport key found\n");
         mesh_upper_transport_process_access_message_done(incoming_access_decrypted);
         return;
     }
-    mesh_transport_key_and_virtual_address_iterator_next(&mesh_transport_key_it);
     const mesh_transport_key_t * message_key = mesh_transport_key_it.key;
 
     if (message_key->akf){
@@ -595,8 +693,15 @@ static void mesh_upper_transport_process_access_message(void){
     printf("AKF: %u\n",   akf);
     printf("AID: %02x\n", aid);
 
-    mesh_transport_key_and_virtual_address_iterator_init(&mesh_transport_key_it, incoming_access_decrypted->dst,
-                                                         incoming_access_decrypted->netkey_index, akf, aid);
+    mesh_upper_transport_key_cache_hit = mesh_upper_transport_key_cache_lookup(incoming_access_decrypted->src,
+                                                                               incoming_access_decrypted->netkey_index,
+                                                                               incoming_access_decrypted->akf_aid_control & 0x7f);
+    if (mesh_upper_transport_key_cache_hit != NULL){
+        mesh_upper_transport_key_pass = MESH_UPPER_TRANSPORT_KEY_PASS_CACHED;
+    } else {
+        mesh_upper_transport_key_pass = MESH_UPPER_TRANSPORT_KEY_PASS_ALL;
+    }
+    mesh_upper_transport_key_iterator_init();
     mesh_upper_transport_validate_access_message();
 }
 
@@ -1266,6 +1371,7 @@ void mesh_upper_transport_register_control_message_handler(void (*callback)(mesh
 }
 
 void mesh_upper_transport_init(){
+    mesh_upper_transport_key_cache_reset();
     mesh_lower_transport_set_higher_layer_handler(&mesh_upper_transport_pdu_handler);
 }
 
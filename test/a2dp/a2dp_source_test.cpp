@@ -0,0 +1,358 @@
+// *****************************************************************************
+//
+// test A2DP Source broadcast group and rate control
+//
+// *****************************************************************************
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "CppUTest/TestHarness.h"
+#include "CppUTest/CommandLineTestRunner.h"
+
+#include "btstack_event.h"
+#include "btstack_util.h"
+#include "hci.h"
+#include "classic/a2dp.h"
+#include "classic/a2dp_source.h"
+#include "classic/avdtp.h"
+#include "classic/avdtp_source.h"
+
+#define TEST_A2DP_CID  0x41
+#define TEST_SEID_A    1
+#define TEST_SEID_B    2
+#define TEST_MAX_PAYLOAD_SIZE 10
+#define TEST_NUM_PACKETS      4
+
+// mock start
+static avdtp_stream_endpoint_t stream_endpoints[2];
+static btstack_packet_handler_t avdtp_source_packet_handler;
+static uint16_t num_can_send_now_forwarded;
+static int      num_packets_in_flight;
+static uint16_t num_rate_changed;
+static uint8_t  rate_changed_bitpool;
+
+// packets sent per stream endpoint: first payload byte and RTP timestamp
+static uint8_t  sent_payload[2][16];
+static uint32_t sent_timestamp[2][16];
+static uint16_t num_sent[2];
+
+extern "C" avdtp_stream_endpoint_t * avdtp_get_stream_endpoint_for_seid(uint16_t seid){
+    if ((seid == 0) || (seid > 2)) return NULL;
+    return &stream_endpoints[seid - 1];
+}
+extern "C" void avdtp_source_stream_endpoint_request_can_send_now(uint16_t avdtp_cid, uint8_t local_seid){
+    UNUSED(avdtp_cid);
+    avdtp_get_stream_endpoint_for_seid(local_seid)->request_can_send_now = true;
+}
+extern "C" uint8_t avdtp_source_stream_send_media_payload_rtp(uint16_t avdtp_cid, uint8_t local_seid, uint8_t marker, uint32_t timestamp,
+                                                              const uint8_t *payload, uint16_t size){
+    UNUSED(avdtp_cid);
+    UNUSED(marker);
+    UNUSED(size);
+    uint8_t index = local_seid - 1;
+    sent_payload[index][num_sent[index]] = payload[0];
+    sent_timestamp[index][num_sent[index]] = timestamp;
+    num_sent[index]++;
+    return ERROR_CODE_SUCCESS;
+}
+extern "C" void avdtp_source_register_packet_handler(btstack_packet_handler_t callback){
+    avdtp_source_packet_handler = callback;
+}
+extern "C" void a2dp_replace_subevent_id_and_emit_source(uint8_t * packet, uint16_t size, uint8_t subevent_id){
+    UNUSED(packet);
+    UNUSED(size);
+    if (subevent_id == A2DP_SUBEVENT_STREAMING_CAN_SEND_MEDIA_PACKET_NOW){
+        num_can_send_now_forwarded++;
+    }
+}
+extern "C" void a2dp_emit_source(uint8_t * packet, uint16_t size){
+    UNUSED(size);
+    if (packet[2] != A2DP_SUBEVENT_STREAMING_RATE_CHANGED) return;
+    num_rate_changed++;
+    rate_changed_bitpool = a2dp_subevent_streaming_rate_changed_get_bitpool(packet);
+}
+extern "C" int hci_number_outgoing_acl_packets_for_handle(hci_con_handle_t con_handle){
+    UNUSED(con_handle);
+    return num_packets_in_flight;
+}
+extern "C" int hci_number_free_acl_slots_for_handle(hci_con_handle_t con_handle){
+    UNUSED(con_handle);
+    return 1;
+}
+
+// unused by tests
+extern "C" void a2dp_init(void){}
+extern "C" void a2dp_deinit(void){}
+extern "C" void avdtp_source_init(void){}
+extern "C" void avdtp_source_deinit(void){}
+extern "C" void a2dp_register_source_packet_handler(btstack_packet_handler_t callback){ UNUSED(callback); }
+extern "C" void a2dp_config_process_avdtp_event_handler(avdtp_role_t role, uint8_t *packet, uint16_t size){ UNUSED(role); UNUSED(packet); UNUSED(size); }
+extern "C" void a2dp_config_process_ready_for_sep_discovery(avdtp_role_t role, avdtp_connection_t *connection){ UNUSED(role); UNUSED(connection); }
+extern "C" uint8_t a2dp_config_process_set_sbc(avdtp_role_t role, uint16_t a2dp_cid, uint8_t local_seid, uint8_t remote_seid,
+                                               const avdtp_configuration_sbc_t * configuration){
+    UNUSED(role); UNUSED(a2dp_cid); UNUSED(local_seid); UNUSED(remote_seid); UNUSED(configuration);
+    return ERROR_CODE_COMMAND_DISALLOWED;
+}
+extern "C" uint8_t a2dp_config_process_set_mpeg_audio(avdtp_role_t role, uint16_t a2dp_cid, uint8_t local_seid, uint8_t remote_seid,
+                                                      const avdtp_configuration_mpeg_audio_t * configuration){
+    UNUSED(role); UNUSED(a2dp_cid); UNUSED(local_seid); UNUSED(remote_seid); UNUSED(configuration);
+    return ERROR_CODE_COMMAND_DISALLOWED;
+}
+extern "C" uint8_t a2dp_config_process_set_mpeg_aac(avdtp_role_t role, uint16_t a2dp_cid, uint8_t local_seid, uint8_t remote_seid,
+                                                    const avdtp_configuration_mpeg_aac_t * configuration){
+    UNUSED(role); UNUSED(a2dp_cid); UNUSED(local_seid); UNUSED(remote_seid); UNUSED(configuration);
+    return ERROR_CODE_COMMAND_DISALLOWED;
+}
+extern "C" uint8_t a2dp_config_process_set_atrac(avdtp_role_t role, uint16_t a2dp_cid, uint8_t local_seid, uint8_t remote_seid,
+                                                 const avdtp_configuration_atrac_t * configuration){
+    UNUSED(role); UNUSED(a2dp_cid); UNUSED(local_seid); UNUSED(remote_seid); UNUSED(configuration);
+    return ERROR_CODE_COMMAND_DISALLOWED;
+}
+extern "C" uint8_t a2dp_config_process_set_other(avdtp_role_t role, uint16_t a2dp_cid, uint8_t local_seid, uint8_t remote_seid,
+                                                 const uint8_t * media_codec_information, uint8_t media_codec_information_len){
+    UNUSED(role); UNUSED(a2dp_cid); UNUSED(local_seid); UNUSED(remote_seid); UNUSED(media_codec_information); UNUSED(media_codec_information_len);
+    return ERROR_CODE_COMMAND_DISALLOWED;
+}
+extern "C" void a2dp_create_sdp_record(uint8_t * service, uint32_t service_record_handle, uint16_t service_class_uuid,
+                                       uint16_t supported_features, const char * service_name, const char * service_provider_name){
+    UNUSED(service); UNUSED(service_record_handle); UNUSED(service_class_uuid); UNUSED(supported_features); UNUSED(service_name); UNUSED(service_provider_name);
+}
+extern "C" uint8_t a2dp_subevent_id_for_avdtp_subevent_id(uint8_t subevent){ return subevent; }
+extern "C" void avdtp_config_sbc_set_sampling_frequency(uint8_t * config, uint16_t sampling_frequency_hz){ UNUSED(config); UNUSED(sampling_frequency_hz); }
+extern "C" void avdtp_config_mpeg_audio_set_sampling_frequency(uint8_t * config, uint16_t sampling_frequency_hz){ UNUSED(config); UNUSED(sampling_frequency_hz); }
+extern "C" void avdtp_config_mpeg_aac_set_sampling_frequency(uint8_t * config, uint16_t sampling_frequency_hz){ UNUSED(config); UNUSED(sampling_frequency_hz); }
+extern "C" void avdtp_config_atrac_set_sampling_frequency(uint8_t * config, uint16_t sampling_frequency_hz){ UNUSED(config); UNUSED(sampling_frequency_hz); }
+extern "C" uint8_t avdtp_disconnect(uint16_t avdtp_cid){ UNUSED(avdtp_cid); return ERROR_CODE_COMMAND_DISALLOWED; }
+extern "C" avdtp_connection_t * avdtp_get_connection_for_avdtp_cid(uint16_t avdtp_cid){ UNUSED(avdtp_cid); return NULL; }
+extern "C" avdtp_connection_t * avdtp_get_connection_for_bd_addr(bd_addr_t addr){ (void) addr; return NULL; }
+extern "C" int avdtp_max_media_payload_size(uint16_t avdtp_cid, uint8_t local_seid){ UNUSED(avdtp_cid); UNUSED(local_seid); return 0; }
+extern "C" uint8_t avdtp_source_connect(bd_addr_t bd_addr, uint16_t * avdtp_cid){ (void) bd_addr; UNUSED(avdtp_cid); return ERROR_CODE_COMMAND_DISALLOWED; }
+extern "C" avdtp_stream_endpoint_t * avdtp_source_create_stream_endpoint(avdtp_sep_type_t sep_type, avdtp_media_type_t media_type){ UNUSED(sep_type); UNUSED(media_type); return NULL; }
+extern "C" void avdtp_source_finalize_stream_endpoint(avdtp_stream_endpoint_t * stream_endpoint){ UNUSED(stream_endpoint); }
+extern "C" uint8_t avdtp_source_reconfigure(uint16_t avdtp_cid, uint8_t int_seid, uint8_t acp_seid, uint16_t configured_services_bitmap, avdtp_capabilities_t configuration){
+    UNUSED(avdtp_cid); UNUSED(int_seid); UNUSED(acp_seid); UNUSED(configured_services_bitmap); UNUSED(configuration);
+    return ERROR_CODE_COMMAND_DISALLOWED;
+}
+extern "C" void avdtp_source_register_delay_reporting_category(uint8_t seid){ UNUSED(seid); }
+extern "C" void avdtp_source_register_media_codec_category(uint8_t seid, avdtp_media_type_t media_type, avdtp_media_codec_type_t media_codec_type, const uint8_t *media_codec_info, uint16_t media_codec_info_len){
+    UNUSED(seid); UNUSED(media_type); UNUSED(media_codec_type); UNUSED(media_codec_info); UNUSED(media_codec_info_len);
+}
+extern "C" void avdtp_source_register_media_config_validator(uint8_t (*callback)(const avdtp_stream_endpoint_t * stream_endpoint, const uint8_t * event, uint16_t size)){ UNUSED(callback); }
+extern "C" void avdtp_source_register_media_transport_category(uint8_t seid){ UNUSED(seid); }
+extern "C" uint8_t avdtp_source_stream_send_media_packet(uint16_t avdtp_cid, uint8_t local_seid, const uint8_t * packet, uint16_t size){
+    UNUSED(avdtp_cid); UNUSED(local_seid); UNUSED(packet); UNUSED(size);
+    return ERROR_CODE_COMMAND_DISALLOWED;
+}
+extern "C" uint8_t avdtp_start_stream(uint16_t avdtp_cid, uint8_t local_seid){ UNUSED(avdtp_cid); UNUSED(local_seid); return ERROR_CODE_COMMAND_DISALLOWED; }
+extern "C" uint8_t avdtp_suspend_stream(uint16_t avdtp_cid, uint8_t local_seid){ UNUSED(avdtp_cid); UNUSED(local_seid); return ERROR_CODE_COMMAND_DISALLOWED; }
+extern "C" uint8_t avdtp_stream_endpoint_seid(avdtp_stream_endpoint_t * stream_endpoint){ UNUSED(stream_endpoint); return 0; }
+// mock end
+
+static void dummy_packet_handler(uint8_t packet_type, uint16_t channel, uint8_t *packet, uint16_t size){
+    UNUSED(packet_type);
+    UNUSED(channel);
+    UNUSED(packet);
+    UNUSED(size);
+}
+
+// emit can send now like AVDTP, if requested for stream endpoint
+static bool emit_can_send_now(uint8_t local_seid){
+    avdtp_stream_endpoint_t * stream_endpoint = avdtp_get_stream_endpoint_for_seid(local_seid);
+    if (stream_endpoint->request_can_send_now == false) return false;
+    stream_endpoint->request_can_send_now = false;
+    uint8_t event[8];
+    event[0] = HCI_EVENT_AVDTP_META;
+    event[1] = sizeof(event) - 2;
+    event[2] = AVDTP_SUBEVENT_STREAMING_CAN_SEND_MEDIA_PACKET_NOW;
+    little_endian_store_16(event, 3, TEST_A2DP_CID);
+    event[5] = local_seid;
+    little_endian_store_16(event, 6, 0);
+    (*avdtp_source_packet_handler)(HCI_EVENT_PACKET, 0, event, sizeof(event));
+    return true;
+}
+
+static void send_all(uint8_t local_seid){
+    while (emit_can_send_now(local_seid)){
+    }
+}
+
+static uint8_t storage[TEST_NUM_PACKETS * (A2DP_SOURCE_BROADCAST_PACKET_HEADER_SIZE + TEST_MAX_PAYLOAD_SIZE)];
+
+TEST_GROUP(A2DPSourceBroadcast){
+    a2dp_source_broadcast_t broadcast;
+    a2dp_source_broadcast_sink_t sink_a;
+    a2dp_source_broadcast_sink_t sink_b;
+    uint8_t next_payload;
+
+    void setup(void){
+        memset(stream_endpoints, 0, sizeof(stream_endpoints));
+        memset(num_sent, 0, sizeof(num_sent));
+        num_can_send_now_forwarded = 0;
+        next_payload = 0;
+        a2dp_source_register_packet_handler(&dummy_packet_handler);
+        CHECK_EQUAL(ERROR_CODE_SUCCESS, a2dp_source_broadcast_init(&broadcast, storage, sizeof(storage), TEST_MAX_PAYLOAD_SIZE));
+    }
+    void teardown(void){
+        a2dp_source_broadcast_deinit(&broadcast);
+        a2dp_source_deinit();
+    }
+    void queue_packet(void){
+        uint8_t payload[TEST_MAX_PAYLOAD_SIZE];
+        memset(payload, next_payload, sizeof(payload));
+        uint32_t timestamp = 1000 + (next_payload * 128);
+        next_payload++;
+        CHECK_EQUAL(ERROR_CODE_SUCCESS, a2dp_source_broadcast_send_media_payload_rtp(&broadcast, 0, timestamp, payload, sizeof(payload)));
+    }
+};
+
+TEST(A2DPSourceBroadcast, PayloadTooLarge){
+    uint8_t payload[TEST_MAX_PAYLOAD_SIZE + 1];
+    memset(payload, 0, sizeof(payload));
+    CHECK_EQUAL(ERROR_CODE_MEMORY_CAPACITY_EXCEEDED, a2dp_source_broadcast_send_media_payload_rtp(&broadcast, 0, 0, payload, sizeof(payload)));
+}
+
+TEST(A2DPSourceBroadcast, AllSinksReceivePackets){
+    a2dp_source_broadcast_add_sink(&broadcast, &sink_a, TEST_A2DP_CID, TEST_SEID_A);
+    a2dp_source_broadcast_add_sink(&broadcast, &sink_b, TEST_A2DP_CID, TEST_SEID_B);
+    queue_packet();
+    queue_packet();
+    queue_packet();
+    send_all(TEST_SEID_A);
+    send_all(TEST_SEID_B);
+    uint8_t i;
+    for (i = 0; i < 2; i++){
+        CHECK_EQUAL(3, num_sent[i]);
+        CHECK_EQUAL(0, sent_payload[i][0]);
+        CHECK_EQUAL(2, sent_payload[i][2]);
+        // RTP timestamp starts at 0 for each sink
+        CHECK_EQUAL(0, sent_timestamp[i][0]);
+        CHECK_EQUAL(256, sent_timestamp[i][2]);
+    }
+    CHECK_EQUAL(0, num_can_send_now_forwarded);
+}
+
+TEST(A2DPSourceBroadcast, SinkBacklog){
+    a2dp_source_broadcast_add_sink(&broadcast, &sink_a, TEST_A2DP_CID, TEST_SEID_A);
+    a2dp_source_broadcast_add_sink(&broadcast, &sink_b, TEST_A2DP_CID, TEST_SEID_B);
+    // sink b cannot send, oldest packets are dropped once storage is full
+    uint8_t i;
+    for (i = 0; i < (TEST_NUM_PACKETS + 2); i++){
+        queue_packet();
+        send_all(TEST_SEID_A);
+    }
+    CHECK_EQUAL(TEST_NUM_PACKETS + 2, num_sent[0]);
+    CHECK_EQUAL(0, sink_a.num_packets_dropped);
+    CHECK_EQUAL(2, sink_b.num_packets_dropped);
+
+    send_all(TEST_SEID_B);
+    CHECK_EQUAL(TEST_NUM_PACKETS, num_sent[1]);
+    CHECK_EQUAL(2, sent_payload[1][0]);
+    CHECK_EQUAL(TEST_NUM_PACKETS + 1, sent_payload[1][TEST_NUM_PACKETS - 1]);
+    CHECK_EQUAL(0, sent_timestamp[1][0]);
+}
+
+TEST(A2DPSourceBroadcast, AddSinkDuringStreaming){
+    a2dp_source_broadcast_add_sink(&broadcast, &sink_a, TEST_A2DP_CID, TEST_SEID_A);
+    queue_packet();
+    queue_packet();
+    send_all(TEST_SEID_A);
+    a2dp_source_broadcast_add_sink(&broadcast, &sink_b, TEST_A2DP_CID, TEST_SEID_B);
+    queue_packet();
+    send_all(TEST_SEID_A);
+    send_all(TEST_SEID_B);
+    CHECK_EQUAL(3, num_sent[0]);
+    // new sink only receives packets queued after it was added
+    CHECK_EQUAL(1, num_sent[1]);
+    CHECK_EQUAL(2, sent_payload[1][0]);
+    CHECK_EQUAL(0, sent_timestamp[1][0]);
+}
+
+TEST(A2DPSourceBroadcast, RemoveSinkDuringStreaming){
+    a2dp_source_broadcast_add_sink(&broadcast, &sink_a, TEST_A2DP_CID, TEST_SEID_A);
+    a2dp_source_broadcast_add_sink(&broadcast, &sink_b, TEST_A2DP_CID, TEST_SEID_B);
+    queue_packet();
+    queue_packet();
+    send_all(TEST_SEID_A);
+    // sink b removed while its request is pending
+    a2dp_source_broadcast_remove_sink(&broadcast, &sink_b);
+    CHECK_FALSE(emit_can_send_now(TEST_SEID_B));
+    queue_packet();
+    send_all(TEST_SEID_A);
+    CHECK_EQUAL(3, num_sent[0]);
+    CHECK_EQUAL(0, num_sent[1]);
+    CHECK_EQUAL(0, num_can_send_now_forwarded);
+}
+
+TEST_GROUP(A2DPSourceRateControl){
+    a2dp_source_rate_control_t rate_control;
+
+    void setup(void){
+        memset(stream_endpoints, 0, sizeof(stream_endpoints));
+        num_can_send_now_forwarded = 0;
+        num_packets_in_flight = 0;
+        num_rate_changed = 0;
+        rate_changed_bitpool = 0;
+        a2dp_source_register_packet_handler(&dummy_packet_handler);
+        a2dp_source_rate_control_enable(&rate_control, TEST_A2DP_CID, TEST_SEID_A, 2, 53);
+    }
+    void teardown(void){
+        a2dp_source_rate_control_disable(&rate_control);
+        a2dp_source_deinit();
+    }
+    void sample(uint16_t num_samples){
+        while (num_samples--){
+            avdtp_source_stream_endpoint_request_can_send_now(TEST_A2DP_CID, TEST_SEID_A);
+            CHECK_TRUE(emit_can_send_now(TEST_SEID_A));
+        }
+    }
+};
+
+TEST(A2DPSourceRateControl, NoCongestion){
+    sample(1000);
+    CHECK_EQUAL(1000, num_can_send_now_forwarded);
+    CHECK_EQUAL(0, num_rate_changed);
+    CHECK_EQUAL(53, rate_control.bitpool);
+}
+
+TEST(A2DPSourceRateControl, HoldOffAfterDecrease){
+    num_packets_in_flight = 4;
+    sample(1);
+    CHECK_EQUAL(1, num_rate_changed);
+    CHECK_EQUAL(40, rate_changed_bitpool);
+    // congestion while packets with previous bitpool drain is ignored
+    sample(16);
+    CHECK_EQUAL(1, num_rate_changed);
+    CHECK_EQUAL(40, rate_control.bitpool);
+    sample(1);
+    CHECK_EQUAL(2, num_rate_changed);
+    CHECK_EQUAL(30, rate_changed_bitpool);
+    // bitpool does not fall below min bitpool
+    sample(200);
+    CHECK_EQUAL(2, rate_control.bitpool);
+    CHECK_EQUAL(218, rate_control.num_congested_samples);
+}
+
+TEST(A2DPSourceRateControl, RecoveryAfterCongestion){
+    num_packets_in_flight = 4;
+    sample(1);
+    CHECK_EQUAL(40, rate_control.bitpool);
+    num_packets_in_flight = 1;
+    sample(63);
+    CHECK_EQUAL(40, rate_control.bitpool);
+    sample(1);
+    CHECK_EQUAL(41, rate_changed_bitpool);
+    // back to max bitpool
+    sample(12 * 64);
+    CHECK_EQUAL(53, rate_changed_bitpool);
+    CHECK_EQUAL(14, num_rate_changed);
+    sample(64);
+    CHECK_EQUAL(14, num_rate_changed);
+    CHECK_EQUAL(53, rate_control.bitpool);
+    CHECK_EQUAL(1 + 64 + 12 * 64 + 64, num_can_send_now_forwarded);
+}
+
+int main (int argc, const char * argv[]){
+    return CommandLineTestRunner::RunAllTests(argc, argv);
+}
@@ -187,6 +187,79 @@ TEST(ADParser, ad_data_contains_uuid128){
     }
 }
 
+TEST(ADParser, ad_index_get_data){
+    ad_index_t index;
+    ad_index_init(&index, sizeof(adv_data), adv_data);
+
+    uint8_t data_len;
+    const uint8_t * data = ad_index_get_data(&index, BLUETOOTH_DATA_TYPE_COMPLETE_LOCAL_NAME, &data_len);
+    CHECK(data != NULL);
+    CHECK_EQUAL(11, data_len);
+    MEMCMP_EQUAL("LE Streamer", data, 11);
+
+    data = ad_index_get_data(&index, BLUETOOTH_DATA_TYPE_FLAGS, &data_len);
+    CHECK(data != NULL);
+    CHECK_EQUAL(1, data_len);
+    CHECK_EQUAL(0x06, data[0]);
+
+    CHECK(ad_index_contains(&index, BLUETOOTH_DATA_TYPE_COMPLETE_LIST_OF_128_BIT_SERVICE_CLASS_UUIDS));
+    CHECK(!ad_index_contains(&index, BLUETOOTH_DATA_TYPE_SHORTENED_LOCAL_NAME));
+    CHECK(!ad_index_contains(&index, BLUETOOTH_DATA_TYPE_MANUFACTURER_SPECIFIC_DATA));
+    CHECK(ad_index_get_data(&index, BLUETOOTH_DATA_TYPE_MANUFACTURER_SPECIFIC_DATA, &data_len) == NULL);
+}
+
+TEST(ADParser, ad_index_manufacturer_data){
+    static const uint8_t manufacturer_adv_data[] = { 0x02, 0x01, 0x06, 0x04, 0xff, 0x4c, 0x00, 0x01, 0x03, 0x40, 0x12, 0x34};
+    ad_index_t index;
+    ad_index_init(&index, sizeof(manufacturer_adv_data), manufacturer_adv_data);
+    uint8_t data_len;
+    const uint8_t * data = ad_index_get_data(&index, BLUETOOTH_DATA_TYPE_MANUFACTURER_SPECIFIC_DATA, &data_len);
+    CHECK(data != NULL);
+    CHECK_EQUAL(3, data_len);
+    CHECK_EQUAL(0x004c, little_endian_read_16(data, 0));
+    // type outside of index
+    data = ad_index_get_data(&index, 0x40, &data_len);
+    CHECK(data != NULL);
+    CHECK_EQUAL(2, data_len);
+    CHECK_EQUAL(0x12, data[0]);
+}
+
+TEST(ADParser, ad_index_contains_any_uuid16){
+    ad_index_t index;
+    ad_index_init(&index, sizeof(adv_data), adv_data);
+
+    const uint16_t no_uuids[] = { 0x0000, 0x180d };
+    CHECK(!ad_index_contains_any_uuid16(&index, no_uuids, 2));
+
+    // 16-bit list
+    const uint16_t uuids[] = { 0x180d, 0xff10 };
+    CHECK(ad_index_contains_any_uuid16(&index, uuids, 2));
+
+    // second 128-bit list with Bluetooth Base UUID
+    const uint16_t uuids_128[] = { 0x1234, 0xaa10 };
+    CHECK(ad_index_contains_any_uuid16(&index, uuids_128, 2));
+
+    ad_index_init(&index, sizeof(adv_data_2), adv_data_2);
+    CHECK(!ad_index_contains_any_uuid16(&index, uuids, 2));
+}
+
+TEST(ADParser, ad_index_contains_uuid128){
+    ad_index_t index;
+    ad_index_init(&index, sizeof(adv_data), adv_data);
+
+    uint8_t ad_uuid128[16];
+    memset(ad_uuid128, 0, 16);
+    CHECK(!ad_index_contains_uuid128(&index, ad_uuid128));
+
+    uint8_t uuid128_le[] = {0x9e, 0xca, 0xdc, 0x24, 0xe, 0xe5, 0xa9, 0xe0, 0x93, 0xf3, 0xa3, 0xb5, 0x1, 0x0, 0x40, 0x6e};
+    reverse_128(uuid128_le, ad_uuid128);
+    CHECK(ad_index_contains_uuid128(&index, ad_uuid128));
+
+    // 16-bit UUID from 16-bit list
+    uuid_add_bluetooth_prefix(ad_uuid128, 0xff10);
+    CHECK(ad_index_contains_uuid128(&index, ad_uuid128));
+}
+
 int main (int argc, const char * argv[]){
     return CommandLineTestRunner::RunAllTests(argc, argv);
 }
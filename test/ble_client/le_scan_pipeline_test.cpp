@@ -0,0 +1,241 @@
+/*
+ * Copyright (C) 2024 BlueKitchen GmbH
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holders nor the names of
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ * 4. Any redistribution, use, or modification is done solely for
+ *    personal benefit and not for any commercial purpose or for
+ *    monetary gain.
+ *
+ * THIS SOFTWARE IS PROVIDED BY BLUEKITCHEN GMBH AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL MATTHIAS
+ * RINGWALD OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF
+ * THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ *
+ * Please inquire about commercial licensing options at 
+ * contact@bluekitchen-gmbh.com
+ *
+ */
+
+// *****************************************************************************
+//
+// test le scan pipeline
+//
+// *****************************************************************************
+
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "CppUTest/TestHarness.h"
+#include "CppUTest/CommandLineTestRunner.h"
+
+#include "bluetooth_data_types.h"
+#include "btstack_event.h"
+#include "btstack_run_loop.h"
+#include "hci.h"
+#include "ble/le_scan_pipeline.h"
+
+extern "C" void le_handle_advertisement_report(uint8_t *packet, uint16_t size);
+
+static uint8_t adv_multi_packet[] = {
+    0x3E, 0x3B, 0x02, 0x03, // num_reports = 3
+    0x00, 0x01, 0x34, 0xB1, 0xF7, 0xD1, 0x77, 0x9B,
+    0x06, 0x02, 0x01, 0x06, 0x02, 0x0A, 0x00, 0xCC,   // data len, flags, tx power, rssi
+
+    0x00, 0x01, 0x34, 0xB1, 0xF7, 0xD1, 0x77, 0x9B,
+    0x06, 0x02, 0x01, 0x06, 0x02, 0x0A, 0x00, 0xCB,   // same data from same address
+
+    0x00, 0x00, 0x11, 0x22, 0x33, 0x44, 0x55, 0x66,
+    0x04, 0x03, 0xFF, 0x01, 0x02, 0xCA,               // manufacturer data from other address
+};
+
+static uint32_t mock_time_ms;
+static int callback_count;
+static uint16_t callback_num_reports;
+static int event_handler_count;
+static uint8_t ring_storage[256];
+static le_scan_pipeline_duplicate_entry_t duplicate_entries[8];
+static btstack_packet_callback_registration_t hci_event_callback_registration;
+
+static void mock_init(void){
+}
+
+static uint32_t mock_get_time_ms(void){
+    return mock_time_ms;
+}
+
+static const btstack_run_loop_t mock_run_loop = {
+    &mock_init, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, &mock_get_time_ms, NULL, NULL, NULL
+};
+
+static int dummy_callback(void){
+    return 0;
+}
+
+static hci_transport_t dummy_transport = {
+  /*  .transport.name                          = */  "DUMMY",
+  /*  .transport.init                          = */  NULL,
+  /*  .transport.open                          = */  NULL,
+  /*  .transport.close                         = */  NULL,
+  /*  .transport.register_packet_handler       = */  (void (*)(void (*)(uint8_t, uint8_t *, uint16_t))) dummy_callback,
+  /*  .transport.can_send_packet_now           = */  NULL,
+  /*  .transport.send_packet                   = */  NULL,
+  /*  .transport.set_baudrate                  = */  NULL,
+};
+
+static void event_handler(uint8_t packet_type, uint16_t channel, uint8_t *packet, uint16_t size){
+    if (hci_event_packet_get_type(packet) == GAP_EVENT_ADVERTISING_REPORT){
+        event_handler_count++;
+    }
+}
+
+static void reports_callback(uint16_t num_reports){
+    callback_count++;
+    callback_num_reports = num_reports;
+}
+
+static int count_reports(void){
+    uint8_t buffer[LE_SCAN_PIPELINE_MAX_REPORT_SIZE];
+    int num_reports = 0;
+    while (le_scan_pipeline_get_report(buffer, sizeof(buffer)) > 0){
+        CHECK_EQUAL(GAP_EVENT_ADVERTISING_REPORT, hci_event_packet_get_type(buffer));
+        num_reports++;
+    }
+    return num_reports;
+}
+
+TEST_GROUP(LEScanPipeline){
+    void setup(void){
+        mock_time_ms = 1000;
+        callback_count = 0;
+        callback_num_reports = 0;
+        event_handler_count = 0;
+        btstack_run_loop_init(&mock_run_loop);
+        hci_init(&dummy_transport, NULL);
+        hci_event_callback_registration.callback = &event_handler;
+        hci_add_event_handler(&hci_event_callback_registration);
+        le_scan_pipeline_init(ring_storage, sizeof(ring_storage));
+        le_scan_pipeline_register_callback(&reports_callback);
+    }
+    void teardown(void){
+        le_scan_pipeline_deinit();
+        btstack_run_loop_deinit();
+    }
+};
+
+TEST(LEScanPipeline, BatchDelivery){
+    le_handle_advertisement_report(adv_multi_packet, sizeof(adv_multi_packet));
+    CHECK_EQUAL(0, event_handler_count);
+    CHECK_EQUAL(1, callback_count);
+    CHECK_EQUAL(3, callback_num_reports);
+
+    uint8_t buffer[LE_SCAN_PIPELINE_MAX_REPORT_SIZE];
+    uint16_t size = le_scan_pipeline_get_report(buffer, sizeof(buffer));
+    CHECK_EQUAL(18, size);
+    CHECK_EQUAL(0xCC, (uint8_t) gap_event_advertising_report_get_rssi(buffer));
+    CHECK_EQUAL(6, gap_event_advertising_report_get_data_length(buffer));
+    bd_addr_t address;
+    gap_event_advertising_report_get_address(buffer, address);
+    const uint8_t expected_address[] = {0x9B, 0x77, 0xD1, 0xF7, 0xB1, 0x34};
+    MEMCMP_EQUAL(expected_address, address, 6);
+    CHECK_EQUAL(2, count_reports());
+}
+
+TEST(LEScanPipeline, Deinit){
+    le_scan_pipeline_deinit();
+    le_handle_advertisement_report(adv_multi_packet, sizeof(adv_multi_packet));
+    CHECK_EQUAL(3, event_handler_count);
+    CHECK_EQUAL(0, callback_count);
+}
+
+TEST(LEScanPipeline, AddressFilter){
+    static const le_scan_pipeline_address_t addresses[] = {
+        { BD_ADDR_TYPE_LE_PUBLIC, {0x66, 0x55, 0x44, 0x00, 0x00, 0x00}, 3},
+    };
+    le_scan_pipeline_set_address_filter(addresses, 1);
+    le_handle_advertisement_report(adv_multi_packet, sizeof(adv_multi_packet));
+    CHECK_EQUAL(1, callback_num_reports);
+    CHECK_EQUAL(1, count_reports());
+    le_scan_pipeline_statistics_t statistics;
+    le_scan_pipeline_get_statistics(&statistics);
+    CHECK_EQUAL(3, statistics.num_received);
+    CHECK_EQUAL(2, statistics.num_filtered);
+}
+
+TEST(LEScanPipeline, AdTypeFilter){
+    const uint8_t ad_types[] = { BLUETOOTH_DATA_TYPE_MANUFACTURER_SPECIFIC_DATA };
+    le_scan_pipeline_set_ad_type_filter(ad_types, 1);
+    le_handle_advertisement_report(adv_multi_packet, sizeof(adv_multi_packet));
+    CHECK_EQUAL(1, callback_num_reports);
+    CHECK_EQUAL(1, count_reports());
+}
+
+TEST(LEScanPipeline, DuplicateFilter){
+    le_scan_pipeline_set_duplicate_filter(duplicate_entries, 8, 500);
+    le_handle_advertisement_report(adv_multi_packet, sizeof(adv_multi_packet));
+    CHECK_EQUAL(2, callback_num_reports);
+    CHECK_EQUAL(2, count_reports());
+
+    // all duplicates, no callback
+    mock_time_ms += 100;
+    le_handle_advertisement_report(adv_multi_packet, sizeof(adv_multi_packet));
+    CHECK_EQUAL(1, callback_count);
+    CHECK_EQUAL(0, count_reports());
+
+    // aged out
+    mock_time_ms += 500;
+    le_handle_advertisement_report(adv_multi_packet, sizeof(adv_multi_packet));
+    CHECK_EQUAL(2, callback_count);
+    CHECK_EQUAL(2, callback_num_reports);
+
+    le_scan_pipeline_statistics_t statistics;
+    le_scan_pipeline_get_statistics(&statistics);
+    CHECK_EQUAL(5, statistics.num_duplicates);
+}
+
+TEST(LEScanPipeline, RingBufferFull){
+    int i;
+    for (i=0;i<10;i++){
+        le_handle_advertisement_report(adv_multi_packet, sizeof(adv_multi_packet));
+    }
+    le_scan_pipeline_statistics_t statistics;
+    le_scan_pipeline_get_statistics(&statistics);
+    CHECK_EQUAL(30, statistics.num_received);
+    int num_stored = count_reports();
+    CHECK(statistics.num_dropped > 0);
+    CHECK_EQUAL(30, num_stored + (int) statistics.num_dropped);
+}
+
+TEST(LEScanPipeline, BufferTooSmall){
+    le_handle_advertisement_report(adv_multi_packet, sizeof(adv_multi_packet));
+    uint8_t buffer[10];
+    CHECK_EQUAL(0, le_scan_pipeline_get_report(buffer, sizeof(buffer)));
+    le_scan_pipeline_statistics_t statistics;
+    le_scan_pipeline_get_statistics(&statistics);
+    CHECK_EQUAL(3, statistics.num_dropped);
+}
+
+int main (int argc, const char * argv[]){
+    return CommandLineTestRunner::RunAllTests(argc, argv);
+}
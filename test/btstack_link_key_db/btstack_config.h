@@ -38,4 +38,6 @@
 #define MAX_NR_SM_LOOKUP_ENTRIES 0
 #define MAX_NR_WHITELIST_ENTRIES 0
 
+#define NVM_NUM_LINK_KEYS 4
+
 #endif
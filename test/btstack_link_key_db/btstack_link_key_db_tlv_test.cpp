@@ -0,0 +1,160 @@
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include "CppUTest/TestHarness.h"
+#include "CppUTest/CommandLineTestRunner.h"
+
+#include "classic/btstack_link_key_db.h"
+#include "classic/btstack_link_key_db_tlv.h"
+#include "btstack_tlv_flash_bank.h"
+#include "hal_flash_bank_memory.h"
+#include "btstack_util.h"
+
+#include "btstack_config.h"
+
+#define HAL_FLASH_BANK_MEMORY_STORAGE_SIZE 4096
+static uint8_t hal_flash_bank_memory_storage[HAL_FLASH_BANK_MEMORY_STORAGE_SIZE];
+
+// btstack_tlv wrapper counting read accesses
+static const btstack_tlv_t * counting_tlv_impl;
+static void *                counting_tlv_context;
+static int                   counting_tlv_num_get_tag;
+
+static int counting_tlv_get_tag(void * context, uint32_t tag, uint8_t * buffer, uint32_t buffer_size){
+    (void) context;
+    counting_tlv_num_get_tag++;
+    return counting_tlv_impl->get_tag(counting_tlv_context, tag, buffer, buffer_size);
+}
+
+static int counting_tlv_store_tag(void * context, uint32_t tag, const uint8_t * data, uint32_t data_size){
+    (void) context;
+    return counting_tlv_impl->store_tag(counting_tlv_context, tag, data, data_size);
+}
+
+static void counting_tlv_delete_tag(void * context, uint32_t tag){
+    (void) context;
+    counting_tlv_impl->delete_tag(counting_tlv_context, tag);
+}
+
+static const btstack_tlv_t counting_tlv = {
+    &counting_tlv_get_tag,
+    &counting_tlv_store_tag,
+    &counting_tlv_delete_tag,
+};
+
+TEST_GROUP(LinkKeyDBTLV){
+    const hal_flash_bank_t * hal_flash_bank_impl;
+    hal_flash_bank_memory_t  hal_flash_bank_context;
+    btstack_tlv_flash_bank_t btstack_tlv_context;
+    const btstack_link_key_db_t * link_key_db;
+    link_key_t link_key;
+    link_key_type_t link_key_type;
+
+    void set_addr(bd_addr_t addr, uint8_t value){
+        bd_addr_t addr_base = {0x00, 0x01, 0x02, 0x03, 0x04, 0x00 };
+        bd_addr_copy(addr, addr_base);
+        addr[5] = value;
+    }
+
+    void setup(void){
+        hal_flash_bank_impl = hal_flash_bank_memory_init_instance(&hal_flash_bank_context, hal_flash_bank_memory_storage, HAL_FLASH_BANK_MEMORY_STORAGE_SIZE);
+        hal_flash_bank_impl->erase(&hal_flash_bank_context, 0);
+        hal_flash_bank_impl->erase(&hal_flash_bank_context, 1);
+        counting_tlv_impl    = btstack_tlv_flash_bank_init_instance(&btstack_tlv_context, hal_flash_bank_impl, &hal_flash_bank_context);
+        counting_tlv_context = &btstack_tlv_context;
+        counting_tlv_num_get_tag = 0;
+
+        link_key_db = btstack_link_key_db_tlv_get_instance(&counting_tlv, NULL);
+        link_key_db->open();
+        link_key_type = (link_key_type_t) 4;
+    }
+};
+
+TEST(LinkKeyDBTLV, PutGetDelete){
+    bd_addr_t addr;
+    set_addr(addr, 1);
+    memset(link_key, 0x11, 16);
+    link_key_db->put_link_key(addr, link_key, link_key_type);
+
+    link_key_t link_key_read;
+    link_key_type_t link_key_type_read;
+    CHECK(link_key_db->get_link_key(addr, link_key_read, &link_key_type_read));
+    MEMCMP_EQUAL(link_key, link_key_read, 16);
+    CHECK_EQUAL(link_key_type, link_key_type_read);
+
+    link_key_db->delete_link_key(addr);
+    CHECK(!link_key_db->get_link_key(addr, link_key_read, &link_key_type_read));
+}
+
+TEST(LinkKeyDBTLV, GetSingleTLVRead){
+    bd_addr_t addr;
+    uint8_t i;
+    for (i=0;i<NVM_NUM_LINK_KEYS;i++){
+        set_addr(addr, i);
+        memset(link_key, i, 16);
+        link_key_db->put_link_key(addr, link_key, link_key_type);
+    }
+
+    // reload index from TLV
+    link_key_db->open();
+
+    counting_tlv_num_get_tag = 0;
+    set_addr(addr, NVM_NUM_LINK_KEYS - 1);
+    CHECK(link_key_db->get_link_key(addr, link_key, &link_key_type));
+    CHECK_EQUAL(1, counting_tlv_num_get_tag);
+    CHECK_EQUAL(NVM_NUM_LINK_KEYS - 1, link_key[0]);
+
+    // unknown address does not touch TLV
+    set_addr(addr, 0x80);
+    CHECK(!link_key_db->get_link_key(addr, link_key, &link_key_type));
+    CHECK_EQUAL(1, counting_tlv_num_get_tag);
+}
+
+TEST(LinkKeyDBTLV, ReplaceOldest){
+    bd_addr_t addr;
+    uint8_t i;
+    for (i=0;i<NVM_NUM_LINK_KEYS;i++){
+        set_addr(addr, i);
+        memset(link_key, i, 16);
+        link_key_db->put_link_key(addr, link_key, link_key_type);
+    }
+    // update first one, second one becomes oldest
+    set_addr(addr, 0);
+    link_key_db->put_link_key(addr, link_key, link_key_type);
+
+    counting_tlv_num_get_tag = 0;
+    set_addr(addr, 0x80);
+    link_key_db->put_link_key(addr, link_key, link_key_type);
+    CHECK_EQUAL(0, counting_tlv_num_get_tag);
+
+    CHECK(link_key_db->get_link_key(addr, link_key, &link_key_type));
+    set_addr(addr, 0);
+    CHECK(link_key_db->get_link_key(addr, link_key, &link_key_type));
+    set_addr(addr, 1);
+    CHECK(!link_key_db->get_link_key(addr, link_key, &link_key_type));
+}
+
+TEST(LinkKeyDBTLV, Iterator){
+    bd_addr_t addr;
+    uint8_t i;
+    for (i=0;i<3;i++){
+        set_addr(addr, i);
+        link_key_db->put_link_key(addr, link_key, link_key_type);
+    }
+    set_addr(addr, 1);
+    link_key_db->delete_link_key(addr);
+
+    btstack_link_key_iterator_t it;
+    int num_entries = 0;
+    CHECK(link_key_db->iterator_init(&it));
+    while (link_key_db->iterator_get_next(&it, addr, link_key, &link_key_type)){
+        CHECK(addr[5] != 1);
+        num_entries++;
+    }
+    link_key_db->iterator_done(&it);
+    CHECK_EQUAL(2, num_entries);
+}
+
+int main (int argc, const char * argv[]){
+    return CommandLineTestRunner::RunAllTests(argc, argv);
+}
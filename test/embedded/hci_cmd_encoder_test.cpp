@@ -0,0 +1,2054 @@
+// Note: Don't edit this file. It is generated by tool/btstack_hci_cmd_encoder_generator.py
+
+#include "CppUTest/TestHarness.h"
+#include "CppUTest/CommandLineTestRunner.h"
+
+#include "btstack_config.h"
+#include "hci_cmd.h"
+#include "hci_cmd_encoder.h"
+#include "btstack_util.h"
+
+static uint8_t expected_buffer[300];
+static uint8_t encoder_buffer[300];
+static uint8_t test_data[300];
+
+TEST_GROUP(HCI_Command_Encoder){
+    void setup(void){
+        uint16_t i;
+        for (i = 0; i < sizeof(test_data); i++){
+            test_data[i] = (uint8_t) (i + 1);
+        }
+        memset(expected_buffer, 0x55, sizeof(expected_buffer));
+        memset(encoder_buffer,  0xaa, sizeof(encoder_buffer));
+    }
+};
+
+TEST(HCI_Command_Encoder, inquiry){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_inquiry, (uint32_t) 0x00020304, 0x22, 0x33);
+    uint16_t size = hci_cmd_inquiry_encode(encoder_buffer, (uint32_t) 0x00020304, 0x22, 0x33);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+TEST(HCI_Command_Encoder, inquiry_cancel){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_inquiry_cancel);
+    uint16_t size = hci_cmd_inquiry_cancel_encode(encoder_buffer);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+TEST(HCI_Command_Encoder, periodic_inquiry_mode){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_periodic_inquiry_mode, 0x0102, 0x0204, (uint32_t) 0x00020306, 0x44, 0x55);
+    uint16_t size = hci_cmd_periodic_inquiry_mode_encode(encoder_buffer, 0x0102, 0x0204, (uint32_t) 0x00020306, 0x44, 0x55);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+TEST(HCI_Command_Encoder, exit_periodic_inquiry_mode){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_exit_periodic_inquiry_mode);
+    uint16_t size = hci_cmd_exit_periodic_inquiry_mode_encode(encoder_buffer);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+TEST(HCI_Command_Encoder, create_connection){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_create_connection, &test_data[0], 0x0204, 0x33, 0x44, 0x050a, 0x66);
+    uint16_t size = hci_cmd_create_connection_encode(encoder_buffer, &test_data[0], 0x0204, 0x33, 0x44, 0x050a, 0x66);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+TEST(HCI_Command_Encoder, disconnect){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_disconnect, 0x0102, 0x22);
+    uint16_t size = hci_cmd_disconnect_encode(encoder_buffer, 0x0102, 0x22);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+TEST(HCI_Command_Encoder, create_connection_cancel){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_create_connection_cancel, &test_data[0]);
+    uint16_t size = hci_cmd_create_connection_cancel_encode(encoder_buffer, &test_data[0]);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+TEST(HCI_Command_Encoder, accept_connection_request){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_accept_connection_request, &test_data[0], 0x22);
+    uint16_t size = hci_cmd_accept_connection_request_encode(encoder_buffer, &test_data[0], 0x22);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+TEST(HCI_Command_Encoder, reject_connection_request){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_reject_connection_request, &test_data[0], 0x22);
+    uint16_t size = hci_cmd_reject_connection_request_encode(encoder_buffer, &test_data[0], 0x22);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+TEST(HCI_Command_Encoder, link_key_request_reply){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_link_key_request_reply, &test_data[0], &test_data[1]);
+    uint16_t size = hci_cmd_link_key_request_reply_encode(encoder_buffer, &test_data[0], &test_data[1]);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+TEST(HCI_Command_Encoder, link_key_request_negative_reply){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_link_key_request_negative_reply, &test_data[0]);
+    uint16_t size = hci_cmd_link_key_request_negative_reply_encode(encoder_buffer, &test_data[0]);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+TEST(HCI_Command_Encoder, pin_code_request_reply){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_pin_code_request_reply, &test_data[0], 0x22, &test_data[2]);
+    uint16_t size = hci_cmd_pin_code_request_reply_encode(encoder_buffer, &test_data[0], 0x22, &test_data[2]);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+TEST(HCI_Command_Encoder, pin_code_request_negative_reply){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_pin_code_request_negative_reply, &test_data[0]);
+    uint16_t size = hci_cmd_pin_code_request_negative_reply_encode(encoder_buffer, &test_data[0]);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+TEST(HCI_Command_Encoder, change_connection_packet_type){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_change_connection_packet_type, 0x0102, 0x0204);
+    uint16_t size = hci_cmd_change_connection_packet_type_encode(encoder_buffer, 0x0102, 0x0204);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+TEST(HCI_Command_Encoder, authentication_requested){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_authentication_requested, 0x0102);
+    uint16_t size = hci_cmd_authentication_requested_encode(encoder_buffer, 0x0102);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+TEST(HCI_Command_Encoder, set_connection_encryption){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_set_connection_encryption, 0x0102, 0x22);
+    uint16_t size = hci_cmd_set_connection_encryption_encode(encoder_buffer, 0x0102, 0x22);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+TEST(HCI_Command_Encoder, change_connection_link_key){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_change_connection_link_key, 0x0102);
+    uint16_t size = hci_cmd_change_connection_link_key_encode(encoder_buffer, 0x0102);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+TEST(HCI_Command_Encoder, remote_name_request){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_remote_name_request, &test_data[0], 0x22, 0x33, 0x0408);
+    uint16_t size = hci_cmd_remote_name_request_encode(encoder_buffer, &test_data[0], 0x22, 0x33, 0x0408);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+TEST(HCI_Command_Encoder, remote_name_request_cancel){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_remote_name_request_cancel, &test_data[0]);
+    uint16_t size = hci_cmd_remote_name_request_cancel_encode(encoder_buffer, &test_data[0]);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+TEST(HCI_Command_Encoder, read_remote_supported_features_command){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_read_remote_supported_features_command, 0x0102);
+    uint16_t size = hci_cmd_read_remote_supported_features_command_encode(encoder_buffer, 0x0102);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+TEST(HCI_Command_Encoder, read_remote_extended_features_command){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_read_remote_extended_features_command, 0x0102, 0x22);
+    uint16_t size = hci_cmd_read_remote_extended_features_command_encode(encoder_buffer, 0x0102, 0x22);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+TEST(HCI_Command_Encoder, read_remote_version_information){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_read_remote_version_information, 0x0102);
+    uint16_t size = hci_cmd_read_remote_version_information_encode(encoder_buffer, 0x0102);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+TEST(HCI_Command_Encoder, read_clock_offset){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_read_clock_offset, 0x0102);
+    uint16_t size = hci_cmd_read_clock_offset_encode(encoder_buffer, 0x0102);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+TEST(HCI_Command_Encoder, setup_synchronous_connection){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_setup_synchronous_connection, 0x0102, (uint32_t) 0x01020305, (uint32_t) 0x01020306, 0x0408, 0x050a, 0x66, 0x070e);
+    uint16_t size = hci_cmd_setup_synchronous_connection_encode(encoder_buffer, 0x0102, (uint32_t) 0x01020305, (uint32_t) 0x01020306, 0x0408, 0x050a, 0x66, 0x070e);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+TEST(HCI_Command_Encoder, accept_synchronous_connection){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_accept_synchronous_connection, &test_data[0], (uint32_t) 0x01020305, (uint32_t) 0x01020306, 0x0408, 0x050a, 0x66, 0x070e);
+    uint16_t size = hci_cmd_accept_synchronous_connection_encode(encoder_buffer, &test_data[0], (uint32_t) 0x01020305, (uint32_t) 0x01020306, 0x0408, 0x050a, 0x66, 0x070e);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+TEST(HCI_Command_Encoder, io_capability_request_reply){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_io_capability_request_reply, &test_data[0], 0x22, 0x33, 0x44);
+    uint16_t size = hci_cmd_io_capability_request_reply_encode(encoder_buffer, &test_data[0], 0x22, 0x33, 0x44);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+TEST(HCI_Command_Encoder, user_confirmation_request_reply){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_user_confirmation_request_reply, &test_data[0]);
+    uint16_t size = hci_cmd_user_confirmation_request_reply_encode(encoder_buffer, &test_data[0]);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+TEST(HCI_Command_Encoder, user_confirmation_request_negative_reply){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_user_confirmation_request_negative_reply, &test_data[0]);
+    uint16_t size = hci_cmd_user_confirmation_request_negative_reply_encode(encoder_buffer, &test_data[0]);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+TEST(HCI_Command_Encoder, user_passkey_request_reply){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_user_passkey_request_reply, &test_data[0], (uint32_t) 0x01020305);
+    uint16_t size = hci_cmd_user_passkey_request_reply_encode(encoder_buffer, &test_data[0], (uint32_t) 0x01020305);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+TEST(HCI_Command_Encoder, user_passkey_request_negative_reply){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_user_passkey_request_negative_reply, &test_data[0]);
+    uint16_t size = hci_cmd_user_passkey_request_negative_reply_encode(encoder_buffer, &test_data[0]);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+TEST(HCI_Command_Encoder, remote_oob_data_request_reply){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_remote_oob_data_request_reply, &test_data[0], &test_data[1], &test_data[2]);
+    uint16_t size = hci_cmd_remote_oob_data_request_reply_encode(encoder_buffer, &test_data[0], &test_data[1], &test_data[2]);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+TEST(HCI_Command_Encoder, remote_oob_data_request_negative_reply){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_remote_oob_data_request_negative_reply, &test_data[0]);
+    uint16_t size = hci_cmd_remote_oob_data_request_negative_reply_encode(encoder_buffer, &test_data[0]);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+TEST(HCI_Command_Encoder, io_capability_request_negative_reply){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_io_capability_request_negative_reply, &test_data[0], 0x22);
+    uint16_t size = hci_cmd_io_capability_request_negative_reply_encode(encoder_buffer, &test_data[0], 0x22);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+TEST(HCI_Command_Encoder, enhanced_setup_synchronous_connection){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_enhanced_setup_synchronous_connection, 0x0102, (uint32_t) 0x01020305, (uint32_t) 0x01020306, 0x44, 0x050a, 0x060c, 0x77, 0x0810, 0x0912, 0x0a14, 0x0b16, (uint32_t) 0x0102030f, (uint32_t) 0x01020310, 0xee, 0x0f1e, 0x0020, 0x21, 0x0224, 0x0326, 0x0428, 0x052a, 0x76, 0x87, 0x98, 0xa9, 0xba, 0xcb, 0xdc, 0xed, 0x0e3c, 0x0f3e, 0x20);
+    uint16_t size = hci_cmd_enhanced_setup_synchronous_connection_encode(encoder_buffer, 0x0102, (uint32_t) 0x01020305, (uint32_t) 0x01020306, 0x44, 0x050a, 0x060c, 0x77, 0x0810, 0x0912, 0x0a14, 0x0b16, (uint32_t) 0x0102030f, (uint32_t) 0x01020310, 0xee, 0x0f1e, 0x0020, 0x21, 0x0224, 0x0326, 0x0428, 0x052a, 0x76, 0x87, 0x98, 0xa9, 0xba, 0xcb, 0xdc, 0xed, 0x0e3c, 0x0f3e, 0x20);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+TEST(HCI_Command_Encoder, enhanced_accept_synchronous_connection){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_enhanced_accept_synchronous_connection, &test_data[0], (uint32_t) 0x01020305, (uint32_t) 0x01020306, 0x44, 0x050a, 0x060c, 0x77, 0x0810, 0x0912, 0x0a14, 0x0b16, (uint32_t) 0x0102030f, (uint32_t) 0x01020310, 0xee, 0x0f1e, 0x0020, 0x21, 0x0224, 0x0326, 0x0428, 0x052a, 0x76, 0x87, 0x98, 0xa9, 0xba, 0xcb, 0xdc, 0xed, 0x0e3c, 0x0f3e, 0x20);
+    uint16_t size = hci_cmd_enhanced_accept_synchronous_connection_encode(encoder_buffer, &test_data[0], (uint32_t) 0x01020305, (uint32_t) 0x01020306, 0x44, 0x050a, 0x060c, 0x77, 0x0810, 0x0912, 0x0a14, 0x0b16, (uint32_t) 0x0102030f, (uint32_t) 0x01020310, 0xee, 0x0f1e, 0x0020, 0x21, 0x0224, 0x0326, 0x0428, 0x052a, 0x76, 0x87, 0x98, 0xa9, 0xba, 0xcb, 0xdc, 0xed, 0x0e3c, 0x0f3e, 0x20);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+TEST(HCI_Command_Encoder, remote_oob_extended_data_request_reply){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_remote_oob_extended_data_request_reply, &test_data[0], &test_data[1], &test_data[2], &test_data[3], &test_data[4]);
+    uint16_t size = hci_cmd_remote_oob_extended_data_request_reply_encode(encoder_buffer, &test_data[0], &test_data[1], &test_data[2], &test_data[3], &test_data[4]);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+TEST(HCI_Command_Encoder, hold_mode){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_hold_mode, 0x0102, 0x0204, 0x0306);
+    uint16_t size = hci_cmd_hold_mode_encode(encoder_buffer, 0x0102, 0x0204, 0x0306);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+TEST(HCI_Command_Encoder, sniff_mode){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_sniff_mode, 0x0102, 0x0204, 0x0306, 0x0408, 0x050a);
+    uint16_t size = hci_cmd_sniff_mode_encode(encoder_buffer, 0x0102, 0x0204, 0x0306, 0x0408, 0x050a);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+TEST(HCI_Command_Encoder, exit_sniff_mode){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_exit_sniff_mode, 0x0102);
+    uint16_t size = hci_cmd_exit_sniff_mode_encode(encoder_buffer, 0x0102);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+TEST(HCI_Command_Encoder, park_state){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_park_state, 0x0102, 0x0204, 0x0306);
+    uint16_t size = hci_cmd_park_state_encode(encoder_buffer, 0x0102, 0x0204, 0x0306);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+TEST(HCI_Command_Encoder, exit_park_state){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_exit_park_state, 0x0102);
+    uint16_t size = hci_cmd_exit_park_state_encode(encoder_buffer, 0x0102);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+TEST(HCI_Command_Encoder, qos_setup){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_qos_setup, 0x0102, 0x22, 0x33, (uint32_t) 0x01020307, (uint32_t) 0x01020308, (uint32_t) 0x01020309, (uint32_t) 0x0102030a);
+    uint16_t size = hci_cmd_qos_setup_encode(encoder_buffer, 0x0102, 0x22, 0x33, (uint32_t) 0x01020307, (uint32_t) 0x01020308, (uint32_t) 0x01020309, (uint32_t) 0x0102030a);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+TEST(HCI_Command_Encoder, role_discovery){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_role_discovery, 0x0102);
+    uint16_t size = hci_cmd_role_discovery_encode(encoder_buffer, 0x0102);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+TEST(HCI_Command_Encoder, switch_role_command){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_switch_role_command, &test_data[0], 0x22);
+    uint16_t size = hci_cmd_switch_role_command_encode(encoder_buffer, &test_data[0], 0x22);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+TEST(HCI_Command_Encoder, read_link_policy_settings){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_read_link_policy_settings, 0x0102);
+    uint16_t size = hci_cmd_read_link_policy_settings_encode(encoder_buffer, 0x0102);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+TEST(HCI_Command_Encoder, write_link_policy_settings){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_write_link_policy_settings, 0x0102, 0x0204);
+    uint16_t size = hci_cmd_write_link_policy_settings_encode(encoder_buffer, 0x0102, 0x0204);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+TEST(HCI_Command_Encoder, sniff_subrating){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_sniff_subrating, 0x0102, 0x0204, 0x0306, 0x0408);
+    uint16_t size = hci_cmd_sniff_subrating_encode(encoder_buffer, 0x0102, 0x0204, 0x0306, 0x0408);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+TEST(HCI_Command_Encoder, write_default_link_policy_setting){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_write_default_link_policy_setting, 0x0102);
+    uint16_t size = hci_cmd_write_default_link_policy_setting_encode(encoder_buffer, 0x0102);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+TEST(HCI_Command_Encoder, flow_specification){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_flow_specification, 0x0102, 0x22, 0x33, 0x44, (uint32_t) 0x01020308, (uint32_t) 0x01020309, (uint32_t) 0x0102030a, (uint32_t) 0x0102030b);
+    uint16_t size = hci_cmd_flow_specification_encode(encoder_buffer, 0x0102, 0x22, 0x33, 0x44, (uint32_t) 0x01020308, (uint32_t) 0x01020309, (uint32_t) 0x0102030a, (uint32_t) 0x0102030b);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+TEST(HCI_Command_Encoder, set_event_mask){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_set_event_mask, (uint32_t) 0x01020304, (uint32_t) 0x01020305);
+    uint16_t size = hci_cmd_set_event_mask_encode(encoder_buffer, (uint32_t) 0x01020304, (uint32_t) 0x01020305);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+TEST(HCI_Command_Encoder, reset){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_reset);
+    uint16_t size = hci_cmd_reset_encode(encoder_buffer);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+TEST(HCI_Command_Encoder, flush){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_flush, 0x0102);
+    uint16_t size = hci_cmd_flush_encode(encoder_buffer, 0x0102);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+TEST(HCI_Command_Encoder, read_pin_type){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_read_pin_type);
+    uint16_t size = hci_cmd_read_pin_type_encode(encoder_buffer);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+TEST(HCI_Command_Encoder, write_pin_type){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_write_pin_type, 0x11);
+    uint16_t size = hci_cmd_write_pin_type_encode(encoder_buffer, 0x11);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+TEST(HCI_Command_Encoder, delete_stored_link_key){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_delete_stored_link_key, &test_data[0], 0x22);
+    uint16_t size = hci_cmd_delete_stored_link_key_encode(encoder_buffer, &test_data[0], 0x22);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+#ifdef ENABLE_CLASSIC
+TEST(HCI_Command_Encoder, write_local_name){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_write_local_name, "BTstack HCI Command Encoder");
+    uint16_t size = hci_cmd_write_local_name_encode(encoder_buffer, "BTstack HCI Command Encoder");
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+#endif
+
+TEST(HCI_Command_Encoder, read_local_name){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_read_local_name);
+    uint16_t size = hci_cmd_read_local_name_encode(encoder_buffer);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+TEST(HCI_Command_Encoder, read_page_timeout){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_read_page_timeout);
+    uint16_t size = hci_cmd_read_page_timeout_encode(encoder_buffer);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+TEST(HCI_Command_Encoder, write_page_timeout){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_write_page_timeout, 0x0102);
+    uint16_t size = hci_cmd_write_page_timeout_encode(encoder_buffer, 0x0102);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+TEST(HCI_Command_Encoder, write_scan_enable){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_write_scan_enable, 0x11);
+    uint16_t size = hci_cmd_write_scan_enable_encode(encoder_buffer, 0x11);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+TEST(HCI_Command_Encoder, read_page_scan_activity){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_read_page_scan_activity);
+    uint16_t size = hci_cmd_read_page_scan_activity_encode(encoder_buffer);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+TEST(HCI_Command_Encoder, write_page_scan_activity){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_write_page_scan_activity, 0x0102, 0x0204);
+    uint16_t size = hci_cmd_write_page_scan_activity_encode(encoder_buffer, 0x0102, 0x0204);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+TEST(HCI_Command_Encoder, read_inquiry_scan_activity){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_read_inquiry_scan_activity);
+    uint16_t size = hci_cmd_read_inquiry_scan_activity_encode(encoder_buffer);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+TEST(HCI_Command_Encoder, write_inquiry_scan_activity){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_write_inquiry_scan_activity, 0x0102, 0x0204);
+    uint16_t size = hci_cmd_write_inquiry_scan_activity_encode(encoder_buffer, 0x0102, 0x0204);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+TEST(HCI_Command_Encoder, write_authentication_enable){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_write_authentication_enable, 0x11);
+    uint16_t size = hci_cmd_write_authentication_enable_encode(encoder_buffer, 0x11);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+TEST(HCI_Command_Encoder, write_automatic_flush_timeout){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_write_automatic_flush_timeout, 0x0102, 0x0204);
+    uint16_t size = hci_cmd_write_automatic_flush_timeout_encode(encoder_buffer, 0x0102, 0x0204);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+TEST(HCI_Command_Encoder, write_class_of_device){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_write_class_of_device, (uint32_t) 0x00020304);
+    uint16_t size = hci_cmd_write_class_of_device_encode(encoder_buffer, (uint32_t) 0x00020304);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+TEST(HCI_Command_Encoder, read_num_broadcast_retransmissions){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_read_num_broadcast_retransmissions);
+    uint16_t size = hci_cmd_read_num_broadcast_retransmissions_encode(encoder_buffer);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+TEST(HCI_Command_Encoder, write_num_broadcast_retransmissions){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_write_num_broadcast_retransmissions, 0x11);
+    uint16_t size = hci_cmd_write_num_broadcast_retransmissions_encode(encoder_buffer, 0x11);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+TEST(HCI_Command_Encoder, read_transmit_power_level){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_read_transmit_power_level, 0x0102, 0x22);
+    uint16_t size = hci_cmd_read_transmit_power_level_encode(encoder_buffer, 0x0102, 0x22);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+TEST(HCI_Command_Encoder, write_synchronous_flow_control_enable){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_write_synchronous_flow_control_enable, 0x11);
+    uint16_t size = hci_cmd_write_synchronous_flow_control_enable_encode(encoder_buffer, 0x11);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+#ifdef ENABLE_HCI_CONTROLLER_TO_HOST_FLOW_CONTROL
+TEST(HCI_Command_Encoder, set_controller_to_host_flow_control){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_set_controller_to_host_flow_control, 0x11);
+    uint16_t size = hci_cmd_set_controller_to_host_flow_control_encode(encoder_buffer, 0x11);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+#endif
+
+#ifdef ENABLE_HCI_CONTROLLER_TO_HOST_FLOW_CONTROL
+TEST(HCI_Command_Encoder, host_buffer_size){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_host_buffer_size, 0x0102, 0x22, 0x0306, 0x0408);
+    uint16_t size = hci_cmd_host_buffer_size_encode(encoder_buffer, 0x0102, 0x22, 0x0306, 0x0408);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+#endif
+
+TEST(HCI_Command_Encoder, read_link_supervision_timeout){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_read_link_supervision_timeout, 0x0102);
+    uint16_t size = hci_cmd_read_link_supervision_timeout_encode(encoder_buffer, 0x0102);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+TEST(HCI_Command_Encoder, write_link_supervision_timeout){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_write_link_supervision_timeout, 0x0102, 0x0204);
+    uint16_t size = hci_cmd_write_link_supervision_timeout_encode(encoder_buffer, 0x0102, 0x0204);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+TEST(HCI_Command_Encoder, write_current_iac_lap_two_iacs){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_write_current_iac_lap_two_iacs, 0x11, (uint32_t) 0x00020305, (uint32_t) 0x00020306);
+    uint16_t size = hci_cmd_write_current_iac_lap_two_iacs_encode(encoder_buffer, 0x11, (uint32_t) 0x00020305, (uint32_t) 0x00020306);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+TEST(HCI_Command_Encoder, write_inquiry_scan_type){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_write_inquiry_scan_type, 0x11);
+    uint16_t size = hci_cmd_write_inquiry_scan_type_encode(encoder_buffer, 0x11);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+TEST(HCI_Command_Encoder, write_inquiry_mode){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_write_inquiry_mode, 0x11);
+    uint16_t size = hci_cmd_write_inquiry_mode_encode(encoder_buffer, 0x11);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+TEST(HCI_Command_Encoder, write_page_scan_type){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_write_page_scan_type, 0x11);
+    uint16_t size = hci_cmd_write_page_scan_type_encode(encoder_buffer, 0x11);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+TEST(HCI_Command_Encoder, write_extended_inquiry_response){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_write_extended_inquiry_response, 0x11, &test_data[1]);
+    uint16_t size = hci_cmd_write_extended_inquiry_response_encode(encoder_buffer, 0x11, &test_data[1]);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+TEST(HCI_Command_Encoder, write_simple_pairing_mode){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_write_simple_pairing_mode, 0x11);
+    uint16_t size = hci_cmd_write_simple_pairing_mode_encode(encoder_buffer, 0x11);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+TEST(HCI_Command_Encoder, read_local_oob_data){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_read_local_oob_data);
+    uint16_t size = hci_cmd_read_local_oob_data_encode(encoder_buffer);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+TEST(HCI_Command_Encoder, read_inquiry_response_transmit_power_level){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_read_inquiry_response_transmit_power_level);
+    uint16_t size = hci_cmd_read_inquiry_response_transmit_power_level_encode(encoder_buffer);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+TEST(HCI_Command_Encoder, write_inquiry_transmit_power_level){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_write_inquiry_transmit_power_level, 0x11);
+    uint16_t size = hci_cmd_write_inquiry_transmit_power_level_encode(encoder_buffer, 0x11);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+TEST(HCI_Command_Encoder, write_default_erroneous_data_reporting){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_write_default_erroneous_data_reporting, 0x11);
+    uint16_t size = hci_cmd_write_default_erroneous_data_reporting_encode(encoder_buffer, 0x11);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+TEST(HCI_Command_Encoder, set_event_mask_2){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_set_event_mask_2, (uint32_t) 0x01020304, (uint32_t) 0x01020305);
+    uint16_t size = hci_cmd_set_event_mask_2_encode(encoder_buffer, (uint32_t) 0x01020304, (uint32_t) 0x01020305);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+TEST(HCI_Command_Encoder, read_le_host_supported){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_read_le_host_supported);
+    uint16_t size = hci_cmd_read_le_host_supported_encode(encoder_buffer);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+TEST(HCI_Command_Encoder, write_le_host_supported){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_write_le_host_supported, 0x11, 0x22);
+    uint16_t size = hci_cmd_write_le_host_supported_encode(encoder_buffer, 0x11, 0x22);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+TEST(HCI_Command_Encoder, write_secure_connections_host_support){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_write_secure_connections_host_support, 0x11);
+    uint16_t size = hci_cmd_write_secure_connections_host_support_encode(encoder_buffer, 0x11);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+TEST(HCI_Command_Encoder, read_local_extended_oob_data){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_read_local_extended_oob_data);
+    uint16_t size = hci_cmd_read_local_extended_oob_data_encode(encoder_buffer);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+TEST(HCI_Command_Encoder, read_extended_page_timeout){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_read_extended_page_timeout);
+    uint16_t size = hci_cmd_read_extended_page_timeout_encode(encoder_buffer);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+TEST(HCI_Command_Encoder, write_extended_page_timeout){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_write_extended_page_timeout, 0x0102);
+    uint16_t size = hci_cmd_write_extended_page_timeout_encode(encoder_buffer, 0x0102);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+TEST(HCI_Command_Encoder, read_extended_inquiry_length){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_read_extended_inquiry_length);
+    uint16_t size = hci_cmd_read_extended_inquiry_length_encode(encoder_buffer);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+TEST(HCI_Command_Encoder, write_extended_inquiry_length){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_write_extended_inquiry_length, 0x0102);
+    uint16_t size = hci_cmd_write_extended_inquiry_length_encode(encoder_buffer, 0x0102);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+TEST(HCI_Command_Encoder, set_ecosystem_base_interval){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_set_ecosystem_base_interval, 0x0102);
+    uint16_t size = hci_cmd_set_ecosystem_base_interval_encode(encoder_buffer, 0x0102);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+TEST(HCI_Command_Encoder, set_min_encryption_key_size){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_set_min_encryption_key_size, 0x11);
+    uint16_t size = hci_cmd_set_min_encryption_key_size_encode(encoder_buffer, 0x11);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+TEST(HCI_Command_Encoder, read_loopback_mode){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_read_loopback_mode);
+    uint16_t size = hci_cmd_read_loopback_mode_encode(encoder_buffer);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+TEST(HCI_Command_Encoder, write_loopback_mode){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_write_loopback_mode, 0x11);
+    uint16_t size = hci_cmd_write_loopback_mode_encode(encoder_buffer, 0x11);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+TEST(HCI_Command_Encoder, enable_device_under_test_mode){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_enable_device_under_test_mode);
+    uint16_t size = hci_cmd_enable_device_under_test_mode_encode(encoder_buffer);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+TEST(HCI_Command_Encoder, write_simple_pairing_debug_mode){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_write_simple_pairing_debug_mode, 0x11);
+    uint16_t size = hci_cmd_write_simple_pairing_debug_mode_encode(encoder_buffer, 0x11);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+TEST(HCI_Command_Encoder, write_secure_connections_test_mode){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_write_secure_connections_test_mode, 0x0102, 0x22, 0x33);
+    uint16_t size = hci_cmd_write_secure_connections_test_mode_encode(encoder_buffer, 0x0102, 0x22, 0x33);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+TEST(HCI_Command_Encoder, read_local_version_information){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_read_local_version_information);
+    uint16_t size = hci_cmd_read_local_version_information_encode(encoder_buffer);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+TEST(HCI_Command_Encoder, read_local_supported_commands){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_read_local_supported_commands);
+    uint16_t size = hci_cmd_read_local_supported_commands_encode(encoder_buffer);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+TEST(HCI_Command_Encoder, read_local_supported_features){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_read_local_supported_features);
+    uint16_t size = hci_cmd_read_local_supported_features_encode(encoder_buffer);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+TEST(HCI_Command_Encoder, read_buffer_size){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_read_buffer_size);
+    uint16_t size = hci_cmd_read_buffer_size_encode(encoder_buffer);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+TEST(HCI_Command_Encoder, read_bd_addr){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_read_bd_addr);
+    uint16_t size = hci_cmd_read_bd_addr_encode(encoder_buffer);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+TEST(HCI_Command_Encoder, read_failed_contact_counter){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_read_failed_contact_counter, 0x0102);
+    uint16_t size = hci_cmd_read_failed_contact_counter_encode(encoder_buffer, 0x0102);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+TEST(HCI_Command_Encoder, reset_failed_contact_counter){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_reset_failed_contact_counter, 0x0102);
+    uint16_t size = hci_cmd_reset_failed_contact_counter_encode(encoder_buffer, 0x0102);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+TEST(HCI_Command_Encoder, read_link_quality){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_read_link_quality, 0x0102);
+    uint16_t size = hci_cmd_read_link_quality_encode(encoder_buffer, 0x0102);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+TEST(HCI_Command_Encoder, read_rssi){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_read_rssi, 0x0102);
+    uint16_t size = hci_cmd_read_rssi_encode(encoder_buffer, 0x0102);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+TEST(HCI_Command_Encoder, read_clock){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_read_clock, 0x0102, 0x22);
+    uint16_t size = hci_cmd_read_clock_encode(encoder_buffer, 0x0102, 0x22);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+TEST(HCI_Command_Encoder, read_encryption_key_size){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_read_encryption_key_size, 0x0102);
+    uint16_t size = hci_cmd_read_encryption_key_size_encode(encoder_buffer, 0x0102);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+#ifdef ENABLE_BLE
+TEST(HCI_Command_Encoder, le_set_event_mask){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_le_set_event_mask, (uint32_t) 0x01020304, (uint32_t) 0x01020305);
+    uint16_t size = hci_cmd_le_set_event_mask_encode(encoder_buffer, (uint32_t) 0x01020304, (uint32_t) 0x01020305);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+#endif
+
+#ifdef ENABLE_BLE
+TEST(HCI_Command_Encoder, le_read_buffer_size){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_le_read_buffer_size);
+    uint16_t size = hci_cmd_le_read_buffer_size_encode(encoder_buffer);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+#endif
+
+#ifdef ENABLE_BLE
+TEST(HCI_Command_Encoder, le_read_local_supported_features){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_le_read_local_supported_features);
+    uint16_t size = hci_cmd_le_read_local_supported_features_encode(encoder_buffer);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+#endif
+
+#ifdef ENABLE_BLE
+TEST(HCI_Command_Encoder, le_set_random_address){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_le_set_random_address, &test_data[0]);
+    uint16_t size = hci_cmd_le_set_random_address_encode(encoder_buffer, &test_data[0]);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+#endif
+
+#ifdef ENABLE_BLE
+TEST(HCI_Command_Encoder, le_set_advertising_parameters){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_le_set_advertising_parameters, 0x0102, 0x0204, 0x33, 0x44, 0x55, &test_data[5], 0x77, 0x88);
+    uint16_t size = hci_cmd_le_set_advertising_parameters_encode(encoder_buffer, 0x0102, 0x0204, 0x33, 0x44, 0x55, &test_data[5], 0x77, 0x88);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+#endif
+
+#ifdef ENABLE_BLE
+TEST(HCI_Command_Encoder, le_read_advertising_channel_tx_power){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_le_read_advertising_channel_tx_power);
+    uint16_t size = hci_cmd_le_read_advertising_channel_tx_power_encode(encoder_buffer);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+#endif
+
+#ifdef ENABLE_BLE
+TEST(HCI_Command_Encoder, le_set_advertising_data){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_le_set_advertising_data, 0x11, &test_data[1]);
+    uint16_t size = hci_cmd_le_set_advertising_data_encode(encoder_buffer, 0x11, &test_data[1]);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+#endif
+
+#ifdef ENABLE_BLE
+TEST(HCI_Command_Encoder, le_set_scan_response_data){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_le_set_scan_response_data, 0x11, &test_data[1]);
+    uint16_t size = hci_cmd_le_set_scan_response_data_encode(encoder_buffer, 0x11, &test_data[1]);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+#endif
+
+#ifdef ENABLE_BLE
+TEST(HCI_Command_Encoder, le_set_advertise_enable){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_le_set_advertise_enable, 0x11);
+    uint16_t size = hci_cmd_le_set_advertise_enable_encode(encoder_buffer, 0x11);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+#endif
+
+#ifdef ENABLE_BLE
+TEST(HCI_Command_Encoder, le_set_scan_parameters){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_le_set_scan_parameters, 0x11, 0x0204, 0x0306, 0x44, 0x55);
+    uint16_t size = hci_cmd_le_set_scan_parameters_encode(encoder_buffer, 0x11, 0x0204, 0x0306, 0x44, 0x55);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+#endif
+
+#ifdef ENABLE_BLE
+TEST(HCI_Command_Encoder, le_set_scan_enable){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_le_set_scan_enable, 0x11, 0x22);
+    uint16_t size = hci_cmd_le_set_scan_enable_encode(encoder_buffer, 0x11, 0x22);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+#endif
+
+#ifdef ENABLE_BLE
+TEST(HCI_Command_Encoder, le_create_connection){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_le_create_connection, 0x0102, 0x0204, 0x33, 0x44, &test_data[4], 0x66, 0x070e, 0x0810, 0x0912, 0x0a14, 0x0b16, 0x0c18);
+    uint16_t size = hci_cmd_le_create_connection_encode(encoder_buffer, 0x0102, 0x0204, 0x33, 0x44, &test_data[4], 0x66, 0x070e, 0x0810, 0x0912, 0x0a14, 0x0b16, 0x0c18);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+#endif
+
+#ifdef ENABLE_BLE
+TEST(HCI_Command_Encoder, le_create_connection_cancel){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_le_create_connection_cancel);
+    uint16_t size = hci_cmd_le_create_connection_cancel_encode(encoder_buffer);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+#endif
+
+#ifdef ENABLE_BLE
+TEST(HCI_Command_Encoder, le_read_white_list_size){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_le_read_white_list_size);
+    uint16_t size = hci_cmd_le_read_white_list_size_encode(encoder_buffer);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+#endif
+
+#ifdef ENABLE_BLE
+TEST(HCI_Command_Encoder, le_clear_white_list){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_le_clear_white_list);
+    uint16_t size = hci_cmd_le_clear_white_list_encode(encoder_buffer);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+#endif
+
+#ifdef ENABLE_BLE
+TEST(HCI_Command_Encoder, le_add_device_to_white_list){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_le_add_device_to_white_list, 0x11, &test_data[1]);
+    uint16_t size = hci_cmd_le_add_device_to_white_list_encode(encoder_buffer, 0x11, &test_data[1]);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+#endif
+
+#ifdef ENABLE_BLE
+TEST(HCI_Command_Encoder, le_remove_device_from_white_list){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_le_remove_device_from_white_list, 0x11, &test_data[1]);
+    uint16_t size = hci_cmd_le_remove_device_from_white_list_encode(encoder_buffer, 0x11, &test_data[1]);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+#endif
+
+#ifdef ENABLE_BLE
+TEST(HCI_Command_Encoder, le_connection_update){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_le_connection_update, 0x0102, 0x0204, 0x0306, 0x0408, 0x050a, 0x060c, 0x070e);
+    uint16_t size = hci_cmd_le_connection_update_encode(encoder_buffer, 0x0102, 0x0204, 0x0306, 0x0408, 0x050a, 0x060c, 0x070e);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+#endif
+
+#ifdef ENABLE_BLE
+TEST(HCI_Command_Encoder, le_set_host_channel_classification){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_le_set_host_channel_classification, (uint32_t) 0x01020304, 0x22);
+    uint16_t size = hci_cmd_le_set_host_channel_classification_encode(encoder_buffer, (uint32_t) 0x01020304, 0x22);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+#endif
+
+#ifdef ENABLE_BLE
+TEST(HCI_Command_Encoder, le_read_channel_map){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_le_read_channel_map, 0x0102);
+    uint16_t size = hci_cmd_le_read_channel_map_encode(encoder_buffer, 0x0102);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+#endif
+
+#ifdef ENABLE_BLE
+TEST(HCI_Command_Encoder, le_read_remote_used_features){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_le_read_remote_used_features, 0x0102);
+    uint16_t size = hci_cmd_le_read_remote_used_features_encode(encoder_buffer, 0x0102);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+#endif
+
+#ifdef ENABLE_BLE
+TEST(HCI_Command_Encoder, le_encrypt){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_le_encrypt, &test_data[0], &test_data[1]);
+    uint16_t size = hci_cmd_le_encrypt_encode(encoder_buffer, &test_data[0], &test_data[1]);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+#endif
+
+#ifdef ENABLE_BLE
+TEST(HCI_Command_Encoder, le_rand){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_le_rand);
+    uint16_t size = hci_cmd_le_rand_encode(encoder_buffer);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+#endif
+
+#ifdef ENABLE_BLE
+TEST(HCI_Command_Encoder, le_start_encryption){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_le_start_encryption, 0x0102, (uint32_t) 0x01020305, (uint32_t) 0x01020306, 0x0408, &test_data[4]);
+    uint16_t size = hci_cmd_le_start_encryption_encode(encoder_buffer, 0x0102, (uint32_t) 0x01020305, (uint32_t) 0x01020306, 0x0408, &test_data[4]);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+#endif
+
+#ifdef ENABLE_BLE
+TEST(HCI_Command_Encoder, le_long_term_key_request_reply){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_le_long_term_key_request_reply, 0x0102, &test_data[1]);
+    uint16_t size = hci_cmd_le_long_term_key_request_reply_encode(encoder_buffer, 0x0102, &test_data[1]);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+#endif
+
+#ifdef ENABLE_BLE
+TEST(HCI_Command_Encoder, le_long_term_key_negative_reply){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_le_long_term_key_negative_reply, 0x0102);
+    uint16_t size = hci_cmd_le_long_term_key_negative_reply_encode(encoder_buffer, 0x0102);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+#endif
+
+#ifdef ENABLE_BLE
+TEST(HCI_Command_Encoder, le_read_supported_states){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_le_read_supported_states, 0x0102);
+    uint16_t size = hci_cmd_le_read_supported_states_encode(encoder_buffer, 0x0102);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+#endif
+
+#ifdef ENABLE_BLE
+TEST(HCI_Command_Encoder, le_receiver_test){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_le_receiver_test, 0x11);
+    uint16_t size = hci_cmd_le_receiver_test_encode(encoder_buffer, 0x11);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+#endif
+
+#ifdef ENABLE_BLE
+TEST(HCI_Command_Encoder, le_transmitter_test){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_le_transmitter_test, 0x11, 0x22, 0x33);
+    uint16_t size = hci_cmd_le_transmitter_test_encode(encoder_buffer, 0x11, 0x22, 0x33);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+#endif
+
+#ifdef ENABLE_BLE
+TEST(HCI_Command_Encoder, le_test_end){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_le_test_end, 0x11);
+    uint16_t size = hci_cmd_le_test_end_encode(encoder_buffer, 0x11);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+#endif
+
+#ifdef ENABLE_BLE
+TEST(HCI_Command_Encoder, le_remote_connection_parameter_request_reply){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_le_remote_connection_parameter_request_reply, 0x0102, 0x0204, 0x0306, 0x0408, 0x050a, 0x060c, 0x070e);
+    uint16_t size = hci_cmd_le_remote_connection_parameter_request_reply_encode(encoder_buffer, 0x0102, 0x0204, 0x0306, 0x0408, 0x050a, 0x060c, 0x070e);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+#endif
+
+#ifdef ENABLE_BLE
+TEST(HCI_Command_Encoder, le_remote_connection_parameter_request_negative_reply){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_le_remote_connection_parameter_request_negative_reply, 0x0102, 0x22);
+    uint16_t size = hci_cmd_le_remote_connection_parameter_request_negative_reply_encode(encoder_buffer, 0x0102, 0x22);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+#endif
+
+#ifdef ENABLE_BLE
+TEST(HCI_Command_Encoder, le_set_data_length){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_le_set_data_length, 0x0102, 0x0204, 0x0306);
+    uint16_t size = hci_cmd_le_set_data_length_encode(encoder_buffer, 0x0102, 0x0204, 0x0306);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+#endif
+
+#ifdef ENABLE_BLE
+TEST(HCI_Command_Encoder, le_read_suggested_default_data_length){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_le_read_suggested_default_data_length);
+    uint16_t size = hci_cmd_le_read_suggested_default_data_length_encode(encoder_buffer);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+#endif
+
+#ifdef ENABLE_BLE
+TEST(HCI_Command_Encoder, le_write_suggested_default_data_length){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_le_write_suggested_default_data_length, 0x0102, 0x0204);
+    uint16_t size = hci_cmd_le_write_suggested_default_data_length_encode(encoder_buffer, 0x0102, 0x0204);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+#endif
+
+#ifdef ENABLE_BLE
+TEST(HCI_Command_Encoder, le_read_local_p256_public_key){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_le_read_local_p256_public_key);
+    uint16_t size = hci_cmd_le_read_local_p256_public_key_encode(encoder_buffer);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+#endif
+
+#ifdef ENABLE_BLE
+#ifdef ENABLE_LE_SECURE_CONNECTIONS
+TEST(HCI_Command_Encoder, le_generate_dhkey){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_le_generate_dhkey, &test_data[0], &test_data[1]);
+    uint16_t size = hci_cmd_le_generate_dhkey_encode(encoder_buffer, &test_data[0], &test_data[1]);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+#endif
+#endif
+
+#ifdef ENABLE_BLE
+TEST(HCI_Command_Encoder, le_add_device_to_resolving_list){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_le_add_device_to_resolving_list, 0x11, &test_data[1], &test_data[2], &test_data[3]);
+    uint16_t size = hci_cmd_le_add_device_to_resolving_list_encode(encoder_buffer, 0x11, &test_data[1], &test_data[2], &test_data[3]);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+#endif
+
+#ifdef ENABLE_BLE
+TEST(HCI_Command_Encoder, le_remove_device_from_resolving_list){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_le_remove_device_from_resolving_list, 0x11, &test_data[1]);
+    uint16_t size = hci_cmd_le_remove_device_from_resolving_list_encode(encoder_buffer, 0x11, &test_data[1]);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+#endif
+
+#ifdef ENABLE_BLE
+TEST(HCI_Command_Encoder, le_clear_resolving_list){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_le_clear_resolving_list);
+    uint16_t size = hci_cmd_le_clear_resolving_list_encode(encoder_buffer);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+#endif
+
+#ifdef ENABLE_BLE
+TEST(HCI_Command_Encoder, le_read_resolving_list_size){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_le_read_resolving_list_size);
+    uint16_t size = hci_cmd_le_read_resolving_list_size_encode(encoder_buffer);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+#endif
+
+#ifdef ENABLE_BLE
+TEST(HCI_Command_Encoder, le_read_peer_resolvable_address){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_le_read_peer_resolvable_address);
+    uint16_t size = hci_cmd_le_read_peer_resolvable_address_encode(encoder_buffer);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+#endif
+
+#ifdef ENABLE_BLE
+TEST(HCI_Command_Encoder, le_read_local_resolvable_address){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_le_read_local_resolvable_address);
+    uint16_t size = hci_cmd_le_read_local_resolvable_address_encode(encoder_buffer);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+#endif
+
+#ifdef ENABLE_BLE
+TEST(HCI_Command_Encoder, le_set_address_resolution_enabled){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_le_set_address_resolution_enabled, 0x11);
+    uint16_t size = hci_cmd_le_set_address_resolution_enabled_encode(encoder_buffer, 0x11);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+#endif
+
+#ifdef ENABLE_BLE
+TEST(HCI_Command_Encoder, le_set_resolvable_private_address_timeout){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_le_set_resolvable_private_address_timeout, 0x0102);
+    uint16_t size = hci_cmd_le_set_resolvable_private_address_timeout_encode(encoder_buffer, 0x0102);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+#endif
+
+#ifdef ENABLE_BLE
+TEST(HCI_Command_Encoder, le_read_maximum_data_length){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_le_read_maximum_data_length);
+    uint16_t size = hci_cmd_le_read_maximum_data_length_encode(encoder_buffer);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+#endif
+
+#ifdef ENABLE_BLE
+TEST(HCI_Command_Encoder, le_read_phy){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_le_read_phy, 0x0102);
+    uint16_t size = hci_cmd_le_read_phy_encode(encoder_buffer, 0x0102);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+#endif
+
+#ifdef ENABLE_BLE
+TEST(HCI_Command_Encoder, le_set_default_phy){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_le_set_default_phy, 0x11, 0x22, 0x33);
+    uint16_t size = hci_cmd_le_set_default_phy_encode(encoder_buffer, 0x11, 0x22, 0x33);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+#endif
+
+#ifdef ENABLE_BLE
+TEST(HCI_Command_Encoder, le_set_phy){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_le_set_phy, 0x0102, 0x22, 0x33, 0x44, 0x050a);
+    uint16_t size = hci_cmd_le_set_phy_encode(encoder_buffer, 0x0102, 0x22, 0x33, 0x44, 0x050a);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+#endif
+
+#ifdef ENABLE_BLE
+TEST(HCI_Command_Encoder, le_receiver_test_v2){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_le_receiver_test_v2, 0x11, 0x22, 0x33);
+    uint16_t size = hci_cmd_le_receiver_test_v2_encode(encoder_buffer, 0x11, 0x22, 0x33);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+#endif
+
+#ifdef ENABLE_BLE
+TEST(HCI_Command_Encoder, le_transmitter_test_v2){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_le_transmitter_test_v2, 0x11, 0x22, 0x33, 0x44);
+    uint16_t size = hci_cmd_le_transmitter_test_v2_encode(encoder_buffer, 0x11, 0x22, 0x33, 0x44);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+#endif
+
+#ifdef ENABLE_BLE
+TEST(HCI_Command_Encoder, le_set_advertising_set_random_address){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_le_set_advertising_set_random_address, 0x11, &test_data[1]);
+    uint16_t size = hci_cmd_le_set_advertising_set_random_address_encode(encoder_buffer, 0x11, &test_data[1]);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+#endif
+
+#ifdef ENABLE_BLE
+TEST(HCI_Command_Encoder, le_set_extended_advertising_parameters){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_le_set_extended_advertising_parameters, 0x11, 0x0204, (uint32_t) 0x00020306, (uint32_t) 0x00020307, 0x55, 0x66, 0x77, &test_data[7], 0x99, 0xaa, 0xbb, 0xcc, 0xdd, 0xee, 0xff);
+    uint16_t size = hci_cmd_le_set_extended_advertising_parameters_encode(encoder_buffer, 0x11, 0x0204, (uint32_t) 0x00020306, (uint32_t) 0x00020307, 0x55, 0x66, 0x77, &test_data[7], 0x99, 0xaa, 0xbb, 0xcc, 0xdd, 0xee, 0xff);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+#endif
+
+#ifdef ENABLE_BLE
+TEST(HCI_Command_Encoder, le_read_maximum_advertising_data_length){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_le_read_maximum_advertising_data_length);
+    uint16_t size = hci_cmd_le_read_maximum_advertising_data_length_encode(encoder_buffer);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+#endif
+
+#ifdef ENABLE_BLE
+TEST(HCI_Command_Encoder, le_read_number_of_supported_advertising_sets){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_le_read_number_of_supported_advertising_sets);
+    uint16_t size = hci_cmd_le_read_number_of_supported_advertising_sets_encode(encoder_buffer);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+#endif
+
+#ifdef ENABLE_BLE
+TEST(HCI_Command_Encoder, le_remove_advertising_set){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_le_remove_advertising_set, 0x11);
+    uint16_t size = hci_cmd_le_remove_advertising_set_encode(encoder_buffer, 0x11);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+#endif
+
+#ifdef ENABLE_BLE
+TEST(HCI_Command_Encoder, le_clear_advertising_sets){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_le_clear_advertising_sets);
+    uint16_t size = hci_cmd_le_clear_advertising_sets_encode(encoder_buffer);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+#endif
+
+#ifdef ENABLE_BLE
+TEST(HCI_Command_Encoder, le_set_periodic_advertising_parameters){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_le_set_periodic_advertising_parameters, 0x11, 0x0204, 0x0306, 0x0408);
+    uint16_t size = hci_cmd_le_set_periodic_advertising_parameters_encode(encoder_buffer, 0x11, 0x0204, 0x0306, 0x0408);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+#endif
+
+#ifdef ENABLE_BLE
+TEST(HCI_Command_Encoder, le_set_periodic_advertising_enable){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_le_set_periodic_advertising_enable, 0x11, 0x22);
+    uint16_t size = hci_cmd_le_set_periodic_advertising_enable_encode(encoder_buffer, 0x11, 0x22);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+#endif
+
+#ifdef ENABLE_BLE
+TEST(HCI_Command_Encoder, le_set_extended_scan_enable){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_le_set_extended_scan_enable, 0x11, 0x22, 0x0306, 0x0408);
+    uint16_t size = hci_cmd_le_set_extended_scan_enable_encode(encoder_buffer, 0x11, 0x22, 0x0306, 0x0408);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+#endif
+
+#ifdef ENABLE_BLE
+TEST(HCI_Command_Encoder, le_periodic_advertising_create_sync){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_le_periodic_advertising_create_sync, 0x11, 0x22, 0x33, &test_data[3], 0x050a, 0x060c, 0x77);
+    uint16_t size = hci_cmd_le_periodic_advertising_create_sync_encode(encoder_buffer, 0x11, 0x22, 0x33, &test_data[3], 0x050a, 0x060c, 0x77);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+#endif
+
+#ifdef ENABLE_BLE
+TEST(HCI_Command_Encoder, le_periodic_advertising_create_sync_cancel){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_le_periodic_advertising_create_sync_cancel);
+    uint16_t size = hci_cmd_le_periodic_advertising_create_sync_cancel_encode(encoder_buffer);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+#endif
+
+#ifdef ENABLE_BLE
+TEST(HCI_Command_Encoder, le_periodic_advertising_terminate_sync){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_le_periodic_advertising_terminate_sync, 0x0102);
+    uint16_t size = hci_cmd_le_periodic_advertising_terminate_sync_encode(encoder_buffer, 0x0102);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+#endif
+
+#ifdef ENABLE_BLE
+TEST(HCI_Command_Encoder, le_add_device_to_periodic_advertiser_list){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_le_add_device_to_periodic_advertiser_list, 0x11, &test_data[1], 0x33);
+    uint16_t size = hci_cmd_le_add_device_to_periodic_advertiser_list_encode(encoder_buffer, 0x11, &test_data[1], 0x33);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+#endif
+
+#ifdef ENABLE_BLE
+TEST(HCI_Command_Encoder, le_remove_device_from_periodic_advertiser_list){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_le_remove_device_from_periodic_advertiser_list, 0x11, &test_data[1], 0x33);
+    uint16_t size = hci_cmd_le_remove_device_from_periodic_advertiser_list_encode(encoder_buffer, 0x11, &test_data[1], 0x33);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+#endif
+
+#ifdef ENABLE_BLE
+TEST(HCI_Command_Encoder, le_clear_periodic_advertiser_list){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_le_clear_periodic_advertiser_list);
+    uint16_t size = hci_cmd_le_clear_periodic_advertiser_list_encode(encoder_buffer);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+#endif
+
+#ifdef ENABLE_BLE
+TEST(HCI_Command_Encoder, le_read_periodic_advertiser_list_size){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_le_read_periodic_advertiser_list_size);
+    uint16_t size = hci_cmd_le_read_periodic_advertiser_list_size_encode(encoder_buffer);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+#endif
+
+#ifdef ENABLE_BLE
+TEST(HCI_Command_Encoder, le_read_transmit_power){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_le_read_transmit_power);
+    uint16_t size = hci_cmd_le_read_transmit_power_encode(encoder_buffer);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+#endif
+
+#ifdef ENABLE_BLE
+TEST(HCI_Command_Encoder, le_read_rf_path_compensation){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_le_read_rf_path_compensation);
+    uint16_t size = hci_cmd_le_read_rf_path_compensation_encode(encoder_buffer);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+#endif
+
+#ifdef ENABLE_BLE
+TEST(HCI_Command_Encoder, le_write_rf_path_compensation){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_le_write_rf_path_compensation, 0x0102, 0x0204);
+    uint16_t size = hci_cmd_le_write_rf_path_compensation_encode(encoder_buffer, 0x0102, 0x0204);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+#endif
+
+#ifdef ENABLE_BLE
+TEST(HCI_Command_Encoder, le_set_privacy_mode){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_le_set_privacy_mode, 0x11, &test_data[1], 0x33);
+    uint16_t size = hci_cmd_le_set_privacy_mode_encode(encoder_buffer, 0x11, &test_data[1], 0x33);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+#endif
+
+#ifdef ENABLE_BLE
+TEST(HCI_Command_Encoder, le_set_connectionless_cte_transmit_enable){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_le_set_connectionless_cte_transmit_enable, 0x11, 0x22);
+    uint16_t size = hci_cmd_le_set_connectionless_cte_transmit_enable_encode(encoder_buffer, 0x11, 0x22);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+#endif
+
+#ifdef ENABLE_BLE
+TEST(HCI_Command_Encoder, le_connection_cte_request_enable){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_le_connection_cte_request_enable, 0x0102, 0x22, 0x0306, 0x44, 0x55);
+    uint16_t size = hci_cmd_le_connection_cte_request_enable_encode(encoder_buffer, 0x0102, 0x22, 0x0306, 0x44, 0x55);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+#endif
+
+#ifdef ENABLE_BLE
+TEST(HCI_Command_Encoder, le_connection_cte_response_enable){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_le_connection_cte_response_enable, 0x0102, 0x22);
+    uint16_t size = hci_cmd_le_connection_cte_response_enable_encode(encoder_buffer, 0x0102, 0x22);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+#endif
+
+#ifdef ENABLE_BLE
+TEST(HCI_Command_Encoder, le_read_antenna_information){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_le_read_antenna_information);
+    uint16_t size = hci_cmd_le_read_antenna_information_encode(encoder_buffer);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+#endif
+
+#ifdef ENABLE_BLE
+TEST(HCI_Command_Encoder, le_set_periodic_advertising_receive_enable){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_le_set_periodic_advertising_receive_enable, 0x0102, 0x22);
+    uint16_t size = hci_cmd_le_set_periodic_advertising_receive_enable_encode(encoder_buffer, 0x0102, 0x22);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+#endif
+
+#ifdef ENABLE_BLE
+TEST(HCI_Command_Encoder, le_periodic_advertising_sync_transfer){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_le_periodic_advertising_sync_transfer, 0x0102, 0x0204, 0x0306);
+    uint16_t size = hci_cmd_le_periodic_advertising_sync_transfer_encode(encoder_buffer, 0x0102, 0x0204, 0x0306);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+#endif
+
+#ifdef ENABLE_BLE
+TEST(HCI_Command_Encoder, le_periodic_advertising_set_info_transfer){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_le_periodic_advertising_set_info_transfer, 0x0102, 0x0204, 0x33);
+    uint16_t size = hci_cmd_le_periodic_advertising_set_info_transfer_encode(encoder_buffer, 0x0102, 0x0204, 0x33);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+#endif
+
+#ifdef ENABLE_BLE
+TEST(HCI_Command_Encoder, le_set_periodic_advertising_sync_transfer_parameters){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_le_set_periodic_advertising_sync_transfer_parameters, 0x0102, 0x22, 0x0306, 0x0408, 0x55);
+    uint16_t size = hci_cmd_le_set_periodic_advertising_sync_transfer_parameters_encode(encoder_buffer, 0x0102, 0x22, 0x0306, 0x0408, 0x55);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+#endif
+
+#ifdef ENABLE_BLE
+TEST(HCI_Command_Encoder, le_set_default_periodic_advertising_sync_transfer_parameters){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_le_set_default_periodic_advertising_sync_transfer_parameters, 0x11, 0x0204, 0x0306, 0x44);
+    uint16_t size = hci_cmd_le_set_default_periodic_advertising_sync_transfer_parameters_encode(encoder_buffer, 0x11, 0x0204, 0x0306, 0x44);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+#endif
+
+#ifdef ENABLE_BLE
+#ifdef ENABLE_LE_SECURE_CONNECTIONS
+TEST(HCI_Command_Encoder, le_generate_dhkey_v2){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_le_generate_dhkey_v2, &test_data[0], &test_data[1], 0x33);
+    uint16_t size = hci_cmd_le_generate_dhkey_v2_encode(encoder_buffer, &test_data[0], &test_data[1], 0x33);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+#endif
+#endif
+
+#ifdef ENABLE_BLE
+TEST(HCI_Command_Encoder, le_modify_sleep_clock_accuracy){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_le_modify_sleep_clock_accuracy, 0x11);
+    uint16_t size = hci_cmd_le_modify_sleep_clock_accuracy_encode(encoder_buffer, 0x11);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+#endif
+
+#ifdef ENABLE_BLE
+TEST(HCI_Command_Encoder, le_read_buffer_size_v2){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_le_read_buffer_size_v2);
+    uint16_t size = hci_cmd_le_read_buffer_size_v2_encode(encoder_buffer);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+#endif
+
+#ifdef ENABLE_BLE
+TEST(HCI_Command_Encoder, le_read_iso_tx_sync){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_le_read_iso_tx_sync, 0x0102);
+    uint16_t size = hci_cmd_le_read_iso_tx_sync_encode(encoder_buffer, 0x0102);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+#endif
+
+#ifdef ENABLE_BLE
+TEST(HCI_Command_Encoder, le_remove_cig){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_le_remove_cig, 0x11);
+    uint16_t size = hci_cmd_le_remove_cig_encode(encoder_buffer, 0x11);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+#endif
+
+#ifdef ENABLE_BLE
+TEST(HCI_Command_Encoder, le_accept_cis_request){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_le_accept_cis_request, 0x0102);
+    uint16_t size = hci_cmd_le_accept_cis_request_encode(encoder_buffer, 0x0102);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+#endif
+
+#ifdef ENABLE_BLE
+TEST(HCI_Command_Encoder, le_reject_cis_request){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_le_reject_cis_request, 0x0102, 0x22);
+    uint16_t size = hci_cmd_le_reject_cis_request_encode(encoder_buffer, 0x0102, 0x22);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+#endif
+
+#ifdef ENABLE_BLE
+TEST(HCI_Command_Encoder, le_create_big){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_le_create_big, 0x11, 0x22, 0x33, (uint32_t) 0x00020307, 0x050a, 0x060c, 0x77, 0x88, 0x99, 0xaa, 0xbb, &test_data[11]);
+    uint16_t size = hci_cmd_le_create_big_encode(encoder_buffer, 0x11, 0x22, 0x33, (uint32_t) 0x00020307, 0x050a, 0x060c, 0x77, 0x88, 0x99, 0xaa, 0xbb, &test_data[11]);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+#endif
+
+#ifdef ENABLE_BLE
+TEST(HCI_Command_Encoder, le_create_big_test){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_le_create_big_test, 0x11, 0x22, 0x33, (uint32_t) 0x00020307, 0x050a, 0x66, 0x070e, 0x0810, 0x99, 0xaa, 0xbb, 0xcc, 0xdd, 0xee, 0xff, &test_data[15]);
+    uint16_t size = hci_cmd_le_create_big_test_encode(encoder_buffer, 0x11, 0x22, 0x33, (uint32_t) 0x00020307, 0x050a, 0x66, 0x070e, 0x0810, 0x99, 0xaa, 0xbb, 0xcc, 0xdd, 0xee, 0xff, &test_data[15]);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+#endif
+
+#ifdef ENABLE_BLE
+TEST(HCI_Command_Encoder, le_terminate_big){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_le_terminate_big, 0x11, 0x22);
+    uint16_t size = hci_cmd_le_terminate_big_encode(encoder_buffer, 0x11, 0x22);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+#endif
+
+#ifdef ENABLE_BLE
+TEST(HCI_Command_Encoder, le_big_terminate_sync){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_le_big_terminate_sync, 0x11);
+    uint16_t size = hci_cmd_le_big_terminate_sync_encode(encoder_buffer, 0x11);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+#endif
+
+#ifdef ENABLE_BLE
+TEST(HCI_Command_Encoder, le_request_peer_sca){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_le_request_peer_sca, 0x0102);
+    uint16_t size = hci_cmd_le_request_peer_sca_encode(encoder_buffer, 0x0102);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+#endif
+
+#ifdef ENABLE_BLE
+TEST(HCI_Command_Encoder, le_remove_iso_data_path){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_le_remove_iso_data_path, 0x0102, 0x22);
+    uint16_t size = hci_cmd_le_remove_iso_data_path_encode(encoder_buffer, 0x0102, 0x22);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+#endif
+
+#ifdef ENABLE_BLE
+TEST(HCI_Command_Encoder, le_iso_transmit_test){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_le_iso_transmit_test, 0x0102, 0x22);
+    uint16_t size = hci_cmd_le_iso_transmit_test_encode(encoder_buffer, 0x0102, 0x22);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+#endif
+
+#ifdef ENABLE_BLE
+TEST(HCI_Command_Encoder, le_iso_receive_test){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_le_iso_receive_test, 0x0102, 0x22);
+    uint16_t size = hci_cmd_le_iso_receive_test_encode(encoder_buffer, 0x0102, 0x22);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+#endif
+
+#ifdef ENABLE_BLE
+TEST(HCI_Command_Encoder, le_iso_read_test_counters){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_le_iso_read_test_counters, 0x0102);
+    uint16_t size = hci_cmd_le_iso_read_test_counters_encode(encoder_buffer, 0x0102);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+#endif
+
+#ifdef ENABLE_BLE
+TEST(HCI_Command_Encoder, le_iso_test_end){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_le_iso_test_end, 0x0102);
+    uint16_t size = hci_cmd_le_iso_test_end_encode(encoder_buffer, 0x0102);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+#endif
+
+#ifdef ENABLE_BLE
+TEST(HCI_Command_Encoder, le_set_host_feature){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_le_set_host_feature, 0x11, 0x22);
+    uint16_t size = hci_cmd_le_set_host_feature_encode(encoder_buffer, 0x11, 0x22);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+#endif
+
+#ifdef ENABLE_BLE
+TEST(HCI_Command_Encoder, le_read_iso_link_quality){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_le_read_iso_link_quality, 0x0102);
+    uint16_t size = hci_cmd_le_read_iso_link_quality_encode(encoder_buffer, 0x0102);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+#endif
+
+#ifdef ENABLE_BLE
+TEST(HCI_Command_Encoder, le_enhanced_read_transmit_power_level){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_le_enhanced_read_transmit_power_level, 0x0102, 0x22);
+    uint16_t size = hci_cmd_le_enhanced_read_transmit_power_level_encode(encoder_buffer, 0x0102, 0x22);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+#endif
+
+#ifdef ENABLE_BLE
+TEST(HCI_Command_Encoder, le_read_remote_transmit_power_level){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_le_read_remote_transmit_power_level, 0x0102, 0x22);
+    uint16_t size = hci_cmd_le_read_remote_transmit_power_level_encode(encoder_buffer, 0x0102, 0x22);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+#endif
+
+#ifdef ENABLE_BLE
+TEST(HCI_Command_Encoder, le_set_path_loss_reporting_parameters){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_le_set_path_loss_reporting_parameters, 0x0102, 0x22, 0x33, 0x44, 0x55, 0x060c);
+    uint16_t size = hci_cmd_le_set_path_loss_reporting_parameters_encode(encoder_buffer, 0x0102, 0x22, 0x33, 0x44, 0x55, 0x060c);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+#endif
+
+#ifdef ENABLE_BLE
+TEST(HCI_Command_Encoder, le_set_path_loss_reporting_enable){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_le_set_path_loss_reporting_enable, 0x0102, 0x22);
+    uint16_t size = hci_cmd_le_set_path_loss_reporting_enable_encode(encoder_buffer, 0x0102, 0x22);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+#endif
+
+#ifdef ENABLE_BLE
+TEST(HCI_Command_Encoder, le_set_transmit_power_reporting_enable){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_le_set_transmit_power_reporting_enable, 0x0102, 0x22, 0x33);
+    uint16_t size = hci_cmd_le_set_transmit_power_reporting_enable_encode(encoder_buffer, 0x0102, 0x22, 0x33);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+#endif
+
+TEST(HCI_Command_Encoder, bcm_enable_wbs){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_bcm_enable_wbs, 0x11, 0x0204);
+    uint16_t size = hci_cmd_bcm_enable_wbs_encode(encoder_buffer, 0x11, 0x0204);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+TEST(HCI_Command_Encoder, bcm_pcm2_setup){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_bcm_pcm2_setup, 0x11, 0x22, 0x33, 0x44, (uint32_t) 0x01020308, 0x66, 0x77, 0x88, 0x99, 0xaa, 0xbb, 0xcc, 0xdd, 0xee, 0xff, 0x10, 0x21, 0x32, 0x43, 0x54, 0x65, 0x76, 0x87);
+    uint16_t size = hci_cmd_bcm_pcm2_setup_encode(encoder_buffer, 0x11, 0x22, 0x33, 0x44, (uint32_t) 0x01020308, 0x66, 0x77, 0x88, 0x99, 0xaa, 0xbb, 0xcc, 0xdd, 0xee, 0xff, 0x10, 0x21, 0x32, 0x43, 0x54, 0x65, 0x76, 0x87);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+TEST(HCI_Command_Encoder, bcm_write_sco_pcm_int){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_bcm_write_sco_pcm_int, 0x11, 0x22, 0x33, 0x44, 0x55);
+    uint16_t size = hci_cmd_bcm_write_sco_pcm_int_encode(encoder_buffer, 0x11, 0x22, 0x33, 0x44, 0x55);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+TEST(HCI_Command_Encoder, bcm_write_pcm_data_format_param){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_bcm_write_pcm_data_format_param, 0x11, 0x22, 0x33, 0x44, 0x55);
+    uint16_t size = hci_cmd_bcm_write_pcm_data_format_param_encode(encoder_buffer, 0x11, 0x22, 0x33, 0x44, 0x55);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+TEST(HCI_Command_Encoder, bcm_write_i2spcm_interface_param){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_bcm_write_i2spcm_interface_param, 0x11, 0x22, 0x33, 0x44);
+    uint16_t size = hci_cmd_bcm_write_i2spcm_interface_param_encode(encoder_buffer, 0x11, 0x22, 0x33, 0x44);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+TEST(HCI_Command_Encoder, bcm_set_sleep_mode){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_bcm_set_sleep_mode, 0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77, 0x88, 0x99, 0xaa, 0xbb, 0xcc);
+    uint16_t size = hci_cmd_bcm_set_sleep_mode_encode(encoder_buffer, 0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77, 0x88, 0x99, 0xaa, 0xbb, 0xcc);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+TEST(HCI_Command_Encoder, bcm_write_tx_power_table){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_bcm_write_tx_power_table, 0x11, 0x22);
+    uint16_t size = hci_cmd_bcm_write_tx_power_table_encode(encoder_buffer, 0x11, 0x22);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+TEST(HCI_Command_Encoder, bcm_set_tx_pwr){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_bcm_set_tx_pwr, 0x11, 0x22, 0x0306);
+    uint16_t size = hci_cmd_bcm_set_tx_pwr_encode(encoder_buffer, 0x11, 0x22, 0x0306);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+TEST(HCI_Command_Encoder, ti_drpb_tester_con_rx){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_ti_drpb_tester_con_rx, 0x11, 0x22);
+    uint16_t size = hci_cmd_ti_drpb_tester_con_rx_encode(encoder_buffer, 0x11, 0x22);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+TEST(HCI_Command_Encoder, ti_drpb_tester_con_tx){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_ti_drpb_tester_con_tx, 0x11, 0x22, 0x33, 0x44, (uint32_t) 0x01020308, (uint32_t) 0x01020309);
+    uint16_t size = hci_cmd_ti_drpb_tester_con_tx_encode(encoder_buffer, 0x11, 0x22, 0x33, 0x44, (uint32_t) 0x01020308, (uint32_t) 0x01020309);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+TEST(HCI_Command_Encoder, ti_drpb_tester_packet_tx_rx){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_ti_drpb_tester_packet_tx_rx, 0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x070e, 0x88, 0x99, 0x0a14);
+    uint16_t size = hci_cmd_ti_drpb_tester_packet_tx_rx_encode(encoder_buffer, 0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x070e, 0x88, 0x99, 0x0a14);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+TEST(HCI_Command_Encoder, ti_configure_ddip){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_ti_configure_ddip, 0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77);
+    uint16_t size = hci_cmd_ti_configure_ddip_encode(encoder_buffer, 0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+TEST(HCI_Command_Encoder, ti_avrp_enable){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_ti_avrp_enable, 0x11, 0x22, 0x33, 0x0408);
+    uint16_t size = hci_cmd_ti_avrp_enable_encode(encoder_buffer, 0x11, 0x22, 0x33, 0x0408);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+TEST(HCI_Command_Encoder, ti_wbs_associate){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_ti_wbs_associate, 0x0102);
+    uint16_t size = hci_cmd_ti_wbs_associate_encode(encoder_buffer, 0x0102);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+TEST(HCI_Command_Encoder, ti_wbs_disassociate){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_ti_wbs_disassociate);
+    uint16_t size = hci_cmd_ti_wbs_disassociate_encode(encoder_buffer);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+TEST(HCI_Command_Encoder, ti_write_codec_config){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_ti_write_codec_config, 0x0102, 0x22, (uint32_t) 0x01020306, 0x0408, 0x55, 0x66, 0x77, 0x0810, 0x0912, 0xaa, 0x0b16, 0x0c18, 0xdd, 0xee, 0x0f1e, 0x0020, 0x21, 0x0224, 0x0326, 0x54, 0x65);
+    uint16_t size = hci_cmd_ti_write_codec_config_encode(encoder_buffer, 0x0102, 0x22, (uint32_t) 0x01020306, 0x0408, 0x55, 0x66, 0x77, 0x0810, 0x0912, 0xaa, 0x0b16, 0x0c18, 0xdd, 0xee, 0x0f1e, 0x0020, 0x21, 0x0224, 0x0326, 0x54, 0x65);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+TEST(HCI_Command_Encoder, ti_drpb_enable_rf_calibration){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_ti_drpb_enable_rf_calibration, 0x11, (uint32_t) 0x01020305, 0x33);
+    uint16_t size = hci_cmd_ti_drpb_enable_rf_calibration_encode(encoder_buffer, 0x11, (uint32_t) 0x01020305, 0x33);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+TEST(HCI_Command_Encoder, ti_write_hardware_register){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_ti_write_hardware_register, (uint32_t) 0x01020304, 0x0204);
+    uint16_t size = hci_cmd_ti_write_hardware_register_encode(encoder_buffer, (uint32_t) 0x01020304, 0x0204);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+TEST(HCI_Command_Encoder, rtk_configure_sco_routing){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_rtk_configure_sco_routing, 0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77, 0x88, 0x99);
+    uint16_t size = hci_cmd_rtk_configure_sco_routing_encode(encoder_buffer, 0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77, 0x88, 0x99);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+TEST(HCI_Command_Encoder, rtk_read_card_info){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_rtk_read_card_info, 0x11, 0x22, 0x33, 0x44, 0x55);
+    uint16_t size = hci_cmd_rtk_read_card_info_encode(encoder_buffer, 0x11, 0x22, 0x33, 0x44, 0x55);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+TEST(HCI_Command_Encoder, nxp_set_sco_data_path){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_nxp_set_sco_data_path, 0x11);
+    uint16_t size = hci_cmd_nxp_set_sco_data_path_encode(encoder_buffer, 0x11);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+TEST(HCI_Command_Encoder, nxp_write_pcm_i2s_settings){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_nxp_write_pcm_i2s_settings, 0x11);
+    uint16_t size = hci_cmd_nxp_write_pcm_i2s_settings_encode(encoder_buffer, 0x11);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+TEST(HCI_Command_Encoder, nxp_write_pcm_i2s_sync_settings){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_nxp_write_pcm_i2s_sync_settings, 0x11, 0x0204);
+    uint16_t size = hci_cmd_nxp_write_pcm_i2s_sync_settings_encode(encoder_buffer, 0x11, 0x0204);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+TEST(HCI_Command_Encoder, nxp_write_pcm_link_settings){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_nxp_write_pcm_link_settings, 0x0102);
+    uint16_t size = hci_cmd_nxp_write_pcm_link_settings_encode(encoder_buffer, 0x0102);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+TEST(HCI_Command_Encoder, nxp_set_wbs_connection){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_nxp_set_wbs_connection, 0x11);
+    uint16_t size = hci_cmd_nxp_set_wbs_connection_encode(encoder_buffer, 0x11);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+TEST(HCI_Command_Encoder, nxp_host_pcm_i2s_audio_config){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_nxp_host_pcm_i2s_audio_config, 0x11, 0x22, 0x0306, 0x0408);
+    uint16_t size = hci_cmd_nxp_host_pcm_i2s_audio_config_encode(encoder_buffer, 0x11, 0x22, 0x0306, 0x0408);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+TEST(HCI_Command_Encoder, nxp_host_pcm_i2s_control_enable){
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &hci_nxp_host_pcm_i2s_control_enable, 0x11);
+    uint16_t size = hci_cmd_nxp_host_pcm_i2s_control_enable_encode(encoder_buffer, 0x11);
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}
+
+int main (int argc, const char * argv[]){
+    return CommandLineTestRunner::RunAllTests(argc, argv);
+}
@@ -14,6 +14,7 @@
 // BTstack features that can be enabled
 #define ENABLE_BLE
 #define ENABLE_LE_CENTRAL
+#define ENABLE_LE_ISOCHRONOUS_STREAMS
 #define ENABLE_LE_PERIPHERAL
 #define ENABLE_LE_SIGNED_WRITE
 #define ENABLE_LOG_ERROR
@@ -41,7 +41,13 @@ static int hci_transport_test_can_send_now(uint8_t packet_type){
     return 1;
 }
 
+static int transport_send_packet_err;
+
 static int hci_transport_test_send_packet(uint8_t packet_type, uint8_t * packet, int size){
+    if (transport_send_packet_err != 0){
+        packet_handler(HCI_EVENT_PACKET, (uint8_t *) &packet_sent_event[0], sizeof(packet_sent_event));
+        return transport_send_packet_err;
+    }
     btstack_assert(transport_count_packets < MAX_HCI_PACKETS);
     memcpy(transport_packets[transport_count_packets].buffer, packet, size);
     transport_packets[transport_count_packets].type = packet_type;
@@ -97,6 +103,7 @@ void CHECK_HCI_COMMAND(const hci_cmd_t * expected_hci_command){
 TEST_GROUP(HCI){
         void setup(void){
             transport_count_packets = 0;
+            transport_send_packet_err = 0;
             next_hci_packet = 0;
             hci_init(&hci_transport_test, NULL);
             hci_simulate_working_fuzz();
@@ -375,6 +382,111 @@ TEST(HCI, GetRole){
     gap_get_role(5);
 }
 
+#define NUM_ISO_SDU_BUFFERS 4
+static hci_iso_sdu_buffer_t iso_sdu_buffers[NUM_ISO_SDU_BUFFERS];
+
+static void iso_number_of_completed_packets(hci_con_handle_t cis_handle_a, hci_con_handle_t cis_handle_b){
+    uint8_t event[] = { HCI_EVENT_NUMBER_OF_COMPLETED_PACKETS, 9, 2, 0, 0, 1, 0, 0, 0, 1, 0};
+    little_endian_store_16(event, 3, cis_handle_a);
+    little_endian_store_16(event, 7, cis_handle_b);
+    packet_handler(HCI_EVENT_PACKET, event, sizeof(event));
+}
+
+static uint16_t iso_sent_handles(uint16_t start, hci_con_handle_t * handles){
+    uint16_t num_iso_packets = 0;
+    uint16_t i;
+    for (i = start; i < transport_count_packets; i++){
+        if (transport_packets[i].type == HCI_ISO_DATA_PACKET){
+            handles[num_iso_packets++] = little_endian_read_16(transport_packets[i].buffer, 0) & 0x0fff;
+        }
+    }
+    return num_iso_packets;
+}
+
+TEST(HCI, IsoSduQueueRoundRobin){
+    hci_set_iso_sdu_buffers(iso_sdu_buffers, NUM_ISO_SDU_BUFFERS);
+    hci_set_num_iso_packets_to_queue(1);
+    uint16_t start = transport_count_packets;
+
+    uint8_t sdu[10];
+    memset(sdu, 0x55, sizeof(sdu));
+    // first SDU of each stream is sent right away, others wait for completed packets
+    CHECK_EQUAL(ERROR_CODE_SUCCESS, hci_send_iso_sdu(0x06, sdu, sizeof(sdu), 0, true, 0x12345678));
+    CHECK_EQUAL(ERROR_CODE_SUCCESS, hci_send_iso_sdu(0x06, sdu, sizeof(sdu), 1, false, 0));
+    CHECK_EQUAL(ERROR_CODE_SUCCESS, hci_send_iso_sdu(0x06, sdu, sizeof(sdu), 2, false, 0));
+    CHECK_EQUAL(ERROR_CODE_SUCCESS, hci_send_iso_sdu(0x07, sdu, sizeof(sdu), 0, false, 0));
+    CHECK_EQUAL(ERROR_CODE_SUCCESS, hci_send_iso_sdu(0x07, sdu, sizeof(sdu), 1, false, 0));
+    CHECK_EQUAL(2, hci_get_num_queued_iso_sdus(0x06));
+    CHECK_EQUAL(1, hci_get_num_queued_iso_sdus(0x07));
+
+    // SDU with time stamp
+    const uint8_t * packet = transport_packets[start].buffer;
+    CHECK_EQUAL(HCI_ISO_DATA_PACKET, transport_packets[start].type);
+    CHECK_EQUAL(0x6006, little_endian_read_16(packet, 0));
+    CHECK_EQUAL(8 + sizeof(sdu), little_endian_read_16(packet, 2));
+    CHECK_EQUAL(0x12345678, little_endian_read_32(packet, 4));
+    CHECK_EQUAL(0, little_endian_read_16(packet, 8));
+    CHECK_EQUAL(sizeof(sdu), little_endian_read_16(packet, 10));
+    MEMCMP_EQUAL(sdu, &packet[12], sizeof(sdu));
+
+    iso_number_of_completed_packets(0x06, 0x07);
+    iso_number_of_completed_packets(0x06, 0x07);
+    CHECK_EQUAL(0, hci_get_num_queued_iso_sdus(0x06));
+    CHECK_EQUAL(0, hci_get_num_queued_iso_sdus(0x07));
+    CHECK_EQUAL(NUM_ISO_SDU_BUFFERS, hci_get_num_free_iso_sdu_buffers());
+
+    hci_con_handle_t handles[10];
+    const hci_con_handle_t expected_handles[] = { 0x06, 0x07, 0x06, 0x07, 0x06 };
+    CHECK_EQUAL(5, iso_sent_handles(start, handles));
+    uint8_t i;
+    for (i = 0; i < 5; i++){
+        CHECK_EQUAL(expected_handles[i], handles[i]);
+    }
+    // second SDU of first stream without time stamp
+    packet = transport_packets[start + 2].buffer;
+    CHECK_EQUAL(0x2006, little_endian_read_16(packet, 0));
+    CHECK_EQUAL(1, little_endian_read_16(packet, 4));
+}
+
+TEST(HCI, IsoSduQueueErrors){
+    uint8_t sdu[HCI_ISO_PAYLOAD_SIZE + 1];
+    memset(sdu, 0, sizeof(sdu));
+    CHECK_EQUAL(ERROR_CODE_UNKNOWN_CONNECTION_IDENTIFIER, hci_send_iso_sdu(0x08, sdu, 10, 0, false, 0));
+    CHECK_EQUAL(ERROR_CODE_INVALID_HCI_COMMAND_PARAMETERS, hci_send_iso_sdu(0x06, sdu, sizeof(sdu), 0, false, 0));
+
+    // pool exhausted
+    hci_set_iso_sdu_buffers(iso_sdu_buffers, 1);
+    hci_set_num_iso_packets_to_queue(1);
+    CHECK_EQUAL(ERROR_CODE_SUCCESS, hci_send_iso_sdu(0x06, sdu, 10, 0, false, 0));
+    CHECK_EQUAL(ERROR_CODE_SUCCESS, hci_send_iso_sdu(0x06, sdu, 10, 1, false, 0));
+    CHECK_EQUAL(ERROR_CODE_MEMORY_CAPACITY_EXCEEDED, hci_send_iso_sdu(0x07, sdu, 10, 0, false, 0));
+    CHECK_EQUAL(0, hci_get_num_free_iso_sdu_buffers());
+
+    // pool cannot be replaced while SDUs are queued
+    CHECK_EQUAL(ERROR_CODE_COMMAND_DISALLOWED, hci_set_iso_sdu_buffers(iso_sdu_buffers, NUM_ISO_SDU_BUFFERS));
+    CHECK_EQUAL(1, hci_get_num_queued_iso_sdus(0x06));
+
+    // queued SDUs are returned to pool on disconnect
+    uint8_t event[] = { HCI_EVENT_DISCONNECTION_COMPLETE, 4, 0, 0x06, 0x00, ERROR_CODE_REMOTE_USER_TERMINATED_CONNECTION};
+    packet_handler(HCI_EVENT_PACKET, event, sizeof(event));
+    CHECK_EQUAL(1, hci_get_num_free_iso_sdu_buffers());
+    CHECK_EQUAL(ERROR_CODE_UNKNOWN_CONNECTION_IDENTIFIER, hci_send_iso_sdu(0x06, sdu, 10, 0, false, 0));
+    CHECK_EQUAL(ERROR_CODE_SUCCESS, hci_set_iso_sdu_buffers(iso_sdu_buffers, NUM_ISO_SDU_BUFFERS));
+    CHECK_EQUAL(NUM_ISO_SDU_BUFFERS, hci_get_num_free_iso_sdu_buffers());
+}
+
+TEST(HCI, IsoSduSendFailed){
+    hci_set_iso_sdu_buffers(iso_sdu_buffers, NUM_ISO_SDU_BUFFERS);
+    hci_set_num_iso_packets_to_queue(1);
+    uint8_t sdu[10];
+    memset(sdu, 0, sizeof(sdu));
+    transport_send_packet_err = -1;
+    CHECK_EQUAL(ERROR_CODE_SUCCESS, hci_send_iso_sdu(0x07, sdu, sizeof(sdu), 0, false, 0));
+    CHECK_EQUAL(1, hci_get_num_failed_iso_sdus(0x07));
+    CHECK_EQUAL(0, hci_get_num_failed_iso_sdus(0x06));
+    CHECK_EQUAL(NUM_ISO_SDU_BUFFERS, hci_get_num_free_iso_sdu_buffers());
+}
+
 int main (int argc, const char * argv[]){
     btstack_run_loop_init(btstack_run_loop_posix_get_instance());
     return CommandLineTestRunner::RunAllTests(argc, argv);
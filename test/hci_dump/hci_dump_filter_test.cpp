@@ -0,0 +1,251 @@
+#include "CppUTest/TestHarness.h"
+#include "CppUTest/CommandLineTestRunner.h"
+
+#include "hci_dump.h"
+#include "l2cap_signaling.h"
+#include "bluetooth_psm.h"
+#include "btstack_defines.h"
+#include "btstack_util.h"
+#include "btstack_config.h"
+#include <string.h>
+
+// mock backend
+static uint16_t logged_packets;
+static uint16_t logged_len;
+static uint16_t logged_original_len;
+static uint8_t  logged_type;
+
+static void mock_log_truncated_packet(uint8_t packet_type, uint8_t in, uint8_t *packet, uint16_t len, uint16_t original_len){
+    UNUSED(in);
+    UNUSED(packet);
+    logged_packets++;
+    logged_len  = len;
+    logged_original_len = original_len;
+    logged_type = packet_type;
+}
+
+static void mock_log_packet(uint8_t packet_type, uint8_t in, uint8_t *packet, uint16_t len){
+    mock_log_truncated_packet(packet_type, in, packet, len, len);
+}
+
+static void mock_log_message(int log_level, const char * format, va_list argptr){
+    UNUSED(log_level);
+    UNUSED(format);
+    (void) argptr;
+}
+
+static const hci_dump_t hci_dump_mock = {
+    NULL,
+    &mock_log_packet,
+    &mock_log_message,
+    &mock_log_truncated_packet,
+};
+
+static void log_acl_packet_with_direction(hci_con_handle_t con_handle, uint8_t in, uint8_t pb, uint16_t cid, uint16_t payload_len){
+    uint8_t packet[100];
+    memset(packet, 0, sizeof(packet));
+    little_endian_store_16(packet, 0, con_handle | (pb << 12));
+    little_endian_store_16(packet, 2, payload_len + 4);
+    little_endian_store_16(packet, 4, payload_len);
+    little_endian_store_16(packet, 6, cid);
+    hci_dump_packet(HCI_ACL_DATA_PACKET, in, packet, 8 + payload_len);
+}
+
+static void log_acl_packet(hci_con_handle_t con_handle, uint8_t pb, uint16_t cid, uint16_t payload_len){
+    log_acl_packet_with_direction(con_handle, 1, pb, cid, payload_len);
+}
+
+static void log_acl_continuation(hci_con_handle_t con_handle){
+    uint8_t packet[10];
+    memset(packet, 0, sizeof(packet));
+    little_endian_store_16(packet, 0, con_handle | (1 << 12));
+    little_endian_store_16(packet, 2, 6);
+    hci_dump_packet(HCI_ACL_DATA_PACKET, 1, packet, sizeof(packet));
+}
+
+static void log_signaling_command(hci_con_handle_t con_handle, uint8_t in, uint8_t code, uint8_t identifier, const uint16_t * params, uint16_t num_params){
+    uint8_t packet[40];
+    uint16_t command_len = 2 * num_params;
+    little_endian_store_16(packet, 0, con_handle | (2 << 12));
+    little_endian_store_16(packet, 2, 8 + command_len);
+    little_endian_store_16(packet, 4, 4 + command_len);
+    little_endian_store_16(packet, 6, L2CAP_CID_SIGNALING);
+    packet[8] = code;
+    packet[9] = identifier;
+    little_endian_store_16(packet, 10, command_len);
+    uint16_t i;
+    for (i = 0; i < num_params; i++){
+        little_endian_store_16(packet, 12 + 2 * i, params[i]);
+    }
+    hci_dump_packet(HCI_ACL_DATA_PACKET, in, packet, 12 + command_len);
+}
+
+static void log_signaling_with_direction(hci_con_handle_t con_handle, uint8_t in, uint8_t code, uint8_t identifier, uint16_t param_1, uint16_t param_2){
+    const uint16_t params[] = { param_1, param_2 };
+    log_signaling_command(con_handle, in, code, identifier, params, 2);
+}
+
+static void log_signaling(hci_con_handle_t con_handle, uint8_t code, uint8_t identifier, uint16_t param_1, uint16_t param_2){
+    log_signaling_with_direction(con_handle, 1, code, identifier, param_1, param_2);
+}
+
+static void log_sco_packet(hci_con_handle_t con_handle){
+    uint8_t packet[63];
+    little_endian_store_16(packet, 0, con_handle);
+    packet[2] = 60;
+    hci_dump_packet(HCI_SCO_DATA_PACKET, 1, packet, sizeof(packet));
+}
+
+static void log_event(uint8_t event_code){
+    uint8_t packet[4] = { event_code, 2, 0, 0};
+    hci_dump_packet(HCI_EVENT_PACKET, 1, packet, sizeof(packet));
+}
+
+TEST_GROUP(HCI_DUMP_FILTER){
+    void setup(void){
+        hci_dump_init(&hci_dump_mock);
+        logged_packets = 0;
+    }
+    void teardown(void){
+        hci_dump_init(NULL);
+    }
+};
+
+TEST(HCI_DUMP_FILTER, Default){
+    log_event(HCI_EVENT_COMMAND_COMPLETE);
+    log_acl_packet(0x0001, 2, 0x0040, 20);
+    log_sco_packet(0x0002);
+    CHECK_EQUAL(3, logged_packets);
+    CHECK_EQUAL(63, logged_len);
+}
+
+TEST(HCI_DUMP_FILTER, PacketType){
+    hci_dump_filter_enable_packet_type(HCI_SCO_DATA_PACKET, false);
+    log_sco_packet(0x0002);
+    CHECK_EQUAL(0, logged_packets);
+    hci_dump_filter_enable_packet_type(HCI_SCO_DATA_PACKET, true);
+    log_sco_packet(0x0002);
+    CHECK_EQUAL(1, logged_packets);
+}
+
+TEST(HCI_DUMP_FILTER, Event){
+    hci_dump_filter_enable_event(HCI_EVENT_NUMBER_OF_COMPLETED_PACKETS, false);
+    log_event(HCI_EVENT_NUMBER_OF_COMPLETED_PACKETS);
+    CHECK_EQUAL(0, logged_packets);
+    log_event(HCI_EVENT_COMMAND_COMPLETE);
+    CHECK_EQUAL(1, logged_packets);
+}
+
+TEST(HCI_DUMP_FILTER, ConHandle){
+    hci_dump_filter_enable_con_handle(0x0001, false);
+    log_acl_packet(0x0001, 2, 0x0040, 20);
+    log_sco_packet(0x0001);
+    CHECK_EQUAL(0, logged_packets);
+    log_acl_packet(0x0002, 2, 0x0040, 20);
+    CHECK_EQUAL(1, logged_packets);
+}
+
+TEST(HCI_DUMP_FILTER, L2capCidWithContinuation){
+    hci_dump_filter_enable_l2cap_cid(0x0041, false);
+    log_acl_packet(0x0001, 2, 0x0041, 20);
+    log_acl_continuation(0x0001);
+    CHECK_EQUAL(0, logged_packets);
+    log_acl_packet(0x0001, 2, 0x0040, 20);
+    log_acl_continuation(0x0001);
+    CHECK_EQUAL(2, logged_packets);
+}
+
+TEST(HCI_DUMP_FILTER, L2capPsm){
+    hci_dump_filter_enable_l2cap_psm(BLUETOOTH_PSM_AVDTP, false);
+    // incoming connection request: psm, source cid 0x0050. outgoing response: destination cid 0x0060, source cid 0x0050
+    log_signaling_with_direction(0x0001, 1, CONNECTION_REQUEST, 7, BLUETOOTH_PSM_AVDTP, 0x0050);
+    log_signaling_with_direction(0x0001, 0, CONNECTION_RESPONSE, 7, 0x0060, 0x0050);
+    CHECK_EQUAL(2, logged_packets);
+    log_acl_packet_with_direction(0x0001, 1, 2, 0x0060, 20);
+    log_acl_packet_with_direction(0x0001, 0, 2, 0x0050, 20);
+    CHECK_EQUAL(2, logged_packets);
+    // other connection and other channel
+    log_acl_packet_with_direction(0x0002, 1, 2, 0x0060, 20);
+    log_acl_packet_with_direction(0x0001, 1, 2, 0x0040, 20);
+    CHECK_EQUAL(4, logged_packets);
+    // incoming disconnect: destination cid 0x0060, source cid 0x0050
+    log_signaling_with_direction(0x0001, 1, DISCONNECTION_REQUEST, 8, 0x0060, 0x0050);
+    log_acl_packet_with_direction(0x0001, 1, 2, 0x0060, 20);
+    CHECK_EQUAL(6, logged_packets);
+}
+
+TEST(HCI_DUMP_FILTER, L2capPsmDirection){
+    hci_dump_filter_enable_l2cap_psm(BLUETOOTH_PSM_AVDTP, false);
+    // outgoing connection request with local cid 0x0040, remote cid 0x0045
+    log_signaling_with_direction(0x0001, 0, CONNECTION_REQUEST, 3, BLUETOOTH_PSM_AVDTP, 0x0040);
+    log_signaling_with_direction(0x0001, 1, CONNECTION_RESPONSE, 3, 0x0045, 0x0040);
+    CHECK_EQUAL(2, logged_packets);
+    log_acl_packet_with_direction(0x0001, 1, 2, 0x0040, 20);
+    log_acl_packet_with_direction(0x0001, 0, 2, 0x0045, 20);
+    CHECK_EQUAL(2, logged_packets);
+    // other channel with remote cid 0x0040 and local cid 0x0045
+    log_acl_packet_with_direction(0x0001, 0, 2, 0x0040, 20);
+    log_acl_packet_with_direction(0x0001, 1, 2, 0x0045, 20);
+    CHECK_EQUAL(4, logged_packets);
+    // outgoing disconnect: destination cid 0x0045, source cid 0x0040
+    log_signaling_with_direction(0x0001, 0, DISCONNECTION_REQUEST, 4, 0x0045, 0x0040);
+    log_acl_packet_with_direction(0x0001, 1, 2, 0x0040, 20);
+    CHECK_EQUAL(6, logged_packets);
+}
+
+TEST(HCI_DUMP_FILTER, L2capPsmEnhancedCreditBased){
+    hci_dump_filter_enable_l2cap_psm(BLUETOOTH_PSM_EATT, false);
+    // incoming request: spsm, mtu, mps, initial credits, source cids 0x0050, 0x0051
+    const uint16_t request[] = { BLUETOOTH_PSM_EATT, 100, 100, 10, 0x0050, 0x0051 };
+    log_signaling_command(0x0001, 1, L2CAP_CREDIT_BASED_CONNECTION_REQUEST, 5, request, 6);
+    // outgoing response: mtu, mps, initial credits, result, destination cids 0x0060, 0x0061
+    const uint16_t response[] = { 100, 100, 10, 0, 0x0060, 0x0061 };
+    log_signaling_command(0x0001, 0, L2CAP_CREDIT_BASED_CONNECTION_RESPONSE, 5, response, 6);
+    CHECK_EQUAL(2, logged_packets);
+    log_acl_packet_with_direction(0x0001, 1, 2, 0x0060, 20);
+    log_acl_packet_with_direction(0x0001, 1, 2, 0x0061, 20);
+    log_acl_packet_with_direction(0x0001, 0, 2, 0x0050, 20);
+    log_acl_packet_with_direction(0x0001, 0, 2, 0x0051, 20);
+    CHECK_EQUAL(2, logged_packets);
+    // cids in other direction
+    log_acl_packet_with_direction(0x0001, 1, 2, 0x0050, 20);
+    log_acl_packet_with_direction(0x0001, 0, 2, 0x0060, 20);
+    CHECK_EQUAL(4, logged_packets);
+}
+
+TEST(HCI_DUMP_FILTER, Truncation){
+    hci_dump_filter_set_max_payload_len(8);
+    log_acl_packet(0x0001, 2, 0x0040, 20);
+    CHECK_EQUAL(4 + 8, logged_len);
+    CHECK_EQUAL(8 + 20, logged_original_len);
+    log_sco_packet(0x0002);
+    CHECK_EQUAL(3 + 8, logged_len);
+    CHECK_EQUAL(63, logged_original_len);
+    log_event(HCI_EVENT_COMMAND_COMPLETE);
+    CHECK_EQUAL(4, logged_len);
+    CHECK_EQUAL(4, logged_original_len);
+}
+
+TEST(HCI_DUMP_FILTER, BTSnoopHeaderTruncated){
+    uint8_t header[HCI_DUMP_HEADER_SIZE_BTSNOOP];
+    hci_dump_setup_header_btsnoop_truncated(header, 0, 0, 0, HCI_ACL_DATA_PACKET, 1, 13, 29);
+    CHECK_EQUAL(29, big_endian_read_32(header, 0));
+    CHECK_EQUAL(13, big_endian_read_32(header, 4));
+}
+
+TEST(HCI_DUMP_FILTER, Sampling){
+    hci_dump_filter_set_sampling_interval(4);
+    uint16_t i;
+    for (i = 0; i < 16; i++){
+        log_sco_packet(0x0002);
+    }
+    CHECK_EQUAL(4, logged_packets);
+    // signaling and events are not sampled
+    log_signaling(0x0001, 0x02, 7, BLUETOOTH_PSM_AVDTP, 0x0050);
+    log_event(HCI_EVENT_COMMAND_COMPLETE);
+    CHECK_EQUAL(6, logged_packets);
+}
+
+int main (int argc, const char * argv[]){
+    return CommandLineTestRunner::RunAllTests(argc, argv);
+}
@@ -0,0 +1,169 @@
+#include "CppUTest/TestHarness.h"
+#include "CppUTest/CommandLineTestRunner.h"
+
+#include "hci_dump.h"
+#include "hci_dump_posix_async.h"
+#include "btstack_defines.h"
+#include "btstack_util.h"
+#include "btstack_config.h"
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/stat.h>
+
+#define TEST_LOG "/tmp/hci_dump_async_test.log"
+
+static uint8_t file_data[64 * 1024];
+
+static uint32_t read_file(const char * path){
+    FILE * file = fopen(path, "rb");
+    if (file == NULL) return 0;
+    size_t len = fread(file_data, 1, sizeof(file_data), file);
+    fclose(file);
+    return (uint32_t) len;
+}
+
+// count BTSnoop records and verify payload pattern
+static uint16_t count_btsnoop_records(uint32_t len){
+    uint16_t num_records = 0;
+    uint32_t pos = 16;
+    while ((pos + 24) <= len){
+        uint32_t record_len = big_endian_read_32(file_data, pos);
+        CHECK_EQUAL(record_len, big_endian_read_32(file_data, pos + 4));
+        CHECK_EQUAL(HCI_ACL_DATA_PACKET, file_data[pos + 24]);
+        CHECK_EQUAL((uint8_t) (record_len - 1), file_data[pos + 25]);
+        pos += 24 + record_len;
+        num_records++;
+    }
+    CHECK_EQUAL(len, pos);
+    return num_records;
+}
+
+static void log_acl_packet(uint16_t len){
+    uint8_t packet[1000];
+    memset(packet, (uint8_t) len, len);
+    hci_dump_packet(HCI_ACL_DATA_PACKET, 0, packet, len);
+}
+
+TEST_GROUP(HCI_DUMP_POSIX_ASYNC){
+    void setup(void){
+        unlink(TEST_LOG);
+        unlink(TEST_LOG ".1");
+        unlink(TEST_LOG ".2");
+        hci_dump_posix_async_set_rotation(0, 0, 0);
+        hci_dump_init(hci_dump_posix_async_get_instance());
+    }
+    void teardown(void){
+        hci_dump_posix_async_close();
+        hci_dump_init(NULL);
+    }
+};
+
+TEST(HCI_DUMP_POSIX_ASYNC, BTSnoop){
+    CHECK_EQUAL(0, hci_dump_posix_async_open(TEST_LOG, HCI_DUMP_BTSNOOP));
+    uint16_t i;
+    for (i = 0; i < 10; i++){
+        log_acl_packet(10 + i);
+    }
+    hci_dump_posix_async_close();
+
+    uint32_t len = read_file(TEST_LOG);
+    MEMCMP_EQUAL("btsnoop", file_data, 8);
+    CHECK_EQUAL(10, count_btsnoop_records(len));
+
+    hci_dump_posix_async_statistics_t statistics;
+    hci_dump_posix_async_get_statistics(&statistics);
+    CHECK_EQUAL(0, statistics.dropped_packets);
+    CHECK_EQUAL(len - 16, statistics.bytes_written);
+}
+
+TEST(HCI_DUMP_POSIX_ASYNC, PacketLogger){
+    CHECK_EQUAL(0, hci_dump_posix_async_open(TEST_LOG, HCI_DUMP_PACKETLOGGER));
+    log_acl_packet(20);
+    hci_dump_log(HCI_DUMP_LOG_LEVEL_INFO, "message");
+    hci_dump_posix_async_close();
+
+    uint32_t len = read_file(TEST_LOG);
+    CHECK_EQUAL(HCI_DUMP_HEADER_SIZE_PACKETLOGGER + 20 + HCI_DUMP_HEADER_SIZE_PACKETLOGGER + 7, len);
+    MEMCMP_EQUAL("message", &file_data[len - 7], 7);
+}
+
+TEST(HCI_DUMP_POSIX_ASYNC, DroppedPackets){
+    // buffer holds 4096 bytes, records are dropped if writer cannot keep up
+    CHECK_EQUAL(0, hci_dump_posix_async_open(TEST_LOG, HCI_DUMP_BTSNOOP));
+    uint16_t i;
+    for (i = 0; i < 100; i++){
+        log_acl_packet(200);
+    }
+    hci_dump_posix_async_close();
+
+    hci_dump_posix_async_statistics_t statistics;
+    hci_dump_posix_async_get_statistics(&statistics);
+    uint32_t len = read_file(TEST_LOG);
+    CHECK_EQUAL(100, count_btsnoop_records(len) + statistics.dropped_packets);
+}
+
+TEST(HCI_DUMP_POSIX_ASYNC, RotationBySize){
+    hci_dump_posix_async_set_rotation(100, 0, 2);
+    CHECK_EQUAL(0, hci_dump_posix_async_open(TEST_LOG, HCI_DUMP_BTSNOOP));
+    log_acl_packet(200);
+    // wait for writer thread
+    usleep(300000);
+    log_acl_packet(50);
+    hci_dump_posix_async_close();
+
+    hci_dump_posix_async_statistics_t statistics;
+    hci_dump_posix_async_get_statistics(&statistics);
+    CHECK_EQUAL(1, statistics.files_rotated);
+
+    uint32_t len = read_file(TEST_LOG ".1");
+    CHECK_EQUAL(1, count_btsnoop_records(len));
+    len = read_file(TEST_LOG);
+    CHECK_EQUAL(1, count_btsnoop_records(len));
+    CHECK_EQUAL(50, file_data[16 + 25]);
+}
+
+TEST(HCI_DUMP_POSIX_ASYNC, ResetDropsPendingRecords){
+    CHECK_EQUAL(0, hci_dump_posix_async_open(TEST_LOG, HCI_DUMP_BTSNOOP));
+    // reset before 4th packet
+    hci_dump_set_max_packets(3);
+    uint16_t i;
+    for (i = 0; i < 5; i++){
+        log_acl_packet(10 + i);
+    }
+    hci_dump_posix_async_close();
+    hci_dump_set_max_packets(-1);
+
+    uint32_t len = read_file(TEST_LOG);
+    CHECK_EQUAL(2, count_btsnoop_records(len));
+    CHECK_EQUAL(13, file_data[16 + 25]);
+
+    hci_dump_posix_async_statistics_t statistics;
+    hci_dump_posix_async_get_statistics(&statistics);
+    CHECK_EQUAL(0, statistics.dropped_packets);
+}
+
+TEST(HCI_DUMP_POSIX_ASYNC, ReopenFailureCountsDroppedPackets){
+    const char * dir = "/tmp/hci_dump_async_test_dir";
+    const char * path = "/tmp/hci_dump_async_test_dir/log";
+    mkdir(dir, 0700);
+    hci_dump_posix_async_set_rotation(0, 1, 1);
+    CHECK_EQUAL(0, hci_dump_posix_async_open(path, HCI_DUMP_BTSNOOP));
+    log_acl_packet(10);
+    // remove directory, log file cannot be created after rotation
+    unlink(path);
+    rmdir(dir);
+    usleep(1300000);
+    log_acl_packet(20);
+    log_acl_packet(30);
+    log_acl_packet(40);
+    hci_dump_posix_async_close();
+
+    hci_dump_posix_async_statistics_t statistics;
+    hci_dump_posix_async_get_statistics(&statistics);
+    CHECK_EQUAL(3, statistics.dropped_packets);
+}
+
+int main (int argc, const char * argv[]){
+    return CommandLineTestRunner::RunAllTests(argc, argv);
+}
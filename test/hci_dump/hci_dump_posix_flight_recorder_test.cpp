@@ -0,0 +1,122 @@
+#include "CppUTest/TestHarness.h"
+#include "CppUTest/CommandLineTestRunner.h"
+
+#include "hci_dump.h"
+#include "hci_dump_posix_flight_recorder.h"
+#include "btstack_defines.h"
+#include "btstack_util.h"
+#include "btstack_config.h"
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+#define TEST_TRACE "/tmp/hci_dump_flight_recorder_test.log"
+#define TEST_TRIGGER_PREFIX "/tmp/hci_dump_flight_recorder_trigger"
+
+static uint8_t recorder_buffer[1000];
+static uint8_t file_data[4096];
+
+static uint32_t read_file(const char * path){
+    FILE * file = fopen(path, "rb");
+    if (file == NULL) return 0;
+    size_t len = fread(file_data, 1, sizeof(file_data), file);
+    fclose(file);
+    return (uint32_t) len;
+}
+
+// returns number of BTSnoop records, first payload byte of first record
+static uint16_t count_btsnoop_records(uint32_t len, uint8_t * first_value){
+    uint16_t num_records = 0;
+    uint32_t pos = 16;
+    *first_value = 0;
+    while ((pos + 24) <= len){
+        uint32_t record_len = big_endian_read_32(file_data, pos);
+        if (num_records == 0){
+            *first_value = file_data[pos + 25];
+        }
+        pos += 24 + record_len;
+        num_records++;
+    }
+    CHECK_EQUAL(len, pos);
+    return num_records;
+}
+
+static void log_acl_packet(uint8_t value){
+    uint8_t packet[100];
+    memset(packet, value, sizeof(packet));
+    hci_dump_packet(HCI_ACL_DATA_PACKET, 0, packet, sizeof(packet));
+}
+
+TEST_GROUP(HCI_DUMP_POSIX_FLIGHT_RECORDER){
+    void setup(void){
+        unlink(TEST_TRACE);
+        unlink(TEST_TRIGGER_PREFIX "-0");
+        hci_dump_posix_flight_recorder_init(recorder_buffer, sizeof(recorder_buffer), HCI_DUMP_BTSNOOP);
+        hci_dump_init(hci_dump_posix_flight_recorder_get_instance());
+    }
+    void teardown(void){
+        hci_dump_init(NULL);
+    }
+};
+
+TEST(HCI_DUMP_POSIX_FLIGHT_RECORDER, Write){
+    log_acl_packet(1);
+    log_acl_packet(2);
+    CHECK_EQUAL(0, hci_dump_posix_flight_recorder_write(TEST_TRACE));
+    uint8_t first_value;
+    uint32_t len = read_file(TEST_TRACE);
+    MEMCMP_EQUAL("btsnoop", file_data, 8);
+    CHECK_EQUAL(2, count_btsnoop_records(len, &first_value));
+    CHECK_EQUAL(1, first_value);
+}
+
+TEST(HCI_DUMP_POSIX_FLIGHT_RECORDER, OldestRecordsDiscarded){
+    // each record uses 125 bytes, buffer holds 8 records
+    uint8_t i;
+    for (i = 1; i <= 20; i++){
+        log_acl_packet(i);
+    }
+    CHECK_EQUAL(0, hci_dump_posix_flight_recorder_write(TEST_TRACE));
+    uint8_t first_value;
+    uint32_t len = read_file(TEST_TRACE);
+    CHECK_EQUAL(8, count_btsnoop_records(len, &first_value));
+    CHECK_EQUAL(13, first_value);
+}
+
+TEST(HCI_DUMP_POSIX_FLIGHT_RECORDER, DisconnectTrigger){
+    hci_dump_posix_flight_recorder_set_triggers(TEST_TRIGGER_PREFIX, HCI_DUMP_FLIGHT_RECORDER_TRIGGER_DISCONNECT);
+    log_acl_packet(1);
+    // regular disconnect
+    uint8_t event[] = { HCI_EVENT_DISCONNECTION_COMPLETE, 4, 0, 0x01, 0x00, ERROR_CODE_REMOTE_USER_TERMINATED_CONNECTION };
+    hci_dump_packet(HCI_EVENT_PACKET, 1, event, sizeof(event));
+    CHECK_EQUAL(0, read_file(TEST_TRIGGER_PREFIX "-0"));
+    // supervision timeout
+    event[5] = ERROR_CODE_CONNECTION_TIMEOUT;
+    hci_dump_packet(HCI_EVENT_PACKET, 1, event, sizeof(event));
+    uint8_t first_value;
+    uint32_t len = read_file(TEST_TRIGGER_PREFIX "-0");
+    CHECK_EQUAL(3, count_btsnoop_records(len, &first_value));
+}
+
+TEST(HCI_DUMP_POSIX_FLIGHT_RECORDER, PacketLoggerWithMessages){
+    hci_dump_posix_flight_recorder_init(recorder_buffer, sizeof(recorder_buffer), HCI_DUMP_PACKETLOGGER);
+    hci_dump_posix_flight_recorder_set_triggers(TEST_TRIGGER_PREFIX, HCI_DUMP_FLIGHT_RECORDER_TRIGGER_LOG_ERROR);
+    uint8_t i;
+    for (i = 1; i <= 20; i++){
+        hci_dump_log(HCI_DUMP_LOG_LEVEL_INFO, "message %u", i);
+    }
+    hci_dump_log(HCI_DUMP_LOG_LEVEL_ERROR, "error");
+    uint32_t len = read_file(TEST_TRIGGER_PREFIX "-0");
+    CHECK(len > 0);
+    MEMCMP_EQUAL("error", &file_data[len - 5], 5);
+    // first record is complete
+    uint32_t pos = 0;
+    while (pos < len){
+        pos += 4 + big_endian_read_32(file_data, pos);
+    }
+    CHECK_EQUAL(len, pos);
+}
+
+int main (int argc, const char * argv[]){
+    return CommandLineTestRunner::RunAllTests(argc, argv);
+}
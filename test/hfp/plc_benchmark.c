@@ -0,0 +1,137 @@
+/*
+ * CPU per concealed frame and concealment SNR for CVSD and mSBC packet loss concealment
+ *
+ * Build with and without ENABLE_PLC_FIXED_POINT to compare float and fixed-point implementation
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+
+#include "classic/btstack_cvsd_plc.h"
+#include "classic/btstack_sbc_plc.h"
+
+#ifdef ENABLE_PLC_FIXED_POINT
+#define PLC_NAME "fixed-point"
+#else
+#define PLC_NAME "float"
+#endif
+
+#define NUM_ITERATIONS 20000
+#define NUM_GOOD_FRAMES 8
+#define AMPLITUDE 12000.0
+
+// voiced speech like signal: fundamental with a few harmonics
+static int16_t signal_sample(uint32_t index, double sample_rate){
+    const double f0 = 180.0;
+    double t = (double) index / sample_rate;
+    double value = sin(2.0 * M_PI * f0 * t) + 0.5 * sin(2.0 * M_PI * 2 * f0 * t + 0.3) + 0.25 * sin(2.0 * M_PI * 3 * f0 * t + 1.1);
+    return (int16_t) lround(AMPLITUDE * value / 1.75);
+}
+
+static void signal_frame(int16_t * frame, uint16_t num_samples, uint32_t frame_nr, double sample_rate){
+    uint16_t i;
+    for (i = 0; i < num_samples; i++){
+        frame[i] = signal_sample(frame_nr * num_samples + i, sample_rate);
+    }
+}
+
+static double snr_db(const int16_t * reference, const int16_t * test, uint16_t num_samples){
+    double signal = 0;
+    double noise  = 0;
+    uint16_t i;
+    for (i = 0; i < num_samples; i++){
+        double error = (double) test[i] - reference[i];
+        signal += (double) reference[i] * reference[i];
+        noise  += error * error;
+    }
+    return 10.0 * log10(signal / (noise + 1e-9));
+}
+
+static void benchmark_cvsd(void){
+    static btstack_cvsd_plc_state_t state;
+    static btstack_cvsd_plc_state_t state_with_history;
+    int16_t frame[CVSD_FS];
+    int16_t out[CVSD_FS];
+    uint32_t frame_nr;
+
+    btstack_cvsd_plc_init(&state_with_history);
+    for (frame_nr = 0; frame_nr < NUM_GOOD_FRAMES; frame_nr++){
+        signal_frame(frame, CVSD_FS, frame_nr, 8000.0);
+        btstack_cvsd_plc_good_frame(&state_with_history, CVSD_FS, frame, out);
+    }
+
+    // quality of first concealed frame
+    state = state_with_history;
+    btstack_cvsd_plc_bad_frame(&state, CVSD_FS, out);
+    signal_frame(frame, CVSD_FS, NUM_GOOD_FRAMES, 8000.0);
+    double snr = snr_db(frame, out, CVSD_FS);
+
+    // first bad frame includes pattern match
+    clock_t start = clock();
+    int i;
+    for (i = 0; i < NUM_ITERATIONS; i++){
+        state = state_with_history;
+        btstack_cvsd_plc_bad_frame(&state, CVSD_FS, out);
+    }
+    double first_us = (double)(clock() - start) * 1e6 / CLOCKS_PER_SEC / NUM_ITERATIONS;
+
+    start = clock();
+    for (i = 0; i < NUM_ITERATIONS; i++){
+        btstack_cvsd_plc_bad_frame(&state, CVSD_FS, out);
+    }
+    double next_us = (double)(clock() - start) * 1e6 / CLOCKS_PER_SEC / NUM_ITERATIONS;
+
+    printf("CVSD: first bad frame %6.2f us, following bad frame %6.2f us, concealment SNR %5.1f dB\n", first_us, next_us, snr);
+}
+
+static void benchmark_msbc(void){
+    static btstack_sbc_plc_state_t state;
+    static btstack_sbc_plc_state_t state_with_history;
+    int16_t frame[SBC_FS];
+    int16_t out[SBC_FS];
+    int16_t zir[SBC_FS];
+    uint32_t frame_nr;
+
+    btstack_sbc_plc_init(&state_with_history);
+    for (frame_nr = 0; frame_nr < NUM_GOOD_FRAMES; frame_nr++){
+        signal_frame(frame, SBC_FS, frame_nr, 16000.0);
+        btstack_sbc_plc_good_frame(&state_with_history, frame, out);
+    }
+    // zero input response approximated by continuation of signal
+    signal_frame(zir, SBC_FS, NUM_GOOD_FRAMES, 16000.0);
+
+    // quality of first concealed frame
+    state = state_with_history;
+    btstack_sbc_plc_bad_frame(&state, zir, out);
+    signal_frame(frame, SBC_FS, NUM_GOOD_FRAMES, 16000.0);
+    double snr = snr_db(frame, out, SBC_FS);
+
+    // first bad frame includes pattern match
+    clock_t start = clock();
+    int i;
+    for (i = 0; i < NUM_ITERATIONS; i++){
+        state = state_with_history;
+        btstack_sbc_plc_bad_frame(&state, zir, out);
+    }
+    double first_us = (double)(clock() - start) * 1e6 / CLOCKS_PER_SEC / NUM_ITERATIONS;
+
+    start = clock();
+    for (i = 0; i < NUM_ITERATIONS; i++){
+        btstack_sbc_plc_bad_frame(&state, zir, out);
+    }
+    double next_us = (double)(clock() - start) * 1e6 / CLOCKS_PER_SEC / NUM_ITERATIONS;
+
+    printf("mSBC: first bad frame %6.2f us, following bad frame %6.2f us, concealment SNR %5.1f dB\n", first_us, next_us, snr);
+}
+
+int main(int argc, const char * argv[]){
+    (void) argc;
+    (void) argv;
+    printf("PLC %s\n", PLC_NAME);
+    benchmark_cvsd();
+    benchmark_msbc();
+    return 0;
+}
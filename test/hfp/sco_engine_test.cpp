@@ -0,0 +1,214 @@
+// *****************************************************************************
+//
+// test SCO Engine with mocked HCI
+//
+// *****************************************************************************
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "CppUTest/TestHarness.h"
+#include "CppUTest/CommandLineTestRunner.h"
+
+#include "classic/btstack_sco_engine.h"
+#include "btstack_util.h"
+#include "hci.h"
+
+#define SCO_PAYLOAD_SIZE 60
+#define BLOCK_SIZE (4 * SCO_PAYLOAD_SIZE)
+
+// mocked HCI
+static btstack_packet_handler_t sco_packet_handler;
+static uint8_t  outgoing_packet_buffer[3 + 255];
+static int      num_free_sco_slots;
+static int      num_can_send_now_requests;
+static int      num_packets_sent;
+static hci_con_handle_t sent_con_handles[32];
+static uint8_t  sent_payload_first_byte[32];
+
+extern "C" void hci_register_sco_packet_handler(btstack_packet_handler_t handler){
+    sco_packet_handler = handler;
+}
+
+extern "C" void hci_reserve_packet_buffer(void){
+}
+
+extern "C" uint8_t * hci_get_outgoing_packet_buffer(void){
+    return outgoing_packet_buffer;
+}
+
+extern "C" uint8_t hci_send_sco_packet_buffer(int size){
+    CHECK_EQUAL(3 + SCO_PAYLOAD_SIZE, size);
+    CHECK(num_free_sco_slots > 0);
+    num_free_sco_slots--;
+    if (num_packets_sent < 32){
+        sent_con_handles[num_packets_sent] = little_endian_read_16(outgoing_packet_buffer, 0);
+        sent_payload_first_byte[num_packets_sent] = outgoing_packet_buffer[3];
+    }
+    num_packets_sent++;
+    return ERROR_CODE_SUCCESS;
+}
+
+extern "C" uint16_t hci_get_sco_packet_length_for_connection(hci_con_handle_t sco_con_handle){
+    UNUSED(sco_con_handle);
+    return 3 + SCO_PAYLOAD_SIZE;
+}
+
+extern "C" bool hci_can_send_sco_packet_now(void){
+    return num_free_sco_slots > 0;
+}
+
+extern "C" bool hci_can_send_sco_packet_now_for_connection(hci_con_handle_t sco_con_handle){
+    UNUSED(sco_con_handle);
+    return num_free_sco_slots > 0;
+}
+
+extern "C" void hci_request_sco_can_send_now_event(void){
+    num_can_send_now_requests++;
+}
+
+static void controller_frees_sco_slots(int num_slots){
+    num_free_sco_slots += num_slots;
+    uint8_t event[2] = { HCI_EVENT_SCO_CAN_SEND_NOW, 0 };
+    (*sco_packet_handler)(HCI_EVENT_PACKET, 0, event, sizeof(event));
+}
+
+static void controller_receives_sco_packet(hci_con_handle_t con_handle, uint8_t value){
+    uint8_t packet[3 + SCO_PAYLOAD_SIZE];
+    little_endian_store_16(packet, 0, con_handle);
+    packet[2] = SCO_PAYLOAD_SIZE;
+    memset(&packet[3], value, SCO_PAYLOAD_SIZE);
+    (*sco_packet_handler)(HCI_SCO_DATA_PACKET, 0, packet, sizeof(packet));
+}
+
+// application
+static int num_send_block_requests;
+static int num_received_block_callbacks;
+
+static void send_block_requested(btstack_sco_stream_t * stream, uint16_t num_bytes_free){
+    UNUSED(stream);
+    CHECK(num_bytes_free >= BLOCK_SIZE);
+    num_send_block_requests++;
+}
+
+static void received_block_available(btstack_sco_stream_t * stream, uint16_t num_bytes_available){
+    UNUSED(stream);
+    CHECK(num_bytes_available >= BLOCK_SIZE);
+    num_received_block_callbacks++;
+}
+
+static int num_fallback_sco_packets;
+static void fallback_sco_packet_handler(uint8_t packet_type, uint16_t channel, uint8_t * packet, uint16_t size){
+    UNUSED(channel);
+    UNUSED(packet);
+    UNUSED(size);
+    if (packet_type == HCI_SCO_DATA_PACKET){
+        num_fallback_sco_packets++;
+    }
+}
+
+TEST_GROUP(SCOEngine){
+    btstack_sco_stream_t stream_a;
+    btstack_sco_stream_t stream_b;
+    uint8_t send_storage_a[2 * BLOCK_SIZE];
+    uint8_t send_storage_b[2 * BLOCK_SIZE];
+    uint8_t receive_storage_a[2 * BLOCK_SIZE];
+    uint8_t receive_storage_b[2 * BLOCK_SIZE];
+
+    void setup(void){
+        sco_packet_handler = NULL;
+        num_free_sco_slots = 0;
+        num_can_send_now_requests = 0;
+        num_packets_sent = 0;
+        num_send_block_requests = 0;
+        num_received_block_callbacks = 0;
+        num_fallback_sco_packets = 0;
+        btstack_sco_engine_init(&fallback_sco_packet_handler);
+        CHECK(sco_packet_handler != NULL);
+    }
+
+    void teardown(void){
+        btstack_sco_engine_deinit();
+    }
+};
+
+TEST(SCOEngine, SendMultiplePacketsPerCanSendNow){
+    btstack_sco_engine_add_stream(&stream_a, 0x0101, BLOCK_SIZE, send_storage_a, sizeof(send_storage_a),
+                                  receive_storage_a, sizeof(receive_storage_a), &send_block_requested, &received_block_available);
+    btstack_sco_engine_add_stream(&stream_b, 0x0102, BLOCK_SIZE, send_storage_b, sizeof(send_storage_b),
+                                  receive_storage_b, sizeof(receive_storage_b), &send_block_requested, &received_block_available);
+    CHECK(num_can_send_now_requests > 0);
+
+    uint8_t block[BLOCK_SIZE];
+    memset(block, 0xaa, sizeof(block));
+    CHECK_EQUAL(BLOCK_SIZE, btstack_sco_engine_write(&stream_a, block, sizeof(block)));
+    memset(block, 0xbb, sizeof(block));
+    CHECK_EQUAL(BLOCK_SIZE, btstack_sco_engine_write(&stream_b, block, sizeof(block)));
+
+    // single credit update for six packets, sent round-robin
+    controller_frees_sco_slots(6);
+    CHECK_EQUAL(6, num_packets_sent);
+    CHECK_EQUAL(0, num_free_sco_slots);
+    int i;
+    for (i=0;i<6;i++){
+        CHECK_EQUAL((i & 1) ? 0x0102 : 0x0101, sent_con_handles[i]);
+        CHECK_EQUAL((i & 1) ? 0xbb : 0xaa, sent_payload_first_byte[i]);
+    }
+    CHECK_EQUAL(3, stream_a.num_packets_sent);
+    CHECK_EQUAL(3, stream_b.num_packets_sent);
+    CHECK(num_send_block_requests >= 2);
+}
+
+TEST(SCOEngine, SendSilenceOnUnderrun){
+    btstack_sco_engine_add_stream(&stream_a, 0x0101, BLOCK_SIZE, send_storage_a, sizeof(send_storage_a),
+                                  receive_storage_a, sizeof(receive_storage_a), NULL, NULL);
+    uint8_t payload[SCO_PAYLOAD_SIZE];
+    memset(payload, 0x55, sizeof(payload));
+    btstack_sco_engine_write(&stream_a, payload, sizeof(payload));
+    controller_frees_sco_slots(3);
+    CHECK_EQUAL(3, num_packets_sent);
+    CHECK_EQUAL(0x55, sent_payload_first_byte[0]);
+    CHECK_EQUAL(0x00, sent_payload_first_byte[1]);
+    CHECK_EQUAL(1, stream_a.num_packets_sent);
+    CHECK_EQUAL(2, stream_a.num_packets_silence);
+}
+
+TEST(SCOEngine, ReceiveBlocks){
+    btstack_sco_engine_add_stream(&stream_a, 0x0101, BLOCK_SIZE, send_storage_a, sizeof(send_storage_a),
+                                  receive_storage_a, sizeof(receive_storage_a), NULL, &received_block_available);
+    int i;
+    for (i=0;i<3;i++){
+        controller_receives_sco_packet(0x0101, (uint8_t) i);
+    }
+    CHECK_EQUAL(0, num_received_block_callbacks);
+    controller_receives_sco_packet(0x0101, 3);
+    CHECK_EQUAL(1, num_received_block_callbacks);
+
+    uint8_t block[BLOCK_SIZE];
+    CHECK_EQUAL(BLOCK_SIZE, btstack_sco_engine_read(&stream_a, block, sizeof(block)));
+    CHECK_EQUAL(0, block[0]);
+    CHECK_EQUAL(3, block[BLOCK_SIZE - 1]);
+
+    // overrun drops newest packets
+    for (i=0;i<9;i++){
+        controller_receives_sco_packet(0x0101, (uint8_t) i);
+    }
+    CHECK_EQUAL(SCO_PAYLOAD_SIZE, stream_a.num_bytes_dropped);
+
+    // packets for unknown connections are forwarded
+    controller_receives_sco_packet(0x0200, 0);
+    CHECK_EQUAL(1, num_fallback_sco_packets);
+}
+
+TEST(SCOEngine, RemoveStream){
+    btstack_sco_engine_add_stream(&stream_a, 0x0101, BLOCK_SIZE, send_storage_a, sizeof(send_storage_a),
+                                  receive_storage_a, sizeof(receive_storage_a), NULL, NULL);
+    btstack_sco_engine_remove_stream(&stream_a);
+    controller_frees_sco_slots(2);
+    CHECK_EQUAL(0, num_packets_sent);
+}
+
+int main (int argc, const char * argv[]){
+    return CommandLineTestRunner::RunAllTests(argc, argv);
+}
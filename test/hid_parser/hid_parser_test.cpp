@@ -584,6 +584,84 @@ TEST(HID, GetReportSize){
     CHECK_EQUAL(8, report_size);
 }
 
+// compare compiled descriptor with single-pass parser
+static void expect_compiled_fields_match_parser(const uint8_t * hid_descriptor, uint16_t hid_descriptor_len, const uint8_t * hid_report, uint16_t hid_report_len){
+    static btstack_hid_compiled_descriptor_t compiled;
+    static btstack_hid_field_t fields[64];
+    CHECK_EQUAL(true, btstack_hid_descriptor_compile(&compiled, hid_descriptor, hid_descriptor_len, HID_REPORT_TYPE_INPUT, fields, 64));
+
+    uint16_t num_fields = 0;
+    const btstack_hid_field_t * report_fields = btstack_hid_compiled_get_fields(&compiled, hid_report, hid_report_len, &num_fields);
+    CHECK(report_fields != NULL);
+
+    static btstack_hid_parser_t hid_parser;
+    btstack_hid_parser_init(&hid_parser, hid_descriptor, hid_descriptor_len, HID_REPORT_TYPE_INPUT, hid_report, hid_report_len);
+    uint16_t i;
+    for (i = 0; i < num_fields; i++){
+        CHECK_EQUAL(1, btstack_hid_parser_has_more(&hid_parser));
+        uint16_t expected_usage_page;
+        uint16_t expected_usage;
+        int32_t  expected_value;
+        btstack_hid_parser_get_field(&hid_parser, &expected_usage_page, &expected_usage, &expected_value);
+        uint16_t usage_page;
+        uint16_t usage;
+        int32_t  value;
+        btstack_hid_field_get_value(&report_fields[i], hid_report, hid_report_len, &usage_page, &usage, &value);
+        CHECK_EQUAL(expected_usage_page, usage_page);
+        CHECK_EQUAL(expected_usage, usage);
+        CHECK_EQUAL(expected_value, value);
+    }
+    CHECK_EQUAL(0, btstack_hid_parser_has_more(&hid_parser));
+}
+
+TEST(HID, CompiledMatchesParser){
+    expect_compiled_fields_match_parser(mouse_descriptor_without_report_id, sizeof(mouse_descriptor_without_report_id), mouse_report_without_id_positive_xy, sizeof(mouse_report_without_id_positive_xy));
+    expect_compiled_fields_match_parser(mouse_descriptor_without_report_id, sizeof(mouse_descriptor_without_report_id), mouse_report_without_id_negative_xy, sizeof(mouse_report_without_id_negative_xy));
+    expect_compiled_fields_match_parser(mouse_descriptor_with_report_id, sizeof(mouse_descriptor_with_report_id), mouse_report_with_id_1, sizeof(mouse_report_with_id_1));
+    expect_compiled_fields_match_parser(hid_descriptor_keyboard_boot_mode, sizeof(hid_descriptor_keyboard_boot_mode), keyboard_report1, sizeof(keyboard_report1));
+    expect_compiled_fields_match_parser(combo_descriptor_with_report_ids, sizeof(combo_descriptor_with_report_ids), combo_report1, sizeof(combo_report1));
+    expect_compiled_fields_match_parser(combo_descriptor_with_report_ids, sizeof(combo_descriptor_with_report_ids), combo_report2, sizeof(combo_report2));
+    expect_compiled_fields_match_parser(tank_mouse_descriptor, sizeof(tank_mouse_descriptor), tank_mouse_report, sizeof(tank_mouse_report));
+    expect_compiled_fields_match_parser(xbox_wireless_descriptor, sizeof(xbox_wireless_descriptor), xbox_wireless_report, sizeof(xbox_wireless_report));
+}
+
+TEST(HID, CompiledMouse){
+    static btstack_hid_compiled_descriptor_t compiled;
+    static btstack_hid_field_t fields[16];
+    CHECK_EQUAL(true, btstack_hid_descriptor_compile(&compiled, mouse_descriptor_with_report_id, sizeof(mouse_descriptor_with_report_id), HID_REPORT_TYPE_INPUT, fields, 16));
+    CHECK_EQUAL(true, compiled.report_ids_declared);
+    CHECK_EQUAL(3, btstack_hid_compiled_get_report_size_for_id(&compiled, 1));
+    CHECK_EQUAL(0, btstack_hid_compiled_get_report_size_for_id(&compiled, 2));
+
+    uint16_t num_fields = 0;
+    const btstack_hid_field_t * report_fields = btstack_hid_compiled_get_fields(&compiled, mouse_report_with_id_1, sizeof(mouse_report_with_id_1), &num_fields);
+    CHECK_EQUAL(5, num_fields);
+    // X axis after Report ID and 8 bit buttons
+    CHECK_EQUAL(16, report_fields[3].bit_offset);
+    CHECK_EQUAL(8, report_fields[3].bit_size);
+    CHECK_EQUAL(0x30, report_fields[3].usage);
+    CHECK_EQUAL(-127, report_fields[3].logical_minimum);
+    CHECK_EQUAL(127, report_fields[3].logical_maximum);
+
+    // unknown report id
+    const uint8_t unknown_report[] = { 0x05, 0x00 };
+    CHECK(btstack_hid_compiled_get_fields(&compiled, unknown_report, sizeof(unknown_report), &num_fields) == NULL);
+}
+
+TEST(HID, CompiledFieldStorageTooSmall){
+    static btstack_hid_compiled_descriptor_t compiled;
+    static btstack_hid_field_t fields[4];
+    CHECK_EQUAL(false, btstack_hid_descriptor_compile(&compiled, hid_descriptor_keyboard_boot_mode, sizeof(hid_descriptor_keyboard_boot_mode), HID_REPORT_TYPE_INPUT, fields, 4));
+}
+
+TEST(HID, CompiledReportSize){
+    static btstack_hid_compiled_descriptor_t compiled;
+    static btstack_hid_field_t fields[32];
+    CHECK_EQUAL(true, btstack_hid_descriptor_compile(&compiled, hid_descriptor_keyboard_boot_mode, sizeof(hid_descriptor_keyboard_boot_mode), HID_REPORT_TYPE_OUTPUT, fields, 32));
+    CHECK_EQUAL(1, btstack_hid_compiled_get_report_size_for_id(&compiled, 0));
+    CHECK_EQUAL(true, btstack_hid_descriptor_compile(&compiled, hid_descriptor_keyboard_boot_mode, sizeof(hid_descriptor_keyboard_boot_mode), HID_REPORT_TYPE_INPUT, fields, 32));
+    CHECK_EQUAL(8, btstack_hid_compiled_get_report_size_for_id(&compiled, 0));
+}
 
 int main (int argc, const char * argv[]){
 #if 1
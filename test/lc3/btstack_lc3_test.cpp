@@ -0,0 +1,259 @@
+#include "CppUTest/TestHarness.h"
+#include "CppUTest/CommandLineTestRunner.h"
+
+#include "bluetooth.h"
+#include "btstack_lc3.h"
+#include "btstack_lc3_thread_pool_posix.h"
+#include "btstack_util.h"
+
+#include <pthread.h>
+#include <string.h>
+#include <unistd.h>
+
+#define MAX_CHANNELS 4
+#define NUM_SAMPLES 4
+#define OCTETS_PER_FRAME NUM_SAMPLES
+
+// mock codec: LC3 frame contains the low byte of each sample
+typedef struct {
+    uint8_t status;
+    uint8_t bec_detect;
+    // keep channel busy to let callers overlap
+    bool    busy;
+} mock_lc3_context_t;
+
+static uint8_t mock_lc3_encode_signed_16(void * context, const int16_t * pcm_in, uint16_t stride, uint8_t * bytes){
+    uint16_t i;
+    for (i = 0; i < NUM_SAMPLES; i++){
+        bytes[i] = (uint8_t) pcm_in[i * stride];
+    }
+    if (((mock_lc3_context_t *) context)->busy){
+        usleep(10);
+    }
+    return ((mock_lc3_context_t *) context)->status;
+}
+
+static uint8_t mock_lc3_decode_signed_16(void * context, const uint8_t * bytes, uint8_t BFI, int16_t * pcm_out, uint16_t stride, uint8_t * BEC_detect){
+    mock_lc3_context_t * mock_context = (mock_lc3_context_t *) context;
+    uint16_t i;
+    for (i = 0; i < NUM_SAMPLES; i++){
+        // mark concealed frames
+        pcm_out[i * stride] = (int16_t) (BFI ? -bytes[i] : bytes[i]);
+    }
+    *BEC_detect = mock_context->bec_detect;
+    return mock_context->status;
+}
+
+static const btstack_lc3_encoder_t mock_lc3_encoder = { NULL, &mock_lc3_encode_signed_16, NULL };
+static const btstack_lc3_decoder_t mock_lc3_decoder = { NULL, &mock_lc3_decode_signed_16, NULL };
+
+// sample i of channel c has value base + c * 16 + i
+static void setup_pcm(int16_t * pcm, uint8_t num_channels, uint8_t base){
+    uint8_t channel;
+    uint16_t i;
+    for (channel = 0; channel < num_channels; channel++){
+        for (i = 0; i < NUM_SAMPLES; i++){
+            pcm[i * num_channels + channel] = base + channel * 16 + i;
+        }
+    }
+}
+
+static void setup_bytes(uint8_t * bytes, uint8_t num_channels, uint8_t base){
+    uint8_t channel;
+    uint16_t i;
+    for (channel = 0; channel < num_channels; channel++){
+        for (i = 0; i < OCTETS_PER_FRAME; i++){
+            bytes[channel * OCTETS_PER_FRAME + i] = base + channel * 16 + i;
+        }
+    }
+}
+
+typedef uint8_t (*encode_frames_t)(const btstack_lc3_encoder_t * encoder, void * const * encoder_contexts, uint8_t num_channels,
+                                   const int16_t * pcm_in, uint8_t * bytes, uint16_t octets_per_frame);
+typedef uint8_t (*decode_frames_t)(const btstack_lc3_decoder_t * decoder, void * const * decoder_contexts, uint8_t num_channels,
+                                   const uint8_t * bytes, uint16_t octets_per_frame, const uint8_t * BFI,
+                                   int16_t * pcm_out, uint8_t * BEC_detect);
+
+static mock_lc3_context_t contexts[MAX_CHANNELS];
+static void * context_pointers[MAX_CHANNELS];
+
+static void setup_contexts(void){
+    uint8_t channel;
+    for (channel = 0; channel < MAX_CHANNELS; channel++){
+        contexts[channel].status = ERROR_CODE_SUCCESS;
+        contexts[channel].bec_detect = 0;
+        context_pointers[channel] = &contexts[channel];
+    }
+}
+
+static void check_encode(encode_frames_t encode_frames){
+    int16_t pcm[MAX_CHANNELS * NUM_SAMPLES];
+    uint8_t bytes[MAX_CHANNELS * OCTETS_PER_FRAME];
+    uint8_t expected[MAX_CHANNELS * OCTETS_PER_FRAME];
+    setup_pcm(pcm, 3, 0);
+    setup_bytes(expected, 3, 0);
+    CHECK_EQUAL(ERROR_CODE_SUCCESS, (*encode_frames)(&mock_lc3_encoder, context_pointers, 3, pcm, bytes, OCTETS_PER_FRAME));
+    MEMCMP_EQUAL(expected, bytes, 3 * OCTETS_PER_FRAME);
+}
+
+static void check_encode_status(encode_frames_t encode_frames){
+    int16_t pcm[MAX_CHANNELS * NUM_SAMPLES];
+    uint8_t bytes[MAX_CHANNELS * OCTETS_PER_FRAME];
+    uint8_t expected[MAX_CHANNELS * OCTETS_PER_FRAME];
+    setup_pcm(pcm, MAX_CHANNELS, 0);
+    setup_bytes(expected, MAX_CHANNELS, 0);
+    contexts[1].status = ERROR_CODE_UNSPECIFIED_ERROR;
+    contexts[3].status = ERROR_CODE_PARAMETER_OUT_OF_MANDATORY_RANGE;
+    CHECK_EQUAL(ERROR_CODE_UNSPECIFIED_ERROR, (*encode_frames)(&mock_lc3_encoder, context_pointers, MAX_CHANNELS, pcm, bytes, OCTETS_PER_FRAME));
+    // all channels are processed
+    MEMCMP_EQUAL(expected, bytes, sizeof(bytes));
+}
+
+static void check_decode(decode_frames_t decode_frames){
+    uint8_t bytes[MAX_CHANNELS * OCTETS_PER_FRAME];
+    int16_t pcm[MAX_CHANNELS * NUM_SAMPLES];
+    int16_t expected[MAX_CHANNELS * NUM_SAMPLES];
+    setup_bytes(bytes, 3, 0);
+    setup_pcm(expected, 3, 0);
+    // BFI and BEC_detect are optional
+    CHECK_EQUAL(ERROR_CODE_SUCCESS, (*decode_frames)(&mock_lc3_decoder, context_pointers, 3, bytes, OCTETS_PER_FRAME, NULL, pcm, NULL));
+    MEMCMP_EQUAL(expected, pcm, 3 * NUM_SAMPLES * sizeof(int16_t));
+}
+
+static void check_decode_bfi(decode_frames_t decode_frames){
+    uint8_t bytes[2 * OCTETS_PER_FRAME];
+    int16_t pcm[2 * NUM_SAMPLES];
+    uint8_t BFI[2] = { 0, 1 };
+    uint8_t BEC_detect[2] = { 0xff, 0xff };
+    setup_bytes(bytes, 2, 0);
+    contexts[0].bec_detect = 1;
+    CHECK_EQUAL(ERROR_CODE_SUCCESS, (*decode_frames)(&mock_lc3_decoder, context_pointers, 2, bytes, OCTETS_PER_FRAME, BFI, pcm, BEC_detect));
+    CHECK_EQUAL(1, BEC_detect[0]);
+    CHECK_EQUAL(0, BEC_detect[1]);
+    CHECK_EQUAL(2, pcm[2 * 2 + 0]);
+    CHECK_EQUAL(-18, pcm[2 * 2 + 1]);
+}
+
+static void check_decode_status(decode_frames_t decode_frames){
+    uint8_t bytes[MAX_CHANNELS * OCTETS_PER_FRAME];
+    int16_t pcm[MAX_CHANNELS * NUM_SAMPLES];
+    int16_t expected[MAX_CHANNELS * NUM_SAMPLES];
+    setup_bytes(bytes, MAX_CHANNELS, 0);
+    setup_pcm(expected, MAX_CHANNELS, 0);
+    contexts[2].status = ERROR_CODE_UNSPECIFIED_ERROR;
+    contexts[3].status = ERROR_CODE_PARAMETER_OUT_OF_MANDATORY_RANGE;
+    CHECK_EQUAL(ERROR_CODE_UNSPECIFIED_ERROR, (*decode_frames)(&mock_lc3_decoder, context_pointers, MAX_CHANNELS, bytes, OCTETS_PER_FRAME, NULL, pcm, NULL));
+    MEMCMP_EQUAL(expected, pcm, sizeof(pcm));
+}
+
+TEST_GROUP(BtstackLC3){
+    void setup(void){
+        setup_contexts();
+    }
+};
+
+TEST(BtstackLC3, EncodeFrames){
+    check_encode(&btstack_lc3_encode_frames_signed_16);
+}
+
+TEST(BtstackLC3, EncodeFramesStatus){
+    check_encode_status(&btstack_lc3_encode_frames_signed_16);
+}
+
+TEST(BtstackLC3, DecodeFrames){
+    check_decode(&btstack_lc3_decode_frames_signed_16);
+}
+
+TEST(BtstackLC3, DecodeFramesBFI){
+    check_decode_bfi(&btstack_lc3_decode_frames_signed_16);
+}
+
+TEST(BtstackLC3, DecodeFramesStatus){
+    check_decode_status(&btstack_lc3_decode_frames_signed_16);
+}
+
+TEST_GROUP(BtstackLC3ThreadPoolPosix){
+    void setup(void){
+        setup_contexts();
+        CHECK_EQUAL(ERROR_CODE_SUCCESS, btstack_lc3_thread_pool_posix_init(2));
+    }
+    void teardown(void){
+        btstack_lc3_thread_pool_posix_deinit();
+    }
+};
+
+TEST(BtstackLC3ThreadPoolPosix, EncodeFrames){
+    check_encode(&btstack_lc3_thread_pool_posix_encode_frames_signed_16);
+}
+
+TEST(BtstackLC3ThreadPoolPosix, EncodeFramesStatus){
+    check_encode_status(&btstack_lc3_thread_pool_posix_encode_frames_signed_16);
+}
+
+TEST(BtstackLC3ThreadPoolPosix, DecodeFrames){
+    check_decode(&btstack_lc3_thread_pool_posix_decode_frames_signed_16);
+}
+
+TEST(BtstackLC3ThreadPoolPosix, DecodeFramesBFI){
+    check_decode_bfi(&btstack_lc3_thread_pool_posix_decode_frames_signed_16);
+}
+
+TEST(BtstackLC3ThreadPoolPosix, DecodeFramesStatus){
+    check_decode_status(&btstack_lc3_thread_pool_posix_decode_frames_signed_16);
+}
+
+// each caller encodes with its own contexts, only the first caller has a failing channel
+typedef struct {
+    uint8_t base;
+    uint8_t expected_status;
+    mock_lc3_context_t contexts[MAX_CHANNELS];
+    void * context_pointers[MAX_CHANNELS];
+    uint16_t num_errors;
+} encode_caller_t;
+
+static void * encode_caller_thread(void * arg){
+    encode_caller_t * caller = (encode_caller_t *) arg;
+    int16_t pcm[MAX_CHANNELS * NUM_SAMPLES];
+    uint8_t bytes[MAX_CHANNELS * OCTETS_PER_FRAME];
+    uint8_t expected[MAX_CHANNELS * OCTETS_PER_FRAME];
+    setup_pcm(pcm, MAX_CHANNELS, caller->base);
+    setup_bytes(expected, MAX_CHANNELS, caller->base);
+    uint16_t i;
+    for (i = 0; i < 1000; i++){
+        memset(bytes, 0, sizeof(bytes));
+        uint8_t status = btstack_lc3_thread_pool_posix_encode_frames_signed_16(&mock_lc3_encoder, caller->context_pointers, MAX_CHANNELS,
+                                                                               pcm, bytes, OCTETS_PER_FRAME);
+        if ((status != caller->expected_status) || (memcmp(expected, bytes, sizeof(bytes)) != 0)){
+            caller->num_errors++;
+        }
+    }
+    return NULL;
+}
+
+TEST(BtstackLC3ThreadPoolPosix, ConcurrentCallers){
+    encode_caller_t callers[2];
+    pthread_t threads[2];
+    uint8_t i;
+    for (i = 0; i < 2; i++){
+        memset(&callers[i], 0, sizeof(encode_caller_t));
+        callers[i].base = (uint8_t) (0x40 * (i + 1));
+        uint8_t channel;
+        for (channel = 0; channel < MAX_CHANNELS; channel++){
+            callers[i].contexts[channel].busy = true;
+            callers[i].context_pointers[channel] = &callers[i].contexts[channel];
+        }
+    }
+    callers[0].contexts[2].status = ERROR_CODE_UNSPECIFIED_ERROR;
+    callers[0].expected_status = ERROR_CODE_UNSPECIFIED_ERROR;
+    for (i = 0; i < 2; i++){
+        CHECK_EQUAL(0, pthread_create(&threads[i], NULL, &encode_caller_thread, &callers[i]));
+    }
+    for (i = 0; i < 2; i++){
+        pthread_join(threads[i], NULL);
+        CHECK_EQUAL(0, callers[i].num_errors);
+    }
+}
+
+int main (int argc, const char * argv[]){
+    return CommandLineTestRunner::RunAllTests(argc, argv);
+}
@@ -0,0 +1,218 @@
+/*
+ * Copyright (C) 2024 BlueKitchen GmbH
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holders nor the names of
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ * 4. Any redistribution, use, or modification is done solely for
+ *    personal benefit and not for any commercial purpose or for
+ *    monetary gain.
+ *
+ * THIS SOFTWARE IS PROVIDED BY BLUEKITCHEN GMBH AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL BLUEKITCHEN
+ * GMBH OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF
+ * THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ *
+ * Please inquire about commercial licensing options at 
+ * contact@bluekitchen-gmbh.com
+ *
+ */
+
+// *****************************************************************************
+//
+// LC3 multi-channel benchmark: sequential vs. POSIX thread pool
+//
+// *****************************************************************************
+
+// enable POSIX functions (needed for -std=c99)
+#define _POSIX_C_SOURCE 200809
+
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "bluetooth.h"
+#include "btstack_util.h"
+
+#include "btstack_lc3.h"
+#include "btstack_lc3_google.h"
+#include "btstack_lc3_thread_pool_posix.h"
+
+#define MAX_NUM_CHANNELS 16
+#define MAX_NUM_THREADS   8
+#define SAMPLE_RATE_HZ    48000
+#define SAMPLES_PER_FRAME 480
+#define OCTETS_PER_FRAME  120
+
+#define PI 3.14159265358979323846
+
+static btstack_lc3_encoder_google_t encoder_contexts[MAX_NUM_CHANNELS];
+static btstack_lc3_decoder_google_t decoder_contexts[MAX_NUM_CHANNELS];
+static void * encoder_context_ptrs[MAX_NUM_CHANNELS];
+static void * decoder_context_ptrs[MAX_NUM_CHANNELS];
+static const btstack_lc3_encoder_t * lc3_encoder;
+static const btstack_lc3_decoder_t * lc3_decoder;
+
+static int16_t pcm_in[SAMPLES_PER_FRAME * MAX_NUM_CHANNELS];
+static int16_t pcm_out[SAMPLES_PER_FRAME * MAX_NUM_CHANNELS];
+static uint8_t lc3_frames[OCTETS_PER_FRAME * MAX_NUM_CHANNELS];
+
+// reference output of sequential run
+static uint8_t lc3_frames_reference[OCTETS_PER_FRAME * MAX_NUM_CHANNELS];
+static int16_t pcm_out_reference[SAMPLES_PER_FRAME * MAX_NUM_CHANNELS];
+
+static void show_usage(const char * path){
+    printf("Usage: %s [num_channels] [num_frames]\n", path);
+    printf("- num_channels: 1..%u, default 8\n", MAX_NUM_CHANNELS);
+    printf("- num_frames: number of 10 ms frames, default 1000\n");
+    printf("\n\n");
+}
+
+static uint64_t time_us(void){
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return ((uint64_t) now.tv_sec) * 1000000 + (now.tv_nsec / 1000);
+}
+
+static void setup_codecs(uint8_t num_channels){
+    uint8_t channel;
+    for (channel = 0; channel < num_channels; channel++){
+        lc3_encoder = btstack_lc3_encoder_google_init_instance(&encoder_contexts[channel]);
+        lc3_encoder->configure(&encoder_contexts[channel], SAMPLE_RATE_HZ, BTSTACK_LC3_FRAME_DURATION_10000US, OCTETS_PER_FRAME);
+        encoder_context_ptrs[channel] = &encoder_contexts[channel];
+        lc3_decoder = btstack_lc3_decoder_google_init_instance(&decoder_contexts[channel]);
+        lc3_decoder->configure(&decoder_contexts[channel], SAMPLE_RATE_HZ, BTSTACK_LC3_FRAME_DURATION_10000US, OCTETS_PER_FRAME);
+        decoder_context_ptrs[channel] = &decoder_contexts[channel];
+    }
+}
+
+// different tone per channel
+static void generate_pcm(uint8_t num_channels, uint32_t frame){
+    uint16_t i;
+    uint8_t channel;
+    for (i = 0; i < SAMPLES_PER_FRAME; i++){
+        uint32_t t = frame * SAMPLES_PER_FRAME + i;
+        for (channel = 0; channel < num_channels; channel++){
+            double frequency_hz = 440.0 * (channel + 1);
+            pcm_in[i * num_channels + channel] = (int16_t) (8000.0 * sin(2.0 * PI * frequency_hz * t / SAMPLE_RATE_HZ));
+        }
+    }
+}
+
+// returns 0 if output of all frames matches reference, which is recorded if num_threads == 0
+static int run(const char * name, uint8_t num_channels, uint32_t num_frames, int num_threads){
+    setup_codecs(num_channels);
+    if (num_threads > 0){
+        btstack_lc3_thread_pool_posix_init((uint8_t) num_threads);
+    }
+
+    uint64_t encode_us = 0;
+    uint64_t decode_us = 0;
+    int mismatch = 0;
+    uint32_t frame;
+    for (frame = 0; frame < num_frames; frame++){
+        generate_pcm(num_channels, frame);
+
+        uint8_t status;
+        uint64_t start_us = time_us();
+        if (num_threads > 0){
+            status = btstack_lc3_thread_pool_posix_encode_frames_signed_16(lc3_encoder, encoder_context_ptrs, num_channels,
+                                                                           pcm_in, lc3_frames, OCTETS_PER_FRAME);
+        } else {
+            status = btstack_lc3_encode_frames_signed_16(lc3_encoder, encoder_context_ptrs, num_channels,
+                                                         pcm_in, lc3_frames, OCTETS_PER_FRAME);
+        }
+        uint64_t encoded_us = time_us();
+        if (status == ERROR_CODE_SUCCESS){
+            if (num_threads > 0){
+                status = btstack_lc3_thread_pool_posix_decode_frames_signed_16(lc3_decoder, decoder_context_ptrs, num_channels,
+                                                                               lc3_frames, OCTETS_PER_FRAME, NULL, pcm_out, NULL);
+            } else {
+                status = btstack_lc3_decode_frames_signed_16(lc3_decoder, decoder_context_ptrs, num_channels,
+                                                             lc3_frames, OCTETS_PER_FRAME, NULL, pcm_out, NULL);
+            }
+        }
+        uint64_t decoded_us = time_us();
+        if (status != ERROR_CODE_SUCCESS){
+            printf("%s: frame %u failed, status 0x%02x\n", name, frame, status);
+            mismatch = 1;
+            break;
+        }
+        encode_us += encoded_us - start_us;
+        decode_us += decoded_us - encoded_us;
+
+        // compare last frame
+        if (frame == (num_frames - 1)){
+            if (num_threads == 0){
+                memcpy(lc3_frames_reference, lc3_frames, num_channels * OCTETS_PER_FRAME);
+                memcpy(pcm_out_reference, pcm_out, num_channels * SAMPLES_PER_FRAME * sizeof(int16_t));
+            } else {
+                mismatch = (memcmp(lc3_frames_reference, lc3_frames, num_channels * OCTETS_PER_FRAME) != 0) ||
+                           (memcmp(pcm_out_reference, pcm_out, num_channels * SAMPLES_PER_FRAME * sizeof(int16_t)) != 0);
+            }
+        }
+    }
+
+    if (num_threads > 0){
+        btstack_lc3_thread_pool_posix_deinit();
+    }
+
+    printf("%-12s encode %6u us/frame, decode %6u us/frame%s\n", name,
+           (unsigned int) (encode_us / num_frames), (unsigned int) (decode_us / num_frames),
+           mismatch ? " - OUTPUT MISMATCH" : "");
+    return mismatch;
+}
+
+int main (int argc, const char * argv[]){
+    uint8_t  num_channels = 8;
+    uint32_t num_frames = 1000;
+    if (argc > 1){
+        int value = atoi(argv[1]);
+        if ((value < 1) || (value > MAX_NUM_CHANNELS)){
+            show_usage(argv[0]);
+            return -1;
+        }
+        num_channels = (uint8_t) value;
+    }
+    if (argc > 2){
+        int value = atoi(argv[2]);
+        if (value < 1){
+            show_usage(argv[0]);
+            return -1;
+        }
+        num_frames = (uint32_t) value;
+    }
+
+    printf("LC3 benchmark: %u channels, %u Hz, 10 ms frames, %u octets per frame, %u frames\n",
+           num_channels, SAMPLE_RATE_HZ, OCTETS_PER_FRAME, num_frames);
+
+    int errors = run("sequential", num_channels, num_frames, 0);
+    // calling thread also processes channels
+    int num_threads;
+    for (num_threads = 2; num_threads <= MAX_NUM_THREADS; num_threads *= 2){
+        char name[20];
+        snprintf(name, sizeof(name), "%u threads", num_threads);
+        errors += run(name, num_channels, num_frames, num_threads - 1);
+    }
+    return errors;
+}
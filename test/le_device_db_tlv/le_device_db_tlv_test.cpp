@@ -56,6 +56,33 @@
 static uint8_t hal_flash_bank_memory_storage[HAL_FLASH_BANK_MEMORY_STORAGE_SIZE];
 static int empty_db_index = NVM_NUM_DEVICE_DB_ENTRIES-1;
 
+// btstack_tlv wrapper counting read accesses
+static const btstack_tlv_t * counting_tlv_impl;
+static void *                counting_tlv_context;
+static int                   counting_tlv_num_get_tag;
+
+static int counting_tlv_get_tag(void * context, uint32_t tag, uint8_t * buffer, uint32_t buffer_size){
+    (void) context;
+    counting_tlv_num_get_tag++;
+    return counting_tlv_impl->get_tag(counting_tlv_context, tag, buffer, buffer_size);
+}
+
+static int counting_tlv_store_tag(void * context, uint32_t tag, const uint8_t * data, uint32_t data_size){
+    (void) context;
+    return counting_tlv_impl->store_tag(counting_tlv_context, tag, data, data_size);
+}
+
+static void counting_tlv_delete_tag(void * context, uint32_t tag){
+    (void) context;
+    counting_tlv_impl->delete_tag(counting_tlv_context, tag);
+}
+
+static const btstack_tlv_t counting_tlv = {
+    &counting_tlv_get_tag,
+    &counting_tlv_store_tag,
+    &counting_tlv_delete_tag,
+};
+
 
 TEST_GROUP(LE_DEVICE_DB_TLV){
     const hal_flash_bank_t * hal_flash_bank_impl;
@@ -234,6 +261,60 @@ TEST(LE_DEVICE_DB_TLV, ReplaceOldest){
     CHECK_EQUAL(num_entries, num_entries_test);
 }
 
+TEST(LE_DEVICE_DB_TLV, AddAndInfoWithoutTLVRead){
+    counting_tlv_impl    = btstack_tlv_impl;
+    counting_tlv_context = &btstack_tlv_context;
+    le_device_db_tlv_configure(&counting_tlv, NULL);
+
+    bd_addr_t addr;
+    sm_key_t  sm_key;
+    int i;
+    counting_tlv_num_get_tag = 0;
+    // fill table, re-add existing entry and replace oldest
+    for (i=0;i<NVM_NUM_DEVICE_DB_ENTRIES;i++){
+        set_addr_and_sm_key(0x10 + i, addr, sm_key);
+        CHECK_TRUE(le_device_db_add(BD_ADDR_TYPE_LE_PUBLIC, addr, sm_key) >= 0);
+    }
+    CHECK_TRUE(le_device_db_add(BD_ADDR_TYPE_LE_PUBLIC, addr, sm_key) >= 0);
+    set_addr_and_sm_key(0x80, addr, sm_key);
+    int index = le_device_db_add(BD_ADDR_TYPE_LE_PUBLIC, addr, sm_key);
+    CHECK_TRUE(index >= 0);
+
+    bd_addr_t addr_info;
+    sm_key_t  sm_key_info;
+    int addr_type;
+    le_device_db_info(index, &addr_type, addr_info, sm_key_info);
+    CHECK_EQUAL(0, counting_tlv_num_get_tag);
+    CHECK_EQUAL(BD_ADDR_TYPE_LE_PUBLIC, addr_type);
+    MEMCMP_EQUAL(addr, addr_info, 6);
+    MEMCMP_EQUAL(sm_key, sm_key_info, 16);
+}
+
+TEST(LE_DEVICE_DB_TLV, ReplaceOldestAfterRescan){
+    bd_addr_t addr;
+    sm_key_t  sm_key;
+    int indices[NVM_NUM_DEVICE_DB_ENTRIES];
+    int i;
+    for (i=0;i<NVM_NUM_DEVICE_DB_ENTRIES;i++){
+        set_addr_and_sm_key(0x10 + i, addr, sm_key);
+        indices[i] = le_device_db_add(BD_ADDR_TYPE_LE_PUBLIC, addr, sm_key);
+        CHECK_TRUE(indices[i] >= 0);
+    }
+    // re-add first one, second one becomes oldest
+    set_addr_and_sm_key(0x10, addr, sm_key);
+    CHECK_EQUAL(indices[0], le_device_db_add(BD_ADDR_TYPE_LE_PUBLIC, addr, sm_key));
+
+    // rebuild index from TLV
+    le_device_db_tlv_configure(btstack_tlv_impl, &btstack_tlv_context);
+    CHECK_EQUAL(NVM_NUM_DEVICE_DB_ENTRIES, le_device_db_count());
+
+    set_addr_and_sm_key(0x80, addr, sm_key);
+    CHECK_EQUAL(indices[1], le_device_db_add(BD_ADDR_TYPE_LE_PUBLIC, addr, sm_key));
+    set_addr_and_sm_key(0x12, addr, sm_key);
+    CHECK_EQUAL(indices[2], le_device_db_add(BD_ADDR_TYPE_LE_PUBLIC, addr, sm_key));
+    CHECK_EQUAL(NVM_NUM_DEVICE_DB_ENTRIES, le_device_db_count());
+}
+
 TEST(LE_DEVICE_DB_TLV, le_device_db_encryption_set_non_existing){
     uint16_t ediv = 16;
     int encryption_key_size = 10;
@@ -0,0 +1,288 @@
+#include "CppUTest/TestHarness.h"
+#include "CppUTest/CommandLineTestRunner.h"
+
+#include "btstack_debug.h"
+#include "btstack_event.h"
+#include "btstack_linked_list.h"
+#include "btstack_run_loop.h"
+#include "btstack_util.h"
+#include "bluetooth_data_types.h"
+#include "gap.h"
+#include "hci.h"
+#include "mesh/adv_bearer.h"
+
+#include <string.h>
+
+// adv_bearer.c is built with ENABLE_MESH_ADV_BEARER_EXTENDED_ADVERTISING for this test
+#define NUM_ADV_SETS 4
+
+// mock hci / gap
+static btstack_packet_handler_t hci_event_handler;
+static bool     extended_advertising_supported;
+static uint8_t  setup_fails_for_set;
+static uint8_t  num_sets_setup;
+static uint8_t  num_sets_removed;
+static uint8_t  next_handle;
+static uint8_t  started_handle;
+static uint8_t  started_num_events;
+static uint8_t  adv_data[31];
+static uint16_t adv_data_len;
+static uint8_t  legacy_enabled;
+static uint8_t  num_legacy_enables;
+
+// mock run loop
+static btstack_linked_list_t timers;
+
+void hci_add_event_handler(btstack_packet_callback_registration_t * callback_handler){
+    hci_event_handler = callback_handler->callback;
+}
+
+HCI_STATE hci_get_state(void){
+    return HCI_STATE_WORKING;
+}
+
+bool hci_le_extended_advertising_supported(void){
+    return extended_advertising_supported;
+}
+
+void gap_le_get_own_address(uint8_t * addr_type, bd_addr_t addr){
+    *addr_type = BD_ADDR_TYPE_LE_PUBLIC;
+    memset(addr, 0, 6);
+}
+
+uint8_t gap_extended_advertising_setup(le_advertising_set_t * storage, const le_extended_advertising_parameters_t * advertising_parameters, uint8_t * out_advertising_handle){
+    UNUSED(storage);
+    UNUSED(advertising_parameters);
+    if ((num_sets_setup + 1) == setup_fails_for_set) return ERROR_CODE_MEMORY_CAPACITY_EXCEEDED;
+    num_sets_setup++;
+    *out_advertising_handle = ++next_handle;
+    return ERROR_CODE_SUCCESS;
+}
+
+uint8_t gap_extended_advertising_remove(uint8_t advertising_handle){
+    UNUSED(advertising_handle);
+    num_sets_removed++;
+    return ERROR_CODE_SUCCESS;
+}
+
+uint8_t gap_extended_advertising_set_random_address(uint8_t advertising_handle, bd_addr_t random_address){
+    UNUSED(advertising_handle);
+    (void) random_address;
+    return ERROR_CODE_SUCCESS;
+}
+
+uint8_t gap_extended_advertising_get_params(uint8_t advertising_handle, le_extended_advertising_parameters_t * advertising_parameters){
+    UNUSED(advertising_handle);
+    memset(advertising_parameters, 0, sizeof(le_extended_advertising_parameters_t));
+    return ERROR_CODE_SUCCESS;
+}
+
+uint8_t gap_extended_advertising_set_params(uint8_t advertising_handle, const le_extended_advertising_parameters_t * advertising_parameters){
+    UNUSED(advertising_handle);
+    UNUSED(advertising_parameters);
+    return ERROR_CODE_SUCCESS;
+}
+
+uint8_t gap_extended_advertising_set_adv_data(uint8_t advertising_handle, uint16_t advertising_data_length, const uint8_t * advertising_data){
+    UNUSED(advertising_handle);
+    memcpy(adv_data, advertising_data, advertising_data_length);
+    adv_data_len = advertising_data_length;
+    return ERROR_CODE_SUCCESS;
+}
+
+uint8_t gap_extended_advertising_start(uint8_t advertising_handle, uint16_t timeout, uint8_t num_extended_advertising_events){
+    UNUSED(timeout);
+    started_handle = advertising_handle;
+    started_num_events = num_extended_advertising_events;
+    return ERROR_CODE_SUCCESS;
+}
+
+uint8_t gap_extended_advertising_stop(uint8_t advertising_handle){
+    UNUSED(advertising_handle);
+    return ERROR_CODE_SUCCESS;
+}
+
+void gap_advertisements_set_params(uint16_t adv_int_min, uint16_t adv_int_max, uint8_t adv_type,
+    uint8_t direct_address_typ, bd_addr_t direct_address, uint8_t channel_map, uint8_t filter_policy){
+    UNUSED(adv_int_min);
+    UNUSED(adv_int_max);
+    UNUSED(adv_type);
+    UNUSED(direct_address_typ);
+    (void) direct_address;
+    UNUSED(channel_map);
+    UNUSED(filter_policy);
+}
+
+void gap_advertisements_set_data(uint8_t advertising_data_length, uint8_t * advertising_data){
+    memcpy(adv_data, advertising_data, advertising_data_length);
+    adv_data_len = advertising_data_length;
+}
+
+void gap_advertisements_enable(int enabled){
+    legacy_enabled = (uint8_t) enabled;
+    if (enabled){
+        num_legacy_enables++;
+    }
+}
+
+void btstack_run_loop_add_timer(btstack_timer_source_t * ts){
+    btstack_linked_list_remove(&timers, (btstack_linked_item_t *) ts);
+    btstack_linked_list_add_tail(&timers, (btstack_linked_item_t *) ts);
+}
+
+int btstack_run_loop_remove_timer(btstack_timer_source_t * ts){
+    return btstack_linked_list_remove(&timers, (btstack_linked_item_t *) ts) ? 1 : 0;
+}
+
+void btstack_run_loop_set_timer(btstack_timer_source_t * ts, uint32_t timeout){
+    UNUSED(ts);
+    UNUSED(timeout);
+}
+
+void btstack_run_loop_set_timer_handler(btstack_timer_source_t * ts, void (*fn)(btstack_timer_source_t * ts)){
+    ts->process = fn;
+}
+
+uint32_t btstack_run_loop_get_time_ms(void){
+    return 0;
+}
+
+static void process_timer(void){
+    btstack_timer_source_t * ts = (btstack_timer_source_t *) btstack_linked_list_pop(&timers);
+    CHECK(ts != NULL);
+    (*ts->process)(ts);
+}
+
+// client
+static uint8_t num_can_send_now;
+
+static void network_pdu_handler(uint8_t packet_type, uint16_t channel, uint8_t *packet, uint16_t size){
+    UNUSED(channel);
+    UNUSED(size);
+    if (packet_type != HCI_EVENT_PACKET) return;
+    if (packet[0] != HCI_EVENT_MESH_META) return;
+    if (packet[2] != MESH_SUBEVENT_CAN_SEND_NOW) return;
+    num_can_send_now++;
+}
+
+static void emit_state(HCI_STATE state){
+    uint8_t event[] = { BTSTACK_EVENT_STATE, 1, (uint8_t) state };
+    (*hci_event_handler)(HCI_EVENT_PACKET, 0, event, sizeof(event));
+}
+
+static void emit_advertising_set_terminated(uint8_t advertising_handle){
+    uint8_t event[] = { HCI_EVENT_LE_META, 6, HCI_SUBEVENT_LE_ADVERTISING_SET_TERMINATED, 0, advertising_handle, 0, 0, 1 };
+    (*hci_event_handler)(HCI_EVENT_PACKET, 0, event, sizeof(event));
+}
+
+static const uint8_t network_pdu[] = { 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08 };
+
+static void send_network_pdu(void){
+    adv_bearer_request_can_send_now_for_network_pdu();
+    CHECK_EQUAL(1, num_can_send_now);
+    num_can_send_now = 0;
+    adv_bearer_send_network_pdu(network_pdu, sizeof(network_pdu), 2, 10);
+}
+
+TEST_GROUP(AdvBearer){
+    void setup(void){
+        hci_event_handler = NULL;
+        extended_advertising_supported = true;
+        setup_fails_for_set = 0;
+        num_sets_setup = 0;
+        num_sets_removed = 0;
+        next_handle = 0;
+        started_handle = 0;
+        started_num_events = 0;
+        adv_data_len = 0;
+        legacy_enabled = 0;
+        num_legacy_enables = 0;
+        num_can_send_now = 0;
+        timers = NULL;
+        adv_bearer_init();
+        adv_bearer_register_for_network_pdu(&network_pdu_handler);
+    }
+    void teardown(void){
+        // drop advertising sets for next test
+        emit_state(HCI_STATE_OFF);
+    }
+};
+
+TEST(AdvBearer, ExtendedAdvertising){
+    emit_state(HCI_STATE_WORKING);
+    CHECK_EQUAL(NUM_ADV_SETS, num_sets_setup);
+
+    send_network_pdu();
+    CHECK_EQUAL(1, started_handle);
+    CHECK_EQUAL(2, started_num_events);
+    CHECK_EQUAL(sizeof(network_pdu) + 2, adv_data_len);
+    CHECK_EQUAL(BLUETOOTH_DATA_TYPE_MESH_MESSAGE, adv_data[1]);
+    MEMCMP_EQUAL(network_pdu, &adv_data[2], sizeof(network_pdu));
+    CHECK_EQUAL(0, num_legacy_enables);
+
+    // set busy until Controller reports Advertising Set Terminated
+    adv_bearer_request_can_send_now_for_network_pdu();
+    CHECK_EQUAL(0, num_can_send_now);
+    emit_advertising_set_terminated(started_handle);
+    CHECK_EQUAL(1, num_can_send_now);
+}
+
+TEST(AdvBearer, LegacyFallbackWhenNotSupported){
+    extended_advertising_supported = false;
+    emit_state(HCI_STATE_WORKING);
+    CHECK_EQUAL(0, num_sets_setup);
+
+    send_network_pdu();
+    CHECK_EQUAL(0, started_handle);
+    CHECK_EQUAL(1, num_legacy_enables);
+    CHECK_EQUAL(BLUETOOTH_DATA_TYPE_MESH_MESSAGE, adv_data[1]);
+    MEMCMP_EQUAL(network_pdu, &adv_data[2], sizeof(network_pdu));
+
+    // message is sent count times, then the next one can be sent
+    adv_bearer_request_can_send_now_for_network_pdu();
+    CHECK_EQUAL(0, num_can_send_now);
+    process_timer();
+    CHECK_EQUAL(2, num_legacy_enables);
+    CHECK_EQUAL(0, num_can_send_now);
+    process_timer();
+    CHECK_EQUAL(0, legacy_enabled);
+    CHECK_EQUAL(1, num_can_send_now);
+}
+
+TEST(AdvBearer, LegacyFallbackWhenSetupFails){
+    setup_fails_for_set = 3;
+    emit_state(HCI_STATE_WORKING);
+    CHECK_EQUAL(2, num_sets_setup);
+    CHECK_EQUAL(2, num_sets_removed);
+
+    send_network_pdu();
+    CHECK_EQUAL(0, started_handle);
+    CHECK_EQUAL(1, num_legacy_enables);
+    process_timer();
+    process_timer();
+    CHECK_EQUAL(0, legacy_enabled);
+}
+
+TEST(AdvBearer, SetupAgainAfterPowerOff){
+    emit_state(HCI_STATE_WORKING);
+    CHECK_EQUAL(NUM_ADV_SETS, num_sets_setup);
+    send_network_pdu();
+
+    // sets are removed on power off and set up again when working
+    adv_bearer_request_can_send_now_for_network_pdu();
+    emit_state(HCI_STATE_OFF);
+    CHECK_EQUAL(NUM_ADV_SETS, num_sets_removed);
+    CHECK_EQUAL(0, num_can_send_now);
+    emit_state(HCI_STATE_WORKING);
+    CHECK_EQUAL(2 * NUM_ADV_SETS, num_sets_setup);
+    CHECK_EQUAL(1, num_can_send_now);
+
+    num_can_send_now = 0;
+    adv_bearer_send_network_pdu(network_pdu, sizeof(network_pdu), 2, 10);
+    CHECK_EQUAL(NUM_ADV_SETS + 1, started_handle);
+    CHECK_EQUAL(0, num_legacy_enables);
+}
+
+int main (int argc, const char * argv[]){
+    return CommandLineTestRunner::RunAllTests(argc, argv);
+}
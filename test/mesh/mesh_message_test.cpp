@@ -32,6 +32,9 @@ static uint8_t outgoing_adv_network_pdu_len;
 static uint8_t  recv_upper_transport_pdu_data[100];
 static uint16_t recv_upper_transport_pdu_len;
 
+static uint16_t                sent_upper_transport_pdus;
+static mesh_transport_status_t sent_upper_transport_status;
+
 #ifdef ENABLE_MESH_ADV_BEARER
 static btstack_packet_handler_t adv_packet_handler;
 void adv_bearer_register_for_network_pdu(btstack_packet_handler_t packet_handler){
@@ -268,10 +271,10 @@ static void test_proxy_server_callback_handler(mesh_network_callback_type_t call
 }
 
 static void test_upper_transport_access_message_handler(mesh_transport_callback_type_t callback_type, mesh_transport_status_t status, mesh_pdu_t * pdu){
-    UNUSED(status);
-
     // free sent pdus
     if (callback_type == MESH_TRANSPORT_PDU_SENT) {
+        sent_upper_transport_pdus++;
+        sent_upper_transport_status = status;
         mesh_upper_transport_pdu_free(pdu);
         return;
     }
@@ -328,6 +331,7 @@ static void test_upper_transport_control_message_handler(mesh_transport_callback
 
 TEST_GROUP(MessageTest){
     void setup(void){
+        mock_clear_timers();
         btstack_memory_init();
         btstack_crypto_init();
         load_provisioning_data_test_message();
@@ -350,6 +354,7 @@ TEST_GROUP(MessageTest){
         outgoing_adv_network_pdu_len = 0;
         received_network_pdu = NULL;
         recv_upper_transport_pdu_len =0;
+        sent_upper_transport_pdus = 0;
     }
     void teardown(void){
         // printf("-- teardown start --\n\n");
@@ -724,6 +729,121 @@ TEST(MessageTest, Message7Send){
     mesh_sequence_number_set(seq);
     test_send_control_message(netkey_index, ttl, src, dest, message7_upper_transport_pdu, 1, message7_lower_transport_pdus, message7_network_pdus);
 }
+
+static void test_receive_segment_acknowledgment(uint16_t src, uint16_t dst, uint32_t seq, uint16_t seq_zero, uint32_t block_ack){
+    uint8_t lower_transport_pdu[7];
+    lower_transport_pdu[0] = 0;
+    big_endian_store_16(lower_transport_pdu, 1, seq_zero << 2);
+    big_endian_store_32(lower_transport_pdu, 3, block_ack);
+    mesh_network_pdu_t * network_pdu = mesh_network_pdu_get();
+    mesh_network_setup_pdu(network_pdu, 0, 0x68, 1, 0, seq, src, dst, lower_transport_pdu, sizeof(lower_transport_pdu));
+    mesh_lower_transport_received_message(MESH_NETWORK_PDU_RECEIVED, network_pdu);
+}
+
+static void test_send_segmented_access_message(uint16_t src, uint16_t dest, char * access_pdu){
+    transport_pdu_len = strlen(access_pdu) / 2;
+    btstack_parse_hex(access_pdu, transport_pdu_len, transport_pdu_data);
+    mesh_upper_transport_builder_t builder;
+    mesh_upper_transport_message_init(&builder, MESH_PDU_TYPE_UPPER_SEGMENTED_ACCESS);
+    mesh_upper_transport_message_add_data(&builder, transport_pdu_data, transport_pdu_len);
+    mesh_pdu_t * pdu = (mesh_pdu_t *) mesh_upper_transport_message_finalize(&builder);
+    mesh_upper_transport_setup_access_pdu_header(pdu, 0, MESH_DEVICE_KEY_INDEX, 4, src, dest, 0);
+    mesh_upper_transport_send_access_pdu(pdu);
+}
+
+// wait for network pdu on first bearer, the segment stays at the network layer until sent is emitted
+static void test_wait_for_network_pdu(void){
+    while ((outgoing_gatt_network_pdu_len == 0) && (outgoing_adv_network_pdu_len == 0)) {
+        mock_process_hci_cmd();
+    }
+}
+
+// emit sent for all network pdus until no further segments are sent
+static void test_emit_network_pdu_sent(void){
+    while (true){
+        if (outgoing_gatt_network_pdu_len != 0){
+            outgoing_gatt_network_pdu_len = 0;
+            gatt_bearer_emit_sent();
+            continue;
+        }
+        if (outgoing_adv_network_pdu_len != 0){
+            outgoing_adv_network_pdu_len = 0;
+            adv_bearer_emit_sent();
+            continue;
+        }
+        if (mock_process_hci_cmd() == 0) break;
+    }
+}
+
+static void test_send_message6(void){
+    load_network_key_nid_68();
+    mesh_set_iv_index(0x12345678);
+    mesh_sequence_number_set(0x3129ab);
+    test_send_access_message(0, MESH_DEVICE_KEY_INDEX, 4, 0x0003, 0x1201, 0, message6_upper_transport_pdu, 2, message6_lower_transport_pdus, message6_network_pdus);
+}
+
+// Segmented message waits for Segment Acknowledgment after all segments have been sent
+TEST(MessageTest, SegmentAckForWaitingMessage){
+    test_send_message6();
+    CHECK_EQUAL(0, sent_upper_transport_pdus);
+    CHECK_FALSE(mesh_lower_transport_can_send_to_dest(0x1201));
+
+    // SeqZero of other message is ignored, first segment acked
+    test_receive_segment_acknowledgment(0x1201, 0x0003, 1, 0x09aa, 0x00000003);
+    test_receive_segment_acknowledgment(0x1201, 0x0003, 2, 0x09ab, 0x00000001);
+    CHECK_EQUAL(0, sent_upper_transport_pdus);
+
+    // second segment acked
+    test_receive_segment_acknowledgment(0x1201, 0x0003, 3, 0x09ab, 0x00000002);
+    CHECK_EQUAL(1, sent_upper_transport_pdus);
+    CHECK_EQUAL(MESH_TRANSPORT_STATUS_SUCCESS, sent_upper_transport_status);
+    CHECK_TRUE(mesh_lower_transport_can_send_to_dest(0x1201));
+}
+
+// Segment transmission timer fires while other message is sent, message is re-queued
+TEST(MessageTest, SegmentAckForRequeuedMessage){
+    test_send_message6();
+
+    // start other message, first segment stays at network layer
+    test_send_segmented_access_message(0x0003, 0x1202, message6_upper_transport_pdu);
+    test_wait_for_network_pdu();
+
+    // timer of first message fires, message is queued behind the active one
+    CHECK_TRUE(mock_process_timer());
+    CHECK_FALSE(mesh_lower_transport_can_send_to_dest(0x1201));
+    CHECK_EQUAL(0, sent_upper_transport_pdus);
+
+    // acknowledged while queued
+    test_receive_segment_acknowledgment(0x1201, 0x0003, 1, 0x09ab, 0x00000003);
+    CHECK_EQUAL(1, sent_upper_transport_pdus);
+    CHECK_EQUAL(MESH_TRANSPORT_STATUS_SUCCESS, sent_upper_transport_status);
+    CHECK_TRUE(mesh_lower_transport_can_send_to_dest(0x1201));
+
+    // other message completes, first message is not sent again
+    test_emit_network_pdu_sent();
+    CHECK_FALSE(mesh_lower_transport_can_send_to_dest(0x1202));
+    test_receive_segment_acknowledgment(0x1202, 0x0003, 1, 0x09ad, 0x00000003);
+    CHECK_EQUAL(2, sent_upper_transport_pdus);
+    CHECK_EQUAL(0, outgoing_gatt_network_pdu_len);
+    CHECK_EQUAL(0, outgoing_adv_network_pdu_len);
+}
+
+// Segment transmission timer fires, message is retransmitted and acknowledged while segment is at network layer
+TEST(MessageTest, SegmentAckForRetransmittedMessage){
+    test_send_message6();
+
+    CHECK_TRUE(mock_process_timer());
+    test_wait_for_network_pdu();
+    test_receive_segment_acknowledgment(0x1201, 0x0003, 1, 0x09ab, 0x00000003);
+    CHECK_EQUAL(0, sent_upper_transport_pdus);
+
+    // completed after segment was sent, remaining segment is not sent
+    test_emit_network_pdu_sent();
+    CHECK_EQUAL(1, sent_upper_transport_pdus);
+    CHECK_EQUAL(MESH_TRANSPORT_STATUS_SUCCESS, sent_upper_transport_status);
+    CHECK_TRUE(mesh_lower_transport_can_send_to_dest(0x1201));
+}
+
 // ACK message, handled in mesh_transport - can be checked with test_control_receive_network_pdu
 // TEST(MessageTest, Message7Receive){
 //     mesh_set_iv_index(0x12345678);
@@ -1105,6 +1225,40 @@ TEST(MessageTest, Message24Send){
     test_send_access_message(netkey_index, appkey_index, ttl, src, pseudo_dst, szmic, message24_upper_transport_pdu, 2, message24_lower_transport_pdus, message24_network_pdus);
 }
 
+// Message 23 + 24 from same src with same AID, with additional non-matching app key with same AID tried first
+TEST(MessageTest, Message23And24ReceiveWithKeyCache){
+    load_network_key_nid_68();
+    mesh_set_iv_index(0x12345677);
+    uint8_t label_uuid[16];
+    btstack_parse_hex(message23_label_string, 16, label_uuid);
+    mesh_virtual_address_register(label_uuid, 0x9736);
+
+    // add other app key with same AID before the valid one
+    static mesh_transport_key_t other_application_key;
+    other_application_key.internal_index = 1;
+    other_application_key.netkey_index = 0;
+    other_application_key.appkey_index = 1;
+    other_application_key.aid = 0x26;
+    other_application_key.akf = 1;
+    memset(other_application_key.key, 0x11, 16);
+    mesh_transport_key_remove(&test_application_key);
+    mesh_transport_key_add(&other_application_key);
+    mesh_transport_key_add(&test_application_key);
+
+    // first message tries other key first, then valid key
+    mock_count_aes128_operations_for_key(other_application_key.key);
+    test_receive_network_pdus(1, message23_network_pdus, message23_lower_transport_pdus, message23_upper_transport_pdu);
+    CHECK_TRUE(mock_aes128_operations_for_key() > 0);
+
+    // second message from same src and AID is decrypted with cached key in a single trial
+    mock_count_aes128_operations_for_key(other_application_key.key);
+    recv_upper_transport_pdu_len = 0;
+    test_receive_network_pdus(2, message24_network_pdus, message24_lower_transport_pdus, message24_upper_transport_pdu);
+    CHECK_EQUAL(0, mock_aes128_operations_for_key());
+
+    mesh_transport_key_remove(&other_application_key);
+}
+
 // Proxy Configuration Test
 char * proxy_config_pdus[] = {
     (char *) "0210386bd60efbbb8b8c28512e792d3711f4b526",
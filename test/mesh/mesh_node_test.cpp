@@ -0,0 +1,135 @@
+#include "CppUTest/TestHarness.h"
+#include "CppUTest/CommandLineTestRunner.h"
+
+#include "btstack_util.h"
+#include "mesh/mesh_node.h"
+
+#include <string.h>
+
+static void handler_a(mesh_model_t * mesh_model, mesh_pdu_t * pdu){
+    UNUSED(mesh_model);
+    UNUSED(pdu);
+}
+
+static void handler_b(mesh_model_t * mesh_model, mesh_pdu_t * pdu){
+    UNUSED(mesh_model);
+    UNUSED(pdu);
+}
+
+static const mesh_operation_t operations_a[] = {
+    { 0x8201, 0, handler_a },
+    { 0x8202, 0, handler_a },
+    { 0x8202, 2, handler_b },
+    { 0, 0, NULL }
+};
+
+static const mesh_operation_t operations_b[] = {
+    { 0x8201, 0, handler_b },
+    { 0, 0, NULL }
+};
+
+// more operations than MAX_NR_MESH_OPCODE_TABLE_ENTRIES
+static mesh_operation_t operations_large[MAX_NR_MESH_OPCODE_TABLE_ENTRIES + 2];
+
+static mesh_element_t element_1;
+static mesh_element_t element_2;
+static mesh_model_t   model_1a;
+static mesh_model_t   model_1b;
+static mesh_model_t   model_2b;
+static mesh_model_t   model_2large;
+
+static void setup_model(mesh_element_t * element, mesh_model_t * model, uint16_t model_id, const mesh_operation_t * operations){
+    memset(model, 0, sizeof(mesh_model_t));
+    model->model_identifier = mesh_model_get_model_identifier_bluetooth_sig(model_id);
+    model->operations = operations;
+    mesh_element_add_model(element, model);
+}
+
+static uint16_t lookup(mesh_element_t * element, uint32_t opcode, mesh_model_t ** models, const mesh_operation_t ** operations, uint16_t max_results){
+    uint16_t num_results = 0;
+    mesh_element_operation_iterator_t it;
+    mesh_element_operation_iterator_init(&it, element, opcode);
+    while (mesh_element_operation_iterator_has_next(&it)){
+        mesh_model_t * model;
+        const mesh_operation_t * operation = mesh_element_operation_iterator_next(&it, &model);
+        CHECK(num_results < max_results);
+        models[num_results] = model;
+        operations[num_results] = operation;
+        num_results++;
+    }
+    return num_results;
+}
+
+TEST_GROUP(MeshNode){
+    void setup(void){
+        mesh_node_init();
+        memset(&element_1, 0, sizeof(element_1));
+        memset(&element_2, 0, sizeof(element_2));
+        setup_model(&element_1, &model_1a, 0x1000, operations_a);
+        setup_model(&element_1, &model_1b, 0x1001, operations_b);
+        setup_model(&element_2, &model_2b, 0x1001, operations_b);
+    }
+};
+
+TEST(MeshNode, LookupPerElement){
+    mesh_model_t * models[4];
+    const mesh_operation_t * operations[4];
+
+    // both models of element 1 in order of mesh_element_add_model
+    CHECK_EQUAL(2, lookup(&element_1, 0x8201, models, operations, 4));
+    POINTERS_EQUAL(&model_1a, models[0]);
+    POINTERS_EQUAL(&operations_a[0], operations[0]);
+    POINTERS_EQUAL(&model_1b, models[1]);
+    POINTERS_EQUAL(&operations_b[0], operations[1]);
+
+    // same opcode on element 2
+    CHECK_EQUAL(1, lookup(&element_2, 0x8201, models, operations, 4));
+    POINTERS_EQUAL(&model_2b, models[0]);
+
+    // all operations of a model with the same opcode
+    CHECK_EQUAL(2, lookup(&element_1, 0x8202, models, operations, 4));
+    POINTERS_EQUAL(&operations_a[1], operations[0]);
+    POINTERS_EQUAL(&operations_a[2], operations[1]);
+
+    // unknown opcode or opcode not supported by element
+    CHECK_EQUAL(0, lookup(&element_1, 0x8203, models, operations, 4));
+    CHECK_EQUAL(0, lookup(&element_2, 0x8202, models, operations, 4));
+}
+
+TEST(MeshNode, LookupFallbackToLinearScan){
+    uint16_t i;
+    for (i = 0; i < (MAX_NR_MESH_OPCODE_TABLE_ENTRIES + 1); i++){
+        operations_large[i].opcode  = 0x8300 + i;
+        operations_large[i].minimum_length = 0;
+        operations_large[i].handler = handler_a;
+    }
+    operations_large[i].handler = NULL;
+    // table overflows
+    setup_model(&element_2, &model_2large, 0x1002, operations_large);
+
+    mesh_model_t * models[4];
+    const mesh_operation_t * operations[4];
+    CHECK_EQUAL(2, lookup(&element_1, 0x8201, models, operations, 4));
+    POINTERS_EQUAL(&model_1a, models[0]);
+    POINTERS_EQUAL(&model_1b, models[1]);
+    CHECK_EQUAL(1, lookup(&element_2, 0x8201, models, operations, 4));
+    POINTERS_EQUAL(&model_2b, models[0]);
+    for (i = 0; i < (MAX_NR_MESH_OPCODE_TABLE_ENTRIES + 1); i++){
+        CHECK_EQUAL(1, lookup(&element_2, 0x8300 + i, models, operations, 4));
+        POINTERS_EQUAL(&model_2large, models[0]);
+        POINTERS_EQUAL(&operations_large[i], operations[0]);
+    }
+    CHECK_EQUAL(0, lookup(&element_1, 0x8300, models, operations, 4));
+}
+
+TEST(MeshNode, LookupAfterInit){
+    // table is reset by mesh_node_init after overflow in previous test
+    mesh_model_t * models[4];
+    const mesh_operation_t * operations[4];
+    CHECK_EQUAL(2, lookup(&element_1, 0x8201, models, operations, 4));
+    CHECK_EQUAL(0, lookup(&element_2, 0x8300, models, operations, 4));
+}
+
+int main (int argc, const char * argv[]){
+    return CommandLineTestRunner::RunAllTests(argc, argv);
+}
@@ -19,6 +19,10 @@ static uint16_t packet_buffer_len = 0;
 static uint8_t aes128_cyphertext[16];
 
 static int report_aes128;
+
+// count AES128 operations with a given key, e.g. CCM trial decryptions
+static uint8_t  aes128_counted_key[16];
+static uint16_t aes128_counted_key_operations;
 static int report_random;
 
 static uint32_t lfsr_random;
@@ -140,6 +144,9 @@ uint8_t hci_send_cmd(const hci_cmd_t *cmd, ...){
  		reverse_128(plaintext_flipped, plaintext);
 	    aes128_calc_cyphertext(key, plaintext, aes128_cyphertext);
 	    report_aes128 = 1;
+	    if (memcmp(key, aes128_counted_key, 16) == 0){
+	        aes128_counted_key_operations++;
+	    }
 #ifdef ENABLE_AES128_LOGGER
 	    printf("AES128 Operation\n");
 	    printf("Key:    "); printf_hexdump(key, 16);
@@ -161,30 +168,50 @@ HCI_STATE hci_get_state(void){
 	return HCI_STATE_WORKING;
 }
 
+// active timers, fired by mock_process_timer in the order they were added
+static btstack_linked_list_t timers;
+
 void btstack_run_loop_add_timer(btstack_timer_source_t * ts){
-    UNUSED(ts);
+    btstack_linked_list_remove(&timers, (btstack_linked_item_t *) ts);
+    btstack_linked_list_add_tail(&timers, (btstack_linked_item_t *) ts);
 }
 int btstack_run_loop_remove_timer(btstack_timer_source_t * ts){
-    UNUSED(ts);
-	return 0;
+	return btstack_linked_list_remove(&timers, (btstack_linked_item_t *) ts) ? 1 : 0;
 }
 void btstack_run_loop_set_timer(btstack_timer_source_t * ts, uint32_t timeout){
     UNUSED(ts);
     UNUSED(timeout);
 }
 void btstack_run_loop_set_timer_handler(btstack_timer_source_t * ts, void (*fn)(btstack_timer_source_t * ts)){
-    UNUSED(ts);
-    UNUSED(fn);
+    ts->process = fn;
 }
-static void * timer_context;
 void btstack_run_loop_set_timer_context(btstack_timer_source_t * ts, void * context){
-    UNUSED(ts);
-	timer_context = context;
+	ts->context = context;
 }
 void * btstack_run_loop_get_timer_context(btstack_timer_source_t * ts){
-    UNUSED(ts);
-	return timer_context;
+	return ts->context;
 }
+
+void mock_count_aes128_operations_for_key(const uint8_t * key){
+    memcpy(aes128_counted_key, key, 16);
+    aes128_counted_key_operations = 0;
+}
+
+uint16_t mock_aes128_operations_for_key(void){
+    return aes128_counted_key_operations;
+}
+
+void mock_clear_timers(void){
+    timers = NULL;
+}
+
+int mock_process_timer(void){
+    btstack_timer_source_t * ts = (btstack_timer_source_t *) btstack_linked_list_pop(&timers);
+    if (ts == NULL) return 0;
+    (*ts->process)(ts);
+    return 1;
+}
+
 void hci_halting_defer(void){
 }
 
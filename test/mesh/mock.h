@@ -51,6 +51,10 @@ void mock_clear_packet_buffer(void);
 void mock_simulate_hci_event(uint8_t * packet, uint16_t size);
 int mock_process_hci_cmd(void);
 void mock_simulate_hci_state_working(void);
+void mock_count_aes128_operations_for_key(const uint8_t * key);
+uint16_t mock_aes128_operations_for_key(void);
+void mock_clear_timers(void);
+int mock_process_timer(void);
 
 #ifdef __cplusplus
 } /* end of extern "C" */
@@ -0,0 +1,343 @@
+#include "CppUTest/TestHarness.h"
+#include "CppUTest/CommandLineTestRunner.h"
+
+#include "btstack_debug.h"
+#include "btstack_defines.h"
+#include "btstack_event.h"
+#include "btstack_network.h"
+#include "btstack_network_posix.h"
+#include "btstack_run_loop.h"
+#include "btstack_util.h"
+#include "classic/bnep.h"
+
+#include <errno.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#define BNEP_CID_A 1
+#define BNEP_CID_B 2
+
+static bd_addr_t addr_a       = { 0x00, 0x1b, 0xdc, 0x00, 0x00, 0x0a };
+static bd_addr_t addr_b       = { 0x00, 0x1b, 0xdc, 0x00, 0x00, 0x0b };
+static bd_addr_t addr_unknown = { 0x00, 0x1b, 0xdc, 0x00, 0x00, 0x0c };
+static bd_addr_t addr_local   = { 0x00, 0x1b, 0xdc, 0x00, 0x00, 0x01 };
+static bd_addr_t addr_multicast = { 0x01, 0x00, 0x5e, 0x00, 0x00, 0x01 };
+
+// mock TAP device: bridge uses one end of a socket pair, test reads and writes frames on the other end
+static int tap_fds[2];
+
+extern "C" int mock_open(const char * path, int flags, ...){
+    UNUSED(path);
+    UNUSED(flags);
+    return tap_fds[0];
+}
+
+extern "C" int mock_ioctl(int fd, unsigned long request, ...){
+    UNUSED(fd);
+    UNUSED(request);
+    return 0;
+}
+
+extern "C" int mock_socket(int domain, int type, int protocol){
+    UNUSED(domain);
+    UNUSED(type);
+    UNUSED(protocol);
+    // closed after interface configuration
+    return dup(tap_fds[0]);
+}
+
+// mock run loop
+static btstack_data_source_t * tap_ds;
+
+void btstack_run_loop_set_data_source_fd(btstack_data_source_t * data_source, int fd){
+    data_source->source.fd = fd;
+}
+
+void btstack_run_loop_set_data_source_handler(btstack_data_source_t * data_source, void (*process)(btstack_data_source_t * _data_source, btstack_data_source_callback_type_t callback_type)){
+    data_source->process = process;
+}
+
+void btstack_run_loop_add_data_source(btstack_data_source_t * data_source){
+    data_source->flags = 0;
+    tap_ds = data_source;
+}
+
+int btstack_run_loop_remove_data_source(btstack_data_source_t * data_source){
+    UNUSED(data_source);
+    tap_ds = NULL;
+    return 1;
+}
+
+void btstack_run_loop_enable_data_source_callbacks(btstack_data_source_t * data_source, uint16_t callbacks){
+    data_source->flags |= callbacks;
+}
+
+void btstack_run_loop_disable_data_source_callbacks(btstack_data_source_t * data_source, uint16_t callbacks){
+    data_source->flags &= ~callbacks;
+}
+
+static bool tap_callback_enabled(uint16_t callback){
+    return (tap_ds->flags & callback) != 0;
+}
+
+static void tap_process(btstack_data_source_callback_type_t callback_type){
+    CHECK(tap_callback_enabled((uint16_t) callback_type));
+    (*tap_ds->process)(tap_ds, callback_type);
+}
+
+// mock bnep
+static uint16_t filtered_cid;
+static uint16_t num_can_send_now_requests[3];
+static uint16_t num_frames_sent[3];
+static uint8_t  sent_frame[3][BNEP_MTU_MIN];
+static uint16_t sent_frame_len[3];
+
+int bnep_frame_passes_filter(uint16_t bnep_cid, const uint8_t * packet, uint16_t len){
+    UNUSED(packet);
+    UNUSED(len);
+    return bnep_cid != filtered_cid;
+}
+
+void bnep_request_can_send_now_event(uint16_t bnep_cid){
+    num_can_send_now_requests[bnep_cid]++;
+}
+
+int bnep_can_send_packet_now(uint16_t bnep_cid){
+    UNUSED(bnep_cid);
+    return 1;
+}
+
+int bnep_send(uint16_t bnep_cid, uint8_t * packet, uint16_t len){
+    num_frames_sent[bnep_cid]++;
+    memcpy(sent_frame[bnep_cid], packet, len);
+    sent_frame_len[bnep_cid] = len;
+    return 0;
+}
+
+static void emit_can_send_now(uint16_t bnep_cid){
+    uint8_t event[] = { BNEP_EVENT_CAN_SEND_NOW, 2, 0, 0 };
+    little_endian_store_16(event, 2, bnep_cid);
+    btstack_network_posix_bridge_packet_handler(HCI_EVENT_PACKET, 0, event, sizeof(event));
+}
+
+// Ethernet frame with destination address and frame number as payload
+static uint8_t  frame[2000];
+
+static uint16_t setup_frame(const bd_addr_t destination, const bd_addr_t source, uint8_t frame_nr, uint16_t len){
+    memset(frame, frame_nr, len);
+    memcpy(&frame[0], destination, 6);
+    memcpy(&frame[6], source, 6);
+    big_endian_store_16(frame, 12, 0x0800);
+    return len;
+}
+
+static void tap_receive_frame(const bd_addr_t destination, uint8_t frame_nr){
+    uint16_t len = setup_frame(destination, addr_local, frame_nr, 100);
+    CHECK_EQUAL(len, write(tap_fds[1], frame, len));
+}
+
+static void bnep_receive_frame(uint16_t bnep_cid, const bd_addr_t destination, const bd_addr_t source, uint16_t len){
+    setup_frame(destination, source, 0x55, len);
+    btstack_network_posix_bridge_packet_handler(BNEP_DATA_PACKET, bnep_cid, frame, len);
+}
+
+// @return len of frame written to TAP device or 0
+static uint16_t tap_read_frame(void){
+    ssize_t len = recv(tap_fds[1], frame, sizeof(frame), MSG_DONTWAIT);
+    if (len < 0){
+        CHECK(errno == EAGAIN);
+        return 0;
+    }
+    return (uint16_t) len;
+}
+
+// fill socket buffer until TAP writes would block
+static void tap_fill_write_buffer(void){
+    memset(frame, 0, 1000);
+    while (send(tap_fds[0], frame, 1000, MSG_DONTWAIT) > 0){
+    }
+    CHECK(errno == EAGAIN);
+}
+
+static void tap_drain_write_buffer(void){
+    while (tap_read_frame() > 0){
+    }
+}
+
+TEST_GROUP(NetworkPosixBridge){
+    btstack_network_posix_channel_t channel_a;
+    btstack_network_posix_channel_t channel_b;
+
+    void setup(void){
+        filtered_cid = 0;
+        memset(num_can_send_now_requests, 0, sizeof(num_can_send_now_requests));
+        memset(num_frames_sent, 0, sizeof(num_frames_sent));
+        memset(sent_frame_len, 0, sizeof(sent_frame_len));
+        CHECK_EQUAL(0, socketpair(AF_UNIX, SOCK_SEQPACKET, 0, tap_fds));
+        btstack_network_posix_bridge_init();
+        CHECK_EQUAL(0, btstack_network_up(addr_local));
+        CHECK(tap_callback_enabled(DATA_SOURCE_CALLBACK_READ));
+        btstack_network_posix_bridge_add_channel(&channel_a, BNEP_CID_A, addr_a);
+        btstack_network_posix_bridge_add_channel(&channel_b, BNEP_CID_B, addr_b);
+    }
+    void teardown(void){
+        btstack_network_posix_bridge_remove_channel(BNEP_CID_A);
+        btstack_network_posix_bridge_remove_channel(BNEP_CID_B);
+        btstack_network_down();
+        close(tap_fds[1]);
+    }
+};
+
+TEST(NetworkPosixBridge, TapUnicastToChannel){
+    tap_receive_frame(addr_b, 1);
+    tap_process(DATA_SOURCE_CALLBACK_READ);
+    CHECK_EQUAL(0, num_can_send_now_requests[BNEP_CID_A]);
+    CHECK_EQUAL(1, num_can_send_now_requests[BNEP_CID_B]);
+
+    emit_can_send_now(BNEP_CID_B);
+    CHECK_EQUAL(1, num_frames_sent[BNEP_CID_B]);
+    CHECK_EQUAL(100, sent_frame_len[BNEP_CID_B]);
+    MEMCMP_EQUAL(addr_b, sent_frame[BNEP_CID_B], 6);
+    CHECK_EQUAL(1, sent_frame[BNEP_CID_B][14]);
+    CHECK_EQUAL(1, channel_b.num_frames_sent);
+    CHECK_EQUAL(1, btstack_network_posix_bridge_get_statistics()->num_tap_frames_received);
+}
+
+TEST(NetworkPosixBridge, TapMulticastToChannels){
+    filtered_cid = BNEP_CID_A;
+    tap_receive_frame(addr_multicast, 1);
+    tap_process(DATA_SOURCE_CALLBACK_READ);
+    CHECK_EQUAL(0, num_can_send_now_requests[BNEP_CID_A]);
+    CHECK_EQUAL(1, channel_a.num_frames_filtered);
+    CHECK_EQUAL(1, num_can_send_now_requests[BNEP_CID_B]);
+}
+
+TEST(NetworkPosixBridge, TapUnknownDestinationToChannels){
+    tap_receive_frame(addr_unknown, 1);
+    tap_process(DATA_SOURCE_CALLBACK_READ);
+    CHECK_EQUAL(1, num_can_send_now_requests[BNEP_CID_A]);
+    CHECK_EQUAL(1, num_can_send_now_requests[BNEP_CID_B]);
+
+    emit_can_send_now(BNEP_CID_A);
+    emit_can_send_now(BNEP_CID_B);
+    CHECK_EQUAL(1, num_frames_sent[BNEP_CID_A]);
+    CHECK_EQUAL(1, num_frames_sent[BNEP_CID_B]);
+}
+
+TEST(NetworkPosixBridge, ChannelUnicastToChannel){
+    bnep_receive_frame(BNEP_CID_A, addr_b, addr_a, 100);
+    CHECK_EQUAL(1, channel_a.num_frames_received);
+    CHECK_EQUAL(0, num_can_send_now_requests[BNEP_CID_A]);
+    CHECK_EQUAL(1, num_can_send_now_requests[BNEP_CID_B]);
+    CHECK_EQUAL(0, tap_read_frame());
+
+    emit_can_send_now(BNEP_CID_B);
+    CHECK_EQUAL(1, num_frames_sent[BNEP_CID_B]);
+    MEMCMP_EQUAL(addr_a, &sent_frame[BNEP_CID_B][6], 6);
+}
+
+TEST(NetworkPosixBridge, ChannelMulticastToChannelsAndTap){
+    bnep_receive_frame(BNEP_CID_A, addr_multicast, addr_a, 100);
+    CHECK_EQUAL(0, num_can_send_now_requests[BNEP_CID_A]);
+    CHECK_EQUAL(1, num_can_send_now_requests[BNEP_CID_B]);
+    CHECK_EQUAL(100, tap_read_frame());
+    MEMCMP_EQUAL(addr_multicast, frame, 6);
+    CHECK_EQUAL(1, btstack_network_posix_bridge_get_statistics()->num_tap_frames_sent);
+}
+
+TEST(NetworkPosixBridge, ChannelUnknownDestinationToTap){
+    bnep_receive_frame(BNEP_CID_A, addr_unknown, addr_a, 100);
+    CHECK_EQUAL(0, num_can_send_now_requests[BNEP_CID_A]);
+    CHECK_EQUAL(0, num_can_send_now_requests[BNEP_CID_B]);
+    CHECK_EQUAL(100, tap_read_frame());
+}
+
+TEST(NetworkPosixBridge, ChannelNotReturnedToSource){
+    bnep_receive_frame(BNEP_CID_A, addr_a, addr_unknown, 100);
+    CHECK_EQUAL(0, num_can_send_now_requests[BNEP_CID_A]);
+    CHECK_EQUAL(0, num_can_send_now_requests[BNEP_CID_B]);
+}
+
+TEST(NetworkPosixBridge, FrameReleasedIfNotQueued){
+    btstack_network_posix_bridge_remove_channel(BNEP_CID_B);
+    filtered_cid = BNEP_CID_A;
+    uint8_t i;
+    for (i = 0; i < 10; i++){
+        tap_receive_frame(addr_multicast, i);
+    }
+    // read in batches, frame buffers are reused
+    tap_process(DATA_SOURCE_CALLBACK_READ);
+    CHECK_EQUAL(BTSTACK_NETWORK_POSIX_READ_BATCH_SIZE, channel_a.num_frames_filtered);
+    CHECK(tap_callback_enabled(DATA_SOURCE_CALLBACK_READ));
+    tap_process(DATA_SOURCE_CALLBACK_READ);
+    CHECK_EQUAL(10, channel_a.num_frames_filtered);
+    CHECK_EQUAL(2, btstack_network_posix_bridge_get_statistics()->num_tap_read_batches);
+}
+
+TEST(NetworkPosixBridge, PauseTapReadUntilFramesReleased){
+    uint8_t i;
+    for (i = 0; i <= BTSTACK_NETWORK_POSIX_NUM_FRAMES; i++){
+        tap_receive_frame(addr_multicast, i);
+    }
+    // each frame is queued once for both channels
+    tap_process(DATA_SOURCE_CALLBACK_READ);
+    CHECK_EQUAL(BTSTACK_NETWORK_POSIX_NUM_FRAMES, btstack_network_posix_bridge_get_statistics()->num_tap_frames_received);
+    CHECK_FALSE(tap_callback_enabled(DATA_SOURCE_CALLBACK_READ));
+
+    // frames still referenced by channel b
+    emit_can_send_now(BNEP_CID_A);
+    CHECK_EQUAL(BTSTACK_NETWORK_POSIX_NUM_FRAMES, num_frames_sent[BNEP_CID_A]);
+    CHECK_FALSE(tap_callback_enabled(DATA_SOURCE_CALLBACK_READ));
+
+    emit_can_send_now(BNEP_CID_B);
+    CHECK_EQUAL(BTSTACK_NETWORK_POSIX_NUM_FRAMES, num_frames_sent[BNEP_CID_B]);
+    CHECK_EQUAL(BTSTACK_NETWORK_POSIX_NUM_FRAMES - 1, sent_frame[BNEP_CID_B][14]);
+    CHECK(tap_callback_enabled(DATA_SOURCE_CALLBACK_READ));
+
+    tap_process(DATA_SOURCE_CALLBACK_READ);
+    CHECK_EQUAL(BTSTACK_NETWORK_POSIX_NUM_FRAMES + 1, btstack_network_posix_bridge_get_statistics()->num_tap_frames_received);
+    CHECK_EQUAL(0, btstack_network_posix_bridge_get_statistics()->num_frames_dropped);
+}
+
+TEST(NetworkPosixBridge, PoolExhaustedDropsChannelFrames){
+    uint8_t i;
+    for (i = 0; i < BTSTACK_NETWORK_POSIX_NUM_FRAMES; i++){
+        tap_receive_frame(addr_b, i);
+    }
+    tap_process(DATA_SOURCE_CALLBACK_READ);
+    bnep_receive_frame(BNEP_CID_B, addr_a, addr_b, 100);
+    CHECK_EQUAL(0, num_can_send_now_requests[BNEP_CID_A]);
+    CHECK_EQUAL(1, channel_a.num_frames_dropped);
+    CHECK_EQUAL(1, btstack_network_posix_bridge_get_statistics()->num_frames_dropped);
+}
+
+TEST(NetworkPosixBridge, TapWriteQueuedWhenBlocked){
+    tap_fill_write_buffer();
+    bnep_receive_frame(BNEP_CID_A, addr_unknown, addr_a, 100);
+    CHECK(tap_callback_enabled(DATA_SOURCE_CALLBACK_WRITE));
+
+    tap_drain_write_buffer();
+    tap_process(DATA_SOURCE_CALLBACK_WRITE);
+    CHECK_FALSE(tap_callback_enabled(DATA_SOURCE_CALLBACK_WRITE));
+    CHECK_EQUAL(1, btstack_network_posix_bridge_get_statistics()->num_tap_frames_sent);
+}
+
+TEST(NetworkPosixBridge, OversizedFrameNotCopied){
+    // forwarded to channel b, frame is not copied into frame buffer
+    bnep_receive_frame(BNEP_CID_A, addr_multicast, addr_a, 1800);
+    CHECK_EQUAL(0, num_can_send_now_requests[BNEP_CID_B]);
+    CHECK_EQUAL(1, channel_b.num_frames_dropped);
+    // directly written to TAP device
+    CHECK_EQUAL(1800, tap_read_frame());
+
+    // not queued for TAP device
+    tap_fill_write_buffer();
+    bnep_receive_frame(BNEP_CID_A, addr_unknown, addr_a, 1800);
+    CHECK_FALSE(tap_callback_enabled(DATA_SOURCE_CALLBACK_WRITE));
+    CHECK_EQUAL(1, btstack_network_posix_bridge_get_statistics()->num_tap_frames_dropped);
+}
+
+int main (int argc, const char * argv[]){
+    return CommandLineTestRunner::RunAllTests(argc, argv);
+}
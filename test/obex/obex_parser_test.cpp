@@ -131,6 +131,50 @@ TEST(OBEX_PARSER, GetResponseWithSRM){
     obex_parser_get_operation_info(&parser, &op_info);
 }
 
+// from body_callback
+static uint8_t  test_body_buffer[600];
+static uint16_t test_body_len;
+
+static void body_callback(void * user_data, uint8_t header_id, uint16_t total_len, uint16_t data_offset, const uint8_t * data_buffer, uint16_t data_len){
+    if (header_id != OBEX_HEADER_BODY) return;
+    CHECK_EQUAL(test_body_len, data_offset);
+    CHECK(data_offset + data_len <= total_len);
+    memcpy(&test_body_buffer[data_offset], data_buffer, data_len);
+    test_body_len += data_len;
+}
+
+TEST(OBEX_PARSER, GetResponseBodySpanningMultipleFrames){
+    // OBEX packet larger than bearer frames, e.g. RFCOMM
+    uint8_t  response[3 + 3 + sizeof(test_body_buffer)];
+    uint16_t pos = 0;
+    response[pos++] = OBEX_RESP_CONTINUE;
+    big_endian_store_16(response, pos, sizeof(response));
+    pos += 2;
+    response[pos++] = OBEX_HEADER_BODY;
+    big_endian_store_16(response, pos, 3 + sizeof(test_body_buffer));
+    pos += 2;
+    for (uint16_t i = 0; i < sizeof(test_body_buffer); i++){
+        response[pos++] = (uint8_t) i;
+    }
+
+    test_body_len = 0;
+    obex_parser_init_for_response(&parser, OBEX_OPCODE_GET, &body_callback, NULL);
+    const uint16_t frame_size = 127;
+    obex_parser_object_state_t parser_state = OBEX_PARSER_OBJECT_STATE_INCOMPLETE;
+    for (pos = 0; pos < sizeof(response); pos += frame_size){
+        CHECK_EQUAL(OBEX_PARSER_OBJECT_STATE_INCOMPLETE, parser_state);
+        uint16_t frame_len = btstack_min(frame_size, sizeof(response) - pos);
+        parser_state = obex_parser_process_data(&parser, &response[pos], frame_len);
+    }
+    CHECK_EQUAL(OBEX_PARSER_OBJECT_STATE_COMPLETE, parser_state);
+    CHECK_EQUAL(sizeof(test_body_buffer), test_body_len);
+    MEMCMP_EQUAL(&response[6], test_body_buffer, sizeof(test_body_buffer));
+
+    obex_parser_operation_info_t op_info;
+    obex_parser_get_operation_info(&parser, &op_info);
+    CHECK_EQUAL(OBEX_RESP_CONTINUE, op_info.response_code);
+}
+
 TEST(OBEX_PARSER, SetPathResponse){
     const uint8_t set_path_response_success[] = { 0xa0, 0x00, 0x03};
     memcpy(message, set_path_response_success, sizeof(set_path_response_success));
@@ -0,0 +1,116 @@
+#include "CppUTest/TestHarness.h"
+#include "CppUTest/CommandLineTestRunner.h"
+
+#include <math.h>
+#include <string.h>
+
+#include "btstack_resample.h"
+
+#ifdef ENABLE_RESAMPLE_POLYPHASE
+#define RESAMPLE_DELAY_FRAMES (BTSTACK_RESAMPLE_POLYPHASE_TAPS / 2)
+#define RESAMPLE_MIN_SNR_DB   60.0
+#else
+#define RESAMPLE_DELAY_FRAMES 0
+#define RESAMPLE_MIN_SNR_DB   30.0
+#endif
+
+#define BLOCK_FRAMES  128
+#define NUM_BLOCKS    40
+#define SAMPLE_RATE   44100.0
+#define AMPLITUDE     16000.0
+
+static int16_t input_buffer[BLOCK_FRAMES * BTSTACK_RESAMPLE_MAX_CHANNELS];
+static int16_t output_buffer[2 * BLOCK_FRAMES * BTSTACK_RESAMPLE_MAX_CHANNELS];
+
+// resample sine per channel and return SNR of worst channel in dB, skipping filter settling time
+static double resample_sine_snr(btstack_resample_t * resample, int num_channels, const double * frequencies, uint32_t factor, uint32_t * out_num_frames){
+    double signal[BTSTACK_RESAMPLE_MAX_CHANNELS] = { 0 };
+    double noise[BTSTACK_RESAMPLE_MAX_CHANNELS]  = { 0 };
+    uint32_t input_frame = 0;
+    uint32_t output_frame = 0;
+    btstack_resample_set_factor(resample, factor);
+    int block;
+    for (block = 0; block < NUM_BLOCKS; block++){
+        int i;
+        int c;
+        for (i = 0; i < BLOCK_FRAMES; i++){
+            for (c = 0; c < num_channels; c++){
+                double phase = 2.0 * M_PI * frequencies[c] * (double) input_frame / SAMPLE_RATE;
+                input_buffer[i * num_channels + c] = (int16_t) lround(AMPLITUDE * sin(phase));
+            }
+            input_frame++;
+        }
+        uint16_t num_frames = btstack_resample_block(resample, input_buffer, BLOCK_FRAMES, output_buffer);
+        for (i = 0; i < num_frames; i++){
+            double position = ((double) output_frame * factor / 65536.0) - RESAMPLE_DELAY_FRAMES;
+            output_frame++;
+            if (position < (4 * 16)) continue;
+            for (c = 0; c < num_channels; c++){
+                double expected = AMPLITUDE * sin(2.0 * M_PI * frequencies[c] * position / SAMPLE_RATE);
+                double error = output_buffer[i * num_channels + c] - expected;
+                signal[c] += expected * expected;
+                noise[c]  += error * error;
+            }
+        }
+    }
+    *out_num_frames = output_frame;
+    double snr = 1000.0;
+    int c;
+    for (c = 0; c < num_channels; c++){
+        snr = fmin(snr, 10.0 * log10(signal[c] / noise[c]));
+    }
+    return snr;
+}
+
+TEST_GROUP(Resample){
+    btstack_resample_t resample;
+};
+
+TEST(Resample, IdentityNumFrames){
+    const double frequencies[] = { 1000.0 };
+    uint32_t num_frames;
+    btstack_resample_init(&resample, 1);
+    resample_sine_snr(&resample, 1, frequencies, 0x10000, &num_frames);
+    CHECK(num_frames >= (NUM_BLOCKS * BLOCK_FRAMES - 1));
+    CHECK(num_frames <= (NUM_BLOCKS * BLOCK_FRAMES));
+}
+
+TEST(Resample, FasterNumFrames){
+    const double frequencies[] = { 1000.0 };
+    uint32_t num_frames;
+    btstack_resample_init(&resample, 1);
+    resample_sine_snr(&resample, 1, frequencies, 0x10400, &num_frames);
+    uint32_t expected = (uint32_t)(((uint64_t) NUM_BLOCKS * BLOCK_FRAMES << 16) / 0x10400);
+    CHECK(num_frames + 2 >= expected);
+    CHECK(num_frames <= expected + 2);
+}
+
+TEST(Resample, SlowerNumFrames){
+    const double frequencies[] = { 1000.0 };
+    uint32_t num_frames;
+    btstack_resample_init(&resample, 1);
+    resample_sine_snr(&resample, 1, frequencies, 0xfc00, &num_frames);
+    uint32_t expected = (uint32_t)(((uint64_t) NUM_BLOCKS * BLOCK_FRAMES << 16) / 0xfc00);
+    CHECK(num_frames + 2 >= expected);
+    CHECK(num_frames <= expected + 2);
+}
+
+TEST(Resample, MonoSine){
+    const double frequencies[] = { 1000.0 };
+    uint32_t num_frames;
+    btstack_resample_init(&resample, 1);
+    double snr = resample_sine_snr(&resample, 1, frequencies, 0x10100, &num_frames);
+    CHECK(snr >= RESAMPLE_MIN_SNR_DB);
+}
+
+TEST(Resample, StereoSine){
+    const double frequencies[] = { 1000.0, 3000.0 };
+    uint32_t num_frames;
+    btstack_resample_init(&resample, 2);
+    double snr = resample_sine_snr(&resample, 2, frequencies, 0xff00, &num_frames);
+    CHECK(snr >= RESAMPLE_MIN_SNR_DB);
+}
+
+int main (int argc, const char * argv[]){
+    return CommandLineTestRunner::RunAllTests(argc, argv);
+}
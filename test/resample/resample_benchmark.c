@@ -0,0 +1,114 @@
+/*
+ * Throughput and SNR of btstack_resample for sine input at sample rate compensation factors
+ *
+ * Build with and without ENABLE_RESAMPLE_POLYPHASE to compare linear and polyphase resampling
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <time.h>
+
+#include "btstack_resample.h"
+
+#ifdef ENABLE_RESAMPLE_POLYPHASE
+#define RESAMPLE_NAME         "polyphase"
+#define RESAMPLE_DELAY_FRAMES (BTSTACK_RESAMPLE_POLYPHASE_TAPS / 2)
+#else
+#define RESAMPLE_NAME         "linear"
+#define RESAMPLE_DELAY_FRAMES 0
+#endif
+
+#define BLOCK_FRAMES   128
+#define SAMPLE_RATE    44100.0
+#define AMPLITUDE      16000.0
+#define SNR_BLOCKS     200
+#define BENCHMARK_BLOCKS 20000
+
+static int16_t input_buffer[BLOCK_FRAMES * BTSTACK_RESAMPLE_MAX_CHANNELS];
+static int16_t output_buffer[2 * BLOCK_FRAMES * BTSTACK_RESAMPLE_MAX_CHANNELS];
+
+static void generate_block(int num_channels, double frequency, uint32_t first_frame){
+    int i;
+    int c;
+    for (i = 0; i < BLOCK_FRAMES; i++){
+        double phase = 2.0 * M_PI * frequency * (double) (first_frame + i) / SAMPLE_RATE;
+        for (c = 0; c < num_channels; c++){
+            input_buffer[i * num_channels + c] = (int16_t) lround(AMPLITUDE * sin(phase));
+        }
+    }
+}
+
+static double measure_snr(int num_channels, double frequency, uint32_t factor){
+    btstack_resample_t resample;
+    btstack_resample_init(&resample, num_channels);
+    btstack_resample_set_factor(&resample, factor);
+    double signal = 0;
+    double noise  = 0;
+    uint32_t output_frame = 0;
+    int block;
+    for (block = 0; block < SNR_BLOCKS; block++){
+        generate_block(num_channels, frequency, block * BLOCK_FRAMES);
+        uint16_t num_frames = btstack_resample_block(&resample, input_buffer, BLOCK_FRAMES, output_buffer);
+        int i;
+        for (i = 0; i < num_frames; i++){
+            double position = ((double) output_frame * factor / 65536.0) - RESAMPLE_DELAY_FRAMES;
+            output_frame++;
+            if (position < 64) continue;
+            double expected = AMPLITUDE * sin(2.0 * M_PI * frequency * position / SAMPLE_RATE);
+            int c;
+            for (c = 0; c < num_channels; c++){
+                double error = output_buffer[i * num_channels + c] - expected;
+                signal += expected * expected;
+                noise  += error * error;
+            }
+        }
+    }
+    return 10.0 * log10(signal / noise);
+}
+
+static double measure_throughput(int num_channels, uint32_t factor){
+    btstack_resample_t resample;
+    btstack_resample_init(&resample, num_channels);
+    btstack_resample_set_factor(&resample, factor);
+    generate_block(num_channels, 1000.0, 0);
+    uint32_t checksum = 0;
+    clock_t start = clock();
+    int block;
+    for (block = 0; block < BENCHMARK_BLOCKS; block++){
+        uint16_t num_frames = btstack_resample_block(&resample, input_buffer, BLOCK_FRAMES, output_buffer);
+        checksum += (uint16_t) output_buffer[num_frames - 1];
+    }
+    double seconds = (double)(clock() - start) / CLOCKS_PER_SEC;
+    // keep results alive
+    if (checksum == 0xffffffff) printf("!");
+    return (double) BENCHMARK_BLOCKS * BLOCK_FRAMES / seconds;
+}
+
+int main(int argc, const char * argv[]){
+    (void) argc;
+    (void) argv;
+    const double frequencies[] = { 100.0, 1000.0, 5000.0, 10000.0, 15000.0 };
+    const uint32_t factors[]   = { 0xff00, 0x10000, 0x10100 };
+    unsigned int f;
+    unsigned int i;
+    printf("btstack_resample %s\n", RESAMPLE_NAME);
+    printf("SNR in dB:\n");
+    printf("  factor   ");
+    for (f = 0; f < sizeof(frequencies) / sizeof(double); f++){
+        printf(" %7.0f Hz", frequencies[f]);
+    }
+    printf("\n");
+    for (i = 0; i < sizeof(factors) / sizeof(uint32_t); i++){
+        printf("  0x%05x  ", factors[i]);
+        for (f = 0; f < sizeof(frequencies) / sizeof(double); f++){
+            printf(" %10.1f", measure_snr(1, frequencies[f], factors[i]));
+        }
+        printf("\n");
+    }
+    int num_channels;
+    for (num_channels = 1; num_channels <= BTSTACK_RESAMPLE_MAX_CHANNELS; num_channels++){
+        printf("Throughput, %u channel(s): %.1f Mframes/s\n", num_channels, measure_throughput(num_channels, 0x10100) / 1e6);
+    }
+    return 0;
+}
@@ -0,0 +1,374 @@
+/*
+ * Copyright (C) 2024 BlueKitchen GmbH
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holders nor the names of
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ * 4. Any redistribution, use, or modification is done solely for
+ *    personal benefit and not for any commercial purpose or for
+ *    monetary gain.
+ *
+ * THIS SOFTWARE IS PROVIDED BY BLUEKITCHEN GMBH AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL BLUEKITCHEN
+ * GMBH OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF
+ * THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ *
+ * Please inquire about commercial licensing options at
+ * contact@bluekitchen-gmbh.com
+ *
+ */
+
+// *****************************************************************************
+//
+// test sdp server responses with continuation and response cache
+//
+// *****************************************************************************
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "CppUTest/TestHarness.h"
+#include "CppUTest/CommandLineTestRunner.h"
+
+#include "bluetooth_sdp.h"
+#include "btstack_event.h"
+#include "btstack_util.h"
+#include "classic/sdp_server.h"
+#include "classic/sdp_util.h"
+#include "l2cap.h"
+
+#define TEST_CID 0x41
+#define TEST_CID_2 0x42
+#define TEST_CID_3 0x43
+
+// l2cap mock
+static btstack_packet_handler_t sdp_server_packet_handler;
+static uint16_t remote_mtu;
+static uint8_t  response[1024];
+static uint16_t response_len;
+static uint16_t response_cid;
+static uint16_t accepted_cid;
+static uint16_t declined_cid;
+static bool     can_send_now_deferred;
+
+uint8_t l2cap_register_service(btstack_packet_handler_t packet_handler, uint16_t psm, uint16_t mtu, gap_security_level_t security_level){
+    UNUSED(psm);
+    UNUSED(mtu);
+    UNUSED(security_level);
+    sdp_server_packet_handler = packet_handler;
+    return ERROR_CODE_SUCCESS;
+}
+
+uint16_t l2cap_get_remote_mtu_for_local_cid(uint16_t local_cid){
+    UNUSED(local_cid);
+    return remote_mtu;
+}
+
+static void emit_can_send_now(uint16_t local_cid){
+    uint8_t event[4] = { L2CAP_EVENT_CAN_SEND_NOW, 2, 0, 0 };
+    little_endian_store_16(event, 2, local_cid);
+    (*sdp_server_packet_handler)(HCI_EVENT_PACKET, local_cid, event, sizeof(event));
+}
+
+uint8_t l2cap_request_can_send_now_event(uint16_t local_cid){
+    if (!can_send_now_deferred){
+        emit_can_send_now(local_cid);
+    }
+    return ERROR_CODE_SUCCESS;
+}
+
+uint8_t l2cap_send(uint16_t local_cid, const uint8_t *data, uint16_t len){
+    response_cid = local_cid;
+    (void)memcpy(response, data, len);
+    response_len = len;
+    return ERROR_CODE_SUCCESS;
+}
+
+void l2cap_accept_connection(uint16_t local_cid){
+    accepted_cid = local_cid;
+}
+
+void l2cap_decline_connection(uint16_t local_cid){
+    declined_cid = local_cid;
+}
+
+static void emit_channel_event(uint8_t event_type, uint16_t local_cid){
+    uint8_t event[4] = { event_type, 2, 0, 0 };
+    (*sdp_server_packet_handler)(HCI_EVENT_PACKET, local_cid, event, sizeof(event));
+}
+
+// test records
+static uint8_t records[4][300];
+
+static void create_record(uint8_t * record, uint32_t handle, uint16_t service_class_uuid, uint16_t name_len){
+    uint8_t name[200];
+    memset(name, 'a', sizeof(name));
+    de_create_sequence(record);
+    de_add_number(record, DE_UINT, DE_SIZE_16, BLUETOOTH_ATTRIBUTE_SERVICE_RECORD_HANDLE);
+    de_add_number(record, DE_UINT, DE_SIZE_32, handle);
+    de_add_number(record, DE_UINT, DE_SIZE_16, BLUETOOTH_ATTRIBUTE_SERVICE_CLASS_ID_LIST);
+    uint8_t * attribute = de_push_sequence(record);
+    de_add_number(attribute, DE_UUID, DE_SIZE_16, service_class_uuid);
+    de_pop_sequence(record, attribute);
+    de_add_number(record, DE_UINT, DE_SIZE_16, 0x0100);
+    de_add_data(record, DE_STRING, name_len, name);
+}
+
+static uint16_t create_pattern(uint8_t * pattern, uint16_t uuid){
+    de_create_sequence(pattern);
+    de_add_number(pattern, DE_UUID, DE_SIZE_16, uuid);
+    return de_get_len(pattern);
+}
+
+static uint16_t create_attribute_id_list(uint8_t * list){
+    de_create_sequence(list);
+    de_add_number(list, DE_UINT, DE_SIZE_32, 0x0000ffff);
+    return de_get_len(list);
+}
+
+static void send_request_on_channel(uint16_t cid, const uint8_t * request, uint16_t len){
+    response_len = 0;
+    (*sdp_server_packet_handler)(L2CAP_DATA_PACKET, cid, (uint8_t *) request, len);
+}
+
+static void send_request(const uint8_t * request, uint16_t len){
+    send_request_on_channel(TEST_CID, request, len);
+    CHECK(response_len > 0);
+}
+
+static uint16_t create_service_search_request(uint8_t * request, uint16_t transaction_id, uint16_t uuid){
+    request[0] = SDP_ServiceSearchRequest;
+    big_endian_store_16(request, 1, transaction_id);
+    uint16_t pos = 5 + create_pattern(&request[5], uuid);
+    big_endian_store_16(request, pos, 10);
+    pos += 2;
+    request[pos++] = 0;
+    big_endian_store_16(request, 3, pos - 5);
+    return pos;
+}
+
+// collect AttributeList(s) of all responses, returns len
+static uint16_t query(uint8_t pdu_id, const uint8_t * key, uint16_t key_len, uint8_t * attribute_lists, uint8_t * last_continuation_len){
+    uint8_t  attribute_id_list[10];
+    uint16_t attribute_id_list_len = create_attribute_id_list(attribute_id_list);
+    uint8_t  continuation[20];
+    uint16_t attribute_lists_len = 0;
+    continuation[0] = 0;
+    *last_continuation_len = 0;
+    while (true){
+        uint8_t  request[100];
+        uint16_t pos = 5;
+        request[0] = pdu_id;
+        big_endian_store_16(request, 1, 0x1234);
+        (void)memcpy(&request[pos], key, key_len);
+        pos += key_len;
+        big_endian_store_16(request, pos, 0xffff);
+        pos += 2;
+        (void)memcpy(&request[pos], attribute_id_list, attribute_id_list_len);
+        pos += attribute_id_list_len;
+        (void)memcpy(&request[pos], continuation, 1 + continuation[0]);
+        pos += 1 + continuation[0];
+        big_endian_store_16(request, 3, pos - 5);
+        send_request(request, pos);
+
+        CHECK_EQUAL(pdu_id + 1, response[0]);
+        uint16_t byte_count = big_endian_read_16(response, 5);
+        CHECK(response_len <= remote_mtu);
+        (void)memcpy(&attribute_lists[attribute_lists_len], &response[7], byte_count);
+        attribute_lists_len += byte_count;
+        (void)memcpy(continuation, &response[7 + byte_count], 1 + response[7 + byte_count]);
+        if (continuation[0] == 0) break;
+        *last_continuation_len = continuation[0];
+    }
+    return attribute_lists_len;
+}
+
+// expected AttributeList, all attributes requested
+static uint16_t expected_attribute_list(uint8_t * buffer, const uint8_t * record){
+    uint16_t len = de_get_len((uint8_t *) record);
+    (void)memcpy(buffer, record, len);
+    return len;
+}
+
+TEST_GROUP(SDPServer){
+    void setup(void){
+        sdp_init();
+        remote_mtu = 48;
+        create_record(records[0], 0x10001, BLUETOOTH_SERVICE_CLASS_SERIAL_PORT, 10);
+        create_record(records[1], 0x10002, BLUETOOTH_SERVICE_CLASS_AUDIO_SINK, 20);
+        create_record(records[2], 0x10003, BLUETOOTH_SERVICE_CLASS_SERIAL_PORT, 30);
+        CHECK_EQUAL(ERROR_CODE_SUCCESS, sdp_register_service(records[0]));
+        CHECK_EQUAL(ERROR_CODE_SUCCESS, sdp_register_service(records[1]));
+        CHECK_EQUAL(ERROR_CODE_SUCCESS, sdp_register_service(records[2]));
+        can_send_now_deferred = false;
+        emit_channel_event(L2CAP_EVENT_INCOMING_CONNECTION, TEST_CID);
+        CHECK_EQUAL(TEST_CID, accepted_cid);
+    }
+    void teardown(void){
+        sdp_unregister_service(0x10001);
+        sdp_unregister_service(0x10002);
+        sdp_unregister_service(0x10003);
+        sdp_unregister_service(0x10004);
+        emit_channel_event(L2CAP_EVENT_CHANNEL_CLOSED, TEST_CID);
+        sdp_deinit();
+    }
+};
+
+TEST(SDPServer, ServiceSearch){
+    uint8_t request[20];
+    uint16_t pos = create_service_search_request(request, 0x1234, BLUETOOTH_SERVICE_CLASS_SERIAL_PORT);
+    send_request(request, pos);
+    CHECK_EQUAL(SDP_ServiceSearchResponse, response[0]);
+    CHECK_EQUAL(2, big_endian_read_16(response, 5));
+    // records are stored in reverse order of registration
+    CHECK_EQUAL(0x10003, big_endian_read_32(response, 9));
+    CHECK_EQUAL(0x10001, big_endian_read_32(response, 13));
+}
+
+TEST(SDPServer, ServiceSearchNoMatch){
+    uint8_t request[20];
+    uint16_t pos = create_service_search_request(request, 0x1234, BLUETOOTH_SERVICE_CLASS_HANDSFREE);
+    send_request(request, pos);
+    CHECK_EQUAL(SDP_ServiceSearchResponse, response[0]);
+    CHECK_EQUAL(0, big_endian_read_16(response, 5));
+}
+
+TEST(SDPServer, ServiceAttributeCached){
+    uint8_t handle[4];
+    big_endian_store_32(handle, 0, 0x10003);
+    uint8_t attribute_list[400];
+    uint8_t continuation_len;
+    uint16_t len = query(SDP_ServiceAttributeRequest, handle, 4, attribute_list, &continuation_len);
+    uint8_t expected[400];
+    uint16_t expected_len = expected_attribute_list(expected, records[2]);
+    CHECK_EQUAL(expected_len, len);
+    MEMCMP_EQUAL(expected, attribute_list, len);
+    CHECK_EQUAL(5, continuation_len);
+}
+
+TEST(SDPServer, ServiceSearchAttributeCached){
+    uint8_t pattern[10];
+    uint16_t pattern_len = create_pattern(pattern, BLUETOOTH_SERVICE_CLASS_SERIAL_PORT);
+    uint8_t attribute_lists[400];
+    uint8_t continuation_len;
+    uint16_t len = query(SDP_ServiceSearchAttributeRequest, pattern, pattern_len, attribute_lists, &continuation_len);
+
+    uint8_t expected[400];
+    uint16_t expected_len = 3;
+    expected_len += expected_attribute_list(&expected[expected_len], records[2]);
+    expected_len += expected_attribute_list(&expected[expected_len], records[0]);
+    de_store_descriptor_with_len(expected, DE_DES, DE_SIZE_VAR_16, expected_len - 3);
+    CHECK_EQUAL(expected_len, len);
+    MEMCMP_EQUAL(expected, attribute_lists, len);
+    CHECK_EQUAL(5, continuation_len);
+}
+
+TEST(SDPServer, ServiceSearchAttributeLargerThanCache){
+    // response does not fit into cache, handled without cache
+    create_record(records[3], 0x10004, BLUETOOTH_SERVICE_CLASS_SERIAL_PORT, 200);
+    CHECK_EQUAL(ERROR_CODE_SUCCESS, sdp_register_service(records[3]));
+
+    uint8_t pattern[10];
+    uint16_t pattern_len = create_pattern(pattern, BLUETOOTH_SERVICE_CLASS_SERIAL_PORT);
+    uint8_t attribute_lists[600];
+    uint8_t continuation_len;
+    uint16_t len = query(SDP_ServiceSearchAttributeRequest, pattern, pattern_len, attribute_lists, &continuation_len);
+
+    uint8_t expected[600];
+    uint16_t expected_len = 3;
+    expected_len += expected_attribute_list(&expected[expected_len], records[3]);
+    expected_len += expected_attribute_list(&expected[expected_len], records[2]);
+    expected_len += expected_attribute_list(&expected[expected_len], records[0]);
+    de_store_descriptor_with_len(expected, DE_DES, DE_SIZE_VAR_16, expected_len - 3);
+    CHECK_EQUAL(expected_len, len);
+    MEMCMP_EQUAL(expected, attribute_lists, len);
+    CHECK_EQUAL(4, continuation_len);
+}
+
+TEST(SDPServer, ContinuationAfterDatabaseChange){
+    uint8_t request[50];
+    uint8_t attribute_id_list[10];
+    uint16_t attribute_id_list_len = create_attribute_id_list(attribute_id_list);
+    request[0] = SDP_ServiceSearchAttributeRequest;
+    big_endian_store_16(request, 1, 0x1234);
+    uint16_t pos = 5 + create_pattern(&request[5], BLUETOOTH_SERVICE_CLASS_SERIAL_PORT);
+    big_endian_store_16(request, pos, 0xffff);
+    pos += 2;
+    (void)memcpy(&request[pos], attribute_id_list, attribute_id_list_len);
+    pos += attribute_id_list_len;
+    uint16_t continuation_pos = pos;
+    request[pos++] = 0;
+    big_endian_store_16(request, 3, pos - 5);
+    send_request(request, pos);
+    CHECK_EQUAL(SDP_ServiceSearchAttributeResponse, response[0]);
+    uint16_t byte_count = big_endian_read_16(response, 5);
+    CHECK_EQUAL(5, response[7 + byte_count]);
+
+    // modify database and continue
+    sdp_unregister_service(0x10002);
+    pos = continuation_pos;
+    (void)memcpy(&request[pos], &response[7 + byte_count], 6);
+    pos += 6;
+    big_endian_store_16(request, 3, pos - 5);
+    send_request(request, pos);
+    CHECK_EQUAL(SDP_ErrorResponse, response[0]);
+    CHECK_EQUAL(0x0005, big_endian_read_16(response, 5));
+}
+
+TEST(SDPServer, ConcurrentConnections){
+    // second connection is served concurrently, third one gets queued
+    accepted_cid = 0;
+    emit_channel_event(L2CAP_EVENT_INCOMING_CONNECTION, TEST_CID_2);
+    CHECK_EQUAL(TEST_CID_2, accepted_cid);
+    accepted_cid = 0;
+    emit_channel_event(L2CAP_EVENT_INCOMING_CONNECTION, TEST_CID_3);
+    CHECK_EQUAL(0, accepted_cid);
+
+    // outstanding requests on both channels
+    can_send_now_deferred = true;
+    uint8_t request[20];
+    uint16_t pos = create_service_search_request(request, 0x1111, BLUETOOTH_SERVICE_CLASS_SERIAL_PORT);
+    send_request_on_channel(TEST_CID, request, pos);
+    pos = create_service_search_request(request, 0x2222, BLUETOOTH_SERVICE_CLASS_AUDIO_SINK);
+    send_request_on_channel(TEST_CID_2, request, pos);
+    CHECK_EQUAL(0, response_len);
+
+    // responses are sent independently
+    emit_can_send_now(TEST_CID_2);
+    CHECK_EQUAL(TEST_CID_2, response_cid);
+    CHECK_EQUAL(0x2222, big_endian_read_16(response, 1));
+    CHECK_EQUAL(1, big_endian_read_16(response, 5));
+    CHECK_EQUAL(0x10002, big_endian_read_32(response, 9));
+    emit_can_send_now(TEST_CID);
+    CHECK_EQUAL(TEST_CID, response_cid);
+    CHECK_EQUAL(0x1111, big_endian_read_16(response, 1));
+    CHECK_EQUAL(2, big_endian_read_16(response, 5));
+
+    // closing a channel accepts queued connection
+    emit_channel_event(L2CAP_EVENT_CHANNEL_CLOSED, TEST_CID_2);
+    CHECK_EQUAL(TEST_CID_3, accepted_cid);
+    emit_channel_event(L2CAP_EVENT_CHANNEL_CLOSED, TEST_CID_3);
+}
+
+int main (int argc, const char * argv[]){
+    return CommandLineTestRunner::RunAllTests(argc, argv);
+}
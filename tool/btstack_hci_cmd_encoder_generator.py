@@ -0,0 +1,341 @@
+#!/usr/bin/env python3
+#
+# Create typed, fixed-layout encoder functions for HCI Commands defined in src/hci_cmd.c
+#
+# Copyright 2024 BlueKitchen GmbH
+#
+# Only commands where all parameters have a fixed size are supported. Commands with
+# variable length parameters (J, V), arrayed parameters (a, b, [..]), or Service Records (S)
+# are skipped and need to be sent via hci_send_cmd / hci_cmd_create_from_template.
+#
+# Besides src/hci_cmd_encoder.h, the generator also creates test/embedded/hci_cmd_encoder_test.cpp
+# which checks each encoder against hci_cmd_create_from_template.
+
+import re
+import sys
+import os
+
+program_info = '''
+BTstack HCI Command Encoder Generator for BTstack
+Copyright 2024, BlueKitchen GmbH
+'''
+
+copyright = """/*
+ * Copyright (C) 2024 BlueKitchen GmbH
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holders nor the names of
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ * 4. Any redistribution, use, or modification is done solely for
+ *    personal benefit and not for any commercial purpose or for
+ *    monetary gain.
+ *
+ * THIS SOFTWARE IS PROVIDED BY BLUEKITCHEN GMBH AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL BLUEKITCHEN
+ * GMBH OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF
+ * THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ *
+ * Please inquire about commercial licensing options at
+ * contact@bluekitchen-gmbh.com
+ *
+ */
+"""
+
+hfile_header_begin = """
+/**
+ * HCI Command Encoder
+ *
+ * Typed encoders for HCI Commands with fixed-size parameters. Each encoder writes the complete
+ * HCI Command packet (opcode, parameter length, parameters) into the provided buffer and returns
+ * its size. The result is identical to hci_cmd_create_from_template for the same command.
+ *
+ * Note: Don't edit this file. It is generated by tool/btstack_hci_cmd_encoder_generator.py
+ *
+ */
+
+#ifndef HCI_CMD_ENCODER_H
+#define HCI_CMD_ENCODER_H
+
+#if defined __cplusplus
+extern "C" {
+#endif
+
+#include "hci_cmd.h"
+#include "btstack_util.h"
+
+#include <stdint.h>
+#include <string.h>
+
+/* API_START */
+
+"""
+
+hfile_header_end = """
+/* API_END */
+
+#if defined __cplusplus
+}
+#endif
+
+#endif // HCI_CMD_ENCODER_H
+"""
+
+test_header = """// Note: Don't edit this file. It is generated by tool/btstack_hci_cmd_encoder_generator.py
+
+#include "CppUTest/TestHarness.h"
+#include "CppUTest/CommandLineTestRunner.h"
+
+#include "btstack_config.h"
+#include "hci_cmd.h"
+#include "hci_cmd_encoder.h"
+#include "btstack_util.h"
+
+static uint8_t expected_buffer[300];
+static uint8_t encoder_buffer[300];
+static uint8_t test_data[300];
+
+TEST_GROUP(HCI_Command_Encoder){
+    void setup(void){
+        uint16_t i;
+        for (i = 0; i < sizeof(test_data); i++){
+            test_data[i] = (uint8_t) (i + 1);
+        }
+        memset(expected_buffer, 0x55, sizeof(expected_buffer));
+        memset(encoder_buffer,  0xaa, sizeof(encoder_buffer));
+    }
+};
+
+"""
+
+test_footer = """int main (int argc, const char * argv[]){
+    return CommandLineTestRunner::RunAllTests(argc, argv);
+}
+"""
+
+encoder_template = '''/**
+ * @brief Encode {command_name} command
+ * @param buffer for HCI Command packet with {size} bytes{param_docs}
+ * @return size of HCI Command packet
+ * @note: format '{format}'
+ */
+static inline uint16_t {fn_name}({fn_params}){{
+    little_endian_store_16(buffer, 0, {opcode});
+    buffer[2] = {param_len};
+{code}    return {size};
+}}
+
+'''
+
+test_template = '''TEST(HCI_Command_Encoder, {test_name}){{
+    uint16_t expected_size = hci_cmd_create_from_template_with_vargs(expected_buffer, &{command_name}{args});
+    uint16_t size = {fn_name}(encoder_buffer{args});
+    CHECK_EQUAL(expected_size, size);
+    MEMCMP_EQUAL(expected_buffer, encoder_buffer, size);
+}}
+
+'''
+
+# size of fixed-size parameters
+size_for_type = {
+    '1' : 1,
+    '2' : 2,
+    'H' : 2,
+    '3' : 3,
+    '4' : 4,
+    'B' : 6,
+    'D' : 8,
+    'E' : 240,
+    'N' : 248,
+    'P' : 16,
+    'K' : 16,
+    'A' : 31,
+    'Q' : 32,
+}
+
+c_type_for_type = {
+    '1' : 'uint8_t',
+    '2' : 'uint16_t',
+    'H' : 'hci_con_handle_t',
+    '3' : 'uint32_t',
+    '4' : 'uint32_t',
+    'B' : 'const bd_addr_t',
+    'D' : 'const uint8_t *',
+    'E' : 'const uint8_t *',
+    'N' : 'const char *',
+    'P' : 'const uint8_t *',
+    'K' : 'const uint8_t *',
+    'A' : 'const uint8_t *',
+    'Q' : 'const uint8_t *',
+}
+
+param_write = {
+    '1' : '    buffer[{pos}] = {name};\n',
+    '2' : '    little_endian_store_16(buffer, {pos}, {name});\n',
+    'H' : '    little_endian_store_16(buffer, {pos}, {name});\n',
+    '3' : '    little_endian_store_24(buffer, {pos}, {name});\n',
+    '4' : '    little_endian_store_32(buffer, {pos}, {name});\n',
+    'B' : '    reverse_bd_addr({name}, &buffer[{pos}]);\n',
+    'D' : '    (void)memcpy(&buffer[{pos}], {name}, 8);\n',
+    'E' : '    (void)memcpy(&buffer[{pos}], {name}, 240);\n',
+    'N' : '    uint16_t {name}_len = (uint16_t) btstack_min((uint32_t) strlen({name}), 248u);\n' +
+          '    (void)memcpy(&buffer[{pos}], {name}, {name}_len);\n' +
+          '    memset(&buffer[{pos} + {name}_len], 0, 248u - {name}_len);\n',
+    'P' : '    (void)memcpy(&buffer[{pos}], {name}, 16);\n',
+    'K' : '    reverse_128({name}, &buffer[{pos}]);\n',
+    'A' : '    (void)memcpy(&buffer[{pos}], {name}, 31);\n',
+    'Q' : '    reverse_256({name}, &buffer[{pos}]);\n',
+}
+
+# formats only supported by hci_cmd_create_from_template with feature enabled
+format_guards = [
+    ('Q', 'ENABLE_LE_SECURE_CONNECTIONS'),
+    ('A', 'ENABLE_BLE'),
+]
+
+def parse_commands(infile):
+    # returns list of (command_name, opcode, format, params, guards), guards lists enclosing #ifdef's
+    commands = []
+    with open (infile, 'rt') as fin:
+        params = []
+        command_name = ''
+        conditionals = []
+        for line in fin:
+            conditional = re.match(r'#\s*(ifdef|ifndef|if)\s+(.*)', line)
+            if conditional:
+                conditionals.append(conditional.groups())
+                continue
+            if re.match(r'#\s*endif', line):
+                conditionals.pop()
+                continue
+
+            parts = re.match(r'.*@param\s*(\w*)\s*', line)
+            if parts:
+                params.append(parts.groups()[0].lower())
+                continue
+
+            declaration = re.match(r'const\s+hci_cmd_t\s+(\w+)[\s=]+', line)
+            if declaration:
+                command_name = declaration.groups()[0]
+                continue
+
+            definition = re.match(r'\s*(HCI_OPCODE_\w+|0x[0-9A-Fa-f]+)\s*,\s*"(\w*)".*', line)
+            if definition:
+                (opcode, format) = definition.groups()
+                # skip commands disabled by '#if 0'
+                if not ('if', '0') in conditionals:
+                    guards = [name.strip() for (directive, name) in conditionals if directive == 'ifdef']
+                    commands.append((command_name, opcode, format, params, guards))
+                params = []
+                continue
+    return commands
+
+# names that cannot be used as parameter names in C or C++
+reserved_names = ['buffer', 'class', 'default', 'delete', 'new', 'private', 'protected', 'public', 'template', 'this']
+
+def param_names_for_command(format, params):
+    # use documented names if they are complete and unique
+    names = []
+    if len(params) == len(format):
+        for param in params:
+            if param == '' or param in reserved_names or param in names:
+                break
+            names.append(param)
+    if len(names) == len(format):
+        return names
+    return ['arg%u' % (i + 1) for i in range(len(format))]
+
+def test_arg_for_type(field_type, index):
+    if field_type == '1':
+        return '0x%02x' % ((0x11 * (index + 1)) & 0xff)
+    if field_type in '2H':
+        return '0x%04x' % ((0x0102 * (index + 1)) & 0x0fff)
+    if field_type in '34':
+        value = 0x01020304 + index
+        if field_type == '3':
+            value &= 0xffffff
+        return '(uint32_t) 0x%08x' % value
+    if field_type == 'N':
+        return '"BTstack HCI Command Encoder"'
+    return '&test_data[%u]' % index
+
+def guards_for_command(format, guards):
+    guards = list(guards)
+    for (field_type, guard) in format_guards:
+        if field_type in format and guard not in guards:
+            guards.append(guard)
+    return guards
+
+def create_encoders(commands, header_path, test_path):
+    supported = [c for c in commands if all(f in size_for_type for f in c[2])]
+
+    with open(header_path, 'wt') as fout:
+        fout.write(copyright)
+        fout.write(hfile_header_begin)
+        for command_name, opcode, format, params, guards in supported:
+            names = param_names_for_command(format, params)
+            base_name = command_name[len('hci_'):] if command_name.startswith('hci_') else command_name
+            fn_name = 'hci_cmd_%s_encode' % base_name
+            fn_params = 'uint8_t * buffer'
+            param_docs = ''
+            code = ''
+            pos = 3
+            for field_type, name in zip(format, names):
+                c_type = c_type_for_type[field_type]
+                if c_type.endswith('*'):
+                    fn_params += ', %s%s' % (c_type, name)
+                else:
+                    fn_params += ', %s %s' % (c_type, name)
+                param_docs += '\n * @param %s' % name
+                code += param_write[field_type].format(pos=pos, name=name)
+                pos += size_for_type[field_type]
+            fout.write(encoder_template.format(command_name=command_name, size=pos, param_docs=param_docs,
+                                               format=format, fn_name=fn_name, fn_params=fn_params,
+                                               opcode=opcode, param_len=pos-3, code=code))
+        fout.write(hfile_header_end)
+
+    with open(test_path, 'wt') as fout:
+        fout.write(test_header)
+        for command_name, opcode, format, params, guards in supported:
+            base_name = command_name[len('hci_'):] if command_name.startswith('hci_') else command_name
+            fn_name = 'hci_cmd_%s_encode' % base_name
+            args = ''.join(', ' + test_arg_for_type(f, i) for i, f in enumerate(format))
+            guards = guards_for_command(format, guards)
+            for guard in guards:
+                fout.write('#ifdef %s\n' % guard)
+            fout.write(test_template.format(test_name=base_name, command_name=command_name, fn_name=fn_name, args=args))
+            for guard in guards:
+                fout.write('#endif\n')
+            if len(guards) > 0:
+                fout.write('\n')
+        fout.write(test_footer)
+
+    print('Generated %u encoders, skipped %u commands with variable layout' % (len(supported), len(commands) - len(supported)))
+
+btstack_root = os.path.abspath(os.path.dirname(sys.argv[0]) + '/..')
+hci_cmd_c_path  = btstack_root + '/src/hci_cmd.c'
+gen_header_path = btstack_root + '/src/hci_cmd_encoder.h'
+gen_test_path   = btstack_root + '/test/embedded/hci_cmd_encoder_test.cpp'
+
+print(program_info)
+
+commands = parse_commands(hci_cmd_c_path)
+create_encoders(commands, gen_header_path, gen_test_path)
+
+print('Done!')